@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define W            128
+#define H            128
+#define ROW_BYTES    (W / 8)
+#define FB_BYTES     (H * ROW_BYTES)
+#define RANDOM_OPS   200000
+#define BENCH_ROUNDS 20000
+
+static GLIB_Context_t ctx;
+
+// Vùng cắt của bản mẫu, giống dimensions trong dmd_memlcd.c
+static int clip_x, clip_y, clip_w, clip_h;
+
+// Bản mẫu cũng đánh dấu hàng dirty như driver để đo cho công bằng
+static volatile uint32_t ref_dirty[H / 32];
+
+// --- HÀM: DMD_writeData ĐƠN SẮC KIỂU CŨ (MẪU SO SÁNH) ---
+static int ref_write_data(uint8_t *fb, int x, int y, const uint8_t *data, uint32_t n)
+{
+    int pixel_bit = 0;
+    int cur_y = clip_y + y;
+
+    if (n > (uint32_t)((clip_h - y) * clip_w - x)) {
+        return -1;
+    }
+    while (n) {
+        unsigned row = n > (unsigned)(clip_w - x) ? (unsigned)(clip_w - x) : n;
+        uint8_t *dst = fb + cur_y * ROW_BYTES;
+        n -= row;
+        x += clip_x;
+
+        if ((x & 7) || (pixel_bit & 7) || row < 8) {
+            row += x;
+            for (; x < (int)row; x++, pixel_bit++) {
+                if ((data[pixel_bit >> 3] >> (pixel_bit & 7)) & 1) {
+                    dst[x >> 3] |= 1 << (x & 7);
+                } else {
+                    dst[x >> 3] &= ~(1 << (x & 7));
+                }
+            }
+        } else {
+            dst += x >> 3;
+            int nbytes = row >> 3;
+            memcpy(dst, &data[pixel_bit >> 3], nbytes);
+            pixel_bit += nbytes << 3;
+            row -= nbytes << 3;
+            dst += nbytes;
+            if (row) {
+                uint8_t m = (1 << row) - 1;
+                *dst = (*dst & ~m) | (data[pixel_bit >> 3] & m);
+                pixel_bit += row;
+            }
+        }
+        ref_dirty[cur_y >> 5] |= 1u << (cur_y & 31);
+        cur_y++;
+        x = 0;
+    }
+    return 0;
+}
+
+// --- HÀM: DMD_writeColor ĐƠN SẮC KIỂU CŨ (MẪU SO SÁNH) ---
+static void ref_write_color(uint8_t *fb, int x, int y, int white, uint32_t n)
+{
+    uint8_t pd = white ? 0xFF : 0x00;
+    int cur_y = clip_y + y;
+
+    while (n) {
+        unsigned row = n > (unsigned)(clip_w - x) ? (unsigned)(clip_w - x) : n;
+        uint8_t *dst = fb + cur_y * ROW_BYTES;
+        n -= row;
+        x += clip_x;
+        if (row < 8) {
+            row += x;
+            for (; x < (int)row; x++) {
+                if (pd) {
+                    dst[x >> 3] |= 1 << (x & 7);
+                } else {
+                    dst[x >> 3] &= ~(1 << (x & 7));
+                }
+            }
+        } else {
+            int off = x & 7;
+            dst += x >> 3;
+            if (off) {
+                uint8_t m = (1 << off) - 1;
+                *dst = (*dst & m) | (pd & ~m);
+                dst++;
+                row -= 8 - off;
+            }
+            memset(dst, pd, row >> 3);
+            dst += row >> 3;
+            row &= 7;
+            if (row) {
+                uint8_t m = (1 << row) - 1;
+                *dst = (*dst & ~m) | (pd & m);
+            }
+        }
+        ref_dirty[cur_y >> 5] |= 1u << (cur_y & 31);
+        cur_y++;
+        x = 0;
+    }
+}
+
+static void set_clip(int x, int y, int w, int h)
+{
+    clip_x = x;
+    clip_y = y;
+    clip_w = w;
+    clip_h = h;
+    DMD_setClippingArea((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h);
+}
+
+// --- HÀM: SO SÁNH NGẪU NHIÊN BẢN MỚI VỚI BẢN CŨ ---
+static int random_check(void)
+{
+    static uint8_t ref[FB_BYTES];
+    static uint8_t data[FB_BYTES + 4];
+    uint8_t *fb;
+    int failures = 0;
+
+    DMD_getFrameBuffer((void **)&fb);
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)rand();
+    }
+    for (size_t i = 0; i < FB_BYTES; i++) {
+        fb[i] = (uint8_t)rand();
+    }
+    memcpy(ref, fb, FB_BYTES);
+
+    for (int op = 0; op < RANDOM_OPS && failures < 5; op++) {
+        int w = 1 + rand() % W, h = 1 + rand() % H;
+        int cx = rand() % (W - w + 1), cy = rand() % (H - h + 1);
+        int x = rand() % w, y = rand() % h;
+        uint32_t room = (uint32_t)((h - y) * w - x);
+        // Phần lớn là đoạn ngắn, thỉnh thoảng dài hết vùng cắt
+        uint32_t n = (rand() & 3) ? 1 + (uint32_t)rand() % (room < 70 ? room : 70)
+                                  : 1 + (uint32_t)rand() % room;
+
+        set_clip(cx, cy, w, h);
+        if (rand() & 1) {
+            // Dữ liệu bắt đầu ở byte lẻ, giống ảnh nằm giữa một mảng
+            const uint8_t *src = data + rand() % 4;
+            ref_write_data(ref, x, y, src, n);
+            DMD_writeData((uint16_t)x, (uint16_t)y, src, n);
+        } else {
+            int white = rand() & 1;
+            ref_write_color(ref, x, y, white, n);
+            DMD_writeColor((uint16_t)x, (uint16_t)y, 0, white ? 0xFF : 0, 0, n);
+        }
+        if (memcmp(ref, fb, FB_BYTES) != 0) {
+            printf("FAIL: op %d clip (%d,%d %dx%d) x=%d y=%d n=%u\n",
+                   op, cx, cy, w, h, x, y, n);
+            memcpy(ref, fb, FB_BYTES);
+            failures++;
+        }
+    }
+    set_clip(0, 0, W, H);
+    return failures;
+}
+
+// --- HÀM: ĐO TỐC ĐỘ VẼ ẢNH (Mpixel/s) Ở ĐỘ LỆCH x CHO TRƯỚC ---
+static double bench_bitmap(int x, int use_ref, int bw, int bh)
+{
+    static uint8_t scratch[FB_BYTES];
+    static uint8_t pic[64 * 64 / 8];
+    uint64_t t0;
+
+    for (size_t i = 0; i < sizeof(pic); i++) {
+        pic[i] = (uint8_t)(i * 37);
+    }
+    t0 = host_now_ns();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        if (use_ref) {
+            set_clip(x, 5, bw, bh);
+            ref_write_data(scratch, 0, 0, pic, (uint32_t)(bw * bh));
+            GLIB_applyClippingRegion(&ctx);
+        } else {
+            GLIB_drawBitmap(&ctx, x, 5, (uint32_t)bw, (uint32_t)bh, pic);
+        }
+    }
+    return (double)BENCH_ROUNDS * bw * bh / ((host_now_ns() - t0) / 1e3);
+}
+
+int main(void)
+{
+    static const int sizes[][2] = { { 64, 64 }, { 61, 40 }, { 13, 9 } };
+    int failures;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    srand(3);
+
+    failures = random_check();
+    printf("%d thao tac ngau nhien writeData/writeColor: %s\n", RANDOM_OPS,
+           failures ? "KHAC" : "giong het ban cu");
+
+    printf("%-8s %-4s %12s %12s %8s\n", "bitmap", "x", "ref Mpx/s", "new Mpx/s", "speedup");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (int x = 0; x < 4; x += 3) {
+            int bw = sizes[s][0], bh = sizes[s][1];
+            double r = bench_bitmap(x, 1, bw, bh);
+            double n = bench_bitmap(x, 0, bw, bh);
+            printf("%3dx%-4d %-4d %12.1f %12.1f %7.1fx\n", bw, bh, x, r, n, n / r);
+        }
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: nhan sao chep theo word giong het ban cu\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,617 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "bmp.h"
+#include "host_platform.h"
+
+// Vẽ file BMP thẳng vào framebuffer 1 bpp (GLIB_drawBmp/BMP_readMonoRow):
+// tạo file 24-bit, 8-bit, RLE8 và 1-bit trong RAM, vẽ ở nhiều vị trí (cả khi
+// bị cắt) và so từng điểm ảnh với bản giải mã + dither tham chiếu làm trên
+// cả ảnh. Sau đó so thời gian với cách cũ: BMP_readRgbData ra RGB rồi vẽ
+// từng điểm.
+
+// ================= CẤU HÌNH =================
+#define W             128
+#define H             128
+#define IMG_W_MAX     200
+#define IMG_H_MAX     128
+#define FILE_MAX      (BMP_HEADER_SIZE + BMP_PALETTE_8BIT_SIZE + IMG_W_MAX * IMG_H_MAX * 3 + 4 * IMG_H_MAX)
+#define TIMING_RUNS   200
+
+static GLIB_Context_t ctx;
+
+// File BMP trong RAM và hàm đọc cho BMP_init()
+static uint8_t file[FILE_MAX];
+static uint32_t file_len, file_pos;
+
+// Ảnh gốc: độ sáng từng điểm (0-255), và kết quả 1 bpp mong đợi
+static int img_w, img_h;
+static uint8_t luma[IMG_H_MAX][IMG_W_MAX];
+static uint8_t expect[IMG_H_MAX][IMG_W_MAX];
+static uint8_t palette[BMP_PALETTE_8BIT_SIZE];
+static uint8_t index_img[IMG_H_MAX][IMG_W_MAX];
+static uint8_t pal_rgb[256][3];
+static int pal_n;
+
+static const char *const dither_names[] = { "NONE", "ORDERED", "FLOYD" };
+
+static EMSTATUS mem_read(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead)
+{
+    if (bytesToRead > bufLength || file_pos + bytesToRead > file_len) {
+        return BMP_ERROR_IO;
+    }
+    memcpy(buffer, file + file_pos, bytesToRead);
+    file_pos += bytesToRead;
+    return BMP_OK;
+}
+
+static int luma_of(int r, int g, int b)
+{
+    return (77 * r + 150 * g + 29 * b) >> 8;
+}
+
+// --- HÀM: GHI FILE BMP ---
+static void put16(uint32_t at, uint32_t v)
+{
+    file[at] = v & 0xFF;
+    file[at + 1] = (v >> 8) & 0xFF;
+}
+
+static void put32(uint32_t at, uint32_t v)
+{
+    put16(at, v & 0xFFFF);
+    put16(at + 2, v >> 16);
+}
+
+// Header + bảng màu (BGR0), trả về vị trí bắt đầu dữ liệu ảnh
+static uint32_t write_header(int bpp, int compression, int entries)
+{
+    memset(file, 0, BMP_HEADER_SIZE);
+    put16(0, 0x4D42);
+    put32(10, BMP_HEADER_SIZE + entries * 4);
+    put32(14, 40);
+    put32(18, img_w);
+    put32(22, img_h);
+    put16(26, 1);
+    put16(28, bpp);
+    put32(30, compression);
+    put32(46, entries);
+    for (int i = 0; i < entries; i++) {
+        file[BMP_HEADER_SIZE + 4 * i] = pal_rgb[i][2];
+        file[BMP_HEADER_SIZE + 4 * i + 1] = pal_rgb[i][1];
+        file[BMP_HEADER_SIZE + 4 * i + 2] = pal_rgb[i][0];
+        file[BMP_HEADER_SIZE + 4 * i + 3] = 0;
+    }
+    return BMP_HEADER_SIZE + entries * 4;
+}
+
+static void finish_file(uint32_t end, uint32_t data_start)
+{
+    file_len = end;
+    put32(2, end);
+    put32(34, end - data_start);
+}
+
+// --- HÀM: CÁC LOẠI ẢNH THỬ ---
+static void make_24bit(int w, int h, int gray)
+{
+    img_w = w;
+    img_h = h;
+    uint32_t pos = write_header(24, 0, 0), start = pos;
+    for (int r = 0; r < h; r++) {
+        int y = h - 1 - r;
+        for (int x = 0; x < w; x++) {
+            int red = (x * 255 / w + y) & 255;
+            int green = (y * 255 / h + rand() % 40) & 255;
+            int blue = (x * y) & 255;
+            if (gray >= 0) {
+                red = green = blue = gray;
+            }
+            file[pos++] = blue;
+            file[pos++] = green;
+            file[pos++] = red;
+            luma[y][x] = luma_of(red, green, blue);
+        }
+        while ((pos - start) & 3) {
+            file[pos++] = 0;
+        }
+    }
+    finish_file(pos, start);
+}
+
+// Bảng màu ngẫu nhiên và ảnh chỉ số gồm các đoạn cùng màu dài ngẫu nhiên
+static void make_index_image(int w, int h, int entries)
+{
+    img_w = w;
+    img_h = h;
+    pal_n = entries;
+    for (int i = 0; i < entries; i++) {
+        for (int c = 0; c < 3; c++) {
+            pal_rgb[i][c] = rand() & 255;
+        }
+    }
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w;) {
+            int run = 1 + rand() % ((rand() & 1) ? 3 : 20);
+            int idx = rand() % entries;
+            for (; run > 0 && x < w; run--, x++) {
+                index_img[y][x] = (rand() % 8) ? idx : rand() % entries;
+            }
+        }
+    }
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int i = index_img[y][x];
+            luma[y][x] = luma_of(pal_rgb[i][0], pal_rgb[i][1], pal_rgb[i][2]);
+        }
+    }
+}
+
+static void make_8bit(int w, int h, int entries)
+{
+    make_index_image(w, h, entries);
+    uint32_t pos = write_header(8, 0, entries), start = pos;
+    for (int r = 0; r < h; r++) {
+        for (int x = 0; x < w; x++) {
+            file[pos++] = index_img[h - 1 - r][x];
+        }
+        while ((pos - start) & 3) {
+            file[pos++] = 0;
+        }
+    }
+    finish_file(pos, start);
+}
+
+// RLE8: đoạn lặp >= 3 điểm mã hóa, còn lại gom thành đoạn tuyệt đối
+static void make_rle8(int w, int h, int entries)
+{
+    make_index_image(w, h, entries);
+    uint32_t pos = write_header(8, 1, entries), start = pos;
+    for (int r = 0; r < h; r++) {
+        const uint8_t *p = index_img[h - 1 - r];
+        int x = 0;
+        while (x < w) {
+            int run = 1;
+            while (x + run < w && run < 255 && p[x + run] == p[x]) {
+                run++;
+            }
+            if (run >= 3) {
+                file[pos++] = run;
+                file[pos++] = p[x];
+                x += run;
+                continue;
+            }
+            int lit = 0;
+            while (x + lit < w && lit < 255) {
+                int k = x + lit;
+                if (k + 2 < w && p[k] == p[k + 1] && p[k] == p[k + 2]) {
+                    break;
+                }
+                lit++;
+            }
+            if (lit < 3) {
+                for (int i = 0; i < lit; i++) {
+                    file[pos++] = 1;
+                    file[pos++] = p[x + i];
+                }
+            } else {
+                file[pos++] = 0;
+                file[pos++] = lit;
+                memcpy(&file[pos], &p[x], lit);
+                pos += lit;
+                if (lit & 1) {
+                    file[pos++] = 0;
+                }
+            }
+            x += lit;
+        }
+        file[pos++] = 0;
+        file[pos++] = (r == h - 1) ? 1 : 0;
+    }
+    finish_file(pos, start);
+}
+
+// RLE8 viết tay: delta trong hàng, delta xuống hàng, kết thúc ảnh sớm.
+// Điểm bị bỏ qua lấy màu số 0 của bảng màu
+static void make_rle8_delta(void)
+{
+    static const uint8_t data[] = {
+        3, 1, 0, 3, 2, 3, 4, 0, 0, 2, 4, 0, 2, 5, 0, 0,  // hàng 0 (dưới cùng)
+        5, 6, 0, 2, 3, 2,                                // hàng 1, nhảy tới hàng 3, cột 8
+        2, 7, 0, 0,                                      // hàng 3
+        0, 1                                             // hết ảnh: hàng 4, 5 để trống
+    };
+    static const char *const rows[] = {  // từ trên xuống, '.' là màu 0
+        "....................",
+        "....................",
+        "........77..........",
+        "....................",
+        "66666...............",
+        "111234....55........",
+    };
+
+    img_w = 20;
+    img_h = 6;
+    pal_n = 8;
+    for (int i = 0; i < pal_n; i++) {
+        pal_rgb[i][0] = pal_rgb[i][1] = pal_rgb[i][2] = (i * 37 + 20) & 255;
+    }
+    pal_rgb[0][0] = pal_rgb[0][1] = pal_rgb[0][2] = 230;
+    uint32_t pos = write_header(8, 1, pal_n), start = pos;
+    memcpy(&file[pos], data, sizeof(data));
+    pos += sizeof(data);
+    finish_file(pos, start);
+    for (int y = 0; y < img_h; y++) {
+        for (int x = 0; x < img_w; x++) {
+            int i = rows[y][x] == '.' ? 0 : rows[y][x] - '0';
+            luma[y][x] = luma_of(pal_rgb[i][0], pal_rgb[i][1], pal_rgb[i][2]);
+        }
+    }
+}
+
+static void make_1bit(int w, int h, int c0, int c1)
+{
+    img_w = w;
+    img_h = h;
+    pal_rgb[0][0] = pal_rgb[0][1] = pal_rgb[0][2] = c0;
+    pal_rgb[1][0] = pal_rgb[1][1] = pal_rgb[1][2] = c1;
+    uint32_t pos = write_header(1, 0, 2), start = pos;
+    for (int r = 0; r < h; r++) {
+        int y = h - 1 - r;
+        for (int x = 0; x < w; x += 8) {
+            uint8_t b = rand() & 255;
+            file[pos++] = b;
+            for (int k = 0; k < 8 && x + k < w; k++) {
+                luma[y][x + k] = ((b >> (7 - k)) & 1) ? c1 : c0;
+            }
+        }
+        while ((pos - start) & 3) {
+            file[pos++] = 0;
+        }
+    }
+    finish_file(pos, start);
+}
+
+// --- HÀM: GIẢI MÃ THAM CHIẾU: DITHER TRÊN CẢ ẢNH, THEO THỨ TỰ HÀNG CỦA FILE ---
+static void ref_mono(BMP_Dither_t dither)
+{
+    static const int bayer[4][4] = { { 0, 8, 2, 10 }, { 12, 4, 14, 6 }, { 3, 11, 1, 9 }, { 15, 7, 13, 5 } };
+    static int err[IMG_H_MAX][IMG_W_MAX];
+    int cw = img_w < BMP_MONO_MAX_WIDTH ? img_w : BMP_MONO_MAX_WIDTH;
+
+    memset(err, 0, sizeof(err));
+    for (int y = img_h - 1; y >= 0; y--) {
+        for (int x = 0; x < cw; x++) {
+            int v = luma[y][x], white;
+            if (dither == BMP_DITHER_ORDERED) {
+                white = v >= bayer[y & 3][x & 3] * 16 + 8;
+            } else if (dither == BMP_DITHER_FLOYD_STEINBERG) {
+                v += err[y][x];
+                white = v >= 128;
+                int q = v - (white ? 255 : 0);
+                if (x + 1 < cw) {
+                    err[y][x + 1] += q * 7 / 16;
+                }
+                if (y > 0) {
+                    if (x > 0) {
+                        err[y - 1][x - 1] += q * 3 / 16;
+                    }
+                    err[y - 1][x] += q * 5 / 16;
+                    if (x + 1 < cw) {
+                        err[y - 1][x + 1] += q / 16;
+                    }
+                }
+            } else {
+                white = v >= 128;
+            }
+            expect[y][x] = white;
+        }
+    }
+}
+
+// --- HÀM: VẼ Ở (ox, oy) RỒI SO CẢ MÀN HÌNH ---
+static int bg_pixel(int x, int y)
+{
+    return ((x >> 2) + (y >> 1)) & 1;
+}
+
+static void fill_background(void)
+{
+    GLIB_setRasterOp(&ctx, GLIB_RASTER_OP_COPY);
+    GLIB_applyClippingRegion(&ctx);
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x += 32) {
+            uint32_t bits = 0;
+            for (int k = 0; k < 32; k++) {
+                bits |= (uint32_t)bg_pixel(x + k, y) << k;
+            }
+            DMD_writeRowMask(x, y, bits, 0xFFFFFFFF);
+        }
+    }
+}
+
+static int check_draw(const char *name, BMP_Dither_t dither, int ox, int oy)
+{
+    int cw = img_w < BMP_MONO_MAX_WIDTH ? img_w : BMP_MONO_MAX_WIDTH;
+    uint8_t row[W / 8];
+
+    fill_background();
+    ref_mono(dither);
+    file_pos = 0;
+    EMSTATUS status = GLIB_drawBmp(&ctx, ox, oy, dither);
+    int visible = ox < W && oy < H && ox + cw > 0 && oy + img_h > 0;
+    if (status != (visible ? GLIB_OK : GLIB_ERROR_NOTHING_TO_DRAW)) {
+        printf("FAIL: %s %s (%d,%d): GLIB_drawBmp tra ve %u\n", name, dither_names[dither], ox, oy,
+               (unsigned)status);
+        return 1;
+    }
+    for (int y = 0; y < H; y++) {
+        DMD_readData(0, y, row, W);
+        for (int x = 0; x < W; x++) {
+            int got = (row[x >> 3] >> (x & 7)) & 1;
+            int ix = x - ox, iy = y - oy;
+            int want = (ix >= 0 && ix < cw && iy >= 0 && iy < img_h) ? expect[iy][ix] : bg_pixel(x, y);
+            if (got != want) {
+                printf("FAIL: %s %s (%d,%d): diem (%d,%d) = %d, can %d\n", name, dither_names[dither],
+                       ox, oy, x, y, got, want);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int check_all(const char *name)
+{
+    static const int offsets[][2] = { { 0, 0 }, { 5, 7 }, { -13, -9 }, { 100, 120 }, { 128, 0 } };
+    int failures = 0;
+
+    for (int d = BMP_DITHER_NONE; d <= BMP_DITHER_FLOYD_STEINBERG; d++) {
+        for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+            failures += check_draw(name, (BMP_Dither_t)d, offsets[o][0], offsets[o][1]);
+        }
+    }
+    return failures;
+}
+
+// --- HÀM: CÁCH CŨ: BMP_readRgbData RA RGB, NGƯỠNG VÀ VẼ TỪNG ĐIỂM ---
+static EMSTATUS draw_rgb_per_pixel(int ox, int oy, int check_luma)
+{
+    static uint8_t rgb[IMG_W_MAX * 3];
+    uint32_t n, p = 0;
+    EMSTATUS status;
+
+    file_pos = 0;
+    status = BMP_reset();
+    if (status != BMP_OK) {
+        return status;
+    }
+    // BMP_readRgbData có thể trả BMP_ERROR_END_OF_FILE cùng các điểm cuối
+    do {
+        status = BMP_readRgbData(rgb, img_w * 3, &n);
+        for (uint32_t i = 0; i < n; i++, p++) {
+            int x = p % img_w, y = img_h - 1 - p / img_w;
+            int l = luma_of(rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]);
+            if (check_luma && l != luma[y][x]) {
+                return BMP_ERROR_FILE_INVALID;
+            }
+            uint8_t v = l >= 128 ? 255 : 0;
+            GLIB_drawPixelRGB(&ctx, ox + x, oy + y, v, v, v);
+        }
+    } while (status == BMP_OK);
+    if (status == BMP_ERROR_END_OF_FILE && p == (uint32_t)(img_w * img_h)) {
+        return BMP_OK;
+    }
+    return status;
+}
+
+static double ns_per_draw(BMP_Dither_t dither, int old_path)
+{
+    uint64_t t0 = host_now_ns();
+    for (int k = 0; k < TIMING_RUNS; k++) {
+        if (old_path) {
+            draw_rgb_per_pixel(0, 0, 0);
+        } else {
+            file_pos = 0;
+            GLIB_drawBmp(&ctx, 0, 0, dither);
+        }
+    }
+    return (double)(host_now_ns() - t0) / TIMING_RUNS;
+}
+
+static void timing_row(const char *name, int has_rgb_path)
+{
+    printf("%-22s", name);
+    for (int d = BMP_DITHER_NONE; d <= BMP_DITHER_FLOYD_STEINBERG; d++) {
+        printf(" %10.0f", ns_per_draw((BMP_Dither_t)d, 0));
+    }
+    if (has_rgb_path) {
+        printf(" %12.0f\n", ns_per_draw(BMP_DITHER_NONE, 1));
+    } else {
+        printf(" %12s\n", "-");
+    }
+}
+
+// --- HÀM: FILE CŨ ĐỌC ĐƯỢC BẰNG CẢ HAI CÁCH PHẢI RA CÙNG ẢNH ---
+static int check_rgb_path(const char *name)
+{
+    static uint8_t fb_new[H][W / 8];
+    uint8_t row[W / 8];
+
+    ref_mono(BMP_DITHER_NONE);
+    fill_background();
+    file_pos = 0;
+    GLIB_drawBmp(&ctx, 0, 0, BMP_DITHER_NONE);
+    for (int y = 0; y < H; y++) {
+        DMD_readData(0, y, fb_new[y], W);
+    }
+    fill_background();
+    if (draw_rgb_per_pixel(0, 0, 1) != BMP_OK) {
+        printf("FAIL: %s: BMP_readRgbData khong doc ra dung anh\n", name);
+        return 1;
+    }
+    for (int y = 0; y < H; y++) {
+        DMD_readData(0, y, row, W);
+        if (memcmp(row, fb_new[y], W / 8) != 0) {
+            printf("FAIL: %s: hang %d khac cach ve tung diem\n", name, y);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// --- HÀM: TỈ LỆ ĐIỂM TRẮNG KHI DITHER MỘT ẢNH XÁM ĐỀU ---
+static double white_ratio(int gray, BMP_Dither_t dither)
+{
+    uint8_t row[W / 8];
+    int white = 0;
+
+    make_24bit(64, 64, gray);
+    fill_background();
+    file_pos = 0;
+    GLIB_drawBmp(&ctx, 0, 0, dither);
+    for (int y = 0; y < 64; y++) {
+        DMD_readData(0, y, row, W);
+        for (int x = 0; x < 64; x++) {
+            white += (row[x >> 3] >> (x & 7)) & 1;
+        }
+    }
+    return white / (64.0 * 64.0);
+}
+
+static int check_gray(void)
+{
+    static const struct {
+        int gray;
+        BMP_Dither_t dither;
+        double lo, hi;
+    } cases[] = {
+        { 128, BMP_DITHER_NONE, 1.0, 1.0 },
+        { 127, BMP_DITHER_NONE, 0.0, 0.0 },
+        { 128, BMP_DITHER_ORDERED, 0.5, 0.5 },
+        { 64, BMP_DITHER_ORDERED, 0.25, 0.25 },
+        { 128, BMP_DITHER_FLOYD_STEINBERG, 0.47, 0.53 },
+        { 64, BMP_DITHER_FLOYD_STEINBERG, 0.22, 0.28 },
+        { 0, BMP_DITHER_FLOYD_STEINBERG, 0.0, 0.0 },
+        { 255, BMP_DITHER_FLOYD_STEINBERG, 1.0, 1.0 },
+    };
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        double r = white_ratio(cases[i].gray, cases[i].dither);
+        if (r < cases[i].lo - 1e-9 || r > cases[i].hi + 1e-9) {
+            printf("FAIL: xam %d %s: %.3f diem trang\n", cases[i].gray, dither_names[cases[i].dither], r);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+// --- HÀM: FILE LỖI / KHÔNG HỖ TRỢ ---
+static int check_errors(void)
+{
+    uint8_t buf[16];
+    uint32_t n;
+    int failures = 0;
+
+    make_1bit(40, 10, 0, 255);
+    file_pos = 0;
+    BMP_reset();
+    if (BMP_readRgbData(buf, sizeof(buf), &n) != BMP_ERROR_FILE_NOT_SUPPORTED) {
+        printf("FAIL: BMP_readRgbData voi file 1-bit\n");
+        failures++;
+    }
+
+    make_8bit(30, 20, 16);
+    file_len -= 25;  // File bị cắt
+    file_pos = 0;
+    if (GLIB_drawBmp(&ctx, 0, 0, BMP_DITHER_NONE) != GLIB_ERROR_IO) {
+        printf("FAIL: file bi cat khong bao GLIB_ERROR_IO\n");
+        failures++;
+    }
+
+    make_8bit(30, 20, 16);
+    put16(28, 4);  // 4 bpp
+    file_pos = 0;
+    if (GLIB_drawBmp(&ctx, 0, 0, BMP_DITHER_NONE) != GLIB_ERROR_FILE_NOT_SUPPORTED) {
+        printf("FAIL: file 4-bit khong bao GLIB_ERROR_FILE_NOT_SUPPORTED\n");
+        failures++;
+    }
+    put16(28, 8);
+    put16(0, 0x1234);
+    file_pos = 0;
+    if (GLIB_drawBmp(&ctx, 0, 0, BMP_DITHER_NONE) != GLIB_ERROR_INVALID_FILE) {
+        printf("FAIL: file sai magic khong bao GLIB_ERROR_INVALID_FILE\n");
+        failures++;
+    }
+    put16(0, 0x4D42);
+    file_pos = 0;
+    if (GLIB_drawBmp(&ctx, 0, 0, (BMP_Dither_t)7) != GLIB_ERROR_INVALID_ARGUMENT) {
+        printf("FAIL: kieu dither sai khong bao GLIB_ERROR_INVALID_ARGUMENT\n");
+        failures++;
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    srand(15);
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    BMP_init(palette, sizeof(palette), mem_read);
+
+    // 1. Từng loại file, 3 kiểu dither, 5 vị trí
+    make_24bit(101, 90, -1);
+    failures += check_all("24-bit 101x90");
+    failures += check_rgb_path("24-bit 101x90");
+    make_24bit(IMG_W_MAX, 40, -1);
+    failures += check_all("24-bit 200x40 (cat)");
+    make_8bit(77, 128, 256);
+    failures += check_all("8-bit 77x128");
+    failures += check_rgb_path("8-bit 77x128");
+    make_8bit(128, 33, 5);
+    failures += check_all("8-bit 5 mau");
+    make_rle8(123, 100, 40);
+    failures += check_all("RLE8 123x100");
+    failures += check_rgb_path("RLE8 123x100");
+    make_rle8_delta();
+    failures += check_all("RLE8 delta/EOF");
+    make_1bit(123, 50, 0, 255);
+    failures += check_all("1-bit 123x50");
+    make_1bit(60, 50, 255, 0);
+    failures += check_all("1-bit dao mau");
+    make_1bit(128, 40, 60, 170);
+    failures += check_all("1-bit hai mau xam");
+
+    // 2. Dither ảnh xám đều, lỗi
+    failures += check_gray();
+    failures += check_errors();
+
+    // 3. Thời gian vẽ cả ảnh 128x128
+    printf("%-22s %10s %10s %10s %12s\n", "ns/anh 128x128", "NONE", "ORDERED", "FLOYD", "RGB tung diem");
+    make_24bit(128, 128, -1);
+    timing_row("24-bit", 1);
+    make_8bit(128, 128, 256);
+    timing_row("8-bit", 1);
+    make_rle8(128, 128, 16);
+    timing_row("RLE8", 1);
+    make_1bit(128, 128, 0, 255);
+    timing_row("1-bit", 0);
+
+    printf("RAM giai ma: cache %u + loi Floyd %u + bang mau->bit %u byte, hang tren stack %u byte"
+           " (anh RGB day du: %u byte)\n",
+           (unsigned)BMP_LOCAL_CACHE_SIZE, (unsigned)(2 * (BMP_MONO_MAX_WIDTH + 2)), 256 / 8,
+           (unsigned)(BMP_MONO_MAX_WIDTH / 8), (unsigned)(W * H * 3));
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: BMP 24/8/RLE8/1-bit ve thang vao framebuffer, khop anh tham chieu\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,294 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "bmp.h"
+#include "host_platform.h"
+
+// Ảnh BMP nằm sẵn trong bộ nhớ (flash): đọc qua hàm callback chép từng đoạn
+// vào cache của module, so với BMP_initMemory() đọc thẳng tại chỗ. Cả hai
+// cách phải ra cùng dữ liệu RGB và cùng framebuffer.
+
+// ================= CẤU HÌNH =================
+#define IMG_W         128
+#define IMG_H         128
+#define FILE_MAX      (BMP_HEADER_SIZE + BMP_PALETTE_8BIT_SIZE + IMG_W * IMG_H * 3)
+#define RUNS          300
+
+static GLIB_Context_t ctx;
+static uint8_t palette[BMP_PALETTE_8BIT_SIZE];
+
+// "Flash": file BMP đang thử
+static uint8_t image[FILE_MAX];
+static uint32_t image_len;
+
+// Callback: chép từ "flash", đếm số lần gọi và số byte chép
+static uint32_t read_pos, read_calls, read_bytes;
+
+static EMSTATUS flash_read(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead)
+{
+    if (bytesToRead > bufLength || read_pos + bytesToRead > image_len) {
+        return BMP_ERROR_IO;
+    }
+    memcpy(buffer, image + read_pos, bytesToRead);
+    read_pos += bytesToRead;
+    read_calls++;
+    read_bytes += bytesToRead;
+    return BMP_OK;
+}
+
+// --- HÀM: TẠO FILE BMP 128x128: 8-bit, RLE8 HOẶC 24-bit ---
+static void put32(uint32_t at, uint32_t v)
+{
+    for (int i = 0; i < 4; i++) {
+        image[at + i] = (v >> (8 * i)) & 0xFF;
+    }
+}
+
+static uint8_t pattern(int x, int y)
+{
+    // Các dải ngang dài để RLE nén được, xen điểm lẻ cho đoạn tuyệt đối
+    return (uint8_t)(((x / 9) * 31 + (y / 5) * 17 + ((x * y) % 13 == 0 ? x : 0)) & 255);
+}
+
+static void make_bmp(int bpp, int rle)
+{
+    int entries = bpp == 8 ? 256 : 0;
+    uint32_t pos = BMP_HEADER_SIZE + entries * 4, start = pos;
+
+    memset(image, 0, BMP_HEADER_SIZE);
+    image[0] = 'B';
+    image[1] = 'M';
+    put32(10, start);
+    put32(14, 40);
+    put32(18, IMG_W);
+    put32(22, IMG_H);
+    image[26] = 1;
+    image[28] = bpp;
+    put32(30, rle);
+    for (int i = 0; i < entries; i++) {
+        image[BMP_HEADER_SIZE + 4 * i] = i;
+        image[BMP_HEADER_SIZE + 4 * i + 1] = 255 - i;
+        image[BMP_HEADER_SIZE + 4 * i + 2] = (i * 7) & 255;
+    }
+    for (int r = 0; r < IMG_H; r++) {
+        int y = IMG_H - 1 - r;
+        for (int x = 0; x < IMG_W;) {
+            uint8_t p = pattern(x, y);
+            if (bpp == 24) {
+                image[pos++] = p;
+                image[pos++] = 255 - p;
+                image[pos++] = (p * 5) & 255;
+                x++;
+            } else if (!rle) {
+                image[pos++] = p;
+                x++;
+            } else {
+                int run = 1;
+                while (x + run < IMG_W && run < 255 && pattern(x + run, y) == p) {
+                    run++;
+                }
+                if (run >= 2) {
+                    image[pos++] = run;
+                    image[pos++] = p;
+                    x += run;
+                } else {
+                    int lit = 0;
+                    while (x + lit < IMG_W && lit < 255
+                           && (x + lit + 1 >= IMG_W || pattern(x + lit, y) != pattern(x + lit + 1, y))) {
+                        lit++;
+                    }
+                    if (lit < 3) {
+                        image[pos++] = 1;
+                        image[pos++] = p;
+                        x++;
+                        continue;
+                    }
+                    image[pos++] = 0;
+                    image[pos++] = lit;
+                    for (int i = 0; i < lit; i++) {
+                        image[pos++] = pattern(x + i, y);
+                    }
+                    if (lit & 1) {
+                        image[pos++] = 0;
+                    }
+                    x += lit;
+                }
+            }
+        }
+        if (rle) {
+            image[pos++] = 0;
+            image[pos++] = (r == IMG_H - 1) ? 1 : 0;
+        } else {
+            while ((pos - start) & 3) {
+                image[pos++] = 0;
+            }
+        }
+    }
+    image_len = pos;
+    put32(2, pos);
+    put32(34, pos - start);
+}
+
+// --- HÀM: GIẢI MÃ RA RGB, TRẢ VỀ MÃ BĂM CỦA DỮ LIỆU ---
+static uint32_t decode_rgb(uint32_t *pixels)
+{
+    static uint8_t rgb[IMG_W * 3];
+    uint32_t hash = 2166136261u, n;
+    EMSTATUS status;
+
+    *pixels = 0;
+    read_pos = 0;
+    if (BMP_reset() != BMP_OK) {
+        return 0;
+    }
+    do {
+        status = BMP_readRgbData(rgb, sizeof(rgb), &n);
+        for (uint32_t i = 0; i < n * 3; i++) {
+            hash = (hash ^ rgb[i]) * 16777619u;
+        }
+        *pixels += n;
+    } while (status == BMP_OK);
+    return hash;
+}
+
+static void draw_mono(void)
+{
+    read_pos = 0;
+    GLIB_drawBmp(&ctx, 0, 0, BMP_DITHER_FLOYD_STEINBERG);
+}
+
+static void use_callback(void)
+{
+    BMP_init(palette, sizeof(palette), flash_read);
+}
+
+static void use_memory(void)
+{
+    BMP_initMemory(image, image_len, palette, sizeof(palette));
+}
+
+typedef struct {
+    double rgb_ns, mono_ns;
+    uint32_t calls, bytes;
+    uint32_t hash, pixels;
+    uint8_t fb[IMG_H][IMG_W / 8];
+} result_t;
+
+static void measure(void (*select)(void), result_t *res)
+{
+    uint64_t t0;
+
+    select();
+    read_calls = read_bytes = 0;
+    res->hash = decode_rgb(&res->pixels);
+    draw_mono();
+    res->calls = read_calls;
+    res->bytes = read_bytes;
+    for (int y = 0; y < IMG_H; y++) {
+        DMD_readData(0, y, res->fb[y], IMG_W);
+    }
+
+    t0 = host_now_ns();
+    for (int k = 0; k < RUNS; k++) {
+        uint32_t n;
+        decode_rgb(&n);
+    }
+    res->rgb_ns = (double)(host_now_ns() - t0) / RUNS;
+    t0 = host_now_ns();
+    for (int k = 0; k < RUNS; k++) {
+        draw_mono();
+    }
+    res->mono_ns = (double)(host_now_ns() - t0) / RUNS;
+}
+
+// --- HÀM: LỖI VÀ ĐỌC LẠI TỪ ĐẦU Ở CHẾ ĐỘ BỘ NHỚ ---
+static int check_memory_api(void)
+{
+    int failures = 0;
+    uint32_t n;
+
+    if (BMP_initMemory(NULL, 10, palette, sizeof(palette)) != BMP_ERROR_INVALID_ARGUMENT) {
+        printf("FAIL: BMP_initMemory(NULL)\n");
+        failures++;
+    }
+
+    // Ảnh bị cắt giữa chừng: vẽ được phần có, rồi báo lỗi IO
+    make_bmp(8, 0);
+    BMP_initMemory(image, image_len - 300, palette, sizeof(palette));
+    if (GLIB_drawBmp(&ctx, 0, 0, BMP_DITHER_NONE) != GLIB_ERROR_IO) {
+        printf("FAIL: anh bi cat khong bao GLIB_ERROR_IO\n");
+        failures++;
+    }
+    BMP_initMemory(image, 20, palette, sizeof(palette));
+    if (BMP_reset() != BMP_ERROR_IO) {
+        printf("FAIL: header bi cat khong bao BMP_ERROR_IO\n");
+        failures++;
+    }
+
+    // BMP_reset quay lại đầu ảnh: giải mã hai lần liên tiếp ra cùng kết quả,
+    // kể cả khi lần đầu dừng giữa chừng
+    BMP_initMemory(image, image_len, palette, sizeof(palette));
+    uint32_t h1 = decode_rgb(&n);
+    uint8_t rgb[30];
+    BMP_reset();
+    BMP_readRgbData(rgb, sizeof(rgb), &n);
+    if (decode_rgb(&n) != h1 || n != IMG_W * IMG_H) {
+        printf("FAIL: BMP_reset khong doc lai anh tu dau\n");
+        failures++;
+    }
+    return failures;
+}
+
+int main(void)
+{
+    static const struct {
+        const char *name;
+        int bpp, rle;
+    } files[] = {
+        { "8-bit", 8, 0 },
+        { "RLE8", 8, 1 },
+        { "24-bit", 24, 0 },
+    };
+    static result_t cb, mem;
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+
+    printf("%-8s %-9s %10s %10s %12s %12s\n", "anh", "nguon", "ns RGB", "ns 1bpp", "lan callback",
+           "byte chep");
+    for (size_t f = 0; f < sizeof(files) / sizeof(files[0]); f++) {
+        make_bmp(files[f].bpp, files[f].rle);
+        measure(use_callback, &cb);
+        measure(use_memory, &mem);
+        printf("%-8s %-9s %10.0f %10.0f %12u %12u\n", files[f].name, "callback", cb.rgb_ns, cb.mono_ns,
+               cb.calls, cb.bytes);
+        printf("%-8s %-9s %10.0f %10.0f %12u %12u\n", "", "bo nho", mem.rgb_ns, mem.mono_ns, mem.calls,
+               mem.bytes);
+
+        if (cb.pixels != IMG_W * IMG_H || mem.pixels != cb.pixels || mem.hash != cb.hash) {
+            printf("FAIL: %s: du lieu RGB khac nhau (%u/%u diem)\n", files[f].name, cb.pixels, mem.pixels);
+            failures++;
+        }
+        if (memcmp(cb.fb, mem.fb, sizeof(cb.fb)) != 0) {
+            printf("FAIL: %s: framebuffer khac nhau\n", files[f].name);
+            failures++;
+        }
+        if (mem.calls != 0) {
+            printf("FAIL: %s: che do bo nho van goi callback\n", files[f].name);
+            failures++;
+        }
+    }
+
+    failures += check_memory_api();
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: doc anh tai cho giong het doc qua callback, khong chep du lieu anh\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,289 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "lcd.h"
+#include "lcd_display.h"
+#include "host_platform.h"
+
+// Chế độ display list (SL_MEMLCD_DISPLAY_LIST): các hàm DMD chỉ ghi lệnh vẽ
+// gọn vào một danh sách, DMD_updateDisplay() dựng lại từng dải
+// SL_MEMLCD_DISPLAY_LIST_BAND_ROWS hàng vào một bộ đệm nhỏ rồi gửi qua
+// lcd_tx, chỉ các dải có hàng vừa vẽ. build.sh build chương trình này hai lần:
+//
+//   bench_display_list_fb   chế độ framebuffer, ghi kết quả và ảnh panel
+//                           cuối mỗi kịch bản vào build/
+//   bench_display_list      chế độ display list, so từng điểm ảnh panel với
+//                           bản framebuffer rồi in bảng so sánh RAM và thời
+//                           gian khung của hai chế độ
+
+// ================= CẤU HÌNH =================
+#define RESULT_FILE     "build/display_list_fb.txt"
+#define PANEL_FILE      "build/display_list_fb_%d.pbm"
+#define REDRAW_FRAMES   30      // Kịch bản 1: vẽ lại cả màn hình mỗi khung
+#define UPDATE_FRAMES   200     // Kịch bản 2: mỗi khung chỉ đổi vài số
+#define CHART_FRAMES    300     // Kịch bản 3: mỗi khung thêm một mẫu biểu đồ
+
+// Panel lớn để ước lượng RAM (Sharp LS027B7DH01 400x240)
+#define BIG_WIDTH       400
+#define BIG_HEIGHT      240
+
+static GLIB_Context_t ctx;
+static GLIB_TextGrid_t grid;
+static GLIB_StripChart_t chart;
+static const GLIB_Rectangle_t chartArea = { 4, 88, 123, 123 };
+static int failures;
+
+typedef struct {
+    const char *name;
+    int frames;
+    double draw_ns;         // Tổng thời gian CPU các hàm vẽ
+    double update_ns;       // Tổng thời gian CPU của DMD_updateDisplay()
+    uint64_t rows;          // Số hàng gửi qua SPI
+    uint32_t bands;         // Số dải đã dựng (chỉ chế độ display list)
+    uint32_t list_peak;     // Số byte danh sách cao nhất
+    uint32_t redraws;       // Số lần vẽ lại biểu đồ vì danh sách đầy
+} result_t;
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// --- HÀM: MÀN HÌNH CHÍNH CỦA ỨNG DỤNG (TIÊU ĐỀ, SỐ LỚN, CÁC DÒNG, BIỂU ĐỒ) ---
+static void draw_values(int frame)
+{
+    char text[24];
+    int n;
+
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNumber16x20);
+    n = snprintf(text, sizeof(text), "%2d.%d", 20 + frame % 10, frame % 7);
+    GLIB_drawString(&ctx, text, (uint32_t)n, 8, 16, true);
+
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    snprintf(text, sizeof(text), "Hum  %2d.%d %%", 40 + frame % 20, frame % 10);
+    GLIB_textGridDrawLine(&grid, text, 6, GLIB_ALIGN_LEFT, 4);
+    snprintf(text, sizeof(text), "RSSI -%2d dBm", 40 + frame % 30);
+    GLIB_textGridDrawLine(&grid, text, 7, GLIB_ALIGN_LEFT, 4);
+    snprintf(text, sizeof(text), "Up %02d:%02d", frame / 60 % 60, frame % 60);
+    GLIB_textGridDrawLine(&grid, text, 8, GLIB_ALIGN_LEFT, 4);
+}
+
+static void draw_screen(int frame)
+{
+    GLIB_Rectangle_t border = { 0, 0, 127, 127 };
+
+    GLIB_clear(&ctx);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNormal8x8);
+    GLIB_drawStringOnLine(&ctx, "DHT20 + BLE", 0, GLIB_ALIGN_CENTER, 0, 2, true);
+    GLIB_drawRect(&ctx, &border);
+    GLIB_drawLineH(&ctx, 0, 12, 127);
+    GLIB_drawCircleFilled(&ctx, 108, 28, 8);
+    ctx.foregroundColor = White;
+    GLIB_drawCircle(&ctx, 108, 28, 4);
+    ctx.foregroundColor = Black;
+
+    // Màn hình vừa xóa: lưới chữ và biểu đồ vẽ lại từ đầu
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    GLIB_textGridInit(&grid, &ctx);
+    draw_values(frame);
+    GLIB_stripChartRedraw(&chart);
+}
+
+// --- HÀM: MỘT KHUNG: ĐO THỜI GIAN VẼ VÀ CẬP NHẬT ---
+static void frame_done(result_t *r, uint64_t t0)
+{
+    uint64_t t1 = host_now_ns();
+
+    DMD_updateDisplay();
+    r->draw_ns += (double)(t1 - t0);
+    r->update_ns += (double)(host_now_ns() - t1);
+    r->frames++;
+}
+
+static void run(int index, result_t *r)
+{
+    DMD_DisplayListStats ls;
+    DMD_UpdateStats us;
+    EMSTATUS status;
+    uint64_t t0;
+
+    srand(1);
+    GLIB_clear(&ctx);
+    GLIB_stripChartInit(&chart, &ctx, &chartArea, 0, 100);
+    for (int i = 0; i < 60; i++) {
+        GLIB_stripChartAddSample(&chart, (int16_t)(50 + rand() % 40 - 20));
+    }
+    draw_screen(0);
+    DMD_updateDisplay();
+    host_spi_reset_stats();
+    DMD_resetUpdateStats();
+
+    for (int f = 1; ; f++) {
+        t0 = host_now_ns();
+        if (index == 0 && f <= REDRAW_FRAMES) {
+            draw_screen(f);
+        } else if (index == 1 && f <= UPDATE_FRAMES) {
+            draw_values(f);
+        } else if (index == 2 && f <= CHART_FRAMES) {
+            status = GLIB_stripChartAddSample(&chart, (int16_t)(50 + rand() % 40 - 20));
+            if (status == DMD_ERROR_NOT_ENOUGH_MEMORY) {
+                // Danh sách đầy: xóa vùng biểu đồ (bỏ các lệnh cũ trong vùng) và vẽ lại
+                GLIB_setClippingRegion(&ctx, &chartArea);
+                GLIB_clearRegion(&ctx);
+                GLIB_resetClippingRegion(&ctx);
+                GLIB_applyClippingRegion(&ctx);
+                status = GLIB_stripChartRedraw(&chart);
+                r->redraws++;
+            }
+            check(status == GLIB_OK, "ve bieu do loi");
+        } else {
+            break;
+        }
+        frame_done(r, t0);
+    }
+
+    r->rows = host_spi_get_stats()->rows;
+    DMD_getUpdateStats(&us);
+    check(host_spi_get_stats()->errors == 0, "panel gia lap bao loi giao thuc");
+    if (DMD_getDisplayListStats(&ls) == DMD_OK) {
+        r->bands = ls.bandsRendered;
+        r->list_peak = ls.bytesPeak;
+        check(ls.overflows == r->redraws, "danh sach day ma khong ve lai");
+        check(us.rowsSent == r->rows, "so hang gui khac so hang panel nhan");
+    }
+}
+
+#if SL_MEMLCD_DISPLAY_LIST
+// --- HÀM: RAM CỦA DRIVER DMD Ở MỖI CHẾ ĐỘ ---
+// Framebuffer: framebuffer + bản sao hàng đã gửi + bộ đệm truyền bất đồng bộ.
+// Display list: bộ đệm một dải + danh sách lệnh.
+static unsigned fb_ram(unsigned w, unsigned h)
+{
+    return 2 * SL_MEMLCD_FRAMEBUFFER_SIZE(w, h, 1) + SL_MEMLCD_TX_BUFFER_SIZE(w, h);
+}
+
+static unsigned list_ram(unsigned w)
+{
+    return SL_MEMLCD_FRAMEBUFFER_SIZE(w, SL_MEMLCD_DISPLAY_LIST_BAND_ROWS, 1)
+           + SL_MEMLCD_DISPLAY_LIST_SIZE;
+}
+#endif
+
+// --- HÀM: ẢNH PANEL CUỐI KỊCH BẢN: GHI (FRAMEBUFFER) HOẶC SO (DISPLAY LIST) ---
+static void panel_done(int index, const char *name)
+{
+    char path[64];
+
+    snprintf(path, sizeof(path), PANEL_FILE, index);
+#if !(SL_MEMLCD_DISPLAY_LIST)
+    (void)name;
+    check(host_pbm_write(path, host_panel_memory()) == 0, "khong ghi duoc anh panel");
+#else
+    static uint8_t expected[HOST_PANEL_BYTES];
+
+    if (host_pbm_read(path, expected) != 0) {
+        printf("FAIL: khong doc duoc %s, chay bench_display_list_fb truoc\n", path);
+        failures++;
+    } else if (memcmp(expected, host_panel_memory(), HOST_PANEL_BYTES) != 0) {
+        printf("FAIL: %s: panel khac che do framebuffer\n", name);
+        failures++;
+    }
+#endif
+}
+
+int main(void)
+{
+    result_t res[3] = {
+        { .name = "ve lai ca man hinh" },
+        { .name = "cap nhat vai so" },
+        { .name = "bieu do cuon" },
+    };
+    FILE *f;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+
+    for (int i = 0; i < 3; i++) {
+        run(i, &res[i]);
+        panel_done(i, res[i].name);
+    }
+
+#if !(SL_MEMLCD_DISPLAY_LIST)
+    // Chế độ framebuffer: ghi kết quả cho bench_display_list
+    f = fopen(RESULT_FILE, "w");
+    check(f != NULL, "khong ghi duoc " RESULT_FILE);
+    for (int i = 0; f != NULL && i < 3; i++) {
+        fprintf(f, "%d %.0f %.0f %llu\n", res[i].frames, res[i].draw_ns, res[i].update_ns,
+                (unsigned long long)res[i].rows);
+    }
+    if (f != NULL) {
+        fclose(f);
+    }
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: da ghi ket qua che do framebuffer vao " RESULT_FILE "\n");
+    return EXIT_SUCCESS;
+#else
+    // Chế độ display list: so với kết quả chế độ framebuffer
+    result_t fb[3];
+
+    f = fopen(RESULT_FILE, "r");
+    if (f == NULL) {
+        printf("FAIL: khong doc duoc " RESULT_FILE ", chay bench_display_list_fb truoc\n");
+        return EXIT_FAILURE;
+    }
+    for (int i = 0; i < 3; i++) {
+        unsigned long long rows;
+        fb[i] = res[i];
+        if (fscanf(f, "%d %lf %lf %llu", &fb[i].frames, &fb[i].draw_ns, &fb[i].update_ns, &rows) != 4) {
+            printf("FAIL: " RESULT_FILE " hong\n");
+            fclose(f);
+            return EXIT_FAILURE;
+        }
+        fb[i].rows = rows;
+        check(fb[i].frames == res[i].frames, "so khung khac che do framebuffer");
+    }
+    fclose(f);
+
+    printf("RAM DMD %ux%u: framebuffer %u byte, display list %u byte"
+           " (dai %d hang %u + danh sach %u)\n",
+           SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_HEIGHT,
+           fb_ram(SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_HEIGHT), list_ram(SL_MEMLCD_DISPLAY_WIDTH),
+           SL_MEMLCD_DISPLAY_LIST_BAND_ROWS,
+           SL_MEMLCD_FRAMEBUFFER_SIZE(SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_LIST_BAND_ROWS, 1),
+           SL_MEMLCD_DISPLAY_LIST_SIZE);
+    printf("RAM DMD %ux%u: framebuffer %u byte, display list %u byte\n",
+           BIG_WIDTH, BIG_HEIGHT, fb_ram(BIG_WIDTH, BIG_HEIGHT), list_ram(BIG_WIDTH));
+    printf("%-20s %6s | %9s %9s %7s | %9s %9s %7s %7s %8s %7s\n", "kich ban", "khung",
+           "fb ve us", "fb gui us", "fb hang", "dl ve us", "dl gui us", "dl hang", "dai",
+           "ds dinh", "ve lai");
+    for (int i = 0; i < 3; i++) {
+        printf("%-20s %6d | %9.2f %9.2f %7llu | %9.2f %9.2f %7llu %7u %8u %7u\n",
+               res[i].name, res[i].frames,
+               fb[i].draw_ns / fb[i].frames / 1e3, fb[i].update_ns / fb[i].frames / 1e3,
+               (unsigned long long)fb[i].rows,
+               res[i].draw_ns / res[i].frames / 1e3, res[i].update_ns / res[i].frames / 1e3,
+               (unsigned long long)res[i].rows, res[i].bands, res[i].list_peak, res[i].redraws);
+    }
+    printf("(thoi gian CPU moi khung tren PC; dai = so dai %d hang da dung, ds dinh = byte danh sach cao nhat)\n",
+           SL_MEMLCD_DISPLAY_LIST_BAND_ROWS);
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: display list cho ra dung anh panel voi %u byte RAM thay vi %u\n",
+           list_ram(SL_MEMLCD_DISPLAY_WIDTH), fb_ram(SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_HEIGHT));
+    return EXIT_SUCCESS;
+#endif
+}
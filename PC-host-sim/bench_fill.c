@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES       (128 * 128 / 8)
+#define CHECK_SHAPES   3000
+#define BENCH_SHAPES   100000
+#define POLY_POINTS    6
+
+static GLIB_Context_t ctx;
+
+// --- HÀM: HÌNH TRÒN ĐẶC KIỂU CŨ, MỖI HÀNG MỘT GLIB_drawLineH (MẪU SO SÁNH) ---
+static EMSTATUS ref_circle(GLIB_Context_t *c, int32_t xc, int32_t yc, uint32_t r)
+{
+    int32_t x = 0, y = (int32_t)r, d = 1 - (int32_t)r;
+
+    GLIB_drawLineH(c, xc - y, yc, xc + y);
+    while (x < y) {
+        if (d < 0) {
+            d += 2 * x + 1;
+        } else {
+            y--;
+            d += 2 * (x - y) + 1;
+        }
+        GLIB_drawLineH(c, xc - x, yc + y, xc + x);
+        GLIB_drawLineH(c, xc - y, yc + x, xc + y);
+        GLIB_drawLineH(c, xc - x, yc - y, xc + x);
+        GLIB_drawLineH(c, xc - y, yc - x, xc + y);
+        x++;
+    }
+    return GLIB_OK;
+}
+
+// --- HÀM: ĐA GIÁC ĐẶC VẼ TỪNG ĐOẠN (MẪU SO SÁNH) ---
+// Cùng quy ước với bộ tô bảng cạnh: hàng min_y+1..max_y-1 trong vùng cắt,
+// giao điểm làm tròn xuống, tô theo cặp sau khi sắp xếp
+static EMSTATUS ref_polygon(GLIB_Context_t *c, uint32_t n, const int32_t *p)
+{
+    int32_t min_y = p[1], max_y = p[1];
+    int32_t cross_x[POLY_POINTS];
+
+    for (uint32_t i = 1; i < n; i++) {
+        min_y = p[2 * i + 1] < min_y ? p[2 * i + 1] : min_y;
+        max_y = p[2 * i + 1] > max_y ? p[2 * i + 1] : max_y;
+    }
+    min_y = min_y + 1 < c->clippingRegion.yMin ? c->clippingRegion.yMin : min_y + 1;
+    max_y = max_y - 1 > c->clippingRegion.yMax ? c->clippingRegion.yMax : max_y - 1;
+
+    for (int32_t y = min_y; y <= max_y; y++) {
+        size_t nc = 0, j = n - 1;
+        for (size_t i = 0; i < n; i++) {
+            int32_t x0 = p[j * 2], y0 = p[j * 2 + 1], x1 = p[i * 2], y1 = p[i * 2 + 1];
+            if (y0 > y1) {
+                int32_t t = x0; x0 = x1; x1 = t;
+                t = y0; y0 = y1; y1 = t;
+            }
+            if (y0 < y && y <= y1) {
+                int32_t num = (y - y0) * (x1 - x0), den = y1 - y0;
+                int32_t q = num / den;
+                cross_x[nc++] = x0 + ((num % den != 0 && num < 0) ? q - 1 : q);
+            }
+            j = i;
+        }
+        for (size_t i = 1; i < nc; i++) {
+            for (size_t k = i; k > 0 && cross_x[k - 1] > cross_x[k]; k--) {
+                int32_t t = cross_x[k]; cross_x[k] = cross_x[k - 1]; cross_x[k - 1] = t;
+            }
+        }
+        for (size_t i = 0; i + 1 < nc; i += 2) {
+            GLIB_drawLineH(c, cross_x[i], y, cross_x[i + 1]);
+        }
+    }
+    return GLIB_OK;
+}
+
+// --- HÀM: HÌNH CHỮ NHẬT ĐẶC KIỂU CŨ (MỘT LẦN DMD_writeColor) ---
+static EMSTATUS ref_rect(GLIB_Context_t *c, const GLIB_Rectangle_t *pr)
+{
+    GLIB_Rectangle_t r = *pr;
+    uint8_t red, green, blue;
+
+    GLIB_normalizeRect(&r);
+    r.xMin = r.xMin < c->clippingRegion.xMin ? c->clippingRegion.xMin : r.xMin;
+    r.xMax = r.xMax > c->clippingRegion.xMax ? c->clippingRegion.xMax : r.xMax;
+    r.yMin = r.yMin < c->clippingRegion.yMin ? c->clippingRegion.yMin : r.yMin;
+    r.yMax = r.yMax > c->clippingRegion.yMax ? c->clippingRegion.yMax : r.yMax;
+    if (r.xMin > r.xMax || r.yMin > r.yMax) {
+        return GLIB_ERROR_NOTHING_TO_DRAW;
+    }
+    GLIB_colorTranslate24bpp(c->foregroundColor, &red, &green, &blue);
+    DMD_setClippingArea(r.xMin, r.yMin, r.xMax - r.xMin + 1, r.yMax - r.yMin + 1);
+    DMD_writeColor(0, 0, red, green, blue, (r.xMax - r.xMin + 1) * (r.yMax - r.yMin + 1));
+    return GLIB_applyClippingRegion(c);
+}
+
+typedef struct {
+    int32_t xc, yc;
+    uint32_t r;
+    int32_t pts[POLY_POINTS * 2];
+    GLIB_Rectangle_t rect;
+} shape_t;
+
+// Hình ngẫu nhiên, một phần nằm ngoài màn hình
+static void random_shape(shape_t *s)
+{
+    s->xc = rand() % 180 - 26;
+    s->yc = rand() % 180 - 26;
+    s->r = (uint32_t)(rand() % 48);
+    for (int i = 0; i < POLY_POINTS; i++) {
+        // Đa giác lồi quanh tâm để số giao điểm luôn là 2
+        static const int dx[POLY_POINTS] = { 0, 26, 26, 0, -26, -26 };
+        static const int dy[POLY_POINTS] = { -30, -15, 15, 30, 15, -15 };
+        s->pts[2 * i] = s->xc + dx[i] * (int)s->r / 32 + rand() % 3;
+        s->pts[2 * i + 1] = s->yc + dy[i] * (int)s->r / 32 + rand() % 3;
+    }
+    s->rect.xMin = s->xc - (int32_t)s->r;
+    s->rect.yMin = s->yc;
+    s->rect.xMax = s->xc + rand() % 60;
+    s->rect.yMax = s->yc - rand() % 60;
+}
+
+typedef enum { SHAPE_CIRCLE, SHAPE_POLYGON, SHAPE_RECT } kind_t;
+static const char *kind_names[] = { "circle", "polygon", "rect" };
+
+static void draw_shape(kind_t k, const shape_t *s, int ref)
+{
+    switch (k) {
+    case SHAPE_CIRCLE:
+        ref ? ref_circle(&ctx, s->xc, s->yc, s->r) : GLIB_drawCircleFilled(&ctx, s->xc, s->yc, s->r);
+        break;
+    case SHAPE_POLYGON:
+        ref ? ref_polygon(&ctx, POLY_POINTS, s->pts) : GLIB_drawPolygonFilled(&ctx, POLY_POINTS, s->pts);
+        break;
+    default:
+        ref ? ref_rect(&ctx, &s->rect) : GLIB_drawRectFilled(&ctx, &s->rect);
+        break;
+    }
+}
+
+// --- HÀM: VẼ CÙNG MỘT DÃY HÌNH, ĐỔI MÀU XEN KẼ, TRẢ VỀ FRAMEBUFFER ---
+static void draw_sequence(kind_t k, int ref, const GLIB_Rectangle_t *clip, uint8_t *out)
+{
+    void *fb;
+    shape_t s;
+
+    srand(7);
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    ctx.backgroundColor = White;
+    GLIB_clear(&ctx);
+    if (clip) {
+        GLIB_setClippingRegion(&ctx, clip);
+        GLIB_applyClippingRegion(&ctx);
+    }
+    for (int i = 0; i < CHECK_SHAPES; i++) {
+        random_shape(&s);
+        ctx.foregroundColor = (i & 1) ? White : Black;
+        draw_shape(k, &s, ref);
+    }
+    DMD_getFrameBuffer(&fb);
+    memcpy(out, fb, FB_BYTES);
+}
+
+// --- HÀM: ĐO SỐ HÌNH/GIÂY ---
+static double bench(kind_t k, int ref)
+{
+    static shape_t shapes[256];
+    uint64_t t0;
+
+    srand(11);
+    for (int i = 0; i < 256; i++) {
+        random_shape(&shapes[i]);
+    }
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    t0 = host_now_ns();
+    for (int i = 0; i < BENCH_SHAPES; i++) {
+        ctx.foregroundColor = (i & 1) ? White : Black;
+        draw_shape(k, &shapes[i & 255], ref);
+    }
+    return BENCH_SHAPES / ((host_now_ns() - t0) / 1e9);
+}
+
+int main(void)
+{
+    static uint8_t ref[FB_BYTES], out[FB_BYTES];
+    static const GLIB_Rectangle_t clip = { 13, 21, 101, 90 };
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+
+    printf("%-8s %14s %14s %8s\n", "shape", "ref shapes/s", "new shapes/s", "speedup");
+    for (kind_t k = SHAPE_CIRCLE; k <= SHAPE_RECT; k++) {
+        for (int c = 0; c < 2; c++) {
+            draw_sequence(k, 1, c ? &clip : NULL, ref);
+            draw_sequence(k, 0, c ? &clip : NULL, out);
+            if (memcmp(ref, out, FB_BYTES) != 0) {
+                printf("FAIL: %s%s khac framebuffer mau\n", kind_names[k],
+                       c ? " (vung cat)" : "");
+                failures++;
+            }
+        }
+
+        double r = bench(k, 1);
+        double n = bench(k, 0);
+        printf("%-8s %14.0f %14.0f %7.1fx\n", kind_names[k], r, n, n / r);
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: hinh to dac giong het ban ve tung doan\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "sl_sleeptimer.h"
+#include "app_lcd.h"
+#include "host_platform.h"
+
+// Lịch vẽ khung của app_lcd.c: nhiều sự kiện liền nhau (đo cảm biến, RSSI,
+// nút nhấn, lệnh UART) chỉ ghi model, màn hình được vẽ và gửi tối đa một
+// lần mỗi chu kỳ khung. So với cách cũ: mỗi lần gọi là một lần vẽ và gửi.
+
+// ================= CẤU HÌNH =================
+#define SIM_MS        10000     // Thời gian mô phỏng mỗi chế độ
+#define MEASURE_MS    1000      // Chu kỳ đo DHT20
+#define RSSI_MS       50        // Sự kiện RSSI khi đang kết nối
+#define PERIOD_MS     MEMLCD_FRAME_PERIOD_MS
+
+static int failures;
+static uint32_t calls;              // Số lần gọi memlcd_* trong mô phỏng
+static uint32_t last_flushed;
+static uint64_t last_flush_ms;
+static uint32_t min_gap_ms;
+static int per_call;                // 1: xử lý sự kiện ngay sau mỗi lần gọi (cách cũ)
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static uint64_t now_ms(void)
+{
+    return sl_sleeptimer_get_tick_count64() * 1000u / HOST_SLEEPTIMER_FREQ;
+}
+
+// --- HÀM: MỘT VÒNG XỬ LÝ SỰ KIỆN CỦA sl_bt_on_event() ---
+// SPI gửi xong ngay trong vòng này (khung 128 hàng mất vài ms, nhỏ hơn chu kỳ).
+static void dispatch(void)
+{
+    memlcd_frame_stats_t fs;
+    uint32_t signals;
+
+    for (;;) {
+        if (host_spi_async_pending()) {
+            host_spi_async_complete();
+        }
+        signals = host_bt_take_signals();
+        if (signals == 0) {
+            break;
+        }
+        if (signals & EX_LCD_FRAME) {
+            memlcd_on_frame();
+        }
+        if (signals & EX_LCD_REFRESH_DONE) {
+            memlcd_on_refresh_done();
+        }
+    }
+
+    memlcd_get_frame_stats(&fs);
+    if (fs.flushed != last_flushed) {
+        uint64_t t = now_ms();
+        if (last_flushed != 0 && t - last_flush_ms < min_gap_ms) {
+            min_gap_ms = (uint32_t)(t - last_flush_ms);
+        }
+        last_flushed = fs.flushed;
+        last_flush_ms = t;
+    }
+}
+
+static void called(void)
+{
+    calls++;
+    if (per_call) {
+        dispatch();
+    }
+}
+
+// --- HÀM: MÔ PHỎNG ỨNG DỤNG TRONG SIM_MS ---
+static void simulate(void)
+{
+    uint32_t samples = 0;
+
+    for (uint32_t ms = 1; ms <= SIM_MS; ms++) {
+        host_time_advance_ms(1);
+        if (ms % MEASURE_MS == 0) {
+            int16_t temp = (int16_t)(2400 + samples % 17 * 100), hum = 5550;
+            samples++;
+            memlcd_plot_sample(temp);
+            called();
+            memlcd_update_sensor(temp, hum, MEASURE_MS);
+            called();
+            memlcd_update_stats(ms / 1000, samples, 0);
+            called();
+        }
+        if (ms % RSSI_MS == 0) {
+            memlcd_update_ble(true, (int8_t)(-40 - (int)(ms / RSSI_MS % 30)), 100);
+            called();
+        }
+        // Nhấn nút liên tục vài lần, rồi một lệnh SET_P từ UART
+        if (ms % 2500 < 4 && ms % 2500 > 0) {
+            memlcd_next_page();
+            called();
+        }
+        if (ms % 3000 == 10) {
+            memlcd_update_sensor(3000, 6000, 2000);
+            called();
+        }
+        dispatch();
+    }
+}
+
+typedef struct {
+    uint32_t requested, flushed, rows, min_gap;
+} run_t;
+
+static void run(int mode_per_call, uint32_t period_ms, run_t *r)
+{
+    memlcd_frame_stats_t before, after;
+
+    per_call = mode_per_call;
+    memlcd_set_frame_period(period_ms);
+    memlcd_get_frame_stats(&before);
+    last_flushed = before.flushed;
+    min_gap_ms = UINT32_MAX;
+    calls = 0;
+    host_spi_reset_stats();
+
+    simulate();
+
+    memlcd_get_frame_stats(&after);
+    r->requested = after.requested - before.requested;
+    r->flushed = after.flushed - before.flushed;
+    r->rows = (uint32_t)host_spi_get_stats()->rows;
+    r->min_gap = min_gap_ms;
+    check(r->requested == calls, "requested khac so lan goi");
+}
+
+int main(void)
+{
+    run_t old, frames;
+    memlcd_frame_stats_t fs;
+    void *fb;
+
+    memlcd_app_init();
+    host_time_advance_ms(1000);
+    dispatch();
+
+    // 1. Cách cũ: mỗi lần gọi vẽ và gửi ngay
+    run(1, 0, &old);
+    check(old.flushed == old.requested, "che do cu: moi lan goi phai la mot khung");
+
+    // 2. Gộp khung: tối đa một khung mỗi PERIOD_MS
+    run(0, PERIOD_MS, &frames);
+    check(frames.flushed <= SIM_MS / PERIOD_MS + 1, "qua nhieu khung");
+    check(frames.flushed < frames.requested, "khong gop duoc khung nao");
+    check(frames.min_gap + 1 >= PERIOD_MS, "hai khung cach nhau it hon mot chu ky");
+
+    // 3. Sau khi rảnh hơn một chu kỳ: yêu cầu được vẽ ngay, không chờ timer
+    host_time_advance_ms(5 * PERIOD_MS);
+    dispatch();
+    memlcd_update_stats(99, 99, 1);
+    dispatch();
+    memlcd_get_frame_stats(&fs);
+    check(fs.flushed == last_flushed && now_ms() == last_flush_ms, "khung sau luc ranh bi tre");
+
+    // Rút ngắn chu kỳ khi đang hẹn khung: khung đến theo chu kỳ mới
+    host_time_advance_ms(5 * PERIOD_MS);
+    dispatch();
+    memlcd_set_frame_period(10 * PERIOD_MS);
+    memlcd_update_stats(100, 100, 1);
+    dispatch();
+    memlcd_set_frame_period(PERIOD_MS);
+    host_time_advance_ms(PERIOD_MS);
+    dispatch();
+    memlcd_get_frame_stats(&fs);
+    check(fs.flushed == last_flushed && now_ms() == last_flush_ms, "doi chu ky khong hen lai khung");
+
+    // 4. Màn hình hiện đúng số liệu cuối: vẽ lại không đổi hàng nào.
+    // Sau 9 lần nhấn nút đang ở trang cảm biến, chuyển sang trang BLE.
+    memlcd_next_page();
+    host_time_advance_ms(5 * PERIOD_MS);
+    dispatch();
+    // Hết thời gian giữ SCS: panel nhận khung ở cạnh xuống
+    host_time_advance_ms(1);
+    DMD_getFrameBuffer(&fb);
+    check(memcmp(host_panel_memory(), fb, HOST_PANEL_BYTES) == 0, "panel khac trang dang hien");
+    host_spi_reset_stats();
+    memlcd_update_ble(true, -40 - (int)(SIM_MS / RSSI_MS % 30), 100);
+    host_time_advance_ms(PERIOD_MS);
+    dispatch();
+    check(host_spi_get_stats()->rows == 0, "khung cuoi chua hien so lieu moi nhat");
+
+    // 5. Khung vẽ khi SPI còn bận chỉ được tính lúc thực sự gửi đi
+    host_time_advance_ms(5 * PERIOD_MS);
+    memlcd_get_frame_stats(&fs);
+    uint32_t flushed = fs.flushed;
+    memlcd_update_ble(true, -90, 100);
+    check(host_bt_take_signals() & EX_LCD_FRAME, "khung sau luc ranh khong duoc ve ngay");
+    memlcd_on_frame();
+    memlcd_update_ble(true, -91, 100);
+    host_time_advance_ms(PERIOD_MS);
+    check(host_bt_take_signals() & EX_LCD_FRAME, "khung ke tiep khong duoc hen");
+    memlcd_on_frame();
+    memlcd_get_frame_stats(&fs);
+    check(fs.flushed == flushed + 1, "khung cho SPI ban bi tinh la da gui");
+    host_spi_async_complete();
+    check(host_bt_take_signals() & EX_LCD_REFRESH_DONE, "SPI gui xong khong bao");
+    memlcd_on_refresh_done();
+    memlcd_get_frame_stats(&fs);
+    check(fs.flushed == flushed + 2 && host_spi_async_pending(), "khung gop khong duoc gui");
+    dispatch();
+
+    printf("%-24s %10s %10s %10s %12s\n", "che do", "yeu cau", "da gui", "hang SPI", "cach nhau ms");
+    printf("%-24s %10u %10u %10u %12u\n", "moi lan goi mot khung", old.requested, old.flushed, old.rows,
+           old.min_gap);
+    printf("%-24s %10u %10u %10u %12u\n", "gop khung 100 ms", frames.requested, frames.flushed,
+           frames.rows, frames.min_gap);
+
+    if (host_spi_get_stats()->errors != 0) {
+        printf("FAIL: panel gia lap bao loi giao thuc\n");
+        failures++;
+    }
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: toi da mot khung moi %d ms, man hinh hien so lieu moi nhat\n", PERIOD_MS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES      (128 * 128 / 8)
+#define BENCH_CHARS   200000
+
+typedef struct {
+    const char *name;
+    const GLIB_Font_t *font;
+    const char *charset;
+} bench_font_t;
+
+static GLIB_Context_t ctx;
+
+// Font dựng lúc chạy: bản layout cũ (xen kẽ theo fontRowOffset) của font có
+// sẵn để so tốc độ với layout glyph liền hàng, và một font tỷ lệ
+static GLIB_Font_t narrow_strided, number_strided, narrow_prop;
+
+static const bench_font_t fonts[] = {
+    { "Narrow6x8",   &GLIB_FontNarrow6x8,   NULL },
+    { "Narrow/old",  &narrow_strided,       NULL },
+    { "Normal8x8",   &GLIB_FontNormal8x8,   NULL },
+    { "Number16x20", &GLIB_FontNumber16x20, "0123456789: " },
+    { "Number/old",  &number_strided,       "0123456789: " },
+    { "Narrow/prop", &narrow_prop,          NULL },
+};
+
+// --- HÀM: ĐỌC MỘT HÀNG CỦA GLYPH, CẢ HAI LAYOUT ---
+static uint32_t glyph_row(const GLIB_Font_t *f, uint32_t glyph, uint32_t row)
+{
+    uint32_t bits = 0;
+
+    if (f->layout == GLIB_FONT_LAYOUT_GLYPH_ROWS) {
+        const uint8_t *p = (const uint8_t *)f->pFontPixMap
+                           + (glyph * f->fontHeight + row) * f->fontRowOffset;
+        for (int b = 0; b < f->fontRowOffset; b++) {
+            bits |= (uint32_t)p[b] << (8 * b);
+        }
+    } else {
+        uint32_t idx = glyph + row * f->fontRowOffset;
+        if (f->sizeOfMapElement == 1) {
+            bits = ((const uint8_t *)f->pFontPixMap)[idx];
+        } else if (f->sizeOfMapElement == 2) {
+            bits = ((const uint16_t *)f->pFontPixMap)[idx];
+        } else {
+            bits = ((const uint32_t *)f->pFontPixMap)[idx];
+        }
+    }
+    return bits;
+}
+
+// --- HÀM: VẼ KÝ TỰ KIỂU CŨ (TỪNG ĐIỂM ẢNH) ĐỂ LÀM MẪU SO SÁNH ---
+static EMSTATUS ref_draw_char(GLIB_Context_t *pContext, char c, int32_t x, int32_t y, bool opaque)
+{
+    const GLIB_Font_t *f = &pContext->font;
+    uint32_t idx;
+    uint32_t drawn = 0;
+
+    if (f->fontClass == NumbersOnlyFont) {
+        idx = (c == ':') ? 10 : (c == ' ') ? 11 : (uint32_t)(c - '0');
+    } else {
+        idx = (uint32_t)(c - ' ');
+    }
+
+    int cell = f->pAdvanceWidths ? f->pAdvanceWidths[idx] : f->fontWidth + f->charSpacing;
+    for (int row = 0; row < f->fontHeight; row++) {
+        uint32_t bits = glyph_row(f, idx, (uint32_t)row);
+
+        for (int col = 0; col < cell; col++, bits >>= 1) {
+            EMSTATUS st = GLIB_ERROR_NOTHING_TO_DRAW;
+            if (col < f->fontWidth && (bits & 1)) {
+                st = GLIB_drawPixel(pContext, x + col, y + row);
+            } else if (opaque) {
+                st = GLIB_drawPixelColor(pContext, x + col, y + row, pContext->backgroundColor);
+            }
+            if (st == GLIB_OK) {
+                drawn++;
+            }
+        }
+    }
+    return drawn ? GLIB_OK : GLIB_ERROR_NOTHING_TO_DRAW;
+}
+
+// --- HÀM: DỰNG CÁC FONT THỬ TỪ FONT CÓ SẴN ---
+static void make_fonts(void)
+{
+    static uint8_t narrow_map[95 * 8];
+    static uint16_t number_map[12 * 20];
+    static uint8_t advance[95];
+    const GLIB_Font_t *n = &GLIB_FontNarrow6x8, *d = &GLIB_FontNumber16x20;
+
+    narrow_strided = *n;
+    for (uint32_t g = 0; g < 95; g++) {
+        uint32_t ink = 0;
+        for (uint32_t r = 0; r < 8; r++) {
+            uint32_t bits = glyph_row(n, g, r);
+            narrow_map[g + r * 95] = (uint8_t)bits;
+            ink |= bits;
+        }
+        // Độ rộng theo nét chữ + 1 cột trống, dấu cách rộng 3
+        advance[g] = ink ? (uint8_t)(32 - __builtin_clz(ink) + 1) : 3;
+    }
+    narrow_strided.pFontPixMap = narrow_map;
+    narrow_strided.cntOfMapElements = sizeof(narrow_map);
+    narrow_strided.fontRowOffset = 95;
+    narrow_strided.layout = GLIB_FONT_LAYOUT_STRIDED;
+
+    number_strided = *d;
+    for (uint32_t g = 0; g < 12; g++) {
+        for (uint32_t r = 0; r < 20; r++) {
+            number_map[g + r * 12] = (uint16_t)glyph_row(d, g, r);
+        }
+    }
+    number_strided.pFontPixMap = number_map;
+    number_strided.cntOfMapElements = 12;
+    number_strided.sizeOfMapElement = 2;
+    number_strided.fontRowOffset = 12;
+    number_strided.layout = GLIB_FONT_LAYOUT_STRIDED;
+
+    narrow_prop = *n;
+    narrow_prop.pAdvanceWidths = advance;
+}
+
+// --- HÀM: SO GLIB_drawString FONT TỶ LỆ VỚI VẼ TỪNG KÝ TỰ BẰNG BẢN MẪU ---
+static int check_prop_string(void)
+{
+    static const char text[] = "Temp 23.5C, Hum 61% | ilWM";
+    static uint8_t ref[FB_BYTES];
+    void *fb;
+    int32_t x = 3;
+
+    GLIB_setFont(&ctx, &narrow_prop);
+    GLIB_clear(&ctx);
+    for (size_t i = 0; i < sizeof(text) - 1; i++) {
+        ref_draw_char(&ctx, text[i], x, 40, true);
+        x += narrow_prop.pAdvanceWidths[text[i] - ' '];
+    }
+    DMD_getFrameBuffer(&fb);
+    memcpy(ref, fb, FB_BYTES);
+    GLIB_clear(&ctx);
+    GLIB_drawString(&ctx, text, sizeof(text) - 1, 3, 40, true);
+    if (memcmp(ref, fb, FB_BYTES) != 0) {
+        printf("FAIL: GLIB_drawString font ty le khac ban mau\n");
+        return 1;
+    }
+    return 0;
+}
+
+typedef EMSTATUS (*draw_fn_t)(GLIB_Context_t *, char, int32_t, int32_t, bool);
+
+static EMSTATUS new_draw_char(GLIB_Context_t *pContext, char c, int32_t x, int32_t y, bool opaque)
+{
+    return GLIB_drawChar(pContext, c, x, y, opaque);
+}
+
+static char pick_char(const bench_font_t *bf, unsigned i)
+{
+    if (bf->charset) {
+        return bf->charset[i % strlen(bf->charset)];
+    }
+    return (char)(' ' + i % 95);
+}
+
+// --- HÀM: VẼ MỘT LOẠT KÝ TỰ Ở MỌI ĐỘ LỆCH BIT, KỂ CẢ BỊ CẮT Ở MÉP ---
+static unsigned draw_pattern(const bench_font_t *bf, draw_fn_t draw, bool opaque, uint8_t *out)
+{
+    void *fb;
+    unsigned ok = 0;
+    const GLIB_Font_t *f = bf->font;
+    int pitch = f->fontHeight + f->lineSpacing;
+
+    GLIB_clear(&ctx);
+    for (unsigned i = 0; i < 400; i++) {
+        int32_t x = (int32_t)(i * (f->fontWidth + 3)) % 150 - 12;
+        int32_t y = (int32_t)((i / 7) * 3) % (128 + pitch) - pitch / 2;
+        if (draw(&ctx, pick_char(bf, i), x, y, opaque) == GLIB_OK) {
+            ok++;
+        }
+    }
+    DMD_getFrameBuffer(&fb);
+    memcpy(out, fb, FB_BYTES);
+    return ok;
+}
+
+// --- HÀM: ĐO SỐ KÝ TỰ/GIÂY ---
+static double bench(const bench_font_t *bf, draw_fn_t draw, bool opaque)
+{
+    const GLIB_Font_t *f = bf->font;
+    int cols = 128 / (f->fontWidth + f->charSpacing);
+    int rows = 128 / f->fontHeight;
+    uint64_t t0 = host_now_ns();
+
+    for (unsigned i = 0; i < BENCH_CHARS; i++) {
+        int32_t x = (int32_t)(i % cols) * (f->fontWidth + f->charSpacing) + (int32_t)(i / 97) % 5;
+        int32_t y = (int32_t)((i / cols) % rows) * f->fontHeight;
+        draw(&ctx, pick_char(bf, i), x, y, opaque);
+    }
+    return BENCH_CHARS / ((host_now_ns() - t0) / 1e9);
+}
+
+int main(void)
+{
+    static uint8_t ref[FB_BYTES], out[FB_BYTES];
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    make_fonts();
+
+    printf("%-12s %-6s %14s %14s %8s\n", "font", "mode", "ref chars/s", "new chars/s", "speedup");
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        const bench_font_t *bf = &fonts[i];
+        GLIB_setFont(&ctx, (GLIB_Font_t *)bf->font);
+
+        for (int opaque = 1; opaque >= 0; opaque--) {
+            unsigned ref_ok = draw_pattern(bf, ref_draw_char, opaque, ref);
+            unsigned new_ok = draw_pattern(bf, new_draw_char, opaque, out);
+            if (memcmp(ref, out, FB_BYTES) != 0 || ref_ok != new_ok) {
+                printf("FAIL: %s %s khac framebuffer mau (ok %u/%u)\n",
+                       bf->name, opaque ? "opaque" : "transp", ref_ok, new_ok);
+                failures++;
+            }
+
+            double r = bench(bf, ref_draw_char, opaque);
+            double n = bench(bf, new_draw_char, opaque);
+            printf("%-12s %-6s %14.0f %14.0f %7.1fx\n", bf->name,
+                   opaque ? "opaque" : "transp", r, n, n / r);
+        }
+    }
+
+    failures += check_prop_string();
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: framebuffer giong het ban ve tung diem anh\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,397 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_sleeptimer.h"
+#include "dht20.h"
+#include "i2c_bus.h"
+#include "sensor_sched.h"
+#include "host_platform.h"
+
+// Hàng đợi I2C theo ngắt (i2c_bus.h) với lưu lượng trộn của nhiều cảm biến
+// trên bus giả lập: DHT20 qua driver thật, gia tốc kế đọc 100 Hz từ ngắt
+// timer (hai bước: ghi địa chỉ thanh ghi rồi đọc 6 byte), EEPROM ghi nhật
+// ký mỗi 50 ms từ vòng lặp chính, và một lần quét cả 127 địa chỉ giữa chừng.
+// Đo độ trễ từ lúc nộp tới callback, tải bus, độ sâu hàng đợi và thời gian
+// vòng lặp chính bị chặn nếu cùng lưu lượng đi qua I2CSPM_Transfer().
+
+// ================= CẤU HÌNH =================
+#define SIM_MS          10000   // Thời gian mô phỏng
+#define DHT20_EVERY_MS  500     // Chu kỳ đo DHT20
+#define ACCEL_ADDR      0x18
+#define ACCEL_EVERY_MS  10      // Chu kỳ đọc gia tốc kế (100 Hz)
+#define ACCEL_STRETCH   100     // Gia tốc kế giữ SCL thêm (µs) mỗi pha
+#define ACCEL_REG       0x28
+#define EEPROM_ADDR     0x50
+#define EEPROM_EVERY_MS 50      // Chu kỳ ghi nhật ký
+#define EEPROM_PAGE     16
+#define SCAN_AT_MS      5000    // Lúc bắt đầu quét bus
+
+// Thống kê độ trễ một loại transaction (tính bằng tick sleeptimer)
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t errors;
+    uint64_t bytes;
+    uint64_t sum_ticks;
+    uint32_t max_ticks;
+} latency_t;
+
+static latency_t lat_dht20 = { .name = "DHT20 (trigger->ket qua)" };
+static latency_t lat_accel = { .name = "gia toc ke (ghi+doc)" };
+static latency_t lat_eeprom = { .name = "EEPROM (ghi trang)" };
+static latency_t lat_scan = { .name = "quet dia chi" };
+
+static int failures;
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static void record(latency_t *l, uint64_t t0, uint32_t bytes, int ok)
+{
+    uint32_t ticks = (uint32_t)(sl_sleeptimer_get_tick_count64() - t0);
+
+    l->count++;
+    l->bytes += bytes;
+    l->sum_ticks += ticks;
+    if (ticks > l->max_ticks) {
+        l->max_ticks = ticks;
+    }
+    if (!ok) {
+        l->errors++;
+    }
+}
+
+static uint32_t ticks_to_us(uint64_t ticks)
+{
+    return (uint32_t)(ticks * 1000000u / HOST_SLEEPTIMER_FREQ);
+}
+
+// ================= THIẾT BỊ GIẢ LẬP =================
+// --- HÀM: DHT20 LUÔN ĐO XONG, KHUNG 7 BYTE CỐ ĐỊNH ---
+static int fake_dht20(void *ctx, int read, uint8_t *data, uint16_t len)
+{
+    static const uint8_t frame[7] = { 0x1C, 0x80, 0x00, 0x05, 0x80, 0x00, 0x00 };
+
+    (void)ctx;
+    if (read) {
+        memcpy(data, frame, len < 7 ? len : 7);
+    }
+    return 0;
+}
+
+// --- HÀM: GIA TỐC KẾ: GHI 1 BYTE CHỌN THANH GHI, ĐỌC TRẢ SỐ MẪU ---
+static struct {
+    uint8_t reg;
+    uint16_t sample;
+} accel;
+
+static int fake_accel(void *ctx, int read, uint8_t *data, uint16_t len)
+{
+    (void)ctx;
+    if (!read) {
+        if (len != 1) {
+            return -1;
+        }
+        accel.reg = data[0];
+        return 0;
+    }
+    if (accel.reg != ACCEL_REG) {
+        return -1;
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        data[i] = (uint8_t)(accel.sample + i);
+    }
+    // Chỉ một lần đọc đủ 6 byte mới sang mẫu mới (lần quét bus đọc 1 byte)
+    if (len == 6) {
+        accel.sample++;
+    }
+    return 0;
+}
+
+// --- HÀM: EEPROM: GHI BYTE ĐẦU LÀ ĐỊA CHỈ, SAU ĐÓ LÀ DỮ LIỆU ---
+static uint8_t eeprom[256];
+static uint8_t eeprom_ptr;
+
+static int fake_eeprom(void *ctx, int read, uint8_t *data, uint16_t len)
+{
+    (void)ctx;
+    if (len < 1) {
+        return -1;
+    }
+    if (read) {
+        for (uint16_t i = 0; i < len; i++) {
+            data[i] = eeprom[eeprom_ptr++];
+        }
+        return 0;
+    }
+    eeprom_ptr = data[0];
+    for (uint16_t i = 1; i < len; i++) {
+        eeprom[eeprom_ptr++] = data[i];
+    }
+    return 0;
+}
+
+// ================= CÁC DRIVER TRÊN HÀNG ĐỢI =================
+// --- GIA TỐC KẾ: TIMER 100 Hz NỘP BƯỚC GHI, CALLBACK GHI NỘP BƯỚC ĐỌC ---
+static i2c_bus_transfer_t accel_xfer;
+static uint8_t accel_reg_cmd = ACCEL_REG;
+static uint8_t accel_data[6];
+static uint64_t accel_t0;
+static uint32_t accel_overruns;
+static uint16_t accel_expect;
+static uint32_t accel_bad;
+static sl_sleeptimer_timer_handle_t accel_timer;
+
+static void accel_read_done(i2c_bus_transfer_t *t, I2C_TransferReturn_TypeDef result)
+{
+    (void)t;
+    if (result == i2cTransferDone && accel_data[0] != (uint8_t)accel_expect) {
+        accel_bad++;
+    }
+    accel_expect++;
+    record(&lat_accel, accel_t0, 7, result == i2cTransferDone);
+}
+
+static void accel_write_done(i2c_bus_transfer_t *t, I2C_TransferReturn_TypeDef result)
+{
+    if (result != i2cTransferDone) {
+        record(&lat_accel, accel_t0, 1, 0);
+        return;
+    }
+    // Bước 2 dùng lại chính mô tả này, nộp từ trong callback
+    i2c_bus_prepare_read(t, ACCEL_ADDR, accel_data, sizeof(accel_data), accel_read_done, NULL);
+    i2c_bus_submit(t);
+}
+
+static void accel_tick(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+    (void)handle;
+    (void)data;
+    if (accel_xfer.pending) {
+        accel_overruns++;
+        return;
+    }
+    accel_t0 = sl_sleeptimer_get_tick_count64();
+    i2c_bus_prepare_write(&accel_xfer, ACCEL_ADDR, &accel_reg_cmd, 1, accel_write_done, NULL);
+    i2c_bus_submit(&accel_xfer);
+}
+
+// --- EEPROM: VÒNG LẶP CHÍNH NỘP MỘT TRANG NHẬT KÝ ---
+static i2c_bus_transfer_t eeprom_xfer;
+static uint8_t eeprom_page[1 + EEPROM_PAGE];
+static uint64_t eeprom_t0;
+static uint32_t eeprom_pages;
+
+static void eeprom_done(i2c_bus_transfer_t *t, I2C_TransferReturn_TypeDef result)
+{
+    (void)t;
+    record(&lat_eeprom, eeprom_t0, sizeof(eeprom_page), result == i2cTransferDone);
+}
+
+static void eeprom_log(void)
+{
+    if (eeprom_xfer.pending) {
+        return;
+    }
+    eeprom_page[0] = (uint8_t)(eeprom_pages * EEPROM_PAGE);
+    for (int i = 0; i < EEPROM_PAGE; i++) {
+        eeprom_page[1 + i] = (uint8_t)(eeprom_pages + i);
+    }
+    eeprom_pages++;
+    eeprom_t0 = sl_sleeptimer_get_tick_count64();
+    i2c_bus_prepare_write(&eeprom_xfer, EEPROM_ADDR, eeprom_page, sizeof(eeprom_page), eeprom_done, NULL);
+    i2c_bus_submit(&eeprom_xfer);
+}
+
+// --- QUÉT BUS: MỘT MÔ TẢ, MỖI ĐỊA CHỈ LÀ MỘT BƯỚC NỘP LẠI TỪ CALLBACK ---
+// Mỗi bước xếp vào cuối hàng đợi nên gia tốc kế không phải chờ cả lần quét
+static i2c_bus_transfer_t scan_xfer;
+static uint8_t scan_addr;
+static uint8_t scan_dummy;
+static uint64_t scan_t0;
+static uint8_t scan_found[128];
+static int scan_done;
+
+static void scan_step(i2c_bus_transfer_t *t, I2C_TransferReturn_TypeDef result)
+{
+    record(&lat_scan, scan_t0, 0, 1);
+    scan_found[scan_addr] = (result == i2cTransferDone);
+    if (++scan_addr >= 127) {
+        scan_done = 1;
+        return;
+    }
+    scan_t0 = sl_sleeptimer_get_tick_count64();
+    i2c_bus_prepare_read(t, scan_addr, &scan_dummy, 1, scan_step, NULL);
+    i2c_bus_submit(t);
+}
+
+static void scan_start(void)
+{
+    scan_addr = 1;
+    scan_t0 = sl_sleeptimer_get_tick_count64();
+    i2c_bus_prepare_read(&scan_xfer, scan_addr, &scan_dummy, 1, scan_step, NULL);
+    i2c_bus_submit(&scan_xfer);
+}
+
+// --- THIẾT BỊ GIỮ SDA: WATCHDOG HỦY TRANSFER, HÀNG ĐỢI VÀ LẬP LỊCH CHẠY TIẾP ---
+static void check_hung_bus(void)
+{
+    const i2c_bus_stats_t *q = i2c_bus_get_stats();
+    uint32_t timeouts = q->timeouts;
+    uint32_t aborts = (uint32_t)host_i2c_get_stats()->aborts;
+    int16_t values[SENSOR_SCHED_VALUES_MAX];
+    sl_status_t sc = SL_STATUS_IN_PROGRESS;
+
+    host_i2c_set_hung(DHT20_ADDR, 1);
+    host_bt_take_signals();
+
+    // Đường chặn lúc khởi động trả lỗi sau số lần hỏi vòng tối đa
+    check(!dht20_is_connected(), "DHT20 treo bus van bao co ket noi");
+    check(q->timeouts == timeouts + 1, "transfer chan khong bi huy khi het han");
+
+    // Trigger bị watchdog hủy, bộ lập lịch bỏ lệnh đọc và kết thúc lần đo
+    // với lỗi của cảm biến
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger DHT20 loi khi bus treo");
+    for (int ms = 0; ms < DHT20_MEASURE_MS + 4 * I2C_BUS_TIMEOUT_MS && sc == SL_STATUS_IN_PROGRESS; ms++) {
+        host_time_advance_ms(1);
+        if (host_bt_take_signals() & EX_SENSOR_READY) {
+            sc = sensor_sched_process();
+        }
+    }
+    check(sc == SL_STATUS_OK && sensor_sched_get(0, values) != SL_STATUS_OK,
+          "lan do tren bus treo khong ket thuc bang loi");
+    check(i2c_bus_is_idle() && q->submitted == q->completed, "hang doi dung yen sau khi bus treo");
+    check(q->timeouts == timeouts + 2, "watchdog khong huy lenh trigger");
+    check(host_i2c_get_stats()->aborts == aborts + 2, "I2C_CMD_ABORT khong toi ngoai vi");
+
+    // Thiết bị thả bus: lần đo kế tiếp thành công
+    host_i2c_set_hung(DHT20_ADDR, 0);
+    sc = SL_STATUS_IN_PROGRESS;
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger DHT20 loi sau khi bus het treo");
+    for (int ms = 0; ms < 2 * DHT20_MEASURE_MS && sc == SL_STATUS_IN_PROGRESS; ms++) {
+        host_time_advance_ms(1);
+        if (host_bt_take_signals() & EX_SENSOR_READY) {
+            sc = sensor_sched_process();
+        }
+    }
+    check(sc == SL_STATUS_OK && sensor_sched_get(0, values) == SL_STATUS_OK,
+          "DHT20 khong doc lai duoc sau khi bus het treo");
+    printf("bus treo: %u transfer bi huy khi het han, hang doi va bo lap lich chay tiep\n",
+           q->timeouts - timeouts);
+}
+
+int main(void)
+{
+    uint64_t dht20_t0 = 0;
+    uint32_t dht20_ok = 0;
+    uint32_t blocked_ticks = 0;
+    uint64_t sim_ticks;
+    host_i2c_stats_t bus;
+    const i2c_bus_stats_t *q;
+    int16_t values[SENSOR_SCHED_VALUES_MAX];
+
+    i2c_bus_init();
+    sensor_sched_init();
+    check(sensor_sched_register(&dht20_sensor, NULL) == SL_STATUS_OK, "dang ky DHT20 loi");
+    host_i2c_attach(DHT20_ADDR, fake_dht20, NULL);
+    host_i2c_attach(ACCEL_ADDR, fake_accel, NULL);
+    host_i2c_attach(EEPROM_ADDR, fake_eeprom, NULL);
+    host_i2c_set_stretch_us(ACCEL_ADDR, ACCEL_STRETCH);
+    host_i2c_reset_stats();
+
+    sim_ticks = sl_sleeptimer_get_tick_count64();
+    sl_sleeptimer_start_periodic_timer_ms(&accel_timer, ACCEL_EVERY_MS, accel_tick, NULL, 0, 0);
+
+    // Vòng lặp chính: mỗi ms xử lý tín hiệu rồi nộp việc đến hạn. Thời gian
+    // ảo không trôi trong thân vòng lặp nếu không có gì chặn.
+    for (uint32_t ms = 1; ms <= SIM_MS; ms++) {
+        host_time_advance_ms(1);
+        uint64_t t0 = sl_sleeptimer_get_tick_count64();
+
+        if ((host_bt_take_signals() & EX_SENSOR_READY) && sensor_sched_process() == SL_STATUS_OK) {
+            sl_status_t sc = sensor_sched_get(0, values);
+            record(&lat_dht20, dht20_t0, 10, sc == SL_STATUS_OK);
+            if (sc == SL_STATUS_OK) {
+                dht20_ok++;
+            }
+        }
+        if (ms % DHT20_EVERY_MS == 1) {
+            dht20_t0 = sl_sleeptimer_get_tick_count64();
+            check(sensor_sched_start() == SL_STATUS_OK, "trigger DHT20 loi");
+        }
+        if (ms % EEPROM_EVERY_MS == 0) {
+            eeprom_log();
+        }
+        if (ms == SCAN_AT_MS) {
+            scan_start();
+        }
+        blocked_ticks += (uint32_t)(sl_sleeptimer_get_tick_count64() - t0);
+    }
+    // Một bước 1 ms là 32 tick nên SIM_MS bước ngắn hơn SIM_MS ms một chút
+    sim_ticks = sl_sleeptimer_get_tick_count64() - sim_ticks;
+    sl_sleeptimer_stop_timer(&accel_timer);
+    host_time_advance_ms(100);
+
+    bus = *host_i2c_get_stats();
+    q = i2c_bus_get_stats();
+
+    // Đúng dữ liệu và đủ số lần
+    check(dht20_ok == SIM_MS / DHT20_EVERY_MS && lat_dht20.errors == 0, "thieu mau DHT20");
+    check(lat_accel.count == sim_ticks / sl_sleeptimer_ms_to_tick(ACCEL_EVERY_MS) && lat_accel.errors == 0,
+          "thieu mau gia toc ke");
+    check(accel_overruns == 0 && accel_bad == 0, "gia toc ke bi lo nhip hoac sai du lieu");
+    check(lat_eeprom.count == SIM_MS / EEPROM_EVERY_MS && lat_eeprom.errors == 0, "thieu trang EEPROM");
+    uint32_t last = eeprom_pages - 1;
+    check(eeprom[(uint8_t)(last * EEPROM_PAGE)] == (uint8_t)last
+          && eeprom[(uint8_t)(last * EEPROM_PAGE + EEPROM_PAGE - 1)] == (uint8_t)(last + EEPROM_PAGE - 1),
+          "EEPROM sai noi dung");
+    check(scan_done && lat_scan.count == 126, "quet bus chua xong");
+    for (int a = 1; a < 127; a++) {
+        int expect = (a == DHT20_ADDR || a == ACCEL_ADDR || a == EEPROM_ADDR);
+        if (scan_found[a] != expect) {
+            printf("FAIL: quet bus sai o dia chi 0x%02X\n", a);
+            failures++;
+        }
+    }
+    check(q->submitted == q->completed && i2c_bus_is_idle(), "con transfer trong hang doi");
+    check(q->errors == 126 - 3, "so NACK khac so dia chi trong khi quet");
+    check(bus.collisions == 0, "I2C_TransferInit chen vao transfer dang chay");
+    check(q->timeouts == 0 && bus.aborts == 0, "transfer binh thuong bi watchdog huy");
+    check(blocked_ticks == 0, "vong lap chinh bi chan");
+    // Quét từng bước nên một lần đọc gia tốc kế chỉ phải chờ tối đa vài
+    // transaction khác, luôn xong trước nhịp kế tiếp
+    check(ticks_to_us(lat_accel.max_ticks) < ACCEL_EVERY_MS * 1000 / 2, "gia toc ke tre qua nua chu ky");
+
+    printf("%-26s %8s %8s %10s %10s\n", "transaction", "so lan", "byte", "tre TB us", "tre max us");
+    const latency_t *all[] = { &lat_dht20, &lat_accel, &lat_eeprom, &lat_scan };
+    for (size_t i = 0; i < sizeof(all) / sizeof(all[0]); i++) {
+        printf("%-26s %8u %8llu %10u %10u\n", all[i]->name, all[i]->count,
+               (unsigned long long)all[i]->bytes,
+               all[i]->count ? ticks_to_us(all[i]->sum_ticks / all[i]->count) : 0,
+               ticks_to_us(all[i]->max_ticks));
+    }
+    printf("bus: %llu transfer, %llu byte, %llu NACK, tai %.1f%%, %.0f byte/s, hang doi sau nhat %u\n",
+           (unsigned long long)bus.transfers, (unsigned long long)bus.bytes,
+           (unsigned long long)bus.nacks, 100.0 * bus.bus_us / ticks_to_us(sim_ticks),
+           bus.bytes * 1e6 / ticks_to_us(sim_ticks), q->max_depth);
+    // I2CSPM_Transfer() hỏi vòng suốt thời gian trên dây, đo DHT20 kiểu chặn
+    // còn chờ DHT20_MEASURE_MS mỗi lần đo
+    printf("vong lap chinh bi chan: hang doi %u ms, I2CSPM_Transfer (uoc tinh) %llu ms\n",
+           ticks_to_us(blocked_ticks) / 1000,
+           (unsigned long long)(bus.bus_us / 1000 + dht20_ok * DHT20_MEASURE_MS));
+
+    check_hung_bus();
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: luu luong I2C tron chay het qua hang doi, vong lap chinh khong bi chan\n");
+    return EXIT_SUCCESS;
+}
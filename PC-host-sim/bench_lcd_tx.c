@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "lcd.h"
+#include "lcd_display.h"
+#include "em_gpio.h"
+#include "sl_udelay.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define ROWS        SL_MEMLCD_DISPLAY_HEIGHT
+#define ROW_BYTES   (SL_MEMLCD_DISPLAY_WIDTH / 8)
+
+typedef struct {
+    const char *name;
+    int first;      // Hàng đầu tiên bị sửa
+    int count;      // Số hàng bị sửa
+    int step;       // Khoảng cách giữa hai hàng bị sửa
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    { "full frame",   0, 128, 1 },
+    { "1 text line", 48,   8, 1 },
+    { "2 text lines", 48,  16, 1 },
+    { "every 4th",     0,  32, 4 },
+};
+
+static GLIB_Context_t ctx;
+static sli_memlcd_spi_handle_t legacy_handle;
+
+// --- HÀM: lcd_tx CŨ, MỖI HÀNG MỘT CỬA SỔ SCS (ĐỂ SO SÁNH) ---
+static void legacy_lcd_tx(const sl_memlcd_t *device, const uint8_t *data, unsigned row)
+{
+    uint8_t cmd = 0x01;
+    uint8_t addr = (uint8_t)row;
+    uint8_t dummy = 0x00;
+
+    GPIO_PinOutSet(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+    sl_udelay_wait(device->setup_us);
+    sli_memlcd_spi_tx(&legacy_handle, &cmd, 1);
+    sli_memlcd_spi_tx(&legacy_handle, &addr, 1);
+    sli_memlcd_spi_tx(&legacy_handle, data, device->width / 8);
+    sli_memlcd_spi_tx(&legacy_handle, &dummy, 1);
+    sli_memlcd_spi_wait(&legacy_handle);
+    sl_udelay_wait(device->hold_us);
+    GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+}
+
+static void touch_rows(const scenario_t *sc, unsigned seed)
+{
+    for (int i = 0; i < sc->count; i++) {
+        int y = sc->first + i * sc->step;
+        DMD_writeRowMask(0, y, (uint32_t)rand() ^ seed, 0xFFFFFFFF);
+        DMD_writeRowMask(64, y, (uint32_t)rand(), 0xFFFFFFFF);
+    }
+}
+
+static void print_stats(const char *label, const host_spi_stats_t *s)
+{
+    printf("  %-7s %6llu byte  %4llu CS toggle  %5llu us cho  ~%8.0f us tren day\n",
+           label, (unsigned long long)s->bytes, (unsigned long long)s->cs_toggles,
+           (unsigned long long)s->udelay_us, host_spi_wire_us(s));
+}
+
+int main(void)
+{
+    const sl_memlcd_t *device;
+    void *fb;
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    device = lcd_get();
+    DMD_getFrameBuffer(&fb);
+    DMD_updateDisplay();
+    srand(1);
+
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        const scenario_t *sc = &scenarios[i];
+        host_spi_stats_t burst, legacy;
+
+        printf("%s (%d hang):\n", sc->name, sc->count);
+
+        // Burst nhiều hàng qua DMD_updateDisplay
+        touch_rows(sc, (unsigned)i);
+        host_spi_reset_stats();
+        DMD_updateDisplay();
+        burst = *host_spi_get_stats();
+        print_stats("burst", &burst);
+
+        if (burst.errors || burst.rows != (uint64_t)sc->count
+            || memcmp(host_panel_memory(), fb, ROWS * ROW_BYTES) != 0) {
+            printf("FAIL: panel giai ma khong khop framebuffer (loi %llu, %llu hang)\n",
+                   (unsigned long long)burst.errors, (unsigned long long)burst.rows);
+            failures++;
+        }
+
+        // Cùng các hàng đó, gửi kiểu cũ
+        host_spi_reset_stats();
+        for (int r = 0; r < sc->count; r++) {
+            int y = sc->first + r * sc->step;
+            legacy_lcd_tx(device, (const uint8_t *)fb + y * ROW_BYTES, (unsigned)y);
+        }
+        legacy = *host_spi_get_stats();
+        print_stats("tung hang", &legacy);
+        printf("  tiet kiem: %.1f%% thoi gian tren day\n",
+               100.0 * (1.0 - host_spi_wire_us(&burst) / host_spi_wire_us(&legacy)));
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: panel gia lap khop framebuffer\n");
+    return EXIT_SUCCESS;
+}
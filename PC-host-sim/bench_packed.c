@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// Ảnh nén GLIB_PackedImage_t (images/*.c, sinh bằng tools/imgc.py từ
+// golden/*.pbm): vẽ ở vị trí và vùng cắt ngẫu nhiên, COPY và XOR, so từng
+// điểm ảnh với ảnh PBM gốc; chỉ các hàng ảnh nằm trong vùng cắt được gửi
+// lên panel. Sau đó so kích thước và thời gian vẽ với ảnh không nén.
+
+// ================= CẤU HÌNH =================
+#define W             128
+#define H             128
+#define FB_BYTES      (W * H / 8)
+#define TRIALS        3000
+#define RUNS          2000
+
+extern const GLIB_PackedImage_t img_splash, img_icon, img_circles, img_polygons, img_textgrid;
+
+static const struct {
+    const char *name;
+    const GLIB_PackedImage_t *image;
+    const char *pbm;
+    int x, y;               // Góc vùng cắt trong ảnh PBM (--crop của imgc.py)
+} images[] = {
+    { "splash", &img_splash, "golden/text.pbm", 0, 0 },
+    { "icon", &img_icon, "golden/bitmaps.pbm", 12, 14 },
+    { "circles", &img_circles, "golden/circles.pbm", 0, 0 },
+    { "polygons", &img_polygons, "golden/polygons.pbm", 0, 0 },
+    { "textgrid", &img_textgrid, "golden/textgrid.pbm", 0, 0 },
+};
+#define IMAGES        (sizeof(images) / sizeof(images[0]))
+
+static const char *const mode_names[] = { "raw", "packbits", "delta", "packbits+delta" };
+
+static GLIB_Context_t ctx;
+static uint8_t source[IMAGES][FB_BYTES];    // Ảnh PBM gốc, định dạng framebuffer
+
+static int pixel(const uint8_t *fb, int x, int y)
+{
+    return (fb[y * (W / 8) + (x >> 3)] >> (x & 7)) & 1;
+}
+
+static void set_clip(int x, int y, int w, int h)
+{
+    GLIB_Rectangle_t r = { x, y, x + w - 1, y + h - 1 };
+    GLIB_setClippingRegion(&ctx, &r);
+}
+
+// --- HÀM: VẼ NGẪU NHIÊN MỘT ẢNH, SO VỚI MÔ HÌNH ---
+static int random_check(int trial)
+{
+    static uint8_t before[FB_BYTES], after[FB_BYTES];
+    int i = rand() % IMAGES;
+    const GLIB_PackedImage_t *img = images[i].image;
+    int x = rand() % (W + img->width + 8) - img->width - 4;
+    int y = rand() % (H + img->height + 8) - img->height - 4;
+    // GLIB_setClippingRegion cần vùng rộng và cao ít nhất 2 điểm
+    int cx = rand() % (W - 1), cy = rand() % (H - 1);
+    int cw = 2 + rand() % (W - cx - 1), ch = 2 + rand() % (H - cy - 1);
+    int xor = rand() & 1, visible_rows = 0;
+    const uint32_t *counts;
+    void *fb;
+    EMSTATUS status;
+
+    DMD_getFrameBuffer(&fb);
+    for (int k = 0; k < FB_BYTES; k++) {
+        ((uint8_t *)fb)[k] = (uint8_t)rand();
+    }
+    memcpy(before, fb, FB_BYTES);
+    DMD_updateDisplay();
+    host_spi_reset_stats();
+
+    set_clip(cx, cy, cw, ch);
+    GLIB_setRasterOp(&ctx, xor ? GLIB_RASTER_OP_XOR : GLIB_RASTER_OP_COPY);
+    status = GLIB_drawPackedImage(&ctx, x, y, img);
+    GLIB_setRasterOp(&ctx, GLIB_RASTER_OP_COPY);
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    DMD_updateDisplay();
+    counts = host_panel_row_counts();
+    memcpy(after, fb, FB_BYTES);
+
+    for (int py = 0; py < H; py++) {
+        int row_visible = 0;
+        for (int px = 0; px < W; px++) {
+            int expect = pixel(before, px, py);
+            int ix = px - x, iy = py - y;
+            if (px >= cx && px < cx + cw && py >= cy && py < cy + ch
+                && ix >= 0 && ix < img->width && iy >= 0 && iy < img->height) {
+                int src = pixel(source[i], images[i].x + ix, images[i].y + iy);
+                expect = xor ? expect ^ src : src;
+                row_visible = 1;
+            }
+            if (pixel(after, px, py) != expect) {
+                printf("FAIL: lan %d: %s tai (%d,%d) cat (%d,%d %dx%d) %s: diem (%d,%d) sai\n", trial,
+                       images[i].name, x, y, cx, cy, cw, ch, xor ? "XOR" : "COPY", px, py);
+                return 1;
+            }
+        }
+        if (counts[py] != (uint32_t)row_visible) {
+            printf("FAIL: lan %d: %s: hang %d gui %u lan, mong doi %d\n", trial, images[i].name, py,
+                   counts[py], row_visible);
+            return 1;
+        }
+        visible_rows += row_visible;
+    }
+    if (status != (visible_rows ? GLIB_OK : GLIB_ERROR_NOTHING_TO_DRAW)) {
+        printf("FAIL: lan %d: %s: tra ve 0x%x\n", trial, images[i].name, (unsigned)status);
+        return 1;
+    }
+    return 0;
+}
+
+// --- HÀM: DỮ LIỆU HỎNG VÀ THAM SỐ SAI ---
+static int check_errors(void)
+{
+    static const uint8_t cross[] = { 0xFE, 0xAA };              // Lặp 3 byte trong hàng 1 byte
+    static const uint8_t noop[] = { 0x80, 0x00, 0x55, 0x00, 0xF0 };
+    static const uint8_t delta[] = { 0x0F, 0xFF };              // Hàng 2 = 0x0F ^ 0xFF
+    GLIB_PackedImage_t img;
+    uint8_t row[W / 8];
+    int failures = 0;
+
+    img = img_splash;
+    img.size -= 1;
+    if (GLIB_drawPackedImage(&ctx, 0, 0, &img) != GLIB_ERROR_INVALID_FILE) {
+        printf("FAIL: du lieu bi cat khong bao GLIB_ERROR_INVALID_FILE\n");
+        failures++;
+    }
+    img = img_textgrid;
+    img.size = 100;
+    if (GLIB_drawPackedImage(&ctx, 0, 0, &img) != GLIB_ERROR_INVALID_FILE
+        || GLIB_drawPackedImage(&ctx, 0, -126, &img) != GLIB_ERROR_INVALID_FILE) {
+        printf("FAIL: anh khong nen bi cat khong bao GLIB_ERROR_INVALID_FILE\n");
+        failures++;
+    }
+    // Hàng bị cắt phía dưới vùng cắt thì không cần đọc tới
+    if (GLIB_drawPackedImage(&ctx, 0, 128 - 6, &img) != GLIB_OK) {
+        printf("FAIL: doc ca hang nam ngoai vung cat\n");
+        failures++;
+    }
+
+    img = (GLIB_PackedImage_t){ 8, 1, GLIB_PACKED_IMAGE_PACKBITS, sizeof(cross), cross };
+    if (GLIB_drawPackedImage(&ctx, 0, 0, &img) != GLIB_ERROR_INVALID_FILE) {
+        printf("FAIL: doan PackBits vat sang hang sau\n");
+        failures++;
+    }
+
+    // Mã -128 bị bỏ qua; hàng 2 là hàng 1 XOR 0xF0
+    img = (GLIB_PackedImage_t){ 8, 2, GLIB_PACKED_IMAGE_PACKBITS | GLIB_PACKED_IMAGE_ROW_DELTA,
+                                sizeof(noop), noop };
+    GLIB_drawPackedImage(&ctx, 3, 7, &img);
+    DMD_readData(3, 7, row, 8);
+    DMD_readData(3, 8, row + 1, 8);
+    if (row[0] != 0x55 || row[1] != (0x55 ^ 0xF0)) {
+        printf("FAIL: ma -128 / hang delta: %02x %02x\n", row[0], row[1]);
+        failures++;
+    }
+    img = (GLIB_PackedImage_t){ 8, 2, GLIB_PACKED_IMAGE_ROW_DELTA, sizeof(delta), delta };
+    GLIB_drawPackedImage(&ctx, 3, 7, &img);
+    DMD_readData(3, 7, row, 8);
+    DMD_readData(3, 8, row + 1, 8);
+    if (row[0] != 0x0F || row[1] != 0xF0) {
+        printf("FAIL: delta khong nen: %02x %02x\n", row[0], row[1]);
+        failures++;
+    }
+
+    img = img_icon;
+    img.width = GLIB_PACKED_IMAGE_MAX_WIDTH + 1;
+    if (GLIB_drawPackedImage(&ctx, 0, 0, &img) != GLIB_ERROR_INVALID_ARGUMENT
+        || GLIB_drawPackedImage(&ctx, 0, 0, NULL) != GLIB_ERROR_INVALID_ARGUMENT
+        || GLIB_drawPackedImage(NULL, 0, 0, &img_icon) != GLIB_ERROR_INVALID_ARGUMENT) {
+        printf("FAIL: tham so sai khong bao GLIB_ERROR_INVALID_ARGUMENT\n");
+        failures++;
+    }
+    if (GLIB_drawPackedImage(&ctx, 128, 0, &img_icon) != GLIB_ERROR_NOTHING_TO_DRAW
+        || GLIB_drawPackedImage(&ctx, 0, -33, &img_icon) != GLIB_ERROR_NOTHING_TO_DRAW) {
+        printf("FAIL: anh ngoai man hinh khong bao GLIB_ERROR_NOTHING_TO_DRAW\n");
+        failures++;
+    }
+    return failures;
+}
+
+// --- HÀM: KÍCH THƯỚC VÀ THỜI GIAN VẼ ---
+static void report(void)
+{
+    static uint8_t raw[FB_BYTES];
+    uint64_t t0;
+
+    printf("%-9s %7s %-15s %8s %8s %8s %9s %9s\n", "anh", "co", "nen", "khong nen", "BMP 1bit", "nen",
+           "ns bitmap", "ns nen");
+    for (size_t i = 0; i < IMAGES; i++) {
+        const GLIB_PackedImage_t *img = images[i].image;
+        uint32_t row_bytes = (img->width + 7) / 8;
+        uint32_t bmp = 54 + 8 + (img->width + 31) / 32 * 4 * img->height;
+        double bitmap_ns = 0, packed_ns;
+
+        // GLIB_drawBitmap chỉ so được với ảnh rộng đúng 128 điểm (không đệm cuối hàng)
+        if (img->width == W) {
+            memcpy(raw, source[i], FB_BYTES);
+            t0 = host_now_ns();
+            for (int k = 0; k < RUNS; k++) {
+                GLIB_drawBitmap(&ctx, 0, 0, W, img->height, raw);
+            }
+            bitmap_ns = (double)(host_now_ns() - t0) / RUNS;
+        }
+        t0 = host_now_ns();
+        for (int k = 0; k < RUNS; k++) {
+            GLIB_drawPackedImage(&ctx, 0, 0, img);
+        }
+        packed_ns = (double)(host_now_ns() - t0) / RUNS;
+
+        printf("%-9s %3ux%-3u %-15s %8u %8u %8u %9.0f %9.0f\n", images[i].name, img->width, img->height,
+               mode_names[img->flags & 3], row_bytes * img->height, bmp, img->size, bitmap_ns,
+               packed_ns);
+    }
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+
+    for (size_t i = 0; i < IMAGES; i++) {
+        if (host_pbm_read(images[i].pbm, source[i]) != 0) {
+            printf("FAIL: khong doc duoc %s\n", images[i].pbm);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Vẽ tại (0,0), toàn màn hình: giống hệt ảnh gốc
+    for (size_t i = 0; i < IMAGES; i++) {
+        uint8_t row[W / 8];
+        GLIB_clear(&ctx);
+        GLIB_drawPackedImage(&ctx, 0, 0, images[i].image);
+        for (int y = 0; y < images[i].image->height && !failures; y++) {
+            DMD_readData(0, y, row, W);
+            for (int x = 0; x < images[i].image->width; x++) {
+                if (pixel(row, x, 0) != pixel(source[i], images[i].x + x, images[i].y + y)) {
+                    printf("FAIL: %s: diem (%d,%d) khac anh goc\n", images[i].name, x, y);
+                    failures++;
+                    break;
+                }
+            }
+        }
+    }
+
+    srand(17);
+    for (int t = 0; t < TRIALS && failures < 5; t++) {
+        failures += random_check(t);
+    }
+    failures += check_errors();
+    report();
+
+    if (host_spi_get_stats()->errors != 0) {
+        printf("FAIL: panel gia lap bao loi giao thuc\n");
+        failures++;
+    }
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: anh nen giai ma dung, cat dung vung, chi gui cac hang cua anh\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "lcd.h"
+#include "host_platform.h"
+
+// Nhiều trang màn hình: mỗi trang một framebuffer lấy từ vùng nhớ của người
+// gọi (DMD_setFramebufferPool). Kiểm tra chuyển trang chỉ đổi con trỏ và
+// panel nhận đúng trang, rồi so chi phí với cách vẽ lại cả trang.
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES      SL_MEMLCD_FRAMEBUFFER_SIZE(128, 128, 1)
+#define PAGES         3
+#define SWITCHES      3000
+#define SENSOR_TICKS  200
+
+static GLIB_Context_t ctx;
+static GLIB_TextGrid_t grid[PAGES];
+static void *page_fb[PAGES];
+
+// Vùng nhớ cho 2 trang thêm, cộng 1 byte để thử vùng nhớ không thẳng hàng
+static uint8_t pool[(PAGES - 1) * FB_BYTES + 1] __attribute__((aligned(4)));
+
+static const char *const titles[PAGES] = { "DHT20 MONITOR", "BLE GATEWAY", "STATISTICS" };
+
+// --- HÀM: VẼ NỘI DUNG MỘT TRANG (DÙNG CHO CẢ CÁCH CŨ: VẼ LẠI MỖI LẦN ĐỔI) ---
+static void draw_page(int page, uint32_t tick)
+{
+    char buf[32];
+
+    GLIB_textGridDrawLine(&grid[page], titles[page], 4, GLIB_ALIGN_CENTER, 0);
+    switch (page) {
+    case 0:
+        snprintf(buf, sizeof(buf), "Temp: %u.%02u C", 20 + tick % 7, tick * 13 % 100);
+        GLIB_textGridDrawLine(&grid[page], buf, 6, GLIB_ALIGN_LEFT, 5);
+        snprintf(buf, sizeof(buf), "Hum : %u.%02u %%", 50 + tick % 11, tick * 7 % 100);
+        GLIB_textGridDrawLine(&grid[page], buf, 7, GLIB_ALIGN_LEFT, 5);
+        break;
+    case 1:
+        GLIB_textGridDrawLine(&grid[page], "ADV : 100 ms", 6, GLIB_ALIGN_LEFT, 5);
+        GLIB_textGridDrawLine(&grid[page], "LINK: CONNECTED", 7, GLIB_ALIGN_LEFT, 5);
+        snprintf(buf, sizeof(buf), "RSSI: -%u dBm", 40 + tick % 30);
+        GLIB_textGridDrawLine(&grid[page], buf, 8, GLIB_ALIGN_LEFT, 5);
+        break;
+    default:
+        snprintf(buf, sizeof(buf), "UP  : 0:%02u:%02u", tick / 60 % 60, tick % 60);
+        GLIB_textGridDrawLine(&grid[page], buf, 6, GLIB_ALIGN_LEFT, 5);
+        snprintf(buf, sizeof(buf), "READ: %u", tick);
+        GLIB_textGridDrawLine(&grid[page], buf, 7, GLIB_ALIGN_LEFT, 5);
+        break;
+    }
+}
+
+static int check_api(void)
+{
+    void *extra, *fb0;
+    int failures = 0;
+
+    DMD_getFrameBuffer(&fb0);
+    if (DMD_allocateFramebuffer(&extra) != DMD_ERROR_NOT_ENOUGH_MEMORY) {
+        printf("FAIL: cap phat khi chua co vung nho\n");
+        failures++;
+    }
+    if (DMD_setFramebufferPool(pool, FB_BYTES - 1) != DMD_ERROR_NOT_ENOUGH_MEMORY) {
+        printf("FAIL: vung nho nho hon mot framebuffer\n");
+        failures++;
+    }
+    // Vùng nhớ bắt đầu lệch 1 byte: driver tự căn, vẫn vừa đúng 2 trang
+    if (DMD_setFramebufferPool(pool + 1, sizeof(pool) - 1) != DMD_OK) {
+        printf("FAIL: DMD_setFramebufferPool\n");
+        failures++;
+    }
+    DMD_setFramebufferPool(pool, sizeof(pool));
+    page_fb[0] = fb0;
+    for (int p = 1; p < PAGES; p++) {
+        if (DMD_allocateFramebuffer(&page_fb[p]) != DMD_OK || ((uintptr_t)page_fb[p] & 3)) {
+            printf("FAIL: cap phat trang %d\n", p);
+            failures++;
+        }
+    }
+    if (DMD_allocateFramebuffer(&extra) != DMD_ERROR_NOT_ENOUGH_MEMORY
+        || DMD_setFramebufferPool(pool, sizeof(pool)) != DMD_ERROR_BUSY
+        || DMD_selectFramebuffer(pool + 5) != DMD_ERROR_NOT_SUPPORTED
+        || DMD_freeFramebuffer(fb0) != DMD_ERROR_NOT_SUPPORTED) {
+        printf("FAIL: loi cua vung nho day / con tro la\n");
+        failures++;
+    }
+
+    // Trả lại rồi cấp phát lại được đúng chỗ đó; không trả được trang đang chọn
+    DMD_selectFramebuffer(page_fb[2]);
+    if (DMD_freeFramebuffer(page_fb[2]) != DMD_ERROR_BUSY) {
+        printf("FAIL: tra lai framebuffer dang chon\n");
+        failures++;
+    }
+    DMD_selectFramebuffer(fb0);
+    if (DMD_freeFramebuffer(page_fb[1]) != DMD_OK
+        || DMD_selectFramebuffer(page_fb[1]) != DMD_ERROR_NOT_SUPPORTED
+        || DMD_allocateFramebuffer(&extra) != DMD_OK || extra != page_fb[1]) {
+        printf("FAIL: tra lai va cap phat lai\n");
+        failures++;
+    }
+    return failures;
+}
+
+static int panel_is(int page)
+{
+    return memcmp(host_panel_memory(), page_fb[page], FB_BYTES) == 0;
+}
+
+int main(void)
+{
+    int failures = 0;
+    uint64_t t0, switch_ns = 0, redraw_ns = 0, switch_rows, redraw_rows;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+
+    failures += check_api();
+
+    // Vẽ sẵn cả 3 trang
+    for (int p = PAGES - 1; p >= 0; p--) {
+        DMD_selectFramebuffer(page_fb[p]);
+        GLIB_clear(&ctx);
+        GLIB_textGridInit(&grid[p], &ctx);
+        draw_page(p, 0);
+    }
+    DMD_updateDisplay();
+    if (!panel_is(0)) {
+        printf("FAIL: panel khong hien trang 0\n");
+        failures++;
+    }
+
+    // 1. Mỗi giây cập nhật cả 3 trang (trang ẩn cũng vẽ), thỉnh thoảng đổi trang
+    int visible = 0;
+    for (uint32_t tick = 1; tick <= SENSOR_TICKS; tick++) {
+        for (int p = 0; p < PAGES; p++) {
+            DMD_selectFramebuffer(page_fb[p]);
+            draw_page(p, tick);
+        }
+        if (tick % 7 == 0) {
+            visible = (visible + 1) % PAGES;
+        }
+        DMD_selectFramebuffer(page_fb[visible]);
+        if (tick & 1) {
+            DMD_updateDisplay();
+        } else {
+            // Bắt đầu gửi, đổi trang giữa chừng, rồi mới để ngắt chạy xong
+            DMD_updateDisplayAsync(NULL, NULL);
+            DMD_selectFramebuffer(page_fb[(visible + 1) % PAGES]);
+            host_spi_async_complete();
+            // Hết thời gian giữ SCS: panel nhận khung ở cạnh xuống
+            host_time_advance_ms(1);
+            DMD_selectFramebuffer(page_fb[visible]);
+            DMD_updateDisplay();
+        }
+        if (!panel_is(visible)) {
+            printf("FAIL: giay %u: panel khac trang %d\n", tick, visible);
+            failures++;
+            break;
+        }
+    }
+
+    // 2. Chi phí đổi trang: chỉ đổi con trỏ, so với xóa và vẽ lại cả trang
+    host_spi_reset_stats();
+    for (int k = 0; k < SWITCHES; k++) {
+        t0 = host_now_ns();
+        DMD_selectFramebuffer(page_fb[k % PAGES]);
+        DMD_updateDisplay();
+        switch_ns += host_now_ns() - t0;
+    }
+    switch_rows = host_spi_get_stats()->rows;
+
+    DMD_selectFramebuffer(page_fb[0]);
+    host_spi_reset_stats();
+    for (int k = 0; k < SWITCHES; k++) {
+        int p = k % PAGES;
+        t0 = host_now_ns();
+        GLIB_clear(&ctx);
+        GLIB_textGridInit(&grid[p], &ctx);
+        draw_page(p, SENSOR_TICKS);
+        DMD_updateDisplay();
+        redraw_ns += host_now_ns() - t0;
+    }
+    redraw_rows = host_spi_get_stats()->rows;
+
+    printf("%-22s %12s %12s\n", "doi trang", "ns/lan", "hang/lan");
+    printf("%-22s %12.0f %12.1f\n", "xoa + ve lai ca trang", (double)redraw_ns / SWITCHES,
+           (double)redraw_rows / SWITCHES);
+    printf("%-22s %12.0f %12.1f\n", "chon framebuffer", (double)switch_ns / SWITCHES,
+           (double)switch_rows / SWITCHES);
+    printf("RAM: %u byte cho %d trang them (vung nho cua nguoi goi)\n",
+           (unsigned)sizeof(pool), PAGES - 1);
+
+    if (host_spi_get_stats()->errors != 0) {
+        printf("FAIL: panel gia lap bao loi giao thuc\n");
+        failures++;
+    }
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: doi trang chi gui cac hang khac, panel dung trang dang chon\n");
+    return EXIT_SUCCESS;
+}
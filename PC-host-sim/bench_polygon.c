@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES      (128 * 128 / 8)
+#define MAX_POINTS    1024
+#define CHART_POINTS  400
+#define RANDOM_POLYS  3000
+
+static GLIB_Context_t ctx;
+static GLIB_PolygonEdge_t scratch[MAX_POINTS];
+
+// --- HÀM: BỘ TÔ CŨ (FLOAT, THỬ MỌI CẠNH TRÊN MỌI HÀNG, TỐI ĐA 64 ĐIỂM) ---
+static void ref_old(GLIB_Context_t *c, uint32_t n, const int32_t *p)
+{
+    int32_t min_y = p[1], max_y = p[1];
+    int32_t cross_x[64];
+
+    for (uint32_t i = 1; i < n; i++) {
+        min_y = p[2 * i + 1] < min_y ? p[2 * i + 1] : min_y;
+        max_y = p[2 * i + 1] > max_y ? p[2 * i + 1] : max_y;
+    }
+    min_y = min_y < c->clippingRegion.yMin ? c->clippingRegion.yMin : min_y;
+    max_y = max_y > c->clippingRegion.yMax ? c->clippingRegion.yMax : max_y;
+
+    for (int32_t y = min_y; y < max_y; y++) {
+        size_t nc = 0, j = n - 1;
+        for (size_t i = 0; i < n; i++) {
+            int32_t cy = p[i * 2 + 1], py = p[j * 2 + 1];
+            if ((cy < y && py >= y) || (py < y && cy >= y)) {
+                cross_x[nc++] = (int)(p[i * 2] + (y - cy) / (float)(py - cy)
+                                      * (float)(p[j * 2] - p[i * 2]));
+            }
+            j = i;
+        }
+        for (size_t i = 0; i < nc; i += 2) {
+            GLIB_drawLineH(c, cross_x[i], y, cross_x[i + 1]);
+        }
+    }
+}
+
+static int64_t floor_div(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+static int cmp_int(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// --- HÀM: MẪU CHÍNH XÁC, TÍNH THẲNG TỪNG HÀNG BẰNG SỐ NGUYÊN ---
+// Cùng quy ước với bộ tô mới: cạnh cắt các hàng (y trên, y dưới], giao điểm
+// làm tròn xuống, tô theo cặp sau khi sắp xếp (even-odd)
+static void ref_exact(GLIB_Context_t *c, uint32_t n, const int32_t *p)
+{
+    static int32_t cross_x[MAX_POINTS];
+    int32_t min_y = p[1], max_y = p[1];
+
+    for (uint32_t i = 1; i < n; i++) {
+        min_y = p[2 * i + 1] < min_y ? p[2 * i + 1] : min_y;
+        max_y = p[2 * i + 1] > max_y ? p[2 * i + 1] : max_y;
+    }
+    min_y = min_y + 1 < c->clippingRegion.yMin ? c->clippingRegion.yMin : min_y + 1;
+    max_y = max_y - 1 > c->clippingRegion.yMax ? c->clippingRegion.yMax : max_y - 1;
+
+    for (int32_t y = min_y; y <= max_y; y++) {
+        size_t nc = 0, j = n - 1;
+        for (size_t i = 0; i < n; i++) {
+            int32_t x0 = p[j * 2], y0 = p[j * 2 + 1], x1 = p[i * 2], y1 = p[i * 2 + 1];
+            if (y0 > y1) {
+                int32_t t = x0; x0 = x1; x1 = t;
+                t = y0; y0 = y1; y1 = t;
+            }
+            if (y0 < y && y <= y1) {
+                cross_x[nc++] = x0 + (int32_t)floor_div((int64_t)(y - y0) * (x1 - x0), y1 - y0);
+            }
+            j = i;
+        }
+        qsort(cross_x, nc, sizeof(cross_x[0]), cmp_int);
+        for (size_t i = 0; i + 1 < nc; i += 2) {
+            GLIB_drawLineH(c, cross_x[i], y, cross_x[i + 1]);
+        }
+    }
+}
+
+static void new_fill(GLIB_Context_t *c, uint32_t n, const int32_t *p)
+{
+    GLIB_drawPolygonFilledEx(c, n, p, scratch, MAX_POINTS);
+}
+
+typedef void (*fill_fn_t)(GLIB_Context_t *, uint32_t, const int32_t *);
+
+static uint8_t *render(fill_fn_t fill, uint32_t n, const int32_t *p, uint8_t *out)
+{
+    void *fb;
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    GLIB_clear(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    fill(&ctx, n, p);
+    DMD_getFrameBuffer(&fb);
+    memcpy(out, fb, FB_BYTES);
+    return out;
+}
+
+static int count_diff(const uint8_t *a, const uint8_t *b, int *black)
+{
+    int d = 0;
+    *black = 0;
+    for (int i = 0; i < FB_BYTES; i++) {
+        d += __builtin_popcount(a[i] ^ b[i]);
+        *black += 8 - __builtin_popcount(a[i]);
+    }
+    return d;
+}
+
+// Đa giác lồi trong màn hình: các điểm trên một elip, theo góc tăng dần
+static uint32_t make_convex(int32_t *p)
+{
+    uint32_t n = 3 + (uint32_t)rand() % 14;
+    int32_t cx = 20 + rand() % 88, cy = 20 + rand() % 88;
+    int32_t rx = 3 + rand() % 18, ry = 3 + rand() % 18;
+    static const int16_t cosv[16] = { 100, 92, 71, 38, 0, -38, -71, -92, -100, -92, -71, -38, 0, 38, 71, 92 };
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t k = i * 16 / n;
+        p[2 * i] = cx + rx * cosv[k] / 100;
+        p[2 * i + 1] = cy + ry * cosv[(k + 12) % 16] / 100;
+    }
+    return n;
+}
+
+// Đa giác bất kỳ, có thể tự cắt, một phần ra ngoài màn hình
+static uint32_t make_random(int32_t *p)
+{
+    uint32_t n = 3 + (uint32_t)rand() % 30;
+    for (uint32_t i = 0; i < n; i++) {
+        p[2 * i] = rand() % 200 - 36;
+        p[2 * i + 1] = rand() % 200 - 36;
+    }
+    return n;
+}
+
+// Biểu đồ vùng: đường nhiệt độ rồi quay về đáy
+static uint32_t make_chart(int32_t *p, uint32_t samples, int seed)
+{
+    int32_t v = 60;
+    srand((unsigned)seed);
+    for (uint32_t i = 0; i < samples; i++) {
+        v += rand() % 7 - 3;
+        v = v < 5 ? 5 : (v > 120 ? 120 : v);
+        p[2 * i] = 2 + (int32_t)(i * 124 / samples);
+        p[2 * i + 1] = v;
+    }
+    p[2 * samples] = 126;
+    p[2 * samples + 1] = 125;
+    p[2 * samples + 2] = 2;
+    p[2 * samples + 3] = 125;
+    return samples + 2;
+}
+
+static double polys_per_sec(fill_fn_t fill, uint32_t n, const int32_t *p, int rounds)
+{
+    uint64_t t0 = host_now_ns();
+    for (int r = 0; r < rounds; r++) {
+        ctx.foregroundColor = (r & 1) ? White : Black;
+        fill(&ctx, n, p);
+    }
+    return rounds / ((host_now_ns() - t0) / 1e9);
+}
+
+int main(void)
+{
+    static int32_t pts[2 * (MAX_POINTS + 2)];
+    static uint8_t a[FB_BYTES], b[FB_BYTES];
+    static const GLIB_Rectangle_t clip = { 9, 17, 111, 100 };
+    int failures = 0;
+    long old_diff = 0, old_black = 0;
+    uint32_t n;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    srand(5);
+
+    // 1. Đa giác lồi: so với bộ tô cũ và với mẫu chính xác
+    for (int k = 0; k < RANDOM_POLYS; k++) {
+        int black;
+        n = make_convex(pts);
+        render(new_fill, n, pts, a);
+        render(ref_exact, n, pts, b);
+        if (memcmp(a, b, FB_BYTES) != 0) {
+            printf("FAIL: da giac loi %d khac mau chinh xac\n", k);
+            failures++;
+        }
+        render(ref_old, n, pts, b);
+        old_diff += count_diff(b, a, &black);
+        old_black += black;
+    }
+    printf("da giac loi: %ld/%ld diem anh khac bo to cu (%.3f%%, do lam tron float)\n",
+           old_diff, old_black, 100.0 * old_diff / old_black);
+    if (old_diff * 200 > old_black) {
+        printf("FAIL: do phu khac bo to cu qua nhieu\n");
+        failures++;
+    }
+
+    // 2. Đa giác tự cắt, ra ngoài màn hình, có và không có vùng cắt
+    for (int k = 0; k < RANDOM_POLYS; k++) {
+        n = make_random(pts);
+        if (k & 1) {
+            GLIB_setClippingRegion(&ctx, &clip);
+        } else {
+            GLIB_resetClippingRegion(&ctx);
+        }
+        GLIB_applyClippingRegion(&ctx);
+        render(new_fill, n, pts, a);
+        render(ref_exact, n, pts, b);
+        if (memcmp(a, b, FB_BYTES) != 0) {
+            printf("FAIL: da giac ngau nhien %d (%u diem) khac mau chinh xac\n", k, n);
+            failures++;
+        }
+    }
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+
+    // 3. Biểu đồ vùng nhiều đỉnh, vượt giới hạn 64 điểm của bộ tô cũ
+    for (int k = 0; k < 20; k++) {
+        n = make_chart(pts, CHART_POINTS + (uint32_t)k * 30, k);
+        render(new_fill, n, pts, a);
+        render(ref_exact, n, pts, b);
+        if (memcmp(a, b, FB_BYTES) != 0) {
+            printf("FAIL: bieu do %u diem khac mau chinh xac\n", n);
+            failures++;
+        }
+    }
+    if (GLIB_drawPolygonFilled(&ctx, n, pts) != GLIB_ERROR_INVALID_ARGUMENT
+        || GLIB_drawPolygonFilledEx(&ctx, n, pts, scratch, n - 1) != GLIB_ERROR_OUT_OF_MEMORY) {
+        printf("FAIL: kiem tra kich thuoc bang canh\n");
+        failures++;
+    }
+
+    // 4. Tốc độ
+    printf("%-22s %14s %14s %8s\n", "polygon", "old polys/s", "new polys/s", "speedup");
+    srand(9);
+    n = make_convex(pts);
+    while (n < 12) {
+        n = make_convex(pts);
+    }
+    double o = polys_per_sec(ref_old, n, pts, 100000);
+    double w = polys_per_sec(new_fill, n, pts, 100000);
+    printf("convex %-2u diem          %14.0f %14.0f %7.1fx\n", n, o, w, w / o);
+    n = make_chart(pts, 62, 1);
+    o = polys_per_sec(ref_old, n, pts, 20000);
+    w = polys_per_sec(new_fill, n, pts, 20000);
+    printf("bieu do %-3u diem        %14.0f %14.0f %7.1fx\n", n, o, w, w / o);
+    n = make_chart(pts, CHART_POINTS, 1);
+    o = polys_per_sec(ref_exact, n, pts, 500);
+    w = polys_per_sec(new_fill, n, pts, 500);
+    printf("bieu do %-3u diem (mau) %14.0f %14.0f %7.1fx\n", n, o, w, w / o);
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: bo to bang canh hoat dong khop mau chinh xac\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// Thời gian CPU cho từng loại hàm vẽ (ns/lần gọi) trên PC, để so trước/sau
+// mỗi lần tối ưu. DMD_updateDisplay được đo cả phần đóng gói lẫn lcd_tx giả
+// lập, không tính thời gian trên dây SPI (xem bench_lcd_tx).
+
+// ================= CẤU HÌNH =================
+#define MIN_RUN_NS    20000000ull   // Mỗi phép đo chạy ít nhất 20 ms
+#define BATCH         64
+
+static GLIB_Context_t ctx;
+static uint32_t seq;
+
+// --- HÀM: CÁC PHÉP VẼ, MỖI LẦN GỌI ĐỔI VỊ TRÍ/MÀU MỘT CHÚT ---
+static void op_string(void)
+{
+    static const char s[] = "Temp 23.5C Hum 61%";
+    GLIB_drawString(&ctx, s, sizeof(s) - 1, (int32_t)(seq & 7), (int32_t)(seq % 120), true);
+}
+
+static void op_char_16x20(void)
+{
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNumber16x20);
+    GLIB_drawChar(&ctx, (char)('0' + seq % 10), (int32_t)(seq % 112), (int32_t)(seq % 108), true);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+}
+
+static void op_line_h(void)
+{
+    GLIB_drawLineH(&ctx, (int32_t)(seq & 15), (int32_t)(seq & 127), 120);
+}
+
+static void op_line_diag(void)
+{
+    GLIB_drawLine(&ctx, 0, (int32_t)(seq & 63), 127, 127 - (int32_t)(seq & 63));
+}
+
+static void op_circle(void)
+{
+    GLIB_drawCircle(&ctx, 64, 64, 10 + seq % 40);
+}
+
+static void op_circle_filled(void)
+{
+    GLIB_drawCircleFilled(&ctx, 64, 64, 10 + seq % 40);
+}
+
+static void op_rect_filled(void)
+{
+    GLIB_Rectangle_t r = { (int32_t)(seq & 7), 10, 100 + (int32_t)(seq & 7), 70 };
+    GLIB_drawRectFilled(&ctx, &r);
+}
+
+static void op_polygon_filled(void)
+{
+    int32_t o = (int32_t)(seq & 15);
+    int32_t p[] = { 30 + o, 5, 90, 20 + o, 110, 70, 60, 120 - o, 10, 90, 5 + o, 40 };
+    GLIB_drawPolygonFilled(&ctx, 6, p);
+}
+
+static void op_bitmap(void)
+{
+    static uint8_t pic[32 * 32 / 8];
+    GLIB_drawBitmap(&ctx, 3 + (int32_t)(seq % 90), 7, 32, 32, pic);
+}
+
+static void op_update_full(void)
+{
+    // Đảo toàn bộ màn hình để mọi hàng đều đổi
+    ctx.backgroundColor = (seq & 1) ? White : Black;
+    GLIB_clear(&ctx);
+    DMD_updateDisplay();
+}
+
+static void op_update_line(void)
+{
+    // Một dòng chữ 8 hàng đổi nội dung
+    char s[4] = { (char)('0' + seq % 10), (char)('0' + seq / 10 % 10), 'C', 0 };
+    GLIB_drawString(&ctx, s, 3, 40, 60, true);
+    DMD_updateDisplay();
+}
+
+typedef struct {
+    const char *name;
+    void (*op)(void);
+} prim_t;
+
+static const prim_t prims[] = {
+    { "drawString 18 ky tu",   op_string },
+    { "drawChar 16x20",        op_char_16x20 },
+    { "drawLineH 110px",       op_line_h },
+    { "drawLine cheo",         op_line_diag },
+    { "drawCircle",            op_circle },
+    { "drawCircleFilled",      op_circle_filled },
+    { "drawRectFilled",        op_rect_filled },
+    { "drawPolygonFilled 6",   op_polygon_filled },
+    { "drawBitmap 32x32",      op_bitmap },
+    { "clear+update 128 hang", op_update_full },
+    { "updateDisplay 1 dong",  op_update_line },
+};
+
+// --- HÀM: ĐO ns/LẦN GỌI, LẶP THEO LÔ CHO ĐẾN KHI ĐỦ THỜI GIAN ---
+static double ns_per_op(void (*op)(void), uint64_t *count)
+{
+    uint64_t n = 0, t0 = host_now_ns(), t;
+
+    do {
+        for (int i = 0; i < BATCH; i++, seq++) {
+            op();
+        }
+        n += BATCH;
+        t = host_now_ns() - t0;
+    } while (t < MIN_RUN_NS);
+    *count = n;
+    return (double)t / (double)n;
+}
+
+int main(void)
+{
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+
+    printf("%-24s %12s %10s\n", "primitive", "ns/op", "lan goi");
+    for (size_t i = 0; i < sizeof(prims) / sizeof(prims[0]); i++) {
+        uint64_t n;
+        ctx.backgroundColor = White;
+        ctx.foregroundColor = Black;
+        GLIB_clear(&ctx);
+        DMD_updateDisplay();
+        double ns = ns_per_op(prims[i].op, &n);
+        printf("%-24s %12.1f %10llu\n", prims[i].name, ns, (unsigned long long)n);
+    }
+
+    if (host_spi_get_stats()->errors != 0) {
+        printf("FAIL: panel gia lap bao loi giao thuc\n");
+        return EXIT_FAILURE;
+    }
+    printf("OK: do xong %zu loai ham ve\n", sizeof(prims) / sizeof(prims[0]));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,380 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// Phép raster (COPY/OR/AND NOT/XOR) trong các đường ghi của DMD và
+// DMD_readData. So từng điểm ảnh với mô hình đơn giản, rồi kiểm tra lớp phủ
+// XOR: vẽ hai lần trả lại đúng framebuffer cũ, chỉ gửi các hàng của nó.
+
+// ================= CẤU HÌNH =================
+#define W             128
+#define H             128
+#define FB_BYTES      (W * H / 8)
+#define TRIALS        4000
+#define READS         2000
+#define TOGGLES       20000
+
+static GLIB_Context_t ctx;
+static uint8_t model[H][W];        // Mô hình: 1 điểm ảnh một byte, 1 = trắng
+static int clip_x, clip_y, clip_w, clip_h;
+
+static const char *const op_names[] = { "COPY", "OR", "AND_NOT", "XOR" };
+
+// --- HÀM: ĐỌC MỘT ĐIỂM ẢNH CỦA FRAMEBUFFER ---
+static int fb_pixel(const uint8_t *fb, int x, int y)
+{
+    return (fb[y * (W / 8) + (x >> 3)] >> (x & 7)) & 1;
+}
+
+// --- HÀM: ÁP PHÉP RASTER VÀO MỘT ĐIỂM CỦA MÔ HÌNH ---
+static void model_put(DMD_RasterOp op, int x, int y, int src)
+{
+    switch (op) {
+    case DMD_RASTER_OP_OR:      model[y][x] |= src; break;
+    case DMD_RASTER_OP_AND_NOT: model[y][x] &= !src; break;
+    case DMD_RASTER_OP_XOR:     model[y][x] ^= src; break;
+    default:                    model[y][x] = src; break;
+    }
+}
+
+static int in_clip(int x, int y)
+{
+    return x >= clip_x && x < clip_x + clip_w && y >= clip_y && y < clip_y + clip_h;
+}
+
+static void random_clip(void)
+{
+    clip_x = rand() % W;
+    clip_y = rand() % H;
+    clip_w = 1 + rand() % (W - clip_x);
+    clip_h = 1 + rand() % (H - clip_y);
+    DMD_setClippingArea(clip_x, clip_y, clip_w, clip_h);
+}
+
+// --- HÀM: MỘT LẦN GHI NGẪU NHIÊN QUA DMD VÀ QUA MÔ HÌNH ---
+static void random_write(DMD_RasterOp op)
+{
+    int kind = rand() % 4;
+    int src = rand() & 1;
+
+    if (kind == 0) {
+        // DMD_writeColor: tọa độ tương đối vùng cắt
+        int x = rand() % clip_w, y = rand() % clip_h;
+        int n = 1 + rand() % ((clip_h - y) * clip_w - x);
+        DMD_writeColor(x, y, 0, src ? 0xFF : 0, 0, n);
+        for (int i = 0; i < n; i++) {
+            int p = y * clip_w + x + i;
+            model_put(op, clip_x + p % clip_w, clip_y + p / clip_w, src);
+        }
+    } else if (kind == 1) {
+        // DMD_writeData: dữ liệu ngẫu nhiên, tọa độ tương đối vùng cắt
+        static uint8_t data[FB_BYTES];
+        int x = rand() % clip_w, y = rand() % clip_h;
+        int n = 1 + rand() % ((clip_h - y) * clip_w - x);
+        for (int i = 0; i < (n + 7) / 8; i++) {
+            data[i] = (uint8_t)rand();
+        }
+        DMD_writeData(x, y, data, n);
+        for (int i = 0; i < n; i++) {
+            int p = y * clip_w + x + i;
+            model_put(op, clip_x + p % clip_w, clip_y + p / clip_w, (data[i >> 3] >> (i & 7)) & 1);
+        }
+    } else if (kind == 2) {
+        // DMD_writeRowMask: tọa độ màn hình, có thể lệch ra ngoài vùng cắt
+        int x = rand() % (W + 40) - 20, y = clip_y + rand() % clip_h;
+        uint32_t pixels = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        uint32_t mask = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        DMD_writeRowMask(x, y, pixels, mask);
+        for (int i = 0; i < 32; i++) {
+            if (((mask >> i) & 1) && in_clip(x + i, y)) {
+                model_put(op, x + i, y, (pixels >> i) & 1);
+            }
+        }
+    } else {
+        // DMD_fillSpans: vài đoạn ngang, đầu mút theo thứ tự bất kỳ
+        DMD_Span spans[4];
+        for (int s = 0; s < 4; s++) {
+            spans[s].y = rand() % (H + 8) - 4;
+            spans[s].x0 = rand() % (W + 40) - 20;
+            spans[s].x1 = rand() % (W + 40) - 20;
+        }
+        DMD_fillSpans(spans, 4, 0, src ? 0xFF : 0, 0);
+        for (int s = 0; s < 4; s++) {
+            int a = spans[s].x0 < spans[s].x1 ? spans[s].x0 : spans[s].x1;
+            int b = spans[s].x0 < spans[s].x1 ? spans[s].x1 : spans[s].x0;
+            for (int x = a; x <= b; x++) {
+                if (in_clip(x, spans[s].y)) {
+                    model_put(op, x, spans[s].y, src);
+                }
+            }
+        }
+    }
+}
+
+static int compare_model(const char *what)
+{
+    void *fb;
+
+    DMD_getFrameBuffer(&fb);
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            if (fb_pixel(fb, x, y) != model[y][x]) {
+                printf("FAIL: %s: diem (%d,%d) = %d, mong doi %d\n", what, x, y,
+                       fb_pixel(fb, x, y), model[y][x]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// --- KIỂM TRA 1: MỖI PHÉP RASTER TRÊN CẢ BỐN ĐƯỜNG GHI ---
+static int check_ops(void)
+{
+    int failures = 0;
+
+    srand(13);
+    for (int op = DMD_RASTER_OP_COPY; op <= DMD_RASTER_OP_XOR; op++) {
+        // Nền ngẫu nhiên vẽ bằng COPY
+        DMD_setRasterOp(DMD_RASTER_OP_COPY);
+        DMD_setClippingArea(0, 0, W, H);
+        clip_x = clip_y = 0;
+        clip_w = W;
+        clip_h = H;
+        for (int i = 0; i < 200; i++) {
+            random_write(DMD_RASTER_OP_COPY);
+        }
+
+        DMD_setRasterOp((DMD_RasterOp)op);
+        for (int t = 0; t < TRIALS; t++) {
+            if (t % 16 == 0) {
+                random_clip();
+            }
+            random_write((DMD_RasterOp)op);
+        }
+        if (compare_model(op_names[op])) {
+            failures++;
+        }
+    }
+    DMD_setRasterOp(DMD_RASTER_OP_COPY);
+    DMD_setClippingArea(0, 0, W, H);
+
+    if (DMD_setRasterOp((DMD_RasterOp)7) != DMD_ERROR_NOT_SUPPORTED
+        || GLIB_setRasterOp(&ctx, (GLIB_RasterOp_t)7) != GLIB_ERROR_INVALID_ARGUMENT) {
+        printf("FAIL: phep raster khong hop le van duoc nhan\n");
+        failures++;
+    }
+    return failures;
+}
+
+// --- KIỂM TRA 2: DMD_readData ĐỌC LẠI ĐÚNG ĐỊNH DẠNG CỦA DMD_writeData ---
+static int check_read(void)
+{
+    static uint8_t data[FB_BYTES + 1];
+
+    srand(29);
+    for (int t = 0; t < READS; t++) {
+        random_clip();
+        int x = rand() % clip_w, y = rand() % clip_h;
+        int n = 1 + rand() % ((clip_h - y) * clip_w - x);
+        memset(data, 0xA5, sizeof(data));
+        if (DMD_readData(x, y, data, n) != DMD_OK) {
+            printf("FAIL: DMD_readData tra loi\n");
+            return 1;
+        }
+        for (int i = 0; i < n; i++) {
+            int p = y * clip_w + x + i;
+            if (((data[i >> 3] >> (i & 7)) & 1) != model[clip_y + p / clip_w][clip_x + p % clip_w]) {
+                printf("FAIL: DMD_readData diem %d cua lan %d\n", i, t);
+                return 1;
+            }
+        }
+        // Các bit sau điểm cuối giữ nguyên
+        for (int i = n; i < (n + 7) / 8 * 8; i++) {
+            if (((data[i >> 3] >> (i & 7)) & 1) != ((0xA5 >> (i & 7)) & 1)) {
+                printf("FAIL: DMD_readData ghi qua diem cuoi\n");
+                return 1;
+            }
+        }
+        if (data[(n + 7) / 8] != 0xA5) {
+            printf("FAIL: DMD_readData ghi qua byte cuoi\n");
+            return 1;
+        }
+        // Đọc rồi ghi lại nguyên vẹn
+        void *fb;
+        static uint8_t before[FB_BYTES];
+        DMD_getFrameBuffer(&fb);
+        memcpy(before, fb, FB_BYTES);
+        DMD_writeData(x, y, data, n);
+        if (memcmp(before, fb, FB_BYTES) != 0) {
+            printf("FAIL: ghi lai du lieu vua doc lam doi framebuffer\n");
+            return 1;
+        }
+    }
+
+    DMD_setClippingArea(10, 10, 20, 20);
+    if (DMD_readData(5, 19, data, 16) != DMD_ERROR_TOO_MUCH_DATA) {
+        printf("FAIL: DMD_readData vuot qua vung cat\n");
+        return 1;
+    }
+    DMD_setClippingArea(0, 0, W, H);
+    return 0;
+}
+
+// --- HÀM: VẼ NỘI DUNG CHỮ, DÙNG CHO CẢ CÁCH CŨ: VẼ LẠI DÒNG ĐỂ ĐẢO MÀU ---
+static void draw_scene(void)
+{
+    GLIB_clear(&ctx);
+    GLIB_drawString(&ctx, "DHT20 MONITOR", 13, 25, 0, true);
+    GLIB_drawString(&ctx, "Temp: 36.12 C", 13, 5, 60, true);
+    GLIB_drawString(&ctx, "Hum : 61.50 %", 13, 5, 70, true);
+}
+
+static void draw_line_inverted(int inverted)
+{
+    GLIB_Rectangle_t line = { 2, 59, 125, 68 };
+
+    ctx.backgroundColor = inverted ? Black : White;
+    ctx.foregroundColor = inverted ? White : Black;
+    GLIB_setClippingRegion(&ctx, &line);
+    GLIB_clearRegion(&ctx);
+    GLIB_drawString(&ctx, "Temp: 36.12 C", 13, 5, 60, true);
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+}
+
+// --- KIỂM TRA 3: LỚP PHỦ XOR BẬT/TẮT KHÔNG CẦN VẼ LẠI ---
+static void toggle_overlay(const GLIB_Rectangle_t *r)
+{
+    GLIB_setRasterOp(&ctx, GLIB_RASTER_OP_XOR);
+    ctx.foregroundColor = White;
+    GLIB_drawRectFilled(&ctx, r);
+    ctx.foregroundColor = Black;
+    GLIB_setRasterOp(&ctx, GLIB_RASTER_OP_COPY);
+}
+
+static int check_overlay(void)
+{
+    static uint8_t before[FB_BYTES], inverted[FB_BYTES];
+    const GLIB_Rectangle_t r = { 2, 59, 125, 68 };
+    const uint32_t rect_rows = r.yMax - r.yMin + 1;
+    int failures = 0;
+    void *fb;
+
+    DMD_getFrameBuffer(&fb);
+    draw_scene();
+    DMD_updateDisplay();
+    memcpy(before, fb, FB_BYTES);
+
+    host_spi_reset_stats();
+    toggle_overlay(&r);
+    DMD_updateDisplay();
+    memcpy(inverted, fb, FB_BYTES);
+    if (host_spi_get_stats()->rows != rect_rows) {
+        printf("FAIL: bat lop phu gui %u hang, mong doi %u\n",
+               (unsigned)host_spi_get_stats()->rows, (unsigned)rect_rows);
+        failures++;
+    }
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            int inside = x >= r.xMin && x <= r.xMax && y >= r.yMin && y <= r.yMax;
+            if (fb_pixel(inverted, x, y) != (fb_pixel(before, x, y) ^ inside)) {
+                printf("FAIL: lop phu khong dao dung diem (%d,%d)\n", x, y);
+                return failures + 1;
+            }
+        }
+    }
+
+    // Nền đảo màu giống hệt vẽ lại dòng chữ với màu đảo
+    draw_line_inverted(1);
+    if (memcmp(inverted, fb, FB_BYTES) != 0) {
+        printf("FAIL: XOR khac voi ve lai dong chu dao mau\n");
+        failures++;
+    }
+    memcpy(fb, inverted, FB_BYTES);
+
+    host_spi_reset_stats();
+    toggle_overlay(&r);
+    DMD_updateDisplay();
+    if (host_spi_get_stats()->rows != rect_rows || memcmp(before, fb, FB_BYTES) != 0
+        || memcmp(before, host_panel_memory(), FB_BYTES) != 0) {
+        printf("FAIL: tat lop phu khong tra lai man hinh cu\n");
+        failures++;
+    }
+
+    // GLIB_clear luôn thay điểm ảnh, kể cả khi context đang ở XOR
+    GLIB_setRasterOp(&ctx, GLIB_RASTER_OP_XOR);
+    GLIB_clear(&ctx);
+    GLIB_setRasterOp(&ctx, GLIB_RASTER_OP_COPY);
+    for (int i = 0; i < FB_BYTES; i++) {
+        if (((uint8_t *)fb)[i] != 0xFF) {
+            printf("FAIL: GLIB_clear bi anh huong boi XOR\n");
+            failures++;
+            break;
+        }
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = 0;
+    uint64_t t0, xor_ns, redraw_ns, xor_rows, redraw_rows;
+    const GLIB_Rectangle_t r = { 2, 59, 125, 68 };
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+
+    failures += check_ops();
+    failures += check_read();
+    failures += check_overlay();
+
+    // Chi phí nhấp nháy một dòng: XOR hình chữ nhật so với vẽ lại dòng chữ
+    draw_scene();
+    DMD_updateDisplay();
+    host_spi_reset_stats();
+    t0 = host_now_ns();
+    for (int k = 0; k < TOGGLES; k++) {
+        toggle_overlay(&r);
+        DMD_updateDisplay();
+    }
+    xor_ns = host_now_ns() - t0;
+    xor_rows = host_spi_get_stats()->rows;
+
+    draw_scene();
+    DMD_updateDisplay();
+    host_spi_reset_stats();
+    t0 = host_now_ns();
+    for (int k = 0; k < TOGGLES; k++) {
+        draw_line_inverted(!(k & 1));
+        DMD_updateDisplay();
+    }
+    redraw_ns = host_now_ns() - t0;
+    redraw_rows = host_spi_get_stats()->rows;
+
+    printf("%-24s %12s %12s\n", "dao mau dong nhiet do", "ns/lan", "hang/lan");
+    printf("%-24s %12.0f %12.1f\n", "ve lai dong chu", (double)redraw_ns / TOGGLES,
+           (double)redraw_rows / TOGGLES);
+    printf("%-24s %12.0f %12.1f\n", "XOR hinh chu nhat", (double)xor_ns / TOGGLES,
+           (double)xor_rows / TOGGLES);
+
+    if (host_spi_get_stats()->errors != 0) {
+        printf("FAIL: panel gia lap bao loi giao thuc\n");
+        failures++;
+    }
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: 4 phep raster khop mo hinh, DMD_readData dung, XOR hai lan tra lai man hinh\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES   (128 * 128 / 8)
+
+static GLIB_Context_t ctx;
+static int done_count;
+static int failures;
+
+static void on_done(void *context)
+{
+    (void)context;
+    done_count++;
+}
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// "Ngắt" TXC rồi chờ hết thời gian giữ SCS: panel nhận khung ở cạnh xuống
+static void tx_complete(void)
+{
+    host_spi_async_complete();
+    host_time_advance_ms(1);
+}
+
+static void draw_screen(const char *temp)
+{
+    GLIB_clear(&ctx);
+    GLIB_drawStringOnLine(&ctx, "DHT20 MONITOR", 4, GLIB_ALIGN_CENTER, 0, 0, true);
+    GLIB_drawStringOnLine(&ctx, temp, 6, GLIB_ALIGN_LEFT, 5, 0, true);
+}
+
+int main(void)
+{
+    static uint8_t frame_a[FB_BYTES];
+    void *fb;
+    uint64_t t0, t_async, t_sync;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    DMD_getFrameBuffer(&fb);
+
+    // 1. Gửi khung A, hàm trả về ngay, panel chưa đổi
+    draw_screen("Temp: 25.12 C");
+    memcpy(frame_a, fb, FB_BYTES);
+    host_spi_reset_stats();
+    t0 = host_now_ns();
+    check(DMD_updateDisplayAsync(on_done, NULL) == DMD_OK, "bat dau khung A");
+    t_async = host_now_ns() - t0;
+    check(host_spi_async_pending(), "khung A dang truyen");
+    check(done_count == 0, "callback chua duoc goi");
+
+    // 2. Vẽ tiếp khung B trong lúc khung A còn đang truyền
+    draw_screen("Temp: 26.50 C");
+    check(DMD_updateDisplayAsync(on_done, NULL) == DMD_ERROR_BUSY, "khung B bi tu choi khi ban");
+
+    // 3. "Ngắt" TXC: panel phải nhận đúng khung A, không lẫn nét vẽ của B.
+    // SCS còn giữ mức cao tới khi timer hết thời gian giữ
+    host_spi_async_complete();
+    check(done_count == 1, "callback khung A");
+    check(host_spi_get_stats()->cs_windows == 1 && host_spi_get_stats()->cs_toggles == 1,
+          "SCS chi ha sau thoi gian giu");
+    host_time_advance_ms(1);
+    check(host_spi_get_stats()->cs_toggles == 2, "timer khong ha SCS");
+    check(memcmp(host_panel_memory(), frame_a, FB_BYTES) == 0, "panel = khung A");
+    check(host_spi_get_stats()->errors == 0, "giao thuc khung A");
+
+    // 4. Gửi những gì đã vẽ cho khung B trong lúc chờ
+    host_spi_reset_stats();
+    check(DMD_updateDisplayAsync(on_done, NULL) == DMD_OK, "bat dau khung B");
+    tx_complete();
+    check(done_count == 2, "callback khung B");
+    check(memcmp(host_panel_memory(), fb, FB_BYTES) == 0, "panel = khung B");
+    printf("khung B: %llu hang, %llu byte, 1 lan truyen bang ngat\n",
+           (unsigned long long)host_spi_get_stats()->rows,
+           (unsigned long long)host_spi_get_stats()->bytes);
+
+    // 5. Không có hàng dirty: callback được gọi ngay
+    check(DMD_updateDisplayAsync(on_done, NULL) == DMD_OK && done_count == 3
+          && !host_spi_async_pending(), "khong co gi de gui");
+
+    // 6. Cập nhật đồng bộ khi còn truyền dở: driver chờ xong rồi mới gửi
+    draw_screen("Temp: 27.00 C");
+    DMD_updateDisplayAsync(on_done, NULL);
+    draw_screen("Temp: 28.25 C");
+    t0 = host_now_ns();
+    DMD_updateDisplay();
+    t_sync = host_now_ns() - t0;
+    check(done_count == 4, "callback truoc khi gui dong bo");
+    check(memcmp(host_panel_memory(), fb, FB_BYTES) == 0, "panel sau cap nhat dong bo");
+    check(host_spi_get_stats()->errors == 0, "giao thuc cap nhat dong bo");
+
+    // Cả màn hình: CPU bị chặn bao lâu trên board. Đảo màu nền để mọi hàng
+    // đều khác bản đã gửi
+    ctx.backgroundColor = Black;
+    GLIB_clear(&ctx);
+    host_spi_reset_stats();
+    DMD_updateDisplayAsync(on_done, NULL);
+    tx_complete();
+    printf("full frame: %.0f us tren day; DMD_updateDisplay chan CPU ca khoang nay, "
+           "DMD_updateDisplayAsync chi dong goi roi tra ve\n",
+           host_spi_wire_us(host_spi_get_stats()));
+    printf("thoi gian goi tren PC: async %.1f us, dong bo %.1f us\n", t_async / 1e3, t_sync / 1e3);
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: cap nhat bat dong bo dung thu tu va dung noi dung\n");
+    return EXIT_SUCCESS;
+}
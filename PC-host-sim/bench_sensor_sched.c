@@ -0,0 +1,294 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_sleeptimer.h"
+#include "dht20.h"
+#include "i2c_bus.h"
+#include "sensor_sched.h"
+#include "host_platform.h"
+
+// Bộ lập lịch lấy mẫu nhiều cảm biến (sensor_sched.h) trên bus I2C giả lập
+// với DHT20 (80 ms) và hai cảm biến giả lập đo 15 ms và 40 ms. So độ trễ một
+// chu kỳ khi trigger cùng lúc với đo lần lượt từng cảm biến, đo tỷ lệ bận
+// của bus và CPU mỗi chu kỳ lấy mẫu, và các trường hợp lỗi của từng cảm biến.
+
+// ================= CẤU HÌNH =================
+#define PERIOD_MS       1000    // Chu kỳ lấy mẫu như app.c
+#define CYCLES          10
+#define HUMID_ADDR      0x44
+#define HUMID_MS        15
+#define PRESS_ADDR      0x76
+#define PRESS_MS        40
+
+// Cảm biến giả lập: trigger rồi đo convert_ms, khung đọc là byte trạng thái
+// (bit 7 = đang đo) và hai giá trị int16 big-endian đơn vị 1/100
+typedef struct {
+    uint32_t convert_ms;
+    int16_t value[2];
+    uint64_t trigger_tick;
+    int nack_write;
+    uint32_t triggers;
+    uint32_t reads;
+} fake_sensor_t;
+
+static fake_sensor_t dht, humid, press;
+static int failures;
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static int busy(const fake_sensor_t *d)
+{
+    return sl_sleeptimer_get_tick_count64() - d->trigger_tick
+           < (uint64_t)d->convert_ms * HOST_SLEEPTIMER_FREQ / 1000u;
+}
+
+// --- HÀM: THIẾT BỊ GIẢ LẬP CHUNG CHO HAI CẢM BIẾN MỚI ---
+static int fake_sensor(void *ctx, int read, uint8_t *data, uint16_t len)
+{
+    fake_sensor_t *d = ctx;
+    uint8_t frame[5];
+
+    if (!read) {
+        if (d->nack_write) {
+            return -1;
+        }
+        d->trigger_tick = sl_sleeptimer_get_tick_count64();
+        d->triggers++;
+        return 0;
+    }
+    d->reads++;
+    frame[0] = busy(d) ? 0x80 : 0x00;
+    frame[1] = (uint8_t)((uint16_t)d->value[0] >> 8);
+    frame[2] = (uint8_t)d->value[0];
+    frame[3] = (uint8_t)((uint16_t)d->value[1] >> 8);
+    frame[4] = (uint8_t)d->value[1];
+    memcpy(data, frame, len < 5 ? len : 5);
+    return 0;
+}
+
+// --- HÀM: DHT20 GIẢ LẬP (KHUNG 7 BYTE, BUSY BIT, MÃ 20 BIT) ---
+static int fake_dht20(void *ctx, int read, uint8_t *data, uint16_t len)
+{
+    fake_sensor_t *d = ctx;
+    uint32_t rh = (uint32_t)(d->value[1] * 1048576LL / 10000);
+    uint32_t t = (uint32_t)((d->value[0] + 5000) * 1048576LL / 20000);
+    uint8_t frame[7];
+
+    if (!read) {
+        if (d->nack_write) {
+            return -1;
+        }
+        d->trigger_tick = sl_sleeptimer_get_tick_count64();
+        d->triggers++;
+        return 0;
+    }
+    d->reads++;
+    frame[0] = (uint8_t)(0x18 | (busy(d) ? 0x80 : 0));
+    frame[1] = (uint8_t)(rh >> 12);
+    frame[2] = (uint8_t)(rh >> 4);
+    frame[3] = (uint8_t)((rh << 4) | (t >> 16));
+    frame[4] = (uint8_t)(t >> 8);
+    frame[5] = (uint8_t)t;
+    frame[6] = 0;
+    memcpy(data, frame, len < 7 ? len : 7);
+    return 0;
+}
+
+// ================= DRIVER CỦA HAI CẢM BIẾN GIẢ LẬP =================
+static sl_status_t fake_decode(const uint8_t *rx, int16_t *values)
+{
+    if (rx[0] & 0x80) {
+        return SL_STATUS_NOT_READY;
+    }
+    values[0] = (int16_t)((rx[1] << 8) | rx[2]);
+    values[1] = (int16_t)((rx[3] << 8) | rx[4]);
+    return SL_STATUS_OK;
+}
+
+static const sensor_driver_t humid_sensor = {
+    .name = "humid", .addr = HUMID_ADDR, .trigger_len = 2, .trigger_cmd = { 0x24, 0x00 },
+    .conversion_ms = HUMID_MS, .read_len = 5, .decode = fake_decode,
+};
+
+static const sensor_driver_t press_sensor = {
+    .name = "press", .addr = PRESS_ADDR, .trigger_len = 2, .trigger_cmd = { 0xF4, 0x25 },
+    .conversion_ms = PRESS_MS, .read_len = 5, .decode = fake_decode,
+};
+
+// --- HÀM: CHẠY ĐỒNG HỒ TỪNG ms TỚI KHI CHU KỲ XONG ---
+static sl_status_t run_cycle(void)
+{
+    sl_status_t sc = sensor_sched_start();
+    uint32_t ms = 0;
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    sc = SL_STATUS_IN_PROGRESS;
+    while (sc == SL_STATUS_IN_PROGRESS && ms++ < PERIOD_MS) {
+        host_time_advance_ms(1);
+        if (host_bt_take_signals() & EX_SENSOR_READY) {
+            sc = sensor_sched_process();
+        }
+    }
+    return sc;
+}
+
+static uint32_t ticks_ms(uint32_t ticks)
+{
+    return (uint32_t)((uint64_t)ticks * 1000u / HOST_SLEEPTIMER_FREQ);
+}
+
+static uint32_t ticks_us(uint32_t ticks)
+{
+    return (uint32_t)((uint64_t)ticks * 1000000u / HOST_SLEEPTIMER_FREQ);
+}
+
+// Giá trị centi: DHT20 lệch tối đa 1 do mã thô bị cắt khi giả lập
+static int near(int a, int b)
+{
+    return abs(a - b) <= 1;
+}
+
+static uint8_t register_all(void)
+{
+    uint8_t idx;
+
+    sensor_sched_init();
+    check(sensor_sched_register(&dht20_sensor, &idx) == SL_STATUS_OK && idx == 0, "dang ky DHT20");
+    check(sensor_sched_register(&humid_sensor, &idx) == SL_STATUS_OK && idx == 1, "dang ky humid");
+    check(sensor_sched_register(&press_sensor, &idx) == SL_STATUS_OK && idx == 2, "dang ky press");
+    return 3;
+}
+
+int main(void)
+{
+    const sensor_driver_t *drivers[] = { &dht20_sensor, &humid_sensor, &press_sensor };
+    const sensor_sched_report_t *r;
+    int16_t v[SENSOR_SCHED_VALUES_MAX];
+    uint32_t seq_ms = 0, seq_bus = 0, pipe_ms;
+    uint64_t bus_sum = 0, cpu_sum = 0;
+    uint32_t bus_max = 0, cpu_max = 0;
+    uint64_t cpu_ns = 0;
+
+    i2c_bus_init();
+    dht = (fake_sensor_t){ .convert_ms = DHT20_MEASURE_MS, .value = { 2350, 6120 } };
+    humid = (fake_sensor_t){ .convert_ms = HUMID_MS, .value = { -1025, 4550 } };
+    press = (fake_sensor_t){ .convert_ms = PRESS_MS, .value = { 10132, 2499 } };
+    host_i2c_attach(DHT20_ADDR, fake_dht20, &dht);
+    host_i2c_attach(HUMID_ADDR, fake_sensor, &humid);
+    host_i2c_attach(PRESS_ADDR, fake_sensor, &press);
+
+    // 1. Lần lượt: mỗi lần chỉ đăng ký một cảm biến, độ trễ cộng dồn
+    printf("%-28s %8s %10s\n", "che do", "tre ms", "bus us");
+    for (size_t i = 0; i < sizeof(drivers) / sizeof(drivers[0]); i++) {
+        sensor_sched_init();
+        sensor_sched_register(drivers[i], NULL);
+        check(run_cycle() == SL_STATUS_OK, "do mot cam bien loi");
+        r = sensor_sched_get_report();
+        seq_ms += ticks_ms(r->latency_ticks);
+        seq_bus += r->bus_ticks;
+    }
+    printf("%-28s %8u %10u\n", "lan luot tung cam bien", seq_ms, ticks_us(seq_bus));
+
+    // 2. Đường ống: trigger cả ba, chờ một lần 80 ms, đọc một loạt
+    register_all();
+    check(run_cycle() == SL_STATUS_OK, "chu ky duong ong loi");
+    r = sensor_sched_get_report();
+    pipe_ms = ticks_ms(r->latency_ticks);
+    printf("%-28s %8u %10u\n", "trigger cung luc", pipe_ms, ticks_us(r->bus_ticks));
+    check(pipe_ms >= DHT20_MEASURE_MS && pipe_ms <= DHT20_MEASURE_MS + 3, "duong ong: do tre khac thoi gian do dai nhat");
+    check(pipe_ms * 10 < seq_ms * 7, "duong ong khong nhanh hon lan luot");
+    check(r->transfers == 6 && r->polls == 0, "duong ong: phai la 3 trigger va 3 lan doc");
+    check(sensor_sched_get(0, v) == SL_STATUS_OK && near(v[0], 2350) && near(v[1], 6120), "sai gia tri DHT20");
+    check(sensor_sched_get(1, v) == SL_STATUS_OK && near(v[0], -1025) && near(v[1], 4550), "sai gia tri humid");
+    check(sensor_sched_get(2, v) == SL_STATUS_OK && near(v[0], 10132) && near(v[1], 2499), "sai gia tri press");
+
+    // 3. Lấy mẫu mỗi PERIOD_MS: tỷ lệ bận của bus và CPU mỗi chu kỳ
+    for (int c = 0; c < CYCLES; c++) {
+        uint64_t t0 = sl_sleeptimer_get_tick_count64();
+        check(run_cycle() == SL_STATUS_OK, "chu ky dinh ky loi");
+        r = sensor_sched_get_report();
+        if (c > 0) {
+            uint32_t b = sensor_sched_bus_duty_ppm(r);
+            uint32_t u = sensor_sched_cpu_duty_ppm(r);
+            bus_sum += b;
+            cpu_sum += u;
+            cpu_ns += (uint64_t)r->cpu_cycles * 1000000000u / r->cpu_hz;
+            bus_max = b > bus_max ? b : bus_max;
+            cpu_max = u > cpu_max ? u : cpu_max;
+            check(ticks_ms(r->period_ticks) >= PERIOD_MS - 1 && ticks_ms(r->period_ticks) <= PERIOD_MS + 1,
+                  "sai chu ky lay mau");
+        }
+        // Phần còn lại của chu kỳ
+        host_time_advance_ms(PERIOD_MS - ticks_ms((uint32_t)(sl_sleeptimer_get_tick_count64() - t0)));
+    }
+    // CPU trên PC: thời gian thật của code bộ lập lịch, decode và callback
+    printf("moi chu ky %u ms: bus ban TB %.3f%% (max %.3f%%), CPU %llu ns (TB %.1f ppm, max %u ppm)\n",
+           PERIOD_MS, bus_sum / 1e4 / (CYCLES - 1), bus_max / 1e4,
+           (unsigned long long)(cpu_ns / (CYCLES - 1)), (double)cpu_sum / (CYCLES - 1), cpu_max);
+    printf("do chan (trigger, cho, doc) lan luot: CPU ban %.1f%% moi chu ky\n",
+           100.0 * (DHT20_MEASURE_MS + HUMID_MS + PRESS_MS) / PERIOD_MS);
+    check(bus_max > 0 && bus_max < 10000, "ty le ban cua bus bat thuong");
+    check(cpu_max < 10000, "CPU ban qua 1% chu ky");
+
+    // 4. Cảm biến chậm hơn dự kiến: chỉ đọc lại cảm biến đó
+    humid.convert_ms = DHT20_MEASURE_MS + 15;
+    uint32_t dht_reads = dht.reads, humid_reads = humid.reads;
+    check(run_cycle() == SL_STATUS_OK, "cam bien cham loi");
+    r = sensor_sched_get_report();
+    check(sensor_sched_get(1, v) == SL_STATUS_OK && near(v[0], -1025), "cam bien cham: sai gia tri");
+    check(r->polls == 2 && humid.reads - humid_reads == 3 && dht.reads - dht_reads == 1,
+          "cam bien cham: phai doc lai rieng cam bien do");
+    printf("cam bien cham %u ms: tre %u ms, doc lai %u lan\n", humid.convert_ms, ticks_ms(r->latency_ticks), r->polls);
+    humid.convert_ms = HUMID_MS;
+
+    // 5. Bận mãi: hết SENSOR_SCHED_MAX_POLLS lần đọc lại thì SL_STATUS_TIMEOUT
+    press.convert_ms = 100000;
+    check(run_cycle() == SL_STATUS_OK, "chu ky co cam bien ban mai loi");
+    check(sensor_sched_get(2, v) == SL_STATUS_TIMEOUT, "ban mai khong bao SL_STATUS_TIMEOUT");
+    check(sensor_sched_get(0, v) == SL_STATUS_OK, "cam bien ban mai lam hong DHT20");
+    press.convert_ms = PRESS_MS;
+    host_time_advance_ms(PRESS_MS);
+
+    // 6. Trigger bị NACK: lỗi riêng cảm biến đó, các cảm biến khác vẫn đọc được
+    press.nack_write = 1;
+    check(run_cycle() == SL_STATUS_OK, "chu ky co NACK loi");
+    check(sensor_sched_get(2, v) == SL_STATUS_TRANSMIT, "NACK trigger khong bao SL_STATUS_TRANSMIT");
+    check(sensor_sched_get(0, v) == SL_STATUS_OK && sensor_sched_get(1, v) == SL_STATUS_OK,
+          "NACK mot cam bien lam hong cam bien khac");
+    check(sensor_sched_get_report()->transfers == 5, "cam bien NACK trigger van bi doc");
+    press.nack_write = 0;
+
+    // 7. Giới hạn và trạng thái
+    check(sensor_sched_start() == SL_STATUS_OK, "bat dau chu ky");
+    check(sensor_sched_start() == SL_STATUS_BUSY, "bat dau khi dang do");
+    check(sensor_sched_register(&humid_sensor, NULL) == SL_STATUS_INVALID_STATE, "dang ky khi dang do");
+    check(sensor_sched_process() == SL_STATUS_IN_PROGRESS, "xu ly truoc khi doc xong");
+    while (sensor_sched_is_busy()) {
+        host_time_advance_ms(1);
+        if (host_bt_take_signals() & EX_SENSOR_READY) {
+            sensor_sched_process();
+        }
+    }
+    check(sensor_sched_process() == SL_STATUS_INVALID_STATE, "xu ly khi khong do");
+    check(sensor_sched_register(&humid_sensor, NULL) == SL_STATUS_OK, "dang ky cam bien thu tu");
+    check(sensor_sched_register(&humid_sensor, NULL) == SL_STATUS_NO_MORE_RESOURCE, "qua SENSOR_SCHED_MAX");
+    check(sensor_sched_get(SENSOR_SCHED_MAX, v) == SL_STATUS_INVALID_PARAMETER, "chi so sai");
+    check(i2c_bus_is_idle() && i2c_bus_get_stats()->submitted == i2c_bus_get_stats()->completed,
+          "con transfer trong hang doi");
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: trigger cung luc, cho mot lan %u ms thay vi %u ms\n", pipe_ms, seq_ms);
+    return EXIT_SUCCESS;
+}
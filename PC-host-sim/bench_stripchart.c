@@ -0,0 +1,297 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// Biểu đồ nhiệt độ cuộn: kiểm tra DMD_scrollLeft với bản mẫu từng điểm ảnh,
+// kiểm tra vẽ tăng dần (cuộn + 1 cột) cho ra đúng ảnh vẽ lại toàn bộ, rồi đo
+// chi phí mỗi mẫu ở chu kỳ đo 1 s như trên board.
+
+// ================= CẤU HÌNH =================
+#define W             128
+#define H             128
+#define ROW_BYTES     (W / 8)
+#define FB_BYTES      (H * ROW_BYTES)
+#define RANDOM_SCROLLS 20000
+#define CHECK_SAMPLES 300
+#define BENCH_SAMPLES 600       // 10 phút đo, mỗi giây một mẫu
+#define SAMPLE_PERIOD_NS 1000000000.0
+
+static GLIB_Context_t ctx;
+static GLIB_StripChart_t chart;
+
+static int get_px(const uint8_t *fb, int x, int y)
+{
+    return (fb[y * ROW_BYTES + (x >> 3)] >> (x & 7)) & 1;
+}
+
+static void set_px(uint8_t *fb, int x, int y, int v)
+{
+    uint8_t m = (uint8_t)(1 << (x & 7));
+    fb[y * ROW_BYTES + (x >> 3)] = v ? (fb[y * ROW_BYTES + (x >> 3)] | m)
+                                     : (fb[y * ROW_BYTES + (x >> 3)] & ~m);
+}
+
+// --- HÀM: KIỂM TRA DMD_scrollLeft VỚI BẢN MẪU TỪNG ĐIỂM ẢNH ---
+static int check_scroll(void)
+{
+    static uint8_t ref[FB_BYTES];
+    uint8_t *fb;
+    int failures = 0;
+
+    DMD_getFrameBuffer((void **)&fb);
+    for (int i = 0; i < FB_BYTES; i++) {
+        fb[i] = (uint8_t)rand();
+    }
+    memcpy(ref, fb, FB_BYTES);
+
+    for (int k = 0; k < RANDOM_SCROLLS && failures < 5; k++) {
+        // Vùng cắt ngẫu nhiên, hình chữ nhật có thể lòi ra ngoài vùng cắt
+        int cw = 1 + rand() % W, ch = 1 + rand() % H;
+        int cx = rand() % (W - cw + 1), cy = rand() % (H - ch + 1);
+        int x = rand() % (W + 20) - 10, y = rand() % (H + 20) - 10;
+        int w = 1 + rand() % W, h = 1 + rand() % 20;
+        uint32_t shift = 1 + (uint32_t)rand() % 31;
+        int x0 = x < cx ? cx : x, x1 = x + w - 1 > cx + cw - 1 ? cx + cw - 1 : x + w - 1;
+        int y0 = y < cy ? cy : y, y1 = y + h - 1 > cy + ch - 1 ? cy + ch - 1 : y + h - 1;
+        EMSTATUS expect = (x1 - x0 + 1 > (int)shift && y0 <= y1) ? DMD_OK
+                                                                  : DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+
+        if (expect == DMD_OK) {
+            for (int r = y0; r <= y1; r++) {
+                for (int c = x0; c + (int)shift <= x1; c++) {
+                    set_px(ref, c, r, get_px(ref, c + (int)shift, r));
+                }
+            }
+        }
+        DMD_setClippingArea((uint16_t)cx, (uint16_t)cy, (uint16_t)cw, (uint16_t)ch);
+        EMSTATUS status = DMD_scrollLeft(x, y, w, h, shift);
+        if (status != expect || memcmp(ref, fb, FB_BYTES) != 0) {
+            printf("FAIL: scroll %d clip (%d,%d %dx%d) rect (%d,%d %dx%d) shift %u\n",
+                   k, cx, cy, cw, ch, x, y, w, h, shift);
+            memcpy(ref, fb, FB_BYTES);
+            failures++;
+        }
+    }
+    if (DMD_scrollLeft(0, 0, W, H, 0) != DMD_ERROR_NOT_SUPPORTED
+        || DMD_scrollLeft(0, 0, W, H, 32) != DMD_ERROR_NOT_SUPPORTED) {
+        printf("FAIL: scroll chap nhan shift ngoai 1..31\n");
+        failures++;
+    }
+    DMD_setClippingArea(0, 0, W, H);
+    return failures;
+}
+
+// Nhiệt độ giả lập, đơn vị 0.1 độ C: dao động chậm cộng nhiễu
+static int16_t next_temp(void)
+{
+    static int32_t t = 245;
+    t += rand() % 9 - 4;
+    t = t < 150 ? 150 : (t > 350 ? 350 : t);
+    return (int16_t)t;
+}
+
+static void draw_text(void)
+{
+    GLIB_drawStringOnLine(&ctx, "DHT20 MONITOR", 0, GLIB_ALIGN_CENTER, 0, 0, true);
+    GLIB_drawStringOnLine(&ctx, "Temp: 24.50 C", 1, GLIB_ALIGN_LEFT, 5, 0, true);
+}
+
+// --- HÀM: VẼ TĂNG DẦN TỪNG MẪU, SO VỚI VẼ LẠI TOÀN BỘ SAU MỖI MẪU ---
+static int check_chart(const GLIB_Rectangle_t *area, const GLIB_Rectangle_t *clip)
+{
+    static uint8_t inc[FB_BYTES], full[FB_BYTES], text[FB_BYTES];
+    uint8_t *fb;
+    int failures = 0;
+
+    DMD_getFrameBuffer((void **)&fb);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_clear(&ctx);
+    draw_text();
+    memcpy(text, fb, FB_BYTES);
+
+    if (clip != NULL) {
+        GLIB_setClippingRegion(&ctx, clip);
+    }
+    GLIB_applyClippingRegion(&ctx);
+    GLIB_stripChartInit(&chart, &ctx, area, 150, 350);
+    GLIB_stripChartRedraw(&chart);
+
+    for (int k = 0; k < CHECK_SAMPLES && failures < 3; k++) {
+        GLIB_stripChartAddSample(&chart, next_temp());
+        memcpy(inc, fb, FB_BYTES);
+
+        // Vẽ lại toàn bộ trên nền chữ ban đầu
+        memcpy(fb, text, FB_BYTES);
+        GLIB_stripChartRedraw(&chart);
+        memcpy(full, fb, FB_BYTES);
+        memcpy(fb, inc, FB_BYTES);
+
+        if (memcmp(inc, full, FB_BYTES) != 0) {
+            printf("FAIL: mau %d: ve tang dan khac ve lai (vung %d,%d-%d,%d)\n",
+                   k, area->xMin, area->yMin, area->xMax, area->yMax);
+            failures++;
+        }
+        // Ngoài vùng biểu đồ và vùng cắt, màn hình giữ nguyên chữ
+        for (int y = 0; y < H; y++) {
+            for (int x = 0; x < W; x++) {
+                const GLIB_Rectangle_t *c = &ctx.clippingRegion;
+                int in_area = x >= area->xMin && x <= area->xMax
+                              && y >= area->yMin && y <= area->yMax
+                              && x >= c->xMin && x <= c->xMax && y >= c->yMin && y <= c->yMax;
+                if (!in_area && get_px(inc, x, y) != get_px(text, x, y)) {
+                    printf("FAIL: mau %d: ve ra ngoai vung tai (%d,%d)\n", k, x, y);
+                    failures++;
+                    y = H;
+                    break;
+                }
+            }
+        }
+    }
+    if (memcmp(&ctx.clippingRegion, clip != NULL ? clip : &(GLIB_Rectangle_t){ 0, 0, W - 1, H - 1 },
+               sizeof(GLIB_Rectangle_t)) != 0) {
+        printf("FAIL: bieu do khong tra lai vung cat\n");
+        failures++;
+    }
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    return failures;
+}
+
+// --- HÀM: CÁCH CŨ: XÓA VÙNG RỒI VẼ LẠI CẢ ĐƯỜNG GẤP KHÚC ---
+// Dùng mảng mẫu riêng, mẫu mới nhất ở cuối, dồn mảng khi đầy
+static int16_t history[W];
+static uint32_t history_count;
+
+static void redraw_polyline(const GLIB_StripChart_t *c, int16_t sample)
+{
+    GLIB_Rectangle_t r = c->area;
+    int32_t range = c->maxValue - c->minValue, h = c->area.yMax - c->area.yMin;
+    int32_t px = 0, py = 0;
+
+    if (history_count == c->columns) {
+        memmove(history, history + 1, (c->columns - 1) * sizeof(history[0]));
+        history_count--;
+    }
+    history[history_count++] = sample;
+
+    ctx.foregroundColor = White;
+    GLIB_drawRectFilled(&ctx, &r);
+    ctx.foregroundColor = Black;
+    for (uint32_t i = 0; i < history_count; i++) {
+        int32_t v = history[i] - c->minValue;
+        int32_t x = c->area.xMax - (int32_t)(history_count - 1 - i);
+        int32_t y = c->area.yMax - (v * h * 2 + range) / (range * 2);
+        if (i > 0) {
+            GLIB_drawLine(&ctx, px, py, x, y);
+        }
+        px = x;
+        py = y;
+    }
+}
+
+typedef struct {
+    double cpu_ns;
+    double rows;
+    double bytes;
+    double wire_us;
+} cost_t;
+
+// --- HÀM: ĐO CHI PHÍ MỖI MẪU (CPU VẼ + GỬI SPI) TRÊN BENCH_SAMPLES MẪU ---
+static cost_t run(int incremental)
+{
+    static const GLIB_Rectangle_t area = { 4, 84, 123, 124 };
+    cost_t cost = { 0, 0, 0, 0 };
+    uint64_t cpu = 0;
+
+    srand(11);
+    history_count = 0;
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    GLIB_clear(&ctx);
+    draw_text();
+    GLIB_stripChartInit(&chart, &ctx, &area, 150, 350);
+    GLIB_stripChartRedraw(&chart);
+    DMD_updateDisplay();
+    host_spi_reset_stats();
+
+    for (int k = 0; k < BENCH_SAMPLES; k++) {
+        int16_t v = next_temp();
+        uint64_t t0 = host_now_ns();
+        if (incremental) {
+            GLIB_stripChartAddSample(&chart, v);
+        } else {
+            redraw_polyline(&chart, v);
+        }
+        cpu += host_now_ns() - t0;
+        DMD_updateDisplay();
+        host_time_advance_ms(1000);
+    }
+
+    const host_spi_stats_t *s = host_spi_get_stats();
+    cost.cpu_ns = (double)cpu / BENCH_SAMPLES;
+    cost.rows = (double)s->rows / BENCH_SAMPLES;
+    cost.bytes = (double)s->bytes / BENCH_SAMPLES;
+    cost.wire_us = host_spi_wire_us(s) / BENCH_SAMPLES;
+    return cost;
+}
+
+int main(void)
+{
+    static const GLIB_Rectangle_t areas[] = {
+        { 4, 84, 123, 124 },      // Vùng dùng trên board
+        { 0, 0, 127, 127 },       // Cả màn hình
+        { 37, 20, 70, 61 },       // Lệch word ở cả hai đầu
+        { 90, 100, 92, 103 },     // Rất hẹp
+    };
+    static const GLIB_Rectangle_t clip = { 10, 30, 100, 110 };
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    srand(7);
+
+    failures += check_scroll();
+    printf("%d lan DMD_scrollLeft ngau nhien: %s\n", RANDOM_SCROLLS,
+           failures ? "KHAC" : "giong ban mau");
+
+    for (size_t i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+        failures += check_chart(&areas[i], NULL);
+        failures += check_chart(&areas[i], &clip);
+    }
+    printf("ve tang dan %d mau x %zu vung (co/khong vung cat): %s\n", CHECK_SAMPLES,
+           sizeof(areas) / sizeof(areas[0]), failures ? "KHAC" : "giong ve lai toan bo");
+
+    if (GLIB_stripChartInit(&chart, &ctx, &(GLIB_Rectangle_t){ 0, 0, 128, 10 }, 0, 1)
+        != GLIB_ERROR_INVALID_ARGUMENT
+        || GLIB_stripChartInit(&chart, &ctx, &areas[0], 5, 5) != GLIB_ERROR_INVALID_ARGUMENT) {
+        printf("FAIL: kiem tra tham so GLIB_stripChartInit\n");
+        failures++;
+    }
+
+    cost_t o = run(0), n = run(1);
+    printf("%-22s %10s %8s %8s %10s %10s\n", "moi mau (1 s)", "CPU ns", "hang", "byte",
+           "SPI us", "tai %");
+    printf("%-22s %10.0f %8.1f %8.0f %10.1f %10.4f\n", "ve lai ca bieu do", o.cpu_ns,
+           o.rows, o.bytes, o.wire_us, 100.0 * (o.cpu_ns + o.wire_us * 1e3) / SAMPLE_PERIOD_NS);
+    printf("%-22s %10.0f %8.1f %8.0f %10.1f %10.4f\n", "cuon + 1 cot", n.cpu_ns,
+           n.rows, n.bytes, n.wire_us, 100.0 * (n.cpu_ns + n.wire_us * 1e3) / SAMPLE_PERIOD_NS);
+    printf("CPU ve nhanh hon %.1f lan\n", o.cpu_ns / n.cpu_ns);
+
+    if (host_spi_get_stats()->errors != 0) {
+        printf("FAIL: panel gia lap bao loi giao thuc\n");
+        failures++;
+    }
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: bieu do cuon khop ve lai toan bo\n");
+    return EXIT_SUCCESS;
+}
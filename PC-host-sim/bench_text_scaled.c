@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// GLIB_drawStringScaled()/GLIB_drawCharScaled(): chữ phóng to 2x, 3x, 4x từ
+// font có sẵn. Mỗi hàng glyph được nở ra qua bảng tra (1 byte -> 8*scale bit)
+// rồi ghi vào scale hàng framebuffer. So từng điểm ảnh với bản mẫu vẽ từng
+// điểm ảnh (mỗi điểm glyph thành một ô scale x scale) và so tốc độ.
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES      (128 * 128 / 8)
+#define BENCH_CHARS   20000
+
+typedef struct {
+    const char *name;
+    const GLIB_Font_t *font;
+    const char *charset;
+} bench_font_t;
+
+static GLIB_Context_t ctx;
+static GLIB_Font_t narrow_prop;
+
+static const bench_font_t fonts[] = {
+    { "Narrow6x8",   &GLIB_FontNarrow6x8,   NULL },
+    { "Normal8x8",   &GLIB_FontNormal8x8,   NULL },
+    { "Number16x20", &GLIB_FontNumber16x20, "0123456789: " },
+    { "Narrow/prop", &narrow_prop,          NULL },
+};
+
+// --- HÀM: ĐỌC MỘT HÀNG CỦA GLYPH (FONT LAYOUT GLYPH LIỀN HÀNG) ---
+static uint32_t glyph_row(const GLIB_Font_t *f, uint32_t glyph, uint32_t row)
+{
+    const uint8_t *p = (const uint8_t *)f->pFontPixMap + (glyph * f->fontHeight + row) * f->fontRowOffset;
+    uint32_t bits = 0;
+
+    for (int b = 0; b < f->fontRowOffset; b++) {
+        bits |= (uint32_t)p[b] << (8 * b);
+    }
+    return bits;
+}
+
+static uint32_t glyph_index(const GLIB_Font_t *f, char c)
+{
+    if (f->fontClass == NumbersOnlyFont) {
+        return (c == ':') ? 10 : (c == ' ') ? 11 : (uint32_t)(c - '0');
+    }
+    return (uint32_t)(c - ' ');
+}
+
+// --- HÀM: BẢN MẪU: VẼ TỪNG ĐIỂM ẢNH, MỖI ĐIỂM GLYPH LÀ MỘT Ô scale x scale ---
+static EMSTATUS ref_draw_char(GLIB_Context_t *pContext, char c, int32_t x, int32_t y,
+                              uint32_t scale, bool opaque)
+{
+    const GLIB_Font_t *f = &pContext->font;
+    uint32_t idx = glyph_index(f, c);
+    uint32_t drawn = 0;
+    int cell = f->pAdvanceWidths ? f->pAdvanceWidths[idx] : f->fontWidth + f->charSpacing;
+
+    for (int row = 0; row < f->fontHeight; row++) {
+        uint32_t bits = glyph_row(f, idx, (uint32_t)row);
+
+        for (int col = 0; col < cell; col++, bits >>= 1) {
+            int ink = col < f->fontWidth && (bits & 1);
+            if (!ink && !opaque) {
+                continue;
+            }
+            for (uint32_t dy = 0; dy < scale; dy++) {
+                for (uint32_t dx = 0; dx < scale; dx++) {
+                    EMSTATUS st = GLIB_drawPixelColor(pContext, x + col * (int32_t)scale + (int32_t)dx,
+                                                      y + row * (int32_t)scale + (int32_t)dy,
+                                                      ink ? pContext->foregroundColor
+                                                          : pContext->backgroundColor);
+                    if (st == GLIB_OK) {
+                        drawn++;
+                    }
+                }
+            }
+        }
+    }
+    return drawn ? GLIB_OK : GLIB_ERROR_NOTHING_TO_DRAW;
+}
+
+typedef EMSTATUS (*draw_fn_t)(GLIB_Context_t *, char, int32_t, int32_t, uint32_t, bool);
+
+static char pick_char(const bench_font_t *bf, unsigned i)
+{
+    if (bf->charset) {
+        return bf->charset[i % strlen(bf->charset)];
+    }
+    return (char)(' ' + i % 95);
+}
+
+// --- HÀM: VẼ MỘT LOẠT KÝ TỰ Ở MỌI ĐỘ LỆCH BIT, KỂ CẢ BỊ CẮT Ở MÉP ---
+static unsigned draw_pattern(const bench_font_t *bf, draw_fn_t draw, uint32_t scale,
+                             bool opaque, uint8_t *out)
+{
+    void *fb;
+    unsigned ok = 0;
+    const GLIB_Font_t *f = bf->font;
+    int w = (f->fontWidth + 3) * (int)scale;
+    int h = f->fontHeight * (int)scale;
+
+    GLIB_clear(&ctx);
+    for (unsigned i = 0; i < 120; i++) {
+        int32_t x = (int32_t)(i * (unsigned)w + i / 5) % (128 + 2 * w) - w;
+        int32_t y = (int32_t)((i / 3) * 7) % (128 + h) - h / 2;
+        if (draw(&ctx, pick_char(bf, i), x, y, scale, opaque) == GLIB_OK) {
+            ok++;
+        }
+    }
+    DMD_getFrameBuffer(&fb);
+    memcpy(out, fb, FB_BYTES);
+    return ok;
+}
+
+// --- HÀM: ĐO SỐ KÝ TỰ/GIÂY ---
+static double bench(const bench_font_t *bf, draw_fn_t draw, uint32_t scale, bool opaque)
+{
+    const GLIB_Font_t *f = bf->font;
+    int cw = (f->fontWidth + f->charSpacing) * (int)scale;
+    int ch = f->fontHeight * (int)scale;
+    int cols = 128 / cw, rows = 128 / ch;
+    uint64_t t0 = host_now_ns();
+
+    for (unsigned i = 0; i < BENCH_CHARS; i++) {
+        int32_t x = (int32_t)(i % (unsigned)cols) * cw + (int32_t)(i / 97) % 5;
+        int32_t y = (int32_t)((i / (unsigned)cols) % (unsigned)rows) * ch;
+        draw(&ctx, pick_char(bf, i), x, y, scale, opaque);
+    }
+    return BENCH_CHARS / ((double)(host_now_ns() - t0) / 1e9);
+}
+
+// --- HÀM: SO GLIB_drawStringScaled VỚI VẼ TỪNG KÝ TỰ BẰNG BẢN MẪU ---
+static int check_string(void)
+{
+    static const char text[] = "23.5C\n61%";
+    static uint8_t ref[FB_BYTES];
+    const GLIB_Font_t *f = &GLIB_FontNormal8x8;
+    GLIB_Rectangle_t clip = { 10, 8, 100, 50 };
+    int32_t x = 4, y = 2;
+    void *fb;
+
+    GLIB_setFont(&ctx, (GLIB_Font_t *)f);
+    GLIB_clear(&ctx);
+    GLIB_setClippingRegion(&ctx, &clip);
+    GLIB_applyClippingRegion(&ctx);
+    for (size_t i = 0; i < sizeof(text) - 1; i++) {
+        if (text[i] == '\n') {
+            x = 4;
+            y += (f->fontHeight + f->lineSpacing) * 3;
+            continue;
+        }
+        ref_draw_char(&ctx, text[i], x, y, 3, true);
+        x += (f->fontWidth + f->charSpacing) * 3;
+    }
+    DMD_getFrameBuffer(&fb);
+    memcpy(ref, fb, FB_BYTES);
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    GLIB_clear(&ctx);
+    GLIB_setClippingRegion(&ctx, &clip);
+    GLIB_applyClippingRegion(&ctx);
+    GLIB_drawStringScaled(&ctx, text, sizeof(text) - 1, 4, 2, 3, true);
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    if (memcmp(ref, fb, FB_BYTES) != 0) {
+        printf("FAIL: GLIB_drawStringScaled khac ban mau\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    static uint8_t ref[FB_BYTES], got[FB_BYTES];
+    static uint8_t advance[95];
+    int failures = 0;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+
+    // Font tỷ lệ dựng từ Narrow6x8: độ rộng theo nét chữ + 1 cột trống
+    narrow_prop = GLIB_FontNarrow6x8;
+    for (uint32_t g = 0; g < 95; g++) {
+        uint32_t ink = 0;
+        for (uint32_t r = 0; r < 8; r++) {
+            ink |= glyph_row(&GLIB_FontNarrow6x8, g, r);
+        }
+        advance[g] = ink ? (uint8_t)(32 - __builtin_clz(ink) + 1) : 3;
+    }
+    narrow_prop.pAdvanceWidths = advance;
+
+    // 1. Đúng từng điểm ảnh so với bản mẫu, mọi font, tỷ lệ, chế độ nền
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        GLIB_setFont(&ctx, (GLIB_Font_t *)fonts[i].font);
+        for (uint32_t scale = 1; scale <= GLIB_FONT_SCALE_MAX; scale++) {
+            for (int opaque = 0; opaque <= 1; opaque++) {
+                unsigned n_ref = draw_pattern(&fonts[i], ref_draw_char, scale, opaque, ref);
+                unsigned n_new = draw_pattern(&fonts[i], GLIB_drawCharScaled, scale, opaque, got);
+                if (memcmp(ref, got, FB_BYTES) != 0 || n_ref != n_new) {
+                    printf("FAIL: %s x%u opaque=%d: khac ban mau (ve %u/%u)\n",
+                           fonts[i].name, scale, opaque, n_new, n_ref);
+                    failures++;
+                }
+            }
+        }
+    }
+    failures += check_string();
+
+    // 2. Tham số sai
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNormal8x8);
+    if (GLIB_drawCharScaled(&ctx, 'A', 0, 0, 0, true) != GLIB_ERROR_INVALID_ARGUMENT
+        || GLIB_drawCharScaled(&ctx, 'A', 0, 0, GLIB_FONT_SCALE_MAX + 1, true) != GLIB_ERROR_INVALID_ARGUMENT
+        || GLIB_drawStringScaled(&ctx, "A", 1, 0, 0, 5, true) != GLIB_ERROR_INVALID_ARGUMENT) {
+        printf("FAIL: ty le sai khong bao GLIB_ERROR_INVALID_ARGUMENT\n");
+        failures++;
+    }
+
+    // 3. Tốc độ: bảng tra + ghi hàng so với vẽ từng điểm ảnh
+    printf("%-12s %5s %7s %14s %14s %8s\n", "font", "ty le", "nen", "tung diem/s", "bang tra/s", "nhanh x");
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        GLIB_setFont(&ctx, (GLIB_Font_t *)fonts[i].font);
+        for (uint32_t scale = 2; scale <= GLIB_FONT_SCALE_MAX; scale++) {
+            if (fonts[i].font->fontWidth * scale > 128 || fonts[i].font->fontHeight * scale > 128) {
+                continue;
+            }
+            for (int opaque = 0; opaque <= 1; opaque++) {
+                GLIB_clear(&ctx);
+                double r = bench(&fonts[i], ref_draw_char, scale, opaque);
+                double n = bench(&fonts[i], GLIB_drawCharScaled, scale, opaque);
+                printf("%-12s %5u %7s %14.0f %14.0f %8.1f\n", fonts[i].name, scale,
+                       opaque ? "opaque" : "trong", r, n, n / r);
+                if (n < r) {
+                    printf("FAIL: %s x%u cham hon ve tung diem anh\n", fonts[i].name, scale);
+                    failures++;
+                }
+            }
+        }
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: chu phong to 2x-4x giong het ban mau tung diem anh\n");
+    return EXIT_SUCCESS;
+}
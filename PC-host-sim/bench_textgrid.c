@@ -0,0 +1,197 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "host_platform.h"
+
+// ================= CẤU HÌNH =================
+#define FB_BYTES   (128 * 128 / 8)
+#define STEPS      200
+
+static GLIB_Context_t ctx;
+static GLIB_TextGrid_t grid;
+
+// Cùng bố cục với memlcd_update_sensor() trong app_lcd.c
+static void format_lines(char lines[4][40], int t_centi, int h_centi, unsigned interval_ms)
+{
+    if (interval_ms >= 1000) {
+        sprintf(lines[0], "CYCLE: %u sec", interval_ms / 1000);
+    } else {
+        sprintf(lines[0], "CYCLE: %u ms", interval_ms);
+    }
+    strcpy(lines[1], "DHT20 MONITOR");
+    sprintf(lines[2], "Temp: %d.%02d C", t_centi / 100, abs(t_centi % 100));
+    sprintf(lines[3], "Hum : %d.%02d %%", h_centi / 100, h_centi % 100);
+}
+
+// --- HÀM: VẼ LẠI TOÀN BỘ MÀN HÌNH NHƯ CÁCH CŨ ---
+static void draw_full(char lines[4][40])
+{
+    GLIB_clear(&ctx);
+    GLIB_drawStringOnLine(&ctx, lines[0], 2, GLIB_ALIGN_CENTER, 0, 0, true);
+    GLIB_drawStringOnLine(&ctx, lines[1], 4, GLIB_ALIGN_CENTER, 0, 0, true);
+    GLIB_drawStringOnLine(&ctx, lines[2], 6, GLIB_ALIGN_LEFT, 5, 0, true);
+    GLIB_drawStringOnLine(&ctx, lines[3], 7, GLIB_ALIGN_LEFT, 5, 0, true);
+}
+
+// --- HÀM: CẬP NHẬT QUA LƯỚI CHỮ ---
+static void draw_grid(char lines[4][40])
+{
+    GLIB_textGridDrawLine(&grid, lines[0], 2, GLIB_ALIGN_CENTER, 0);
+    GLIB_textGridDrawLine(&grid, lines[1], 4, GLIB_ALIGN_CENTER, 0);
+    GLIB_textGridDrawLine(&grid, lines[2], 6, GLIB_ALIGN_LEFT, 5);
+    GLIB_textGridDrawLine(&grid, lines[3], 7, GLIB_ALIGN_LEFT, 5);
+}
+
+static uint64_t spi_bytes_of_update(void)
+{
+    host_spi_reset_stats();
+    DMD_updateDisplay();
+    return host_spi_get_stats()->bytes;
+}
+
+// --- HÀM: MÀN HÌNH KHỞI ĐỘNG, ĐIỂM XUẤT PHÁT CHUNG CỦA HAI CÁCH ---
+static void boot_screen(void)
+{
+    GLIB_clear(&ctx);
+    GLIB_textGridInit(&grid, &ctx);
+    GLIB_textGridDrawLine(&grid, "SYSTEM BOOT...", 2, GLIB_ALIGN_CENTER, 0);
+    DMD_updateDisplay();
+    DMD_resetUpdateStats();
+}
+
+// Dãy cập nhật: nhiệt độ/độ ẩm trôi dần, thỉnh thoảng nhảy xa hoặc đổi chu kỳ
+static int next_step(int step, int *t, int *h, char lines[4][40])
+{
+    static const unsigned intervals[] = { 1000, 500, 2000, 200, 5000 };
+    int old_t = *t;
+
+    *t += (step % 3) - 1 + ((step % 17) == 0 ? -950 : 0) + ((step % 19) == 0 ? 900 : 0);
+    *h += (step % 5) - 2;
+    format_lines(lines, *t, *h, intervals[(step / 40) % 5]);
+
+    // Chỉ đổi một chữ số của nhiệt độ, độ ẩm giữ nguyên
+    return *t != old_t && old_t / 10 == *t / 10 && (step % 5) == 2 && (step % 40) != 0;
+}
+
+// --- HÀM: FONT TỶ LỆ, LƯỚI CHỮ PHẢI GIỐNG VẼ LẠI TOÀN BỘ ---
+// Font narrow với độ rộng từng ký tự khác nhau: ký tự đổi làm dịch các ô sau
+static int check_proportional(void)
+{
+    static uint8_t advance[95];
+    static uint8_t grid_fb[FB_BYTES];
+    GLIB_Font_t prop = GLIB_FontNarrow6x8;
+    char lines[4][40];
+    void *fb;
+    int t = 2512, h = 6050;
+
+    for (int g = 0; g < 95; g++) {
+        advance[g] = (uint8_t)(strchr(" .:1il!|", ' ' + g) ? 3 : 4 + g % 3);
+    }
+    prop.pAdvanceWidths = advance;
+    GLIB_setFont(&ctx, &prop);
+    DMD_getFrameBuffer(&fb);
+
+    GLIB_clear(&ctx);
+    GLIB_textGridInit(&grid, &ctx);
+    for (int step = 0; step < STEPS; step++) {
+        next_step(step, &t, &h, lines);
+        draw_grid(lines);
+        memcpy(grid_fb, fb, FB_BYTES);
+        draw_full(lines);
+        if (memcmp(grid_fb, fb, FB_BYTES) != 0) {
+            printf("FAIL: font ty le, buoc %d khac ban ve lai toan bo\n", step);
+            GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+            return 1;
+        }
+    }
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    return 0;
+}
+
+int main(void)
+{
+    static uint8_t expect[STEPS][FB_BYTES];
+    char lines[4][40];
+    void *fb;
+    int failures = 0;
+    int t, h;
+    int one_digit_steps = 0;
+    uint64_t full_bytes = 0, grid_bytes = 0, one_digit_bytes = 0;
+    DMD_UpdateStats full_rows, grid_rows;
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    DMD_getFrameBuffer(&fb);
+
+    // 1. Cách cũ: xóa và vẽ lại toàn bộ mỗi lần
+    boot_screen();
+    t = 2512;
+    h = 6050;
+    for (int step = 0; step < STEPS; step++) {
+        next_step(step, &t, &h, lines);
+        draw_full(lines);
+        memcpy(expect[step], fb, FB_BYTES);
+        full_bytes += spi_bytes_of_update();
+    }
+    DMD_getUpdateStats(&full_rows);
+
+    // 2. Cùng dãy đó qua lưới chữ
+    boot_screen();
+    t = 2512;
+    h = 6050;
+    for (int step = 0; step < STEPS; step++) {
+        int one_digit = next_step(step, &t, &h, lines);
+        draw_grid(lines);
+        if (memcmp(fb, expect[step], FB_BYTES) != 0) {
+            printf("FAIL: buoc %d khac ban ve lai toan bo\n", step);
+            failures++;
+        }
+        uint64_t bytes = spi_bytes_of_update();
+        grid_bytes += bytes;
+        if (memcmp(host_panel_memory(), fb, FB_BYTES) != 0) {
+            printf("FAIL: buoc %d panel khong khop framebuffer\n", step);
+            failures++;
+        }
+        if (one_digit) {
+            one_digit_steps++;
+            one_digit_bytes += bytes;
+        }
+    }
+    DMD_getUpdateStats(&grid_rows);
+
+    printf("%d lan cap nhat: full %llu byte SPI, textgrid %llu byte SPI\n", STEPS,
+           (unsigned long long)full_bytes, (unsigned long long)grid_bytes);
+    printf("hang dirty/da gui: full %lu/%lu, textgrid %lu/%lu\n",
+           (unsigned long)full_rows.rowsDirty, (unsigned long)full_rows.rowsSent,
+           (unsigned long)grid_rows.rowsDirty, (unsigned long)grid_rows.rowsSent);
+    if (one_digit_steps) {
+        printf("doi 1 chu so: trung binh %.0f byte/lan (1 dong chu = %d byte)\n",
+               (double)one_digit_bytes / one_digit_steps,
+               GLIB_FontNarrow6x8.fontHeight * (1 + 128 / 8 + 1) + 2);
+    }
+
+    failures += check_proportional();
+
+    // Driver so sánh với bản đã gửi nên hai cách phải gửi đúng các hàng như nhau
+    if (full_rows.rowsSent != grid_rows.rowsSent || full_bytes != grid_bytes) {
+        printf("FAIL: so hang gui khac nhau\n");
+        failures++;
+    }
+    if (grid_rows.rowsDirty > full_rows.rowsDirty / 5) {
+        printf("FAIL: textgrid danh dau qua nhieu hang dirty\n");
+        failures++;
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: textgrid giong het ve lai toan bo man hinh, ca voi font ty le\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+#!/bin/sh
+# Build các chương trình kiểm tra/benchmark chạy trên PC cho driver đồ họa.
+# Dùng mã nguồn thật trong do_an/do_an, phần SDK được thay bằng stubs/ và
+# host_platform.c.
+#
+#   ./build.sh        chỉ build
+#   ./build.sh run    build rồi chạy lần lượt, dừng ở chương trình lỗi đầu tiên
+#   ./build.sh golden ghi lại ảnh chuẩn golden/*.pbm (xem ảnh mới trước khi commit)
+#   ./build.sh fonts  sinh lại glib_font_*.c từ fonts/*.bdf bằng tools/fontc.py
+#   ./build.sh images sinh lại images/*.c từ golden/*.pbm bằng tools/imgc.py
+set -e
+cd "$(dirname "$0")"
+
+SRC=../do_an/do_an
+OUT=build
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:-"-O2 -g -Wall -Wextra -std=gnu99"}
+CFLAGS="$CFLAGS -Istubs -I. -I$SRC"
+
+GFX="$SRC/glib.c $SRC/glib_bitmap.c $SRC/glib_circle.c $SRC/glib_line.c
+     $SRC/glib_polygon.c $SRC/glib_rectangle.c $SRC/glib_string.c
+     $SRC/glib_textgrid.c $SRC/glib_stripchart.c
+     $SRC/glib_font_narrow_6x8.c $SRC/glib_font_normal_8x8.c
+     $SRC/glib_font_number_16x20.c $SRC/bmp.c
+     $SRC/dmd_memlcd.c $SRC/lcd.c $SRC/lcd_display.c host_platform.c"
+
+# Font BDF -> file C trong do_an/do_an
+FONTS="narrow_6x8 normal_8x8 number_16x20"
+PYTHON=${PYTHON:-python3}
+
+# Ảnh nén cho bench_packed, dạng <tên>:<ảnh trong golden/>:<cách nén>[:<vùng cắt>]
+IMAGES="splash:text.pbm:auto icon:bitmaps.pbm:auto:12,14,41,33 circles:circles.pbm:packbits
+        polygons:polygons.pbm:delta textgrid:textgrid.pbm:raw"
+
+imgc() {
+    check=$2
+    set -- $(echo "$1" | tr ':' ' ')
+    $PYTHON tools/imgc.py golden/$2 -o images/$1.c --name img_$1 --mode $3 ${4:+--crop $4} $check
+}
+
+if [ "$1" = "fonts" ]; then
+    for f in $FONTS; do
+        echo "FONT $f"
+        $PYTHON tools/fontc.py fonts/$f.bdf -o $SRC/glib_font_$f.c
+    done
+    exit 0
+fi
+
+if [ "$1" = "images" ]; then
+    mkdir -p images
+    for i in $IMAGES; do
+        echo "IMG ${i%%:*}"
+        imgc $i
+    done
+    exit 0
+fi
+
+# File font sinh ra phải khớp với BDF (bỏ qua nếu máy không có python)
+if command -v $PYTHON >/dev/null 2>&1; then
+    for f in $FONTS; do
+        $PYTHON tools/fontc.py fonts/$f.bdf -o $SRC/glib_font_$f.c --check
+    done
+    for i in $IMAGES; do
+        imgc $i --check
+    done
+fi
+
+PROGS="bench_glyph bench_textgrid bench_lcd_tx bench_refresh_async bench_fill bench_blit bench_polygon golden_test bench_primitives bench_stripchart bench_pages bench_rasterop bench_bmp bench_bmp_memory bench_packed bench_frames bench_display_list_fb bench_display_list bench_text_scaled test_dht20 bench_i2c_bus bench_sensor_sched test_fixed_point test_sensor_filter"
+
+# Xoay/lật màn hình chọn lúc build (lcd_display.h): golden_test chạy thêm
+# ở mọi chế độ khác, dạng <độ xoay>:<lật>
+ORIENTATIONS="0:1 90:0 90:1 180:0 180:1 270:0 270:1"
+
+# Chế độ display list (SL_MEMLCD_DISPLAY_LIST): golden_test chạy thêm ở các
+# hướng xoay được hỗ trợ, với danh sách đủ lớn cho các cảnh kiểm tra
+LIST_ORIENTATIONS="0:0 180:1"
+LIST_FLAGS="-DSL_MEMLCD_DISPLAY_LIST=1 -DSL_MEMLCD_DISPLAY_LIST_SIZE=8192"
+
+mkdir -p $OUT
+for p in $PROGS; do
+    echo "CC  $p"
+    src=$p
+    flags=
+    extra=
+    case $p in
+        bench_packed)          extra=images/*.c ;;
+        bench_frames)          extra="$SRC/app_lcd.c $SRC/centi.c" ;;
+        bench_display_list_fb) src=bench_display_list ;;
+        bench_display_list)    flags=-DSL_MEMLCD_DISPLAY_LIST=1 ;;
+        test_dht20 | bench_i2c_bus | bench_sensor_sched)
+                               extra="$SRC/dht20.c $SRC/i2c_bus.c $SRC/sensor_sched.c" ;;
+        test_fixed_point)      extra="$SRC/dht20.c $SRC/i2c_bus.c $SRC/sensor_sched.c $SRC/centi.c" ;;
+        test_sensor_filter)    extra=$SRC/sensor_filter.c ;;
+    esac
+    $CC $CFLAGS $flags -o $OUT/$p $src.c $GFX $extra
+done
+for o in $ORIENTATIONS; do
+    g=golden_test_r${o%:*}_m${o#*:}
+    echo "CC  $g"
+    $CC $CFLAGS -DSL_MEMLCD_DISPLAY_ROTATION=${o%:*} -DSL_MEMLCD_DISPLAY_MIRROR=${o#*:} \
+        -o $OUT/$g golden_test.c $GFX
+done
+for o in $LIST_ORIENTATIONS; do
+    g=golden_test_list_r${o%:*}_m${o#*:}
+    echo "CC  $g"
+    $CC $CFLAGS $LIST_FLAGS -DSL_MEMLCD_DISPLAY_ROTATION=${o%:*} -DSL_MEMLCD_DISPLAY_MIRROR=${o#*:} \
+        -o $OUT/$g golden_test.c $GFX
+done
+
+if [ "$1" = "golden" ]; then
+    mkdir -p golden
+    ./$OUT/golden_test --update
+fi
+
+if [ "$1" = "run" ]; then
+    for p in $PROGS; do
+        echo "RUN $p"
+        ./$OUT/$p
+    done
+    for o in $ORIENTATIONS; do
+        g=golden_test_r${o%:*}_m${o#*:}
+        echo "RUN $g"
+        ./$OUT/$g
+    done
+    for o in $LIST_ORIENTATIONS; do
+        g=golden_test_list_r${o%:*}_m${o#*:}
+        echo "RUN $g"
+        ./$OUT/$g
+    done
+fi
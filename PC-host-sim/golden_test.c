@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glib.h"
+#include "dmd.h"
+#include "lcd_display.h"
+#include "host_platform.h"
+
+// Bộ ảnh chuẩn (golden) cho glib*.c + dmd_memlcd.c: mỗi cảnh được vẽ, đẩy
+// qua DMD_updateDisplay() và lcd_tx tới panel giả lập, rồi so từng điểm ảnh
+// của panel với golden/<cảnh>.pbm.
+//
+//   golden_test                 so với ảnh chuẩn
+//   golden_test --update        ghi lại ảnh chuẩn (sau khi đã xem ảnh mới là đúng)
+//   golden_test --capture DIR   ghi thêm mọi khung hình panel nhận được ra DIR
+//
+// Build với -DSL_MEMLCD_DISPLAY_ROTATION=90/180/270 và/hoặc
+// -DSL_MEMLCD_DISPLAY_MIRROR=1 thì panel nhận ảnh đã xoay/lật; ảnh được xoay
+// ngược lại trước khi so, nên mọi chế độ dùng chung một bộ ảnh chuẩn.
+
+// ================= CẤU HÌNH =================
+#define GOLDEN_DIR    "golden"
+
+static GLIB_Context_t ctx;
+
+// Ảnh 1bpp 24x16 (bit 1 là trắng): khung đen, vạch giữa và các điểm lẻ để
+// lộ lỗi lệch bit
+static const uint8_t icon24x16[] = {
+    0x00, 0x00, 0x00, 0xfe, 0xe7, 0x7f, 0xfe, 0xe7, 0x7f, 0xfa, 0xe7, 0x5f,
+    0xfe, 0xe7, 0x7f, 0xfe, 0xe7, 0x7f, 0xfe, 0xe7, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0xe7, 0x7f, 0xfe, 0xe7, 0x7f, 0xfe, 0xe7, 0x7f,
+    0xfa, 0xe7, 0x5f, 0xfe, 0xe7, 0x7f, 0xfe, 0xe7, 0x7f, 0x00, 0x00, 0x00,
+};
+
+// --- HÀM: ĐẶT LẠI NGỮ CẢNH VÀ XÓA MÀN HÌNH TRẮNG ---
+static void begin_scene(void)
+{
+    GLIB_resetClippingRegion(&ctx);
+    GLIB_applyClippingRegion(&ctx);
+    ctx.backgroundColor = White;
+    ctx.foregroundColor = Black;
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNormal8x8);
+    GLIB_clear(&ctx);
+}
+
+// ================= CÁC CẢNH =================
+static void scene_text(void)
+{
+    static const char line[] = "Temp 23.5C Hum 61%";
+
+    GLIB_drawString(&ctx, line, strlen(line), 2, 2, true);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    GLIB_drawString(&ctx, "Narrow 6x8: !\"#$%&'()*+,-./", 27, 1, 14, true);
+    GLIB_drawString(&ctx, "abc\nxyz {|}~", 12, -3, 26, false);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNumber16x20);
+    GLIB_drawString(&ctx, "12:45", 5, 5, 48, true);
+    GLIB_drawString(&ctx, "0987", 4, 100, 110, false);
+    ctx.foregroundColor = White;
+    ctx.backgroundColor = Black;
+    GLIB_drawString(&ctx, "36", 2, 3, 75, true);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNormal8x8);
+    GLIB_drawStringOnLine(&ctx, "RIGHT", 12, GLIB_ALIGN_RIGHT, -1, 0, true);
+}
+
+static void scene_lines(void)
+{
+    for (int i = 0; i <= 16; i++) {
+        GLIB_drawLine(&ctx, 64, 64, i * 8, 0);
+        GLIB_drawLine(&ctx, 64, 64, 127, i * 8);
+    }
+    for (int i = 0; i < 10; i++) {
+        GLIB_drawLineH(&ctx, -20 + i * 3, 90 + i * 3, 40 + i * 7);
+        GLIB_drawLineV(&ctx, 80 + i * 5, 140 - i * 4, 70 + i);
+    }
+    GLIB_drawLine(&ctx, -30, 127, 50, 60);
+    GLIB_drawLine(&ctx, 130, 10, 100, 200);
+}
+
+static void scene_circles(void)
+{
+    GLIB_drawCircle(&ctx, 30, 30, 25);
+    GLIB_drawCircleFilled(&ctx, 30, 30, 12);
+    GLIB_drawCircleFilled(&ctx, 100, 20, 40);
+    ctx.foregroundColor = White;
+    GLIB_drawCircleFilled(&ctx, 100, 20, 20);
+    ctx.foregroundColor = Black;
+    GLIB_drawCircle(&ctx, 64, 100, 0);
+    GLIB_drawCircle(&ctx, 64, 100, 1);
+    GLIB_drawCircle(&ctx, 64, 100, 5);
+    GLIB_drawCircleFilled(&ctx, 10, 125, 15);
+    GLIB_drawPartialCircle(&ctx, 100, 100, 20, 0x5A);
+}
+
+static void scene_polygons(void)
+{
+    static const int32_t hexagon[] = { 30, 5, 55, 18, 55, 44, 30, 57, 5, 44, 5, 18 };
+    static const int32_t star[] = { 95, 2, 103, 50, 70, 20, 122, 20, 87, 50 };
+    static const int32_t chart[] = { 0, 127, 0, 100, 16, 90, 32, 96, 48, 70, 64, 80,
+                                     80, 64, 96, 75, 112, 60, 127, 66, 127, 127 };
+    static const int32_t outline[] = { -10, 60, 60, 62, 40, 85, 140, 70 };
+
+    GLIB_drawPolygonFilled(&ctx, 6, hexagon);
+    GLIB_drawPolygonFilled(&ctx, 5, star);
+    GLIB_drawPolygonFilled(&ctx, 11, chart);
+    ctx.foregroundColor = White;
+    GLIB_drawPolygon(&ctx, 11, chart);
+    ctx.foregroundColor = Black;
+    GLIB_drawPolygon(&ctx, 4, outline);
+}
+
+static void scene_rects(void)
+{
+    GLIB_Rectangle_t r1 = { 4, 4, 60, 40 };
+    GLIB_Rectangle_t r2 = { 70, 50, 20, 10 };   // Góc ngược, phải chuẩn hóa
+    GLIB_Rectangle_t r3 = { -5, 100, 200, 110 };
+    GLIB_Rectangle_t clip = { 10, 60, 117, 121 };
+    GLIB_Rectangle_t r4 = { 0, 70, 127, 127 };
+
+    GLIB_drawRect(&ctx, &r1);
+    GLIB_drawRectFilled(&ctx, &r2);
+    GLIB_drawRectFilled(&ctx, &r3);
+    GLIB_setClippingRegion(&ctx, &clip);
+    GLIB_applyClippingRegion(&ctx);
+    ctx.foregroundColor = White;
+    GLIB_drawRectFilled(&ctx, &r4);
+    ctx.foregroundColor = Black;
+    GLIB_drawCircle(&ctx, 64, 90, 40);
+    GLIB_drawString(&ctx, "clipped text", 12, 0, 64, true);
+}
+
+static void scene_bitmaps(void)
+{
+    for (int i = 0; i < 8; i++) {
+        GLIB_drawBitmap(&ctx, i * 17 - 5, i * 15 + (i & 1), 24, 16, icon24x16);
+    }
+    GLIB_drawBitmap(&ctx, 101, 3, 24, 16, icon24x16);
+    GLIB_drawBitmap(&ctx, 115, 120, 24, 16, icon24x16);
+}
+
+static void scene_textgrid(void)
+{
+    static GLIB_TextGrid_t grid;
+
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    GLIB_textGridInit(&grid, &ctx);
+    GLIB_textGridDrawLine(&grid, "DHT20 sensor", 0, GLIB_ALIGN_CENTER, 0);
+    GLIB_textGridDrawLine(&grid, "Temp: 23.51 C", 2, GLIB_ALIGN_LEFT, 2);
+    GLIB_textGridDrawLine(&grid, "Hum:  61.20 %", 3, GLIB_ALIGN_LEFT, 2);
+    GLIB_textGridDrawLine(&grid, "Temp: 23.58 C", 2, GLIB_ALIGN_LEFT, 2);
+    GLIB_textGridDrawLine(&grid, "BLE adv", 11, GLIB_ALIGN_RIGHT, -2);
+}
+
+static void scene_scaled(void)
+{
+    GLIB_drawStringScaled(&ctx, "23.5C", 5, 2, 2, 3, true);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNarrow6x8);
+    GLIB_drawStringScaled(&ctx, "Hum 61%\nBLE", 12, -4, 30, 2, false);
+    GLIB_drawStringScaled(&ctx, "x4", 2, 90, 40, 4, true);
+    GLIB_setFont(&ctx, (GLIB_Font_t *)&GLIB_FontNumber16x20);
+    GLIB_drawStringScaled(&ctx, "42", 2, 10, 85, 2, true);
+    ctx.foregroundColor = White;
+    ctx.backgroundColor = Black;
+    GLIB_drawStringScaled(&ctx, "7", 1, 100, 100, 2, true);
+}
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+} scene_t;
+
+static const scene_t scenes[] = {
+    { "text",     scene_text },
+    { "lines",    scene_lines },
+    { "circles",  scene_circles },
+    { "polygons", scene_polygons },
+    { "rects",    scene_rects },
+    { "bitmaps",  scene_bitmaps },
+    { "textgrid", scene_textgrid },
+    { "scaled",   scene_scaled },
+};
+
+// --- HÀM: ĐỌC/GHI MỘT ĐIỂM ẢNH 1bpp ---
+static int get_pixel(const uint8_t *img, int x, int y)
+{
+    return (img[y * (HOST_PANEL_WIDTH / 8) + (x >> 3)] >> (x & 7)) & 1;
+}
+
+static void set_pixel(uint8_t *img, int x, int y, int v)
+{
+    uint8_t *p = &img[y * (HOST_PANEL_WIDTH / 8) + (x >> 3)];
+    *p = (uint8_t)((*p & ~(1u << (x & 7))) | ((unsigned)v << (x & 7)));
+}
+
+// --- HÀM: FRAMEBUFFER -> ẢNH PANEL PHẢI NHẬN (lcd_tx ĐẢO ĐIỂM/ĐẢO HÀNG) ---
+static void fb_to_panel(const uint8_t *fb, uint8_t *out)
+{
+    const int width = HOST_PANEL_WIDTH, height = HOST_PANEL_HEIGHT;
+
+    for (int py = 0; py < height; py++) {
+        for (int px = 0; px < width; px++) {
+            int fx = SL_MEMLCD_DISPLAY_REVERSE_PIXELS ? width - 1 - px : px;
+            int fy = SL_MEMLCD_DISPLAY_REVERSE_ROWS ? height - 1 - py : py;
+            set_pixel(out, px, py, get_pixel(fb, fx, fy));
+        }
+    }
+}
+
+// --- HÀM: ẢNH PANEL -> ẢNH ĐÃ VẼ, XOAY NGƯỢC CHẾ ĐỘ ĐÃ BUILD ---
+// Tính thẳng từ định nghĩa (xoay theo chiều kim đồng hồ rồi lật trái-phải),
+// không dùng các macro suy ra trong lcd_display.h, để kiểm tra cả chúng.
+static void panel_to_image(const uint8_t *panel, uint8_t *out)
+{
+    const int w = HOST_PANEL_WIDTH, h = HOST_PANEL_HEIGHT;
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int px, py;
+            switch (SL_MEMLCD_DISPLAY_ROTATION) {
+            case 90:  px = h - 1 - y; py = x;         break;
+            case 180: px = w - 1 - x; py = h - 1 - y; break;
+            case 270: px = y;         py = w - 1 - x; break;
+            default:  px = x;         py = y;         break;
+            }
+            if (SL_MEMLCD_DISPLAY_MIRROR) {
+                px = w - 1 - px;
+            }
+            set_pixel(out, x, y, get_pixel(panel, px, py));
+        }
+    }
+}
+
+// --- HÀM: SỐ ĐIỂM ẢNH KHÁC NHAU VÀ ĐIỂM KHÁC ĐẦU TIÊN ---
+static int diff_pixels(const uint8_t *a, const uint8_t *b, int *first_x, int *first_y)
+{
+    int d = 0;
+    *first_x = *first_y = -1;
+    for (uint32_t i = 0; i < HOST_PANEL_BYTES; i++) {
+        uint8_t x = a[i] ^ b[i];
+        if (x && *first_x < 0) {
+            *first_x = (int)(i % (HOST_PANEL_WIDTH / 8)) * 8 + __builtin_ctz(x);
+            *first_y = (int)(i / (HOST_PANEL_WIDTH / 8));
+        }
+        d += __builtin_popcount(x);
+    }
+    return d;
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t golden[HOST_PANEL_BYTES];
+    static uint8_t expected_panel[HOST_PANEL_BYTES];
+    static uint8_t image[HOST_PANEL_BYTES];
+    int update = 0;
+    int failures = 0;
+    void *fb;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = 1;
+        } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            host_panel_capture(argv[++i]);
+        } else {
+            printf("dung: %s [--update] [--capture DIR]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    DMD_init(NULL);
+    GLIB_contextInit(&ctx);
+    DMD_getFrameBuffer(&fb);
+
+    printf("xoay %d do, lat %d%s\n", SL_MEMLCD_DISPLAY_ROTATION, SL_MEMLCD_DISPLAY_MIRROR,
+           SL_MEMLCD_DISPLAY_LIST ? ", display list" : "");
+    printf("%-10s %6s %8s  %s\n", "scene", "rows", "bytes", "result");
+    for (size_t s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++) {
+        char path[256];
+        const host_spi_stats_t *st;
+        int fx, fy;
+
+        // Mỗi cảnh bắt đầu từ màn hình trắng đã nằm trên panel
+        begin_scene();
+        DMD_updateDisplay();
+        host_spi_reset_stats();
+
+        scenes[s].draw();
+        DMD_updateDisplay();
+        st = host_spi_get_stats();
+
+        snprintf(path, sizeof(path), GOLDEN_DIR "/%s.pbm", scenes[s].name);
+        // Chế độ display list không có framebuffer: chỉ so với ảnh chuẩn
+        if (fb != NULL) {
+            fb_to_panel(fb, expected_panel);
+        } else {
+            memcpy(expected_panel, host_panel_memory(), HOST_PANEL_BYTES);
+        }
+        panel_to_image(host_panel_memory(), image);
+        if (st->errors != 0 || memcmp(host_panel_memory(), expected_panel, HOST_PANEL_BYTES) != 0) {
+            printf("%-10s %6llu %8llu  FAIL: panel khac framebuffer\n", scenes[s].name,
+                   (unsigned long long)st->rows, (unsigned long long)st->bytes);
+            failures++;
+        } else if (update) {
+            if (host_pbm_write(path, image) != 0) {
+                printf("%-10s FAIL: khong ghi duoc %s\n", scenes[s].name, path);
+                failures++;
+                continue;
+            }
+            printf("%-10s %6llu %8llu  da ghi %s\n", scenes[s].name,
+                   (unsigned long long)st->rows, (unsigned long long)st->bytes, path);
+        } else if (host_pbm_read(path, golden) != 0) {
+            printf("%-10s FAIL: khong doc duoc %s\n", scenes[s].name, path);
+            failures++;
+        } else {
+            int d = diff_pixels(golden, image, &fx, &fy);
+            if (d) {
+                printf("%-10s %6llu %8llu  FAIL: %d diem anh khac, dau tien (%d,%d)\n",
+                       scenes[s].name, (unsigned long long)st->rows,
+                       (unsigned long long)st->bytes, d, fx, fy);
+                failures++;
+            } else {
+                printf("%-10s %6llu %8llu  ok\n", scenes[s].name,
+                       (unsigned long long)st->rows, (unsigned long long)st->bytes);
+            }
+        }
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    if (update) {
+        printf("OK: da ghi %zu anh chuan vao " GOLDEN_DIR "/\n", sizeof(scenes) / sizeof(scenes[0]));
+    } else {
+        printf("OK: %zu canh giong het anh chuan\n", sizeof(scenes) / sizeof(scenes[0]));
+    }
+    return EXIT_SUCCESS;
+}
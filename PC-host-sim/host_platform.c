@@ -0,0 +1,775 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_platform.h"
+#include "em_device.h"
+#include "em_gpio.h"
+#include "em_usart.h"
+#include "sl_clock_manager.h"
+#include "sl_sleeptimer.h"
+#include "sl_udelay.h"
+#include "sl_bt_api.h"
+#include "sl_i2cspm_instances.h"
+#include "lcd.h"
+#include "lcd_display.h"
+
+#define HOST_GPIO_PORTS       4
+#define HOST_MAX_TIMERS       16
+
+#define PANEL_ROW_BYTES       (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP / 8)
+#define PANEL_CMD_UPDATE      0x01
+#define PANEL_CMD_ALL_CLEAR   0x04
+// Cửa sổ SCS dài nhất: CMD, mọi hàng {địa chỉ, dữ liệu, dummy}, dummy cuối
+#define PANEL_MAX_WINDOW      (2 + SL_MEMLCD_DISPLAY_HEIGHT * (PANEL_ROW_BYTES + 2))
+
+USART_TypeDef host_usart2;
+
+static uint32_t gpio_out[HOST_GPIO_PORTS];
+static host_spi_stats_t spi_stats;
+
+static uint8_t spi_log[HOST_SPI_LOG_BYTES];
+static uint32_t spi_log_len;
+static uint32_t window_start;
+
+static uint8_t panel[SL_MEMLCD_DISPLAY_HEIGHT * PANEL_ROW_BYTES];
+static host_panel_frame_t last_frame;
+static uint32_t row_counts[SL_MEMLCD_DISPLAY_HEIGHT];
+static const char *capture_dir;
+
+_Static_assert(sizeof(panel) == HOST_PANEL_BYTES
+               && SL_MEMLCD_DISPLAY_HEIGHT == HOST_PANEL_HEIGHT,
+               "HOST_PANEL_* khac kich thuoc man hinh");
+
+// Truyền bất đồng bộ đang chờ "ngắt" hoàn tất
+static struct {
+    const uint8_t *data;
+    unsigned len;
+    unsigned sent;
+    sli_memlcd_spi_callback_t callback;
+    void *context;
+    int pending;
+} async_tx;
+
+static void panel_decode_window(const uint8_t *p, uint32_t len);
+
+static uint64_t now_tick;
+static sl_sleeptimer_timer_handle_t *timers[HOST_MAX_TIMERS];
+
+// ================= GPIO =================
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin,
+                     GPIO_Mode_TypeDef mode, unsigned int out)
+{
+    (void)mode;
+    if (out) {
+        gpio_out[port] |= 1u << pin;
+    } else {
+        gpio_out[port] &= ~(1u << pin);
+    }
+}
+
+static int is_cs(GPIO_Port_TypeDef port, unsigned int pin)
+{
+    return port == SL_MEMLCD_SPI_CS_PORT && pin == SL_MEMLCD_SPI_CS_PIN;
+}
+
+void GPIO_PinOutSet(GPIO_Port_TypeDef port, unsigned int pin)
+{
+    // Cạnh lên của SCS mở một cửa sổ truyền mới
+    if (is_cs(port, pin) && !(gpio_out[port] & (1u << pin))) {
+        spi_stats.cs_windows++;
+        spi_stats.cs_toggles++;
+        // Nhật ký gần đầy thì quay lại từ đầu, để cửa sổ mới luôn ghi đủ
+        if (spi_log_len + PANEL_MAX_WINDOW > HOST_SPI_LOG_BYTES) {
+            spi_log_len = 0;
+        }
+        window_start = spi_log_len;
+    }
+    gpio_out[port] |= 1u << pin;
+}
+
+void GPIO_PinOutClear(GPIO_Port_TypeDef port, unsigned int pin)
+{
+    // Cạnh xuống của SCS kết thúc cửa sổ: giải mã những gì đã nhận
+    if (is_cs(port, pin) && (gpio_out[port] & (1u << pin))) {
+        spi_stats.cs_toggles++;
+        panel_decode_window(&spi_log[window_start], spi_log_len - window_start);
+    }
+    gpio_out[port] &= ~(1u << pin);
+}
+
+void GPIO_PinOutToggle(GPIO_Port_TypeDef port, unsigned int pin)
+{
+    gpio_out[port] ^= 1u << pin;
+}
+
+unsigned int GPIO_PinOutGet(GPIO_Port_TypeDef port, unsigned int pin)
+{
+    return (gpio_out[port] >> pin) & 1u;
+}
+
+unsigned int host_gpio_get(unsigned int port, unsigned int pin)
+{
+    return GPIO_PinOutGet((GPIO_Port_TypeDef)port, pin);
+}
+
+// ================= CLOCK / UDELAY =================
+sl_status_t sl_clock_manager_enable_bus_clock(sl_bus_clock_t clock)
+{
+    (void)clock;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_clock_manager_disable_bus_clock(sl_bus_clock_t clock)
+{
+    (void)clock;
+    return SL_STATUS_OK;
+}
+
+void sl_udelay_wait(unsigned us)
+{
+    spi_stats.udelay_us += us;
+}
+
+// ================= SPI CỦA MEMORY LCD =================
+sl_status_t sli_memlcd_spi_init(sli_memlcd_spi_handle_t *handle, int baudrate, USART_ClockMode_TypeDef mode)
+{
+    (void)handle;
+    (void)baudrate;
+    (void)mode;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sli_memlcd_spi_shutdown(sli_memlcd_spi_handle_t *handle)
+{
+    (void)handle;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sli_memlcd_spi_tx(sli_memlcd_spi_handle_t *handle, const void *data, unsigned len)
+{
+    const uint8_t *p = data;
+    (void)handle;
+
+    // Byte gửi ngoài cửa sổ SCS là lỗi: màn hình sẽ bỏ qua
+    if (!GPIO_PinOutGet(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN)) {
+        spi_stats.errors++;
+    }
+    for (unsigned i = 0; i < len; i++) {
+        if (spi_log_len < HOST_SPI_LOG_BYTES) {
+            spi_log[spi_log_len++] = p[i];
+        }
+    }
+    spi_stats.bytes += len;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sli_memlcd_spi_tx_async(sli_memlcd_spi_handle_t *handle,
+                                    const void *data, unsigned len,
+                                    sli_memlcd_spi_callback_t callback,
+                                    void *context)
+{
+    (void)handle;
+    if (async_tx.pending) {
+        return SL_STATUS_BUSY;
+    }
+    if (len == 0) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    async_tx.data = data;
+    async_tx.len = len;
+    async_tx.sent = 0;
+    async_tx.callback = callback;
+    async_tx.context = context;
+    async_tx.pending = 1;
+    spi_stats.async_tx++;
+    return SL_STATUS_OK;
+}
+
+bool sli_memlcd_spi_tx_busy(sli_memlcd_spi_handle_t *handle)
+{
+    (void)handle;
+    if (async_tx.pending && ++async_tx.sent >= async_tx.len) {
+        host_spi_async_complete();
+    }
+    return async_tx.pending;
+}
+
+void sli_memlcd_spi_irq_handler(sli_memlcd_spi_handle_t *handle)
+{
+    (void)handle;
+}
+
+int host_spi_async_pending(void)
+{
+    return async_tx.pending;
+}
+
+void host_spi_async_complete(void)
+{
+    if (!async_tx.pending) {
+        return;
+    }
+    // Byte được đọc từ bộ đệm lúc này, nên nếu driver sửa bộ đệm trong khi
+    // đang truyền thì panel giả lập sẽ nhận dữ liệu sai
+    async_tx.pending = 0;
+    sli_memlcd_spi_tx(NULL, async_tx.data, async_tx.len);
+    if (async_tx.callback != NULL) {
+        async_tx.callback(async_tx.context);
+    }
+}
+
+void sli_memlcd_spi_wait(sli_memlcd_spi_handle_t *handle)
+{
+    (void)handle;
+    spi_stats.spi_waits++;
+}
+
+void sli_memlcd_spi_rx_flush(sli_memlcd_spi_handle_t *handle)
+{
+    (void)handle;
+}
+
+void host_spi_reset_stats(void)
+{
+    memset(&spi_stats, 0, sizeof(spi_stats));
+    memset(row_counts, 0, sizeof(row_counts));
+    spi_log_len = 0;
+    window_start = 0;
+}
+
+const host_spi_stats_t *host_spi_get_stats(void)
+{
+    return &spi_stats;
+}
+
+const uint8_t *host_spi_log(uint32_t *len)
+{
+    *len = spi_log_len;
+    return spi_log;
+}
+
+double host_spi_wire_us(const host_spi_stats_t *stats)
+{
+    return stats->bytes * 8 * 1e6 / SL_MEMLCD_SCLK_FREQ + stats->udelay_us;
+}
+
+// ================= PANEL GIẢ LẬP =================
+const uint8_t *host_panel_memory(void)
+{
+    return panel;
+}
+
+const host_panel_frame_t *host_panel_last_frame(void)
+{
+    return &last_frame;
+}
+
+const uint32_t *host_panel_row_counts(void)
+{
+    return row_counts;
+}
+
+void host_panel_capture(const char *dir)
+{
+    capture_dir = dir;
+}
+
+// --- HÀM: PBM NHỊ PHÂN: HÀNG ĐỆM THEO BYTE, MSB LÀ ĐIỂM TRÁI, BIT 1 LÀ ĐEN ---
+int host_pbm_write(const char *path, const uint8_t *pixels)
+{
+    FILE *f = fopen(path, "wb");
+    int ok;
+
+    if (f == NULL) {
+        return -1;
+    }
+    fprintf(f, "P4\n%u %u\n", HOST_PANEL_WIDTH, HOST_PANEL_HEIGHT);
+    for (uint32_t i = 0; i < HOST_PANEL_BYTES; i++) {
+        // Đảo thứ tự bit và đảo màu
+        uint8_t b = pixels[i], r = 0;
+        for (int k = 0; k < 8; k++) {
+            r |= ((b >> k) & 1) << (7 - k);
+        }
+        fputc((uint8_t)~r, f);
+    }
+    ok = ferror(f) == 0;
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
+
+int host_pbm_read(const char *path, uint8_t *pixels)
+{
+    FILE *f = fopen(path, "rb");
+    unsigned w = 0, h = 0;
+    int ok;
+
+    if (f == NULL) {
+        return -1;
+    }
+    ok = fscanf(f, "P4 %u %u", &w, &h) == 2 && fgetc(f) != EOF
+         && w == HOST_PANEL_WIDTH && h == HOST_PANEL_HEIGHT
+         && fread(pixels, 1, HOST_PANEL_BYTES, f) == HOST_PANEL_BYTES;
+    fclose(f);
+    if (!ok) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < HOST_PANEL_BYTES; i++) {
+        uint8_t b = (uint8_t)~pixels[i], r = 0;
+        for (int k = 0; k < 8; k++) {
+            r |= ((b >> k) & 1) << (7 - k);
+        }
+        pixels[i] = r;
+    }
+    return 0;
+}
+
+// --- HÀM: GIẢI MÃ MỘT CỬA SỔ SCS ---
+// Update: CMD, rồi {địa chỉ, dữ liệu 1 hàng, dummy} cho từng hàng, cuối cùng
+// thêm một byte dummy. All clear: CMD + 1 byte dummy.
+static void panel_decode_window(const uint8_t *p, uint32_t len)
+{
+    uint32_t pos = 1;
+
+    if (len == 0) {
+        spi_stats.errors++;
+        return;
+    }
+    if (p[0] & PANEL_CMD_ALL_CLEAR) {
+        memset(panel, 0xFF, sizeof(panel));
+        return;
+    }
+    if (!(p[0] & PANEL_CMD_UPDATE)) {
+        spi_stats.errors++;
+        return;
+    }
+
+    memset(&last_frame.sent, 0, sizeof(last_frame.sent));
+    last_frame.index++;
+    last_frame.rows = 0;
+    last_frame.bytes = len;
+
+    while (len - pos >= 1 + PANEL_ROW_BYTES + 1) {
+        uint8_t row = p[pos];
+        if (row >= SL_MEMLCD_DISPLAY_HEIGHT) {
+            spi_stats.errors++;
+            return;
+        }
+        memcpy(&panel[row * PANEL_ROW_BYTES], &p[pos + 1], PANEL_ROW_BYTES);
+        spi_stats.rows++;
+        last_frame.sent[row] = 1;
+        last_frame.rows++;
+        row_counts[row]++;
+        pos += 1 + PANEL_ROW_BYTES + 1;
+    }
+
+    // Phải còn đúng một byte dummy kết thúc
+    if (len - pos != 1) {
+        spi_stats.errors++;
+    }
+
+    if (capture_dir != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%05u.pbm", capture_dir, last_frame.index);
+        if (host_pbm_write(path, panel) != 0) {
+            spi_stats.errors++;
+        }
+    }
+}
+
+// ================= SLEEPTIMER ẢO =================
+static sl_status_t timer_arm(sl_sleeptimer_timer_handle_t *handle, uint32_t timeout,
+                             uint32_t periodic, sl_sleeptimer_timer_callback_t callback,
+                             void *callback_data)
+{
+    int free_slot = -1;
+
+    for (int i = 0; i < HOST_MAX_TIMERS; i++) {
+        if (timers[i] == handle) {
+            free_slot = i;
+            break;
+        }
+        if (timers[i] == NULL && free_slot < 0) {
+            free_slot = i;
+        }
+    }
+    if (free_slot < 0) {
+        return SL_STATUS_NO_MORE_RESOURCE;
+    }
+
+    handle->callback = callback;
+    handle->callback_data = callback_data;
+    handle->timeout_periodic = periodic;
+    handle->expire_tick = now_tick + timeout;
+    handle->running = true;
+    timers[free_slot] = handle;
+    return SL_STATUS_OK;
+}
+
+uint32_t sl_sleeptimer_get_timer_frequency(void)
+{
+    return HOST_SLEEPTIMER_FREQ;
+}
+
+uint32_t sl_sleeptimer_get_tick_count(void)
+{
+    return (uint32_t)now_tick;
+}
+
+uint64_t sl_sleeptimer_get_tick_count64(void)
+{
+    return now_tick;
+}
+
+uint32_t sl_sleeptimer_ms_to_tick(uint16_t time_ms)
+{
+    return (uint32_t)(((uint64_t)time_ms * HOST_SLEEPTIMER_FREQ) / 1000u);
+}
+
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick)
+{
+    return (uint32_t)(((uint64_t)tick * 1000u) / HOST_SLEEPTIMER_FREQ);
+}
+
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags)
+{
+    (void)priority;
+    (void)option_flags;
+    if (handle->running) {
+        return SL_STATUS_INVALID_STATE;
+    }
+    return timer_arm(handle, timeout, 0, callback, callback_data);
+}
+
+sl_status_t sl_sleeptimer_start_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                         uint32_t timeout_ms,
+                                         sl_sleeptimer_timer_callback_t callback,
+                                         void *callback_data,
+                                         uint8_t priority,
+                                         uint16_t option_flags)
+{
+    uint32_t ticks = (uint32_t)(((uint64_t)timeout_ms * HOST_SLEEPTIMER_FREQ) / 1000u);
+    return sl_sleeptimer_start_timer(handle, ticks, callback, callback_data,
+                                     priority, option_flags);
+}
+
+sl_status_t sl_sleeptimer_restart_periodic_timer(sl_sleeptimer_timer_handle_t *handle,
+                                                 uint32_t timeout,
+                                                 sl_sleeptimer_timer_callback_t callback,
+                                                 void *callback_data,
+                                                 uint8_t priority,
+                                                 uint16_t option_flags)
+{
+    (void)priority;
+    (void)option_flags;
+    return timer_arm(handle, timeout, timeout, callback, callback_data);
+}
+
+sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                  uint32_t timeout_ms,
+                                                  sl_sleeptimer_timer_callback_t callback,
+                                                  void *callback_data,
+                                                  uint8_t priority,
+                                                  uint16_t option_flags)
+{
+    uint32_t ticks = (uint32_t)(((uint64_t)timeout_ms * HOST_SLEEPTIMER_FREQ) / 1000u);
+    (void)priority;
+    (void)option_flags;
+    if (handle->running) {
+        return SL_STATUS_INVALID_STATE;
+    }
+    return timer_arm(handle, ticks, ticks, callback, callback_data);
+}
+
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
+{
+    for (int i = 0; i < HOST_MAX_TIMERS; i++) {
+        if (timers[i] == handle) {
+            timers[i] = NULL;
+        }
+    }
+    if (!handle->running) {
+        return SL_STATUS_INVALID_STATE;
+    }
+    handle->running = false;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle,
+                                           bool *running)
+{
+    *running = handle->running;
+    return SL_STATUS_OK;
+}
+
+void sl_sleeptimer_delay_millisecond(uint16_t time_ms)
+{
+    host_time_advance_ms(time_ms);
+}
+
+void host_time_advance_ms(uint32_t ms)
+{
+    uint64_t target = now_tick + ((uint64_t)ms * HOST_SLEEPTIMER_FREQ) / 1000u;
+
+    // Gọi lần lượt từng timer theo thứ tự hết hạn, giống hàng đợi của SDK
+    for (;;) {
+        sl_sleeptimer_timer_handle_t *next = NULL;
+        int next_slot = -1;
+
+        for (int i = 0; i < HOST_MAX_TIMERS; i++) {
+            if (timers[i] != NULL && timers[i]->expire_tick <= target
+                && (next == NULL || timers[i]->expire_tick < next->expire_tick)) {
+                next = timers[i];
+                next_slot = i;
+            }
+        }
+        if (next == NULL) {
+            break;
+        }
+
+        now_tick = next->expire_tick;
+        if (next->timeout_periodic) {
+            next->expire_tick += next->timeout_periodic;
+        } else {
+            next->running = false;
+            timers[next_slot] = NULL;
+        }
+        next->callback(next, next->callback_data);
+    }
+    now_tick = target;
+}
+
+// ================= EXTERNAL SIGNAL CỦA STACK BLE =================
+static uint32_t bt_signals;
+
+sl_status_t sl_bt_external_signal(uint32_t signals)
+{
+    bt_signals |= signals;
+    return SL_STATUS_OK;
+}
+
+uint32_t host_bt_take_signals(void)
+{
+    uint32_t signals = bt_signals;
+    bt_signals = 0;
+    return signals;
+}
+
+// ================= NVIC =================
+static uint64_t nvic_enabled;
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    nvic_enabled |= 1ull << irq;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    nvic_enabled &= ~(1ull << irq);
+}
+
+// ================= BUS I2C GIẢ LẬP =================
+I2C_TypeDef host_i2c0;
+sl_i2cspm_t *sl_i2cspm_sensor = &host_i2c0;
+
+static struct {
+    host_i2c_device_t device;
+    void *ctx;
+    uint32_t stretch_us;
+    int hung;
+} i2c_devices[128];
+static host_i2c_stats_t i2c_stats;
+
+// Transfer của I2C_TransferInit() đang chờ I2C_Transfer() lấy kết quả
+static struct {
+    I2C_TransferReturn_TypeDef result;
+    int active;
+    int hung;
+    sl_sleeptimer_timer_handle_t irq_timer;
+} i2c0;
+
+void host_i2c_attach(uint8_t addr, host_i2c_device_t device, void *ctx)
+{
+    i2c_devices[addr & 0x7F].device = device;
+    i2c_devices[addr & 0x7F].ctx = ctx;
+}
+
+void host_i2c_set_stretch_us(uint8_t addr, uint32_t us)
+{
+    i2c_devices[addr & 0x7F].stretch_us = us;
+}
+
+void host_i2c_set_hung(uint8_t addr, int hung)
+{
+    i2c_devices[addr & 0x7F].hung = hung;
+}
+
+void host_i2c_reset_stats(void)
+{
+    memset(&i2c_stats, 0, sizeof(i2c_stats));
+}
+
+const host_i2c_stats_t *host_i2c_get_stats(void)
+{
+    return &i2c_stats;
+}
+
+// Một pha: START, byte địa chỉ, len byte dữ liệu, mỗi byte 9 bit kể cả ACK
+static int i2c_phase(uint8_t addr, int read, uint8_t *data, uint16_t len)
+{
+    uint32_t bits = 1 + 9 * (1u + len);
+
+    i2c_stats.bus_us += (bits * 1000000u + HOST_I2C_FREQ - 1) / HOST_I2C_FREQ;
+    if (i2c_devices[addr].device == NULL
+        || i2c_devices[addr].device(i2c_devices[addr].ctx, read, data, len) != 0) {
+        return -1;
+    }
+    i2c_stats.bus_us += i2c_devices[addr].stretch_us;
+    i2c_stats.bytes += len;
+    return 0;
+}
+
+// Chạy cả transfer trên bus, cộng thời gian trên dây vào i2c_stats.bus_us
+static I2C_TransferReturn_TypeDef i2c_run(I2C_TransferSeq_TypeDef *seq)
+{
+    uint8_t addr = (uint8_t)((seq->addr >> 1) & 0x7F);
+    int nack;
+
+    i2c_stats.transfers++;
+    switch (seq->flags) {
+        case I2C_FLAG_WRITE:
+            nack = i2c_phase(addr, 0, seq->buf[0].data, seq->buf[0].len);
+            break;
+        case I2C_FLAG_READ:
+            nack = i2c_phase(addr, 1, seq->buf[0].data, seq->buf[0].len);
+            break;
+        case I2C_FLAG_WRITE_READ:
+            nack = i2c_phase(addr, 0, seq->buf[0].data, seq->buf[0].len)
+                   || i2c_phase(addr, 1, seq->buf[1].data, seq->buf[1].len);
+            break;
+        default:
+            return i2cTransferUsageFault;
+    }
+    // STOP
+    i2c_stats.bus_us += (1000000u + HOST_I2C_FREQ - 1) / HOST_I2C_FREQ;
+    if (nack) {
+        i2c_stats.nacks++;
+        return i2cTransferNack;
+    }
+    return i2cTransferDone;
+}
+
+I2C_TransferReturn_TypeDef I2CSPM_Transfer(sl_i2cspm_t *i2c, I2C_TransferSeq_TypeDef *seq)
+{
+    I2C_TransferReturn_TypeDef ret = i2c_run(seq);
+
+    (void)i2c;
+    // Thiết bị treo bus: I2CSPM_Transfer() thật hết I2CSPM_TRANSFER_TIMEOUT
+    // lần hỏi vòng và trả về trạng thái đang chạy
+    if (ret != i2cTransferUsageFault && i2c_devices[(seq->addr >> 1) & 0x7F].hung) {
+        return i2cTransferInProgress;
+    }
+    return ret;
+}
+
+// Lệnh ghi vào CMD được xử lý ở lần kế tiếp phần cứng giả lập được chạm tới
+static void i2c0_command(void)
+{
+    if (host_i2c0.CMD & I2C_CMD_ABORT) {
+        if (i2c0.active) {
+            i2c_stats.aborts++;
+        }
+        i2c0.active = 0;
+        i2c0.hung = 0;
+        sl_sleeptimer_stop_timer(&i2c0.irq_timer);
+    }
+    host_i2c0.CMD = 0;
+}
+
+void I2C_IntClear(I2C_TypeDef *i2c, uint32_t flags)
+{
+    (void)flags;
+    (void)i2c;
+    i2c0_command();
+}
+
+void I2C_IntDisable(I2C_TypeDef *i2c, uint32_t flags)
+{
+    (void)flags;
+    (void)i2c;
+    i2c0_command();
+}
+
+// Handler mặc định như bảng vector của CMSIS, i2c_bus.c định nghĩa bản thật
+__attribute__((weak)) void I2C0_IRQHandler(void)
+{
+    I2C_Transfer(I2C0);
+}
+
+static void i2c0_irq(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+    (void)handle;
+    (void)data;
+    i2c0_command();
+    if (i2c0.active && (nvic_enabled & (1ull << I2C0_IRQn))) {
+        I2C0_IRQHandler();
+    }
+}
+
+I2C_TransferReturn_TypeDef I2C_TransferInit(I2C_TypeDef *i2c, I2C_TransferSeq_TypeDef *seq)
+{
+    uint64_t bus_us = i2c_stats.bus_us;
+    uint64_t ticks;
+
+    (void)i2c;
+    i2c0_command();
+    if (i2c0.active) {
+        i2c_stats.collisions++;
+    }
+    // Thiết bị thấy transfer ngay lúc bắt đầu, kết quả chỉ có sau thời gian
+    // trên dây (ngắt của lần cuối cùng)
+    i2c0.result = i2c_run(seq);
+    if (i2c0.result == i2cTransferUsageFault) {
+        return i2c0.result;
+    }
+    i2c0.active = 1;
+    // Thiết bị giữ SDA: transfer không bao giờ kết thúc, không có ngắt
+    i2c0.hung = i2c_devices[(seq->addr >> 1) & 0x7F].hung;
+    if (!i2c0.hung && (nvic_enabled & (1ull << I2C0_IRQn))) {
+        ticks = ((i2c_stats.bus_us - bus_us) * HOST_SLEEPTIMER_FREQ + 999999u) / 1000000u;
+        timer_arm(&i2c0.irq_timer, (uint32_t)ticks, 0, i2c0_irq, NULL);
+    }
+    return i2cTransferInProgress;
+}
+
+I2C_TransferReturn_TypeDef I2C_Transfer(I2C_TypeDef *i2c)
+{
+    (void)i2c;
+    i2c0_command();
+    if (!i2c0.active) {
+        return i2cTransferSwFault;
+    }
+    // Đang chờ ngắt: hỏi vòng trước khi dây chạy xong vẫn thấy chưa xong
+    if (i2c0.hung || i2c0.irq_timer.running) {
+        return i2cTransferInProgress;
+    }
+    i2c0.active = 0;
+    return i2c0.result;
+}
+
+// ================= ĐỒNG HỒ THẬT =================
+uint64_t host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
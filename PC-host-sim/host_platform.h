@@ -0,0 +1,134 @@
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stdint.h>
+
+// ================= NỀN TẢNG GIẢ LẬP TRÊN PC =================
+// Thay thế GPIO, udelay, sleeptimer, clock và SPI của memory LCD để các
+// driver thật (lcd.c, dmd_memlcd.c, glib*.c) chạy được trên máy tính.
+
+// Tần số sleeptimer giả lập, giống RTC 32.768 kHz trên board
+#define HOST_SLEEPTIMER_FREQ  32768u
+
+// Kích thước nhật ký byte SPI, đủ cho vài chục khung hình đầy đủ
+#define HOST_SPI_LOG_BYTES    (256u * 1024u)
+
+// Kích thước panel giả lập, bằng SL_MEMLCD_DISPLAY_WIDTH/HEIGHT
+#define HOST_PANEL_WIDTH      128u
+#define HOST_PANEL_HEIGHT     128u
+#define HOST_PANEL_BYTES      (HOST_PANEL_WIDTH * HOST_PANEL_HEIGHT / 8u)
+
+// Thống kê đường SPI tới màn hình
+typedef struct {
+    uint64_t bytes;         // Tổng số byte đã gửi
+    uint64_t cs_windows;    // Số lần SCS được kéo lên
+    uint64_t cs_toggles;    // Số cạnh lên + xuống của SCS
+    uint64_t udelay_us;     // Tổng thời gian chờ bận (setup/hold)
+    uint64_t spi_waits;     // Số lần chờ USART truyền xong
+    uint64_t rows;          // Số hàng panel đã nhận (giải mã từ byte stream)
+    uint64_t errors;        // Số cửa sổ SCS sai giao thức
+    uint64_t async_tx;      // Số lần truyền bằng ngắt
+} host_spi_stats_t;
+
+// --- HÀM: ĐẶT LẠI TOÀN BỘ THỐNG KÊ VÀ NHẬT KÝ ---
+void host_spi_reset_stats(void);
+const host_spi_stats_t *host_spi_get_stats(void);
+
+// --- HÀM: LẤY NHẬT KÝ BYTE (THỨ TỰ LOGIC, TRƯỚC KHI ĐẢO BIT CHO USART) ---
+// Khi sắp đầy, nhật ký quay lại từ đầu ở cửa sổ SCS kế tiếp.
+const uint8_t *host_spi_log(uint32_t *len);
+
+// --- HÀM: TRUYỀN BẤT ĐỒNG BỘ (GIẢ LẬP NGẮT TX CỦA USART) ---
+// sli_memlcd_spi_tx_async() chỉ ghi nhận yêu cầu; byte được đọc từ bộ đệm
+// và callback được gọi khi host_spi_async_complete() chạy, giống lúc ngắt
+// TXC xảy ra. Mỗi lần driver hỏi sli_memlcd_spi_tx_busy() coi như một byte
+// đã đi ra dây, nên vòng chờ bận của driver vẫn kết thúc được.
+int host_spi_async_pending(void);
+void host_spi_async_complete(void);
+
+// --- HÀM: THỜI GIAN ƯỚC TÍNH TRÊN DÂY (µs) Ở TẦN SỐ SCLK CỦA DRIVER ---
+double host_spi_wire_us(const host_spi_stats_t *stats);
+
+// --- HÀM: BỘ NHỚ ĐIỂM ẢNH CỦA PANEL GIẢ LẬP ---
+// Mỗi cửa sổ SCS được giải mã theo giao thức Sharp memory LCD và ghi vào
+// đây, cùng định dạng với framebuffer của dmd_memlcd.c.
+const uint8_t *host_panel_memory(void);
+
+// Một khung hình panel đã nhận = một cửa sổ SCS mang lệnh update
+typedef struct {
+    uint32_t index;                     // Số thứ tự khung, đếm từ 1
+    uint32_t rows;                      // Số hàng trong khung
+    uint32_t bytes;                     // Số byte của cửa sổ SCS
+    uint8_t  sent[HOST_PANEL_HEIGHT];   // 1 nếu hàng có trong khung
+} host_panel_frame_t;
+
+// --- HÀM: KHUNG HÌNH CUỐI CÙNG VÀ SỐ LẦN MỖI HÀNG ĐƯỢC GỬI ---
+// Số lần gửi từng hàng cộng dồn từ lần host_spi_reset_stats() gần nhất.
+const host_panel_frame_t *host_panel_last_frame(void);
+const uint32_t *host_panel_row_counts(void);
+
+// --- HÀM: GHI MỖI KHUNG HÌNH NHẬN ĐƯỢC RA FILE PBM ---
+// Bật bằng một thư mục có sẵn (file dir/frame_00001.pbm, ...), tắt bằng NULL.
+void host_panel_capture(const char *dir);
+
+// --- HÀM: ĐỌC/GHI ẢNH PBM (P4) ---
+// Ảnh cùng định dạng framebuffer: HOST_PANEL_BYTES byte, điểm ảnh x ở bit
+// (x & 7) của byte x / 8, bit 1 là trắng. Trả về 0 nếu thành công.
+int host_pbm_write(const char *path, const uint8_t *pixels);
+int host_pbm_read(const char *path, uint8_t *pixels);
+
+// --- HÀM: CHO ĐỒNG HỒ ẢO CHẠY VÀ GỌI CÁC TIMER ĐÃ HẾT HẠN ---
+void host_time_advance_ms(uint32_t ms);
+
+// --- HÀM: ĐỌC MỨC LOGIC CỦA MỘT CHÂN GPIO ---
+unsigned int host_gpio_get(unsigned int port, unsigned int pin);
+
+// --- HÀM: LẤY VÀ XÓA CÁC BIT sl_bt_external_signal() ĐANG CHỜ ---
+// Giống sl_bt_evt_system_external_signal_id: các bit gửi nhiều lần trước
+// khi được xử lý gộp thành một sự kiện.
+uint32_t host_bt_take_signals(void);
+
+// ================= BUS I2C GIẢ LẬP =================
+// I2CSPM_Transfer() (sl_i2cspm_instances.h) và ngoại vi I2C0 của emlib
+// (I2C_TransferInit()/I2C_Transfer(), em_i2c.h) chạy trên bus này: mỗi pha
+// ghi hoặc đọc của một transfer được giao cho thiết bị gắn ở địa chỉ 7 bit.
+// Địa chỉ không có thiết bị trả về NACK.
+//
+// Khi ngắt I2C0_IRQn đang bật (NVIC_EnableIRQ()), I2C_TransferInit() hẹn
+// gọi I2C0_IRQHandler() bằng sleeptimer ảo sau thời gian trên dây, nên
+// transfer theo ngắt chiếm thời gian thật của host_time_advance_ms().
+
+// Tần số SCL, bằng chế độ chuẩn của sl_i2cspm_sensor
+#define HOST_I2C_FREQ         100000u
+
+// Một thiết bị trên bus: read = 1 khi master đọc len byte vào data, 0 khi
+// master ghi len byte từ data. Trả về 0 nếu thiết bị ACK.
+typedef int (*host_i2c_device_t)(void *ctx, int read, uint8_t *data, uint16_t len);
+
+typedef struct {
+    uint64_t transfers;     // Số transfer đã chạy trên bus
+    uint64_t bytes;         // Số byte dữ liệu (không tính byte địa chỉ)
+    uint64_t nacks;         // Số transfer bị NACK
+    uint64_t bus_us;        // Thời gian trên dây ở HOST_I2C_FREQ (µs)
+    uint64_t collisions;    // I2C_TransferInit() khi transfer trước chưa xong
+    uint64_t aborts;        // Transfer bị hủy bằng I2C_CMD_ABORT
+} host_i2c_stats_t;
+
+// --- HÀM: GẮN/GỠ (device = NULL) THIẾT BỊ Ở ĐỊA CHỈ 7 BIT ---
+void host_i2c_attach(uint8_t addr, host_i2c_device_t device, void *ctx);
+
+// --- HÀM: THIẾT BỊ GIỮ SCL (CLOCK STRETCHING) THÊM us MỖI PHA ĐƯỢC ACK ---
+void host_i2c_set_stretch_us(uint8_t addr, uint32_t us);
+
+// --- HÀM: THIẾT BỊ GIỮ SDA Ở MỨC THẤP (hung = 1) HOẶC THẢ RA (hung = 0) ---
+// Transfer tới địa chỉ này không bao giờ xong: không có ngắt, I2C_Transfer()
+// trả i2cTransferInProgress mãi cho tới khi bị hủy bằng I2C_CMD_ABORT.
+void host_i2c_set_hung(uint8_t addr, int hung);
+
+void host_i2c_reset_stats(void);
+const host_i2c_stats_t *host_i2c_get_stats(void);
+
+// --- HÀM: ĐỒNG HỒ THẬT (ns) DÙNG CHO BENCHMARK ---
+uint64_t host_now_ns(void);
+
+#endif
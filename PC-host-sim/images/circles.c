@@ -0,0 +1,94 @@
+/* Generated by PC-host-sim/tools/imgc.py from circles.pbm, do not edit. */
+/* 128x128, packbits: 1266 bytes, 2048 unpacked. */
+
+/* Standard C header files */
+#include <stdint.h>
+#include "glib.h"
+
+static const uint8_t img_circlesData[] =
+{
+  0xf9, 0xff, 0x00, 0x01, 0xfe, 0x00, 0x03, 0xff, 0x01, 0x00, 0x00, 0xf9, 0xff, 0x07, 0x01, 0x00,
+  0x00, 0xe0, 0xff, 0x0f, 0x00, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x04, 0xf8, 0xff, 0x3f, 0x00, 0x00,
+  0xf9, 0xff, 0xfe, 0x00, 0x04, 0xfe, 0xff, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x7f, 0xfe, 0x00,
+  0xfe, 0xff, 0x01, 0x01, 0x00, 0xfe, 0xff, 0x07, 0x03, 0xf8, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x80,
+  0xfe, 0xff, 0x01, 0x03, 0x00, 0xff, 0xff, 0x08, 0x3f, 0xfc, 0x87, 0xff, 0xff, 0x7f, 0x00, 0x00,
+  0xc0, 0xfe, 0xff, 0x01, 0x07, 0x00, 0xff, 0xff, 0x08, 0xcf, 0xff, 0x7f, 0xfe, 0xff, 0x3f, 0x00,
+  0x00, 0xe0, 0xfe, 0xff, 0x01, 0x0f, 0x00, 0xff, 0xff, 0x08, 0xf3, 0xff, 0xff, 0xf9, 0xff, 0x3f,
+  0x00, 0x00, 0xf0, 0xfe, 0xff, 0x01, 0x1f, 0x00, 0xff, 0xff, 0x08, 0xfc, 0xff, 0xff, 0xe7, 0xff,
+  0x3f, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0x01, 0x3f, 0x00, 0x01, 0xff, 0x7f, 0xfe, 0xff, 0x05, 0xdf,
+  0xff, 0x1f, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0x01, 0x3f, 0x00, 0x01, 0xff, 0xbf, 0xfe, 0xff, 0x05,
+  0xbf, 0xff, 0x1f, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x01, 0x7f, 0x00, 0x01, 0xff, 0xdf, 0xfe, 0xff,
+  0x05, 0x7f, 0xff, 0x1f, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x01, 0x7f, 0x00, 0x01, 0xff, 0xef, 0xfd,
+  0xff, 0x04, 0xfe, 0x1f, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x00, 0x01, 0xff, 0xf7, 0xfd, 0xff,
+  0x04, 0xfd, 0x0f, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x00, 0x01, 0xff, 0xfb, 0xfd, 0xff, 0x04,
+  0xfb, 0x0f, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x00, 0x01, 0xff, 0xfd, 0xfd, 0xff, 0x03, 0xf7,
+  0x0f, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x01, 0x01, 0xff, 0xfd, 0xfd, 0xff, 0x03, 0xf7, 0x0f, 0x00,
+  0x00, 0xfc, 0xff, 0x00, 0x01, 0x09, 0xff, 0xfe, 0xff, 0x07, 0xfc, 0xff, 0xef, 0x0f, 0x00, 0x00,
+  0xfc, 0xff, 0x00, 0x01, 0x09, 0xff, 0xfe, 0xff, 0x01, 0xf0, 0xff, 0xef, 0x0f, 0x00, 0x00, 0xfc,
+  0xff, 0x00, 0x01, 0x09, 0x7f, 0xff, 0x7f, 0x00, 0xc0, 0xff, 0xdf, 0x0f, 0x00, 0x00, 0xfc, 0xff,
+  0x00, 0x01, 0x09, 0x7f, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xdf, 0x0f, 0x00, 0x00, 0xfc, 0xff, 0x00,
+  0x01, 0x09, 0xbf, 0xff, 0x1f, 0x00, 0x00, 0xff, 0xbf, 0x0f, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x01,
+  0x09, 0xbf, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xbf, 0x0f, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x01, 0x09,
+  0xbf, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xbf, 0x0f, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x01, 0x0a, 0xbf,
+  0xff, 0x07, 0x00, 0x00, 0xfc, 0xbf, 0x0f, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x00, 0x0a, 0xdf,
+  0xff, 0x07, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x00, 0x0a, 0xdf,
+  0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x1f, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x00, 0x0a, 0xdf,
+  0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x1f, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x01, 0x7f, 0x00, 0x0a,
+  0xdf, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x1f, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x01, 0x7f, 0x00,
+  0x0a, 0xdf, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x1f, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0x01, 0x3f,
+  0x00, 0x0a, 0xdf, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x3f, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0x01,
+  0x3f, 0x00, 0x0a, 0xdf, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x3f, 0x00, 0x00, 0xf0, 0xfe, 0xff,
+  0x01, 0x1f, 0x00, 0x0a, 0xdf, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x7f, 0x3f, 0x00, 0x00, 0xe0, 0xfe,
+  0xff, 0x01, 0x0f, 0x00, 0x0a, 0xdf, 0xff, 0x07, 0x00, 0x00, 0xfc, 0x7f, 0x7f, 0x00, 0x00, 0xc0,
+  0xfe, 0xff, 0x01, 0x07, 0x00, 0x0a, 0xbf, 0xff, 0x07, 0x00, 0x00, 0xfc, 0xbf, 0x7f, 0x00, 0x00,
+  0x80, 0xfe, 0xff, 0x01, 0x03, 0x00, 0x07, 0xbf, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xbf, 0x7f, 0xfe,
+  0x00, 0xfe, 0xff, 0x01, 0x01, 0x00, 0x07, 0xbf, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xbf, 0xff, 0xfe,
+  0x00, 0x04, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x07, 0xbf, 0xff, 0x1f, 0x00, 0x00, 0xff, 0xbf, 0xff,
+  0xfe, 0x00, 0x04, 0xf8, 0xff, 0x3f, 0x00, 0x00, 0x0f, 0x7f, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xdf,
+  0xff, 0x01, 0x00, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x00, 0x08, 0x7f, 0xff, 0x7f, 0x00, 0xc0, 0xff,
+  0xdf, 0xff, 0x01, 0xfe, 0x00, 0x03, 0xff, 0x01, 0x00, 0x00, 0x08, 0xff, 0xfe, 0xff, 0x01, 0xf0,
+  0xff, 0xef, 0xff, 0x03, 0xfa, 0x00, 0x08, 0xff, 0xfe, 0xff, 0x07, 0xfc, 0xff, 0xef, 0xff, 0x07,
+  0xfa, 0x00, 0x01, 0xff, 0xfd, 0xfd, 0xff, 0x02, 0xf7, 0xff, 0x07, 0xfa, 0x00, 0x01, 0xff, 0xfd,
+  0xfd, 0xff, 0x02, 0xf7, 0xff, 0x0f, 0xfa, 0x00, 0x01, 0xff, 0xfb, 0xfd, 0xff, 0x02, 0xfb, 0xff,
+  0x1f, 0xfa, 0x00, 0x01, 0xff, 0xf7, 0xfd, 0xff, 0x02, 0xfd, 0xff, 0x3f, 0xfa, 0x00, 0x01, 0xff,
+  0xef, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x7f, 0xfa, 0x00, 0x01, 0xff, 0xdf, 0xfe, 0xff, 0x03, 0x7f,
+  0xff, 0xff, 0x7f, 0xfa, 0x00, 0x01, 0xff, 0xbf, 0xfe, 0xff, 0x00, 0xbf, 0xfe, 0xff, 0xfa, 0x00,
+  0x01, 0xff, 0x7f, 0xfe, 0xff, 0x00, 0xdf, 0xfe, 0xff, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x80, 0xff,
+  0xff, 0x03, 0xfc, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0x00, 0x07, 0xfc, 0x00, 0x00, 0xc0, 0xff, 0xff,
+  0x03, 0xf3, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x03,
+  0xcf, 0xff, 0x7f, 0xfe, 0xfe, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x02, 0x3f,
+  0xfc, 0x87, 0xfd, 0xff, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x01, 0x03, 0xf8, 0xfc,
+  0xff, 0xfc, 0x00, 0x00, 0xfe, 0xf7, 0xff, 0x00, 0x03, 0xfe, 0x00, 0x01, 0x80, 0xff, 0xf7, 0xff,
+  0x00, 0x0f, 0xfe, 0x00, 0x01, 0xe0, 0xff, 0xf7, 0xff, 0x00, 0x7f, 0xfe, 0x00, 0x01, 0xfc, 0xff,
+  0xf6, 0xff, 0x04, 0x03, 0x00, 0x80, 0xff, 0xff, 0xf6, 0xff, 0x04, 0x3f, 0x00, 0xf8, 0xff, 0xff,
+  0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff,
+  0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff,
+  0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0x03, 0x0f, 0xfe, 0xff, 0xff, 0xf4, 0xff, 0x02,
+  0xf1, 0xff, 0xff, 0xf4, 0xff, 0x02, 0xcf, 0xff, 0xff, 0xf4, 0xff, 0x02, 0x3f, 0xff, 0xff, 0xf3,
+  0xff, 0x01, 0xfe, 0xff, 0xf3, 0xff, 0x01, 0xfd, 0xff, 0xf7, 0xff, 0x00, 0xbf, 0xfe, 0xff, 0x01,
+  0xfb, 0xff, 0xf7, 0xff, 0x00, 0xdf, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xef, 0xfc, 0xff, 0xf7, 0xff,
+  0x00, 0xf7, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xf7, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xfb, 0xfc, 0xff,
+  0xf7, 0xff, 0x00, 0xfb, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xfd, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xfd,
+  0xfc, 0xff, 0xfa, 0xff, 0x03, 0x7f, 0xfc, 0xff, 0xfd, 0xfc, 0xff, 0xfa, 0xff, 0x03, 0x9f, 0xf3,
+  0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xff, 0xff, 0xef, 0x01, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xff, 0xff,
+  0xef, 0x01, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xff, 0x03, 0xf7, 0xde, 0xff, 0xfe, 0xfc, 0xff, 0xfa,
+  0xff, 0x03, 0x77, 0xdc, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xff, 0x03, 0xf7, 0xde, 0xff, 0xfe, 0xfc,
+  0xff, 0xfa, 0xff, 0xff, 0xef, 0x01, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xff, 0xff, 0xef, 0x01, 0xff,
+  0xfe, 0xfc, 0xff, 0xfa, 0xff, 0x03, 0x9f, 0xf3, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xff, 0x03, 0x7f,
+  0xfc, 0xff, 0xfd, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xfd, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xfd, 0xfc,
+  0xff, 0xf7, 0xff, 0x00, 0xfb, 0xfc, 0xff, 0xf7, 0xff, 0x00, 0xfb, 0xfc, 0xff, 0x01, 0x7f, 0xc0,
+  0xf9, 0xff, 0x00, 0xf7, 0xfc, 0xff, 0x02, 0x0f, 0x00, 0xfe, 0xfa, 0xff, 0x00, 0xf7, 0xfc, 0xff,
+  0x02, 0x03, 0x00, 0xf8, 0xfa, 0xff, 0x00, 0xef, 0xfc, 0xff, 0x02, 0x01, 0x00, 0xf0, 0xfa, 0xff,
+  0x00, 0xdf, 0xfc, 0xff, 0xff, 0x00, 0x00, 0xe0, 0xfa, 0xff, 0x00, 0xbf, 0xfe, 0xff, 0x01, 0xfb,
+  0xff, 0xff, 0x00, 0x00, 0xc0, 0xf6, 0xff, 0x01, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x80, 0xf6, 0xff,
+  0x01, 0xfe, 0xff, 0xfe, 0x00, 0xf7, 0xff, 0x02, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0xf7, 0xff, 0x02,
+  0xcf, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0xf8, 0xff, 0x02, 0xf1, 0xff, 0xff, 0xfe, 0x00, 0x00,
+  0xfe, 0xf9, 0xff, 0x03, 0x0f, 0xfe, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0xf5, 0xff, 0xfe, 0x00,
+  0x00, 0xfc, 0xf5, 0xff, 0xfe, 0x00, 0x00, 0xfc, 0xf5, 0xff, 0xfe, 0x00, 0x00, 0xfc, 0xf5, 0xff,
+  0xfe, 0x00, 0x00, 0xfc, 0xf5, 0xff, 0xfe, 0x00, 0x00, 0xfc, 0xf5, 0xff, 0xfe, 0x00, 0x00, 0xfc,
+  0xf5, 0xff
+};
+
+const GLIB_PackedImage_t img_circles = { 128, 128,
+                                         GLIB_PACKED_IMAGE_PACKBITS,
+                                         sizeof(img_circlesData), img_circlesData };
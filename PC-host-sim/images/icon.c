@@ -0,0 +1,24 @@
+/* Generated by PC-host-sim/tools/imgc.py from bitmaps.pbm (12,14 41x33), do not edit. */
+/* 41x33, packbits-delta: 152 bytes, 198 unpacked. */
+
+/* Standard C header files */
+#include <stdint.h>
+#include "glib.h"
+
+static const uint8_t img_iconData[] =
+{
+  0xfc, 0xff, 0x00, 0x01, 0xfb, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x02, 0xfe, 0xe7, 0x7f, 0xfe, 0x00,
+  0xfb, 0x00, 0x02, 0x04, 0x00, 0x20, 0xfe, 0x00, 0x02, 0x04, 0x00, 0x20, 0xfe, 0x00, 0xfb, 0x00,
+  0xfb, 0x00, 0x02, 0xfe, 0xe7, 0x7f, 0xfe, 0x00, 0xfb, 0x00, 0x02, 0xfe, 0xe7, 0x7f, 0xfe, 0x00,
+  0xfb, 0x00, 0xfb, 0x00, 0x02, 0x04, 0x00, 0x20, 0xfe, 0x00, 0x02, 0x04, 0x00, 0x20, 0xfe, 0x00,
+  0xff, 0x00, 0x03, 0x7e, 0xff, 0xff, 0x01, 0x05, 0xfe, 0xe7, 0xfd, 0xcf, 0xff, 0x00, 0xff, 0xff,
+  0x00, 0x01, 0xfe, 0x00, 0xff, 0x00, 0x03, 0x08, 0x00, 0x40, 0x00, 0xff, 0x00, 0x03, 0x08, 0x00,
+  0x40, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xff, 0x00, 0x03, 0xfc, 0xcf, 0xff, 0x00, 0xfb, 0x00, 0xff,
+  0x00, 0x03, 0xfc, 0xcf, 0xff, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xff, 0x00, 0x03, 0x08, 0x00, 0x40,
+  0x00, 0xff, 0x00, 0x03, 0x08, 0x00, 0x40, 0x00, 0xfb, 0x00, 0xff, 0x00, 0x03, 0xfc, 0xcf, 0xff,
+  0x00, 0xff, 0x00, 0x03, 0xfe, 0xff, 0x03, 0x00
+};
+
+const GLIB_PackedImage_t img_icon = { 41, 33,
+                                      GLIB_PACKED_IMAGE_PACKBITS | GLIB_PACKED_IMAGE_ROW_DELTA,
+                                      sizeof(img_iconData), img_iconData };
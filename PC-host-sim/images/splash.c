@@ -0,0 +1,70 @@
+/* Generated by PC-host-sim/tools/imgc.py from text.pbm, do not edit. */
+/* 128x128, packbits-delta: 885 bytes, 2048 unpacked. */
+
+/* Standard C header files */
+#include <stdint.h>
+#include "glib.h"
+
+static const uint8_t img_splashData[] =
+{
+  0xf1, 0xff, 0xf1, 0x00, 0x01, 0xf8, 0x01, 0xfe, 0x00, 0x0a, 0xf0, 0xf1, 0x01, 0xf8, 0xf3, 0x01,
+  0x18, 0x03, 0x00, 0x00, 0xf0, 0x01, 0x98, 0x01, 0xfe, 0x00, 0x05, 0xe8, 0xea, 0x02, 0xe0, 0xeb,
+  0x02, 0xfd, 0x00, 0x00, 0xe8, 0x06, 0x00, 0xf0, 0xb8, 0xf9, 0x00, 0x98, 0x1a, 0xfe, 0x00, 0x05,
+  0x03, 0x00, 0x98, 0xb9, 0x01, 0x00, 0x0f, 0x00, 0x68, 0xe1, 0x62, 0x01, 0x40, 0xc1, 0x02, 0xe0,
+  0x01, 0x00, 0xe0, 0x00, 0xe0, 0x02, 0xe0, 0x0b, 0x00, 0x60, 0x00, 0x60, 0x01, 0xa0, 0xc0, 0x72,
+  0xf8, 0x02, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0xe0, 0x41, 0xe0, 0x00, 0x50, 0x18,
+  0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xe8, 0xfe, 0x00, 0x0a, 0xc8,
+  0xeb, 0x02, 0xe8, 0xea, 0x02, 0x00, 0x68, 0x00, 0x00, 0xe8, 0x0f, 0x60, 0xf0, 0x18, 0x1b, 0x00,
+  0xf8, 0xf3, 0x71, 0xf0, 0xf1, 0x01, 0x18, 0xf3, 0x19, 0x03, 0xf0, 0xf1, 0x00, 0xf1, 0x00, 0xf1,
+  0x00, 0xf1, 0x00, 0x00, 0x22, 0xfd, 0x00, 0x0a, 0x60, 0x00, 0x07, 0x00, 0x08, 0x45, 0x21, 0x06,
+  0xc3, 0x40, 0x04, 0xfc, 0x00, 0x02, 0x70, 0x80, 0xcf, 0xfe, 0x00, 0x04, 0xd0, 0xa0, 0x47, 0x60,
+  0x0c, 0x06, 0x04, 0xa7, 0x69, 0x9c, 0x08, 0x18, 0x22, 0xfe, 0x00, 0x05, 0xa0, 0xfa, 0x36, 0xc6,
+  0x30, 0x98, 0x0f, 0x0c, 0xcf, 0xf3, 0x3e, 0x00, 0x70, 0xb6, 0xcf, 0x00, 0x00, 0xa5, 0x7a, 0x98,
+  0x43, 0x00, 0x80, 0x0f, 0x18, 0x47, 0x92, 0x00, 0x02, 0xf0, 0x9c, 0xcf, 0x00, 0x08, 0xa0, 0xf2,
+  0x8c, 0x0b, 0x00, 0x80, 0x01, 0x90, 0x07, 0xfd, 0x00, 0x00, 0x1c, 0xfe, 0x00, 0x05, 0xa0, 0xfa,
+  0x36, 0x0e, 0x30, 0x98, 0x0f, 0x80, 0x07, 0x00, 0xbe, 0x0f, 0xf8, 0xb6, 0xcf, 0x00, 0x08, 0x00,
+  0x58, 0x82, 0x0f, 0x60, 0x0c, 0x0f, 0x22, 0x2f, 0x08, 0x1c, 0x05, 0x70, 0x22, 0x07, 0x00, 0x08,
+  0x40, 0x21, 0x30, 0x0b, 0x40, 0x04, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0x00, 0x08,
+  0xf2, 0x00, 0xf1, 0x00, 0x01, 0x61, 0x1c, 0xf3, 0x00, 0x01, 0xf3, 0x1e, 0xf3, 0x00, 0x00, 0x11,
+  0xf2, 0x00, 0x01, 0x01, 0x20, 0xf3, 0x00, 0x01, 0xf1, 0x3e, 0xf3, 0x00, 0x01, 0x7b, 0x1c, 0xf3,
+  0x00, 0xf1, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x02, 0x80, 0x21, 0x0c, 0xf6, 0x00, 0xff, 0x00, 0x03,
+  0xc0, 0x01, 0x1c, 0x01, 0xf7, 0x00, 0x05, 0x8a, 0x3e, 0x00, 0x00, 0x80, 0x0b, 0xf7, 0x00, 0x05,
+  0x03, 0x2e, 0x60, 0x00, 0xb0, 0x0e, 0xf7, 0x00, 0x05, 0x79, 0x18, 0x60, 0x00, 0x30, 0x04, 0xf7,
+  0x00, 0x01, 0x71, 0x0c, 0xf3, 0x00, 0x04, 0xf3, 0x3a, 0xc0, 0x01, 0x1c, 0xf6, 0x00, 0x04, 0x72,
+  0x3e, 0x80, 0x21, 0x0c, 0xf6, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0x03, 0x00, 0x60, 0x00, 0xf8, 0xfe, 0x00, 0x03, 0xe0, 0x01, 0xff, 0x03, 0xfc, 0x00,
+  0x07, 0x00, 0x1c, 0x00, 0x04, 0x01, 0x00, 0x00, 0x10, 0xf9, 0x00, 0x05, 0x80, 0x03, 0x00, 0x72,
+  0x02, 0x30, 0xfe, 0x00, 0x01, 0xf8, 0x03, 0xfc, 0x00, 0x07, 0x00, 0x08, 0x00, 0x89, 0x04, 0x48,
+  0x00, 0x08, 0xf9, 0x00, 0x01, 0x80, 0x07, 0xfc, 0x00, 0x00, 0x24, 0xf9, 0x00, 0xfc, 0x00, 0x00,
+  0x48, 0xfe, 0x00, 0x00, 0xf0, 0xfb, 0x00, 0xfe, 0x00, 0x07, 0x87, 0x00, 0x30, 0x00, 0x12, 0x00,
+  0x08, 0x01, 0xfc, 0x00, 0xfd, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x01, 0x78, 0x02, 0xfc, 0x00, 0xfe,
+  0x00, 0x07, 0x40, 0x02, 0x00, 0x00, 0x09, 0x00, 0x84, 0x04, 0xfc, 0x00, 0xfe, 0x00, 0x06, 0x20,
+  0x01, 0x00, 0x80, 0x04, 0x00, 0x03, 0xfb, 0x00, 0xfe, 0x00, 0x05, 0x90, 0x00, 0x30, 0x00, 0x3c,
+  0x06, 0xfa, 0x00, 0xfe, 0x00, 0x02, 0x48, 0x00, 0x48, 0xf7, 0x00, 0xfe, 0x00, 0x05, 0x24, 0x00,
+  0x00, 0x80, 0x3f, 0x06, 0xfa, 0x00, 0xfe, 0x00, 0x02, 0x12, 0x00, 0x48, 0xf7, 0x00, 0xfe, 0x00,
+  0x07, 0x09, 0x00, 0x30, 0x00, 0x00, 0x80, 0x81, 0x04, 0xfc, 0x00, 0x0a, 0x80, 0x8f, 0x8f, 0xf8,
+  0x07, 0x00, 0x00, 0x38, 0x06, 0x7e, 0x02, 0xfc, 0x00, 0xf9, 0x00, 0x02, 0x80, 0x01, 0x01, 0xfc,
+  0x00, 0x09, 0x80, 0xff, 0x8f, 0xff, 0x07, 0x00, 0x00, 0xf8, 0x07, 0xfe, 0xfb, 0x00, 0xf1, 0x00,
+  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0x00, 0xf8, 0xfe, 0xff,
+  0x00, 0x07, 0xf6, 0x00, 0xf1, 0x00, 0x03, 0x00, 0x1f, 0x00, 0xf8, 0xf5, 0x00, 0x04, 0x80, 0x60,
+  0x00, 0x06, 0x01, 0xf6, 0x00, 0x03, 0x40, 0x0e, 0x00, 0x71, 0xf5, 0x00, 0x04, 0x00, 0x91, 0x80,
+  0x8c, 0x01, 0xf6, 0x00, 0x03, 0xc0, 0x00, 0x40, 0x02, 0xf5, 0x00, 0xf1, 0x00, 0x03, 0x00, 0x90,
+  0x20, 0x3f, 0xf5, 0x00, 0x03, 0x00, 0x4e, 0x00, 0x41, 0xf5, 0x00, 0xfe, 0x00, 0x00, 0x9c, 0xf5,
+  0x00, 0x04, 0x00, 0xce, 0x00, 0x02, 0x01, 0xf6, 0x00, 0x03, 0x00, 0x10, 0x01, 0x20, 0xf5, 0x00,
+  0x03, 0x00, 0x20, 0x00, 0x01, 0xf5, 0x00, 0xf1, 0x00, 0xff, 0x00, 0x01, 0x20, 0x01, 0xf5, 0x00,
+  0x04, 0x60, 0x20, 0x01, 0x20, 0x01, 0xf6, 0x00, 0x03, 0x80, 0x1f, 0x40, 0x1e, 0xf5, 0x00, 0x03,
+  0x60, 0xc0, 0x80, 0xc1, 0xf5, 0x00, 0x03, 0x80, 0x3f, 0x00, 0x3e, 0xf5, 0x00, 0x00, 0xf8, 0xfe,
+  0xff, 0x00, 0x07, 0xf6, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1,
+  0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1,
+  0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf4, 0x00, 0x02, 0x3c, 0x00, 0x3e, 0xf4, 0x00, 0x02, 0xc3, 0x00,
+  0x41, 0xf5, 0x00, 0x03, 0x80, 0x18, 0x81, 0x9c, 0xf4, 0x00, 0x02, 0x24, 0x40, 0x22, 0xf5, 0x00,
+  0x03, 0x40, 0x42, 0x02, 0x40, 0xf1, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0x00, 0x40, 0xf7, 0x00, 0x05,
+  0x80, 0xc0, 0x21, 0x40, 0x5f, 0x01, 0xf6, 0x00, 0x04, 0x5c, 0x12, 0x5d, 0x00, 0x33, 0xf4, 0x00,
+  0x02, 0x60, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x5c, 0x00, 0x78, 0x1c, 0x00, 0xf6, 0x00, 0x04, 0x5c,
+  0x00, 0x18, 0x1c, 0x00, 0xf1, 0x00, 0xf5, 0x00, 0x03, 0x12, 0x1d, 0x00, 0x00, 0xf6, 0x00, 0x04,
+  0x63, 0x1e, 0x7e, 0x63, 0x8c
+};
+
+const GLIB_PackedImage_t img_splash = { 128, 128,
+                                        GLIB_PACKED_IMAGE_PACKBITS | GLIB_PACKED_IMAGE_ROW_DELTA,
+                                        sizeof(img_splashData), img_splashData };
@@ -0,0 +1,8 @@
+/* Stub SDK cho bản build trên PC: nhật ký của driver bị bỏ qua để kết quả
+ * benchmark dễ đọc. */
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#define app_log(...)  ((void)0)
+
+#endif
@@ -0,0 +1,9 @@
+/* Stub SDK cho bản build trên PC. */
+#ifndef EM_ASSERT_H
+#define EM_ASSERT_H
+
+#include <assert.h>
+
+#define EFM_ASSERT(expr)  assert(expr)
+
+#endif
@@ -0,0 +1,12 @@
+/* Stub SDK cho bản build trên PC: chương trình chạy một luồng, "ngắt" chỉ
+ * được gọi từ host_time_advance_ms(), nên vùng găng không cần làm gì. */
+#ifndef EM_CORE_H
+#define EM_CORE_H
+
+#define CORE_DECLARE_IRQ_STATE    int core_irq_state = 0
+#define CORE_ENTER_CRITICAL()     ((void)core_irq_state)
+#define CORE_EXIT_CRITICAL()      ((void)core_irq_state)
+#define CORE_ENTER_ATOMIC()       ((void)core_irq_state)
+#define CORE_EXIT_ATOMIC()        ((void)core_irq_state)
+
+#endif
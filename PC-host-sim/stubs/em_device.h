@@ -0,0 +1,17 @@
+/* Stub SDK cho bản build trên PC. NVIC chỉ nhớ ngắt nào đang bật để
+ * host_platform.c biết có gọi handler ngắt giả lập hay không. */
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#define __INLINE inline
+
+typedef enum {
+  USART2_TX_IRQn = 20,
+  I2C0_IRQn      = 27,
+} IRQn_Type;
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+
+#endif
@@ -0,0 +1,29 @@
+/* Stub SDK cho bản build trên PC: GPIO chỉ được ghi lại trong host_platform.c. */
+#ifndef EM_GPIO_H
+#define EM_GPIO_H
+
+#include <stdint.h>
+#include "em_device.h"
+
+typedef enum {
+  gpioPortA = 0,
+  gpioPortB = 1,
+  gpioPortC = 2,
+  gpioPortD = 3,
+} GPIO_Port_TypeDef;
+
+typedef enum {
+  gpioModeDisabled = 0,
+  gpioModeInput,
+  gpioModeInputPull,
+  gpioModePushPull,
+} GPIO_Mode_TypeDef;
+
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin,
+                     GPIO_Mode_TypeDef mode, unsigned int out);
+void GPIO_PinOutSet(GPIO_Port_TypeDef port, unsigned int pin);
+void GPIO_PinOutClear(GPIO_Port_TypeDef port, unsigned int pin);
+void GPIO_PinOutToggle(GPIO_Port_TypeDef port, unsigned int pin);
+unsigned int GPIO_PinOutGet(GPIO_Port_TypeDef port, unsigned int pin);
+
+#endif
@@ -0,0 +1,55 @@
+/* Stub SDK cho bản build trên PC: kiểu dữ liệu I2C của emlib, phần cứng là
+ * bus giả lập trong host_platform.c. */
+#ifndef EM_I2C_H
+#define EM_I2C_H
+
+#include <stdint.h>
+
+typedef struct {
+  volatile uint32_t CMD;
+} I2C_TypeDef;
+
+#define I2C_CMD_ABORT         0x0020
+#define I2C_CMD_CLEARTX       0x0040
+#define I2C_CMD_CLEARPC       0x0080
+
+#define _I2C_IF_MASK          0x001FFFFF
+#define _I2C_IEN_MASK         0x001FFFFF
+
+#define I2C_FLAG_WRITE        0x0001
+#define I2C_FLAG_READ         0x0002
+#define I2C_FLAG_WRITE_READ   0x0004
+#define I2C_FLAG_WRITE_WRITE  0x0008
+
+typedef enum {
+  i2cTransferInProgress = 1,
+  i2cTransferDone       = 0,
+  i2cTransferNack       = -1,
+  i2cTransferBusErr     = -2,
+  i2cTransferArbLost    = -3,
+  i2cTransferUsageFault = -4,
+  i2cTransferSwFault    = -5,
+} I2C_TransferReturn_TypeDef;
+
+typedef struct {
+  uint16_t addr;
+  uint16_t flags;
+  struct {
+    uint8_t  *data;
+    uint16_t len;
+  } buf[2];
+} I2C_TransferSeq_TypeDef;
+
+/* Ngoại vi I2C0 giả lập: I2C_TransferInit() chạy transfer trên bus của
+ * host_platform.c, nếu ngắt I2C0_IRQn đang bật thì hẹn gọi I2C0_IRQHandler()
+ * sau thời gian trên dây, nếu không thì I2C_Transfer() trả kết quả ngay.
+ * Ghi I2C_CMD_ABORT vào CMD hủy transfer đang chạy (kể cả ngắt đã hẹn). */
+extern I2C_TypeDef host_i2c0;
+#define I2C0 (&host_i2c0)
+
+I2C_TransferReturn_TypeDef I2C_TransferInit(I2C_TypeDef *i2c, I2C_TransferSeq_TypeDef *seq);
+I2C_TransferReturn_TypeDef I2C_Transfer(I2C_TypeDef *i2c);
+void I2C_IntClear(I2C_TypeDef *i2c, uint32_t flags);
+void I2C_IntDisable(I2C_TypeDef *i2c, uint32_t flags);
+
+#endif
@@ -0,0 +1,9 @@
+/* Stub SDK cho bản build trên PC: chỉ khai báo những gì driver đồ họa cần. */
+#ifndef EM_TYPES_H
+#define EM_TYPES_H
+
+#include <stdint.h>
+
+typedef uint32_t EMSTATUS;
+
+#endif
@@ -0,0 +1,21 @@
+/* Stub SDK cho bản build trên PC: USART chỉ là một thẻ để lcd_spi.h biên dịch được. */
+#ifndef EM_USART_H
+#define EM_USART_H
+
+#include <stdint.h>
+
+typedef struct {
+  volatile uint32_t STATUS;
+} USART_TypeDef;
+
+typedef enum {
+  usartClockMode0 = 0,
+  usartClockMode1,
+  usartClockMode2,
+  usartClockMode3,
+} USART_ClockMode_TypeDef;
+
+extern USART_TypeDef host_usart2;
+#define USART2  (&host_usart2)
+
+#endif
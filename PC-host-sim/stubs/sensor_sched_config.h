@@ -0,0 +1,14 @@
+/* Stub cho bản build trên PC: như config/sensor_sched_config.h nhưng bộ đếm
+ * chu kỳ CPU là đồng hồ thật của host (ns), không có DWT. */
+#ifndef SENSOR_SCHED_CONFIG_H
+#define SENSOR_SCHED_CONFIG_H
+
+#include <stdint.h>
+
+uint64_t host_now_ns(void);
+
+#define SENSOR_SCHED_CPU_COUNTER_INIT()   ((void)0)
+#define SENSOR_SCHED_CPU_COUNTER()        ((uint32_t)host_now_ns())
+#define SENSOR_SCHED_CPU_HZ()             1000000000u
+
+#endif
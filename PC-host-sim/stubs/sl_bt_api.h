@@ -0,0 +1,11 @@
+/* Stub SDK cho bản build trên PC: chỉ có external signal, gom lại cho
+ * host_bt_take_signals() (host_platform.h) như hàng đợi sự kiện của stack. */
+#ifndef SL_BT_API_H
+#define SL_BT_API_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+sl_status_t sl_bt_external_signal(uint32_t signals);
+
+#endif
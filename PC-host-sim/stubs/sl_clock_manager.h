@@ -0,0 +1,17 @@
+/* Stub SDK cho bản build trên PC. */
+#ifndef SL_CLOCK_MANAGER_H
+#define SL_CLOCK_MANAGER_H
+
+#include "sl_status.h"
+
+typedef int sl_bus_clock_t;
+
+#define SL_BUS_CLOCK_GPIO    0
+#define SL_BUS_CLOCK_I2C0    1
+#define SL_BUS_CLOCK_I2C1    2
+#define SL_BUS_CLOCK_USART2  3
+
+sl_status_t sl_clock_manager_enable_bus_clock(sl_bus_clock_t clock);
+sl_status_t sl_clock_manager_disable_bus_clock(sl_bus_clock_t clock);
+
+#endif
@@ -0,0 +1,19 @@
+/* Stub SDK cho bản build trên PC. */
+#ifndef SL_COMMON_H
+#define SL_COMMON_H
+
+#include <stdint.h>
+
+static inline uint8_t sl_host_rbit8(uint8_t v)
+{
+  v = (uint8_t)(((v & 0xF0) >> 4) | ((v & 0x0F) << 4));
+  v = (uint8_t)(((v & 0xCC) >> 2) | ((v & 0x33) << 2));
+  v = (uint8_t)(((v & 0xAA) >> 1) | ((v & 0x55) << 1));
+  return v;
+}
+
+#define SL_RBIT8(x)  sl_host_rbit8((uint8_t)(x))
+
+#define SL_ATTRIBUTE_ALIGN(X)  __attribute__ ((aligned(X)))
+
+#endif
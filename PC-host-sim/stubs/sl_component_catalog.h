@@ -0,0 +1,5 @@
+/* Stub SDK cho bản build trên PC: không có component tùy chọn nào. */
+#ifndef SL_COMPONENT_CATALOG_H
+#define SL_COMPONENT_CATALOG_H
+
+#endif
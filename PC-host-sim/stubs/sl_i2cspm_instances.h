@@ -0,0 +1,14 @@
+/* Stub SDK cho bản build trên PC: I2CSPM_Transfer() chạy trên bus giả lập
+ * của host_platform.c (host_i2c_attach()). */
+#ifndef SL_I2CSPM_INSTANCES_H
+#define SL_I2CSPM_INSTANCES_H
+
+#include "em_i2c.h"
+
+typedef I2C_TypeDef sl_i2cspm_t;
+
+extern sl_i2cspm_t *sl_i2cspm_sensor;
+
+I2C_TransferReturn_TypeDef I2CSPM_Transfer(sl_i2cspm_t *i2c, I2C_TransferSeq_TypeDef *seq);
+
+#endif
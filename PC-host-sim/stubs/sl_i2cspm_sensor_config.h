@@ -0,0 +1,8 @@
+/* Stub SDK cho bản build trên PC: như config/sl_i2cspm_sensor_config.h. */
+#ifndef SL_I2CSPM_SENSOR_CONFIG_H
+#define SL_I2CSPM_SENSOR_CONFIG_H
+
+#define SL_I2CSPM_SENSOR_PERIPHERAL      I2C0
+#define SL_I2CSPM_SENSOR_PERIPHERAL_NO   0
+
+#endif
@@ -0,0 +1,58 @@
+/* Stub SDK cho bản build trên PC: đồng hồ ảo, chỉ chạy khi gọi host_time_advance_ms(). */
+#ifndef SL_SLEEPTIMER_H
+#define SL_SLEEPTIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+#define SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG  0x01
+
+typedef struct sl_sleeptimer_timer_handle sl_sleeptimer_timer_handle_t;
+
+typedef void (*sl_sleeptimer_timer_callback_t)(sl_sleeptimer_timer_handle_t *handle,
+                                               void *data);
+
+struct sl_sleeptimer_timer_handle {
+  void *callback_data;
+  sl_sleeptimer_timer_callback_t callback;
+  uint32_t timeout_periodic;
+  uint64_t expire_tick;
+  bool running;
+};
+
+uint32_t sl_sleeptimer_get_timer_frequency(void);
+uint32_t sl_sleeptimer_get_tick_count(void);
+uint64_t sl_sleeptimer_get_tick_count64(void);
+uint32_t sl_sleeptimer_ms_to_tick(uint16_t time_ms);
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick);
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags);
+sl_status_t sl_sleeptimer_start_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                         uint32_t timeout_ms,
+                                         sl_sleeptimer_timer_callback_t callback,
+                                         void *callback_data,
+                                         uint8_t priority,
+                                         uint16_t option_flags);
+sl_status_t sl_sleeptimer_restart_periodic_timer(sl_sleeptimer_timer_handle_t *handle,
+                                                 uint32_t timeout,
+                                                 sl_sleeptimer_timer_callback_t callback,
+                                                 void *callback_data,
+                                                 uint8_t priority,
+                                                 uint16_t option_flags);
+sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                  uint32_t timeout_ms,
+                                                  sl_sleeptimer_timer_callback_t callback,
+                                                  void *callback_data,
+                                                  uint8_t priority,
+                                                  uint16_t option_flags);
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle);
+sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle,
+                                           bool *running);
+void sl_sleeptimer_delay_millisecond(uint16_t time_ms);
+
+#endif
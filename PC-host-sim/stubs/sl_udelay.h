@@ -0,0 +1,7 @@
+/* Stub SDK cho bản build trên PC: thời gian chờ được cộng dồn, không ngủ thật. */
+#ifndef SL_UDELAY_H
+#define SL_UDELAY_H
+
+void sl_udelay_wait(unsigned us);
+
+#endif
@@ -0,0 +1,384 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_sleeptimer.h"
+#include "dht20.h"
+#include "i2c_bus.h"
+#include "sensor_sched.h"
+#include "host_platform.h"
+
+// Đo DHT20 qua mô tả dht20_sensor và bộ lập lịch (sensor_sched.h) trên bus
+// I2C giả lập, như app.c: trigger và đọc đi qua hàng đợi I2C theo ngắt, vòng
+// lặp chính chỉ giải mã khi nhận EX_SENSOR_READY. So với cách đo chặn cũ
+// (trigger, chờ DHT20_MEASURE_MS, đọc) chặn vòng lặp chính mỗi lần đo.
+// Đo riêng lẻ bằng dht20_start()/dht20_poll() được kiểm tra với cùng cảm
+// biến giả lập.
+
+// ================= CẤU HÌNH =================
+#define SIM_MS        10000     // Thời gian mô phỏng vòng lặp chính
+#define MEASURE_MS    1000      // Chu kỳ đo như app.c
+#define TOLERANCE     1         // centi (0.01 °C, 0.01 %RH)
+
+// Cảm biến DHT20 giả lập
+typedef struct {
+    uint32_t convert_ms;        // Thời gian đo sau lệnh 0xAC
+    uint32_t rh_code;           // Mã độ ẩm 20 bit
+    uint32_t temp_code;         // Mã nhiệt độ 20 bit
+    uint64_t trigger_tick;
+    int triggered;
+    int nack_write;             // 1: NACK mọi pha ghi
+    int nack_read;              // 1: NACK mọi pha đọc
+    uint32_t triggers;
+    uint32_t reads;
+} fake_dht20_t;
+
+static fake_dht20_t dev;
+static int failures;
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static uint64_t now_ms(void)
+{
+    return sl_sleeptimer_get_tick_count64() * 1000u / HOST_SLEEPTIMER_FREQ;
+}
+
+// --- HÀM: CRC8 CỦA DHT20 (ĐA THỨC 0x31, GIÁ TRỊ ĐẦU 0xFF) ---
+static uint8_t crc8(const uint8_t *p, int n)
+{
+    uint8_t crc = 0xFF;
+
+    while (n--) {
+        crc ^= *p++;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// --- HÀM: THIẾT BỊ I2C Ở ĐỊA CHỈ DHT20_ADDR ---
+static int fake_dht20(void *ctx, int read, uint8_t *data, uint16_t len)
+{
+    fake_dht20_t *d = ctx;
+
+    if (!read) {
+        if (d->nack_write) {
+            return -1;
+        }
+        if (len >= 1 && data[0] == 0xAC) {
+            d->trigger_tick = sl_sleeptimer_get_tick_count64();
+            d->triggered = 1;
+            d->triggers++;
+        }
+        return 0;
+    }
+
+    if (d->nack_read) {
+        return -1;
+    }
+    d->reads++;
+
+    uint8_t frame[7];
+    uint64_t elapsed = sl_sleeptimer_get_tick_count64() - d->trigger_tick;
+    int busy = d->triggered && elapsed < (uint64_t)d->convert_ms * HOST_SLEEPTIMER_FREQ / 1000u;
+
+    frame[0] = (uint8_t)(0x18 | (busy ? 0x80 : 0));     // Đã hiệu chỉnh, chế độ NOR
+    frame[1] = (uint8_t)(d->rh_code >> 12);
+    frame[2] = (uint8_t)(d->rh_code >> 4);
+    frame[3] = (uint8_t)((d->rh_code << 4) | (d->temp_code >> 16));
+    frame[4] = (uint8_t)(d->temp_code >> 8);
+    frame[5] = (uint8_t)d->temp_code;
+    frame[6] = crc8(frame, 6);
+    memcpy(data, frame, len < 7 ? len : 7);
+    if (!busy) {
+        d->triggered = 0;
+    }
+    return 0;
+}
+
+// Giá trị đặt theo centi (0.01 °C, 0.01 %RH) như kết quả của driver
+static void set_values(int32_t temp_centi, int32_t hum_centi)
+{
+    dev.rh_code = (uint32_t)(hum_centi * 1048576LL / 10000);
+    dev.temp_code = (uint32_t)((temp_centi + 5000) * 1048576LL / 20000);
+}
+
+static uint8_t dht20_index;
+
+// --- HÀM: XỬ LÝ EX_SENSOR_READY NHƯ sl_bt_on_event() CỦA app.c ---
+// Chu kỳ xong thì trả về trạng thái của DHT20, còn đọc lại thì trả về
+// SL_STATUS_IN_PROGRESS.
+static sl_status_t sensor_ready(int16_t *temp, int16_t *hum)
+{
+    int16_t values[SENSOR_SCHED_VALUES_MAX];
+    sl_status_t sc;
+
+    if (sensor_sched_process() != SL_STATUS_OK) {
+        return SL_STATUS_IN_PROGRESS;
+    }
+    sc = sensor_sched_get(dht20_index, values);
+    if (sc == SL_STATUS_OK) {
+        *temp = values[0];
+        *hum = values[1];
+    }
+    return sc;
+}
+
+// --- HÀM: MỘT VÒNG XỬ LÝ SỰ KIỆN ---
+static sl_status_t dispatch(int16_t *temp, int16_t *hum)
+{
+    if (host_bt_take_signals() & EX_SENSOR_READY) {
+        return sensor_ready(temp, hum);
+    }
+    return SL_STATUS_IN_PROGRESS;
+}
+
+// --- HÀM: CHẠY ĐỒNG HỒ TỪNG ms TỚI KHI ĐO XONG, TRẢ VỀ TRẠNG THÁI CUỐI ---
+// elapsed_ms đo bằng tick của sleeptimer (một bước 1 ms là 32 tick), reads
+// là số lần đọc trên bus, wakeups là số lần vòng lặp chính nhận
+// EX_SENSOR_READY.
+static sl_status_t wait_result(int16_t *temp, int16_t *hum, uint32_t *elapsed_ms,
+                               uint32_t *reads, uint32_t *wakeups)
+{
+    sl_status_t sc = SL_STATUS_IN_PROGRESS;
+    uint64_t t0 = now_ms();
+    uint32_t reads0 = dev.reads;
+
+    *wakeups = 0;
+    while (sc == SL_STATUS_IN_PROGRESS && now_ms() - t0 < 1000) {
+        host_time_advance_ms(1);
+        if (host_bt_take_signals() & EX_SENSOR_READY) {
+            (*wakeups)++;
+            sc = sensor_ready(temp, hum);
+        }
+    }
+    *elapsed_ms = (uint32_t)(now_ms() - t0);
+    *reads = dev.reads - reads0;
+    return sc;
+}
+
+// --- HÀM: ĐO CHẶN NHƯ CÁCH CŨ, ĐỂ SO SÁNH ---
+// Trigger, chờ DHT20_MEASURE_MS ngay trong vòng lặp chính rồi đọc khung
+static sl_status_t blocking_read(int16_t *temp, int16_t *hum)
+{
+    uint8_t cmd[DHT20_TRIGGER_LEN] = DHT20_TRIGGER_CMD;
+    uint8_t rx[DHT20_FRAME_LEN];
+    int16_t values[SENSOR_SCHED_VALUES_MAX];
+    I2C_TransferSeq_TypeDef seq = { .addr = DHT20_ADDR << 1, .flags = I2C_FLAG_WRITE };
+    sl_status_t sc;
+
+    seq.buf[0].data = cmd;
+    seq.buf[0].len = sizeof(cmd);
+    if (i2c_bus_transfer_blocking(&seq) != i2cTransferDone) {
+        return SL_STATUS_TRANSMIT;
+    }
+    sl_sleeptimer_delay_millisecond(DHT20_MEASURE_MS);
+    seq.flags = I2C_FLAG_READ;
+    seq.buf[0].data = rx;
+    seq.buf[0].len = sizeof(rx);
+    if (i2c_bus_transfer_blocking(&seq) != i2cTransferDone) {
+        return SL_STATUS_RECEIVE;
+    }
+    sc = dht20_sensor.decode(rx, values);
+    *temp = values[0];
+    *hum = values[1];
+    return sc;
+}
+
+// --- HÀM: CÁC TRƯỜNG HỢP CỦA MỘT LẦN ĐO ---
+static void test_measurement(void)
+{
+    int16_t t = 0, h = 0;
+    uint32_t ms, reads, wakeups;
+    uint64_t t0;
+    sl_status_t sc;
+
+    // 1. Cảm biến đo đúng 80 ms: trigger không chặn, đọc đúng một lần. Kết
+    // quả có sau DHT20_MEASURE_MS cộng thời gian trên dây của trigger và đọc
+    dev.convert_ms = DHT20_MEASURE_MS;
+    set_values(2350, 6120);
+    t0 = sl_sleeptimer_get_tick_count64();
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger loi");
+    check(sl_sleeptimer_get_tick_count64() == t0, "trigger chan vong lap");
+    check(sensor_sched_is_busy(), "sau trigger phai dang do");
+    check(sensor_sched_start() == SL_STATUS_BUSY, "trigger lan hai khi dang do");
+    check(sensor_sched_process() == SL_STATUS_IN_PROGRESS, "doc truoc khi het gio");
+    sc = wait_result(&t, &h, &ms, &reads, &wakeups);
+    check(sc == SL_STATUS_OK, "do 80 ms khong xong");
+    check(ms >= DHT20_MEASURE_MS && ms <= DHT20_MEASURE_MS + 2 && reads == 1 && wakeups == 1,
+          "do 80 ms: sai thoi diem doc");
+    check(abs(t - 2350) <= TOLERANCE, "sai nhiet do");
+    check(abs(h - 6120) <= TOLERANCE, "sai do am");
+    check(!sensor_sched_is_busy(), "do xong van bao ban");
+    printf("%-30s %6u ms %4u lan doc %4u lan danh thuc\n", "cam bien 80 ms", ms, reads, wakeups);
+
+    // 2. Cảm biến chậm: busy bit -> đọc lại mỗi SENSOR_SCHED_POLL_MS, mỗi
+    // lần đọc đánh thức vòng lặp chính một lần để giải mã
+    dev.convert_ms = 105;
+    set_values(-1025, 500);
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger loi");
+    sc = wait_result(&t, &h, &ms, &reads, &wakeups);
+    check(sc == SL_STATUS_OK, "cam bien cham khong xong");
+    // Đo xong ở 105 ms: đọc lúc ~81 (bận), ~92, ~102 (bận) và ~113 ms
+    check(reads == 4 && wakeups == reads && ms < DHT20_MEASURE_MS + 4 * SENSOR_SCHED_POLL_MS,
+          "cam bien cham: sai so lan hoi lai");
+    check(abs(t + 1025) <= TOLERANCE, "sai nhiet do am");
+    printf("%-30s %6u ms %4u lan doc %4u lan danh thuc\n", "cam bien 105 ms (busy bit)", ms, reads, wakeups);
+
+    // 3. Bận mãi: hết SENSOR_SCHED_MAX_POLLS lần đọc lại thì SL_STATUS_TIMEOUT
+    dev.convert_ms = 100000;
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger loi");
+    sc = wait_result(&t, &h, &ms, &reads, &wakeups);
+    check(sc == SL_STATUS_TIMEOUT, "ban mai khong bao het gio");
+    check(reads == SENSOR_SCHED_MAX_POLLS + 1, "ban mai: sai so lan hoi lai");
+    check(!sensor_sched_is_busy(), "het gio van bao ban");
+    printf("%-30s %6u ms %4u lan doc %4u lan danh thuc\n", "cam bien ban mai (het gio)", ms, reads, wakeups);
+    dev.convert_ms = DHT20_MEASURE_MS;
+    dev.triggered = 0;
+
+    // 4. Lỗi bus: NACK lúc trigger thì không đọc, NACK lúc đọc báo riêng
+    dev.nack_write = 1;
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger loi");
+    sc = wait_result(&t, &h, &ms, &reads, &wakeups);
+    check(sc == SL_STATUS_TRANSMIT && reads == 0, "NACK trigger khong bao SL_STATUS_TRANSMIT");
+    check(!sensor_sched_is_busy(), "NACK trigger van bao ban");
+    dev.nack_write = 0;
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger loi");
+    dev.nack_read = 1;
+    sc = wait_result(&t, &h, &ms, &reads, &wakeups);
+    check(sc == SL_STATUS_RECEIVE, "NACK doc khong bao SL_STATUS_RECEIVE");
+    check(!sensor_sched_is_busy(), "NACK doc van bao ban");
+    dev.nack_read = 0;
+    check(sensor_sched_process() == SL_STATUS_INVALID_STATE, "doc khi khong do");
+
+    // 5. Hàm chặn không chen vào giữa lúc hàng đợi đang bận
+    check(sensor_sched_start() == SL_STATUS_OK, "trigger loi");
+    check(!dht20_is_connected(), "dht20_is_connected chen vao hang doi dang ban");
+    sc = wait_result(&t, &h, &ms, &reads, &wakeups);
+    check(sc == SL_STATUS_OK && dht20_is_connected(), "sau khi do xong phai thay DHT20");
+}
+
+// --- HÀM: VÒNG LẶP CHÍNH SIM_MS, ĐO MỖI MEASURE_MS ---
+// Trả về thời gian dài nhất (ms) một lần gọi trong vòng lặp bị chặn.
+static uint32_t simulate(int blocking, uint32_t *samples)
+{
+    uint32_t worst = 0;
+    int16_t t, h;
+
+    *samples = 0;
+    for (uint32_t ms = 1; ms <= SIM_MS; ms++) {
+        host_time_advance_ms(1);
+        uint64_t t0 = now_ms();
+        if (ms % MEASURE_MS == 1) {
+            if (blocking) {
+                if (blocking_read(&t, &h) == SL_STATUS_OK) {
+                    (*samples)++;
+                }
+            } else {
+                check(sensor_sched_start() == SL_STATUS_OK, "trigger loi trong vong lap");
+            }
+        }
+        if (dispatch(&t, &h) == SL_STATUS_OK) {
+            (*samples)++;
+        }
+        if (now_ms() - t0 > worst) {
+            worst = (uint32_t)(now_ms() - t0);
+        }
+    }
+    return worst;
+}
+
+// --- HÀM: ĐO RIÊNG LẺ BẰNG dht20_start()/dht20_poll(), KHÔNG QUA BỘ LẬP LỊCH ---
+static sl_status_t poll_result(int16_t *temp, int16_t *hum, uint32_t *reads)
+{
+    sl_status_t sc = SL_STATUS_IN_PROGRESS;
+    uint64_t t0 = now_ms();
+    uint32_t reads0 = dev.reads;
+
+    while (sc == SL_STATUS_IN_PROGRESS && now_ms() - t0 < 1000) {
+        host_time_advance_ms(1);
+        sc = dht20_poll(temp, hum);
+    }
+    *reads = dev.reads - reads0;
+    return sc;
+}
+
+static void test_standalone(void)
+{
+    int16_t t = 0, h = 0;
+    uint32_t reads;
+    uint64_t t0;
+
+    check(dht20_poll(&t, &h) == SL_STATUS_INVALID_STATE, "dht20_poll khi khong do");
+
+    dev.convert_ms = DHT20_MEASURE_MS;
+    set_values(2175, 4830);
+    t0 = sl_sleeptimer_get_tick_count64();
+    check(dht20_start() == SL_STATUS_OK, "dht20_start loi");
+    check(sl_sleeptimer_get_tick_count64() == t0, "dht20_start chan vong lap");
+    check(dht20_start() == SL_STATUS_BUSY, "dht20_start lan hai khi dang do");
+    check(dht20_poll(&t, &h) == SL_STATUS_IN_PROGRESS, "dht20_poll truoc khi het gio");
+    check(poll_result(&t, &h, &reads) == SL_STATUS_OK && reads == 1, "dht20_poll khong xong");
+    check(abs(t - 2175) <= TOLERANCE && abs(h - 4830) <= TOLERANCE, "dht20_poll sai ket qua");
+
+    // Busy bit: đọc lại như bộ lập lịch
+    dev.convert_ms = 105;
+    check(dht20_start() == SL_STATUS_OK, "dht20_start loi");
+    check(poll_result(&t, &h, &reads) == SL_STATUS_OK && reads == 4, "dht20_poll: sai so lan hoi lai");
+    dev.convert_ms = DHT20_MEASURE_MS;
+    dev.triggered = 0;
+
+    // NACK lúc trigger: không đọc, báo SL_STATUS_TRANSMIT
+    dev.nack_write = 1;
+    check(dht20_start() == SL_STATUS_OK, "dht20_start loi");
+    check(poll_result(&t, &h, &reads) == SL_STATUS_TRANSMIT && reads == 0,
+          "dht20_poll: NACK trigger khong bao SL_STATUS_TRANSMIT");
+    dev.nack_write = 0;
+    check(dht20_start() == SL_STATUS_OK && poll_result(&t, &h, &reads) == SL_STATUS_OK,
+          "dht20_poll khong do lai duoc sau loi");
+}
+
+int main(void)
+{
+    uint32_t worst_block, worst_async, n_block, n_async;
+    host_i2c_stats_t bus;
+
+    i2c_bus_init();
+    sensor_sched_init();
+    check(sensor_sched_register(&dht20_sensor, &dht20_index) == SL_STATUS_OK, "dang ky DHT20 loi");
+    host_i2c_attach(DHT20_ADDR, fake_dht20, &dev);
+    dev.convert_ms = DHT20_MEASURE_MS;
+    set_values(2500, 5000);
+    check(dht20_is_connected(), "khong thay DHT20 tren bus gia lap");
+
+    test_measurement();
+    test_standalone();
+
+    worst_block = simulate(1, &n_block);
+    host_i2c_reset_stats();
+    worst_async = simulate(0, &n_async);
+    bus = *host_i2c_get_stats();
+
+    check(n_block == SIM_MS / MEASURE_MS && n_async == SIM_MS / MEASURE_MS, "thieu mau do");
+    check(worst_async == 0, "do khong chan van chan vong lap");
+    check(bus.nacks == 0 && bus.transfers == 2 * n_async, "moi lan do phai la mot lan ghi va mot lan doc");
+
+    printf("%-30s %10s %14s %12s\n", "che do", "so mau", "chan toi da", "I2C / mau");
+    printf("%-30s %10u %11u ms %12s\n", "trigger + cho + doc (chan)", n_block, worst_block, "-");
+    printf("%-30s %10u %11u ms %9llu us\n", "dht20_sensor + sensor_sched", n_async, worst_async,
+           (unsigned long long)(bus.bus_us / n_async));
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: do DHT20 khong chan vong lap chinh, busy bit duoc hoi lai\n");
+    return EXIT_SUCCESS;
+}
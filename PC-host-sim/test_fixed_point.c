@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dht20.h"
+#include "centi.h"
+#include "host_platform.h"
+
+// Đổi mã thô DHT20 sang centi bằng số nguyên (dht20_temp_centi(),
+// dht20_hum_centi()) so với công thức float cũ của dht20_convert() và
+// convert_float_to_int16() trong custom_adv.c: phải ra cùng giá trị trên cả
+// 2^20 mã, tức gói quảng bá BLE không đổi một bit nào. Thêm cách in centi
+// ra chữ (centi_format()) cho log và LCD, nhất là số âm gần 0.
+
+// ================= CẤU HÌNH =================
+#define CODES         (1u << 20)    // Mã thô 20 bit
+#define SHOW_MAX      5             // Số mã lệch in ra khi lỗi
+
+static int failures;
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// --- HÀM: CÔNG THỨC FLOAT CŨ, TỪNG BƯỚC LÀM TRÒN VỀ float ---
+// volatile để trình biên dịch không gộp phép nhân (FMA) hay giữ độ chính
+// xác cao hơn float giữa các bước, như khi hai bước nằm ở hai hàm khác nhau
+static int16_t float_hum_centi(uint32_t code)
+{
+    volatile float hum = ((float)code / 1048576.0f) * 100.0f;
+    volatile float centi = hum * 100;
+    return (int16_t)centi;
+}
+
+static int16_t float_temp_centi(uint32_t code)
+{
+    volatile float temp = ((float)code / 1048576.0f) * 200.0f - 50.0f;
+    volatile float centi = temp * 100;
+    return (int16_t)centi;
+}
+
+// --- HÀM: SO SÁNH MỘT ĐẠI LƯỢNG TRÊN MỌI MÃ ---
+// exact_off: số mã mà phép chia nguyên thuần túy (cắt về phía 0) lệch so
+// với float, để thấy vì sao cần làm tròn như float
+static uint32_t compare(const char *name, int16_t (*fixed)(uint32_t), int16_t (*ref)(uint32_t),
+                        int64_t scale, int64_t offset, uint32_t *exact_off)
+{
+    uint32_t mismatches = 0;
+
+    *exact_off = 0;
+    for (uint32_t code = 0; code < CODES; code++) {
+        int16_t want = ref(code);
+        int16_t got = fixed(code);
+        int64_t num = (int64_t)code * scale - (offset << 20);
+        int64_t exact = num < 0 ? -(-num >> 20) : num >> 20;
+
+        if (got != want) {
+            if (mismatches < SHOW_MAX) {
+                printf("  %s: ma 0x%05X float %d, so nguyen %d\n", name, (unsigned) code, want, got);
+            }
+            mismatches++;
+        }
+        if (exact != want) {
+            (*exact_off)++;
+        }
+    }
+    return mismatches;
+}
+
+// --- HÀM: THỜI GIAN ĐỔI MỌI MÃ (ns/mã) ---
+static double time_all(int16_t (*f)(uint32_t))
+{
+    // Không dấu: cộng dồn 2^20 giá trị tới 14999 vượt int32_t, tràn có dấu là UB
+    volatile uint32_t sink = 0;
+    uint64_t t0 = host_now_ns();
+
+    for (uint32_t code = 0; code < CODES; code++) {
+        sink += (uint32_t)f(code);
+    }
+    (void) sink;
+    return (double)(host_now_ns() - t0) / CODES;
+}
+
+int main(void)
+{
+    uint32_t bad_hum, bad_temp, off_hum, off_temp;
+    int16_t v[SENSOR_SCHED_VALUES_MAX];
+    char s[CENTI_STR_LEN];
+    // Khung 7 byte: trạng thái, RH 0x80000, T 0x60000, CRC (không kiểm)
+    const uint8_t frame[7] = { 0x1C, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00 };
+    const uint8_t busy[7] = { 0x9C, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00 };
+
+    bad_hum = compare("do am", dht20_hum_centi, float_hum_centi, 10000, 0, &off_hum);
+    bad_temp = compare("nhiet do", dht20_temp_centi, float_temp_centi, 20000, 5000, &off_temp);
+    printf("%-10s %12s %22s\n", "dai luong", "lech float", "chia nguyen lech float");
+    printf("%-10s %12u %22u\n", "do am", bad_hum, off_hum);
+    printf("%-10s %12u %22u\n", "nhiet do", bad_temp, off_temp);
+    check(bad_hum == 0, "do am: so nguyen khac float");
+    check(bad_temp == 0, "nhiet do: so nguyen khac float");
+
+    // Hai đầu thang đo và nhiệt độ âm gần 0 (cắt về phía 0)
+    check(dht20_hum_centi(0) == 0 && dht20_hum_centi(CODES - 1) == 9999, "do am hai dau thang do");
+    check(dht20_temp_centi(0) == -5000 && dht20_temp_centi(CODES - 1) == 14999, "nhiet do hai dau thang do");
+    check(dht20_temp_centi(0x40000) == 0 && dht20_temp_centi(0x3FFFF) == 0, "nhiet do quanh 0 C");
+
+    // Driver cho bộ lập lịch trả về centi qua cùng đường đổi
+    check(dht20_sensor.decode(frame, v) == SL_STATUS_OK && v[0] == 2500 && v[1] == 5000,
+          "decode: sai gia tri centi");
+    check(dht20_sensor.decode(busy, v) == SL_STATUS_NOT_READY, "decode: bo qua busy bit");
+
+    // In ra chữ: dấu trừ giữ nguyên cả khi phần nguyên là 0
+    check(strcmp(centi_format(s, sizeof(s), 2534), "25.34") == 0, "in 25.34");
+    check(strcmp(centi_format(s, sizeof(s), 5), "0.05") == 0, "in 0.05");
+    check(strcmp(centi_format(s, sizeof(s), 0), "0.00") == 0, "in 0.00");
+    check(strcmp(centi_format(s, sizeof(s), -1), "-0.01") == 0, "in -0.01 mat dau");
+    check(strcmp(centi_format(s, sizeof(s), -99), "-0.99") == 0, "in -0.99 mat dau");
+    check(strcmp(centi_format(s, sizeof(s), -150), "-1.50") == 0, "in -1.50");
+    check(strcmp(centi_format(s, sizeof(s), INT16_MIN), "-327.68") == 0, "in INT16_MIN");
+    // Mã 0x3F000 là -0.78 °C
+    check(dht20_temp_centi(0x3F000) < 0 && dht20_temp_centi(0x3F000) > -100
+          && strncmp(centi_format(s, sizeof(s), dht20_temp_centi(0x3F000)), "-0.", 3) == 0,
+          "in nhiet do am gan 0");
+
+    printf("thoi gian: float %.1f ns/ma, so nguyen %.1f ns/ma (do am)\n",
+           time_all(float_hum_centi), time_all(dht20_hum_centi));
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: doi ma tho sang centi bang so nguyen khop float tren ca %u ma\n", CODES);
+    return EXIT_SUCCESS;
+}
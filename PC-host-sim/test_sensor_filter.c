@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sensor_filter.h"
+
+// Tầng lọc số liệu cảm biến (sensor_filter.c): kiểm tra từng bộ lọc trên
+// chuỗi mẫu biết trước, rồi chạy một chuỗi đo có nhiễu như DHT20 để so sai
+// số so với giá trị thật và số lần cập nhật LCD/BLE được bỏ qua.
+
+// ================= CẤU HÌNH =================
+#define SAMPLES       2000      // Số mẫu của chuỗi đo có nhiễu
+#define NOISE_CENTI   20        // Biên độ nhiễu đo (0.20 °C / 0.20 %RH)
+#define DEADBAND      5         // Ngưỡng bỏ qua khi so sánh (0.05)
+
+static int failures;
+
+static void check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// Lọc một mẫu cùng giá trị trên cả hai kênh, trả về kênh 0
+static int16_t feed(int16_t v, bool *changed)
+{
+    int16_t in[SENSOR_FILTER_CHANNELS] = { v, v };
+    int16_t out[SENSOR_FILTER_CHANNELS];
+    bool c = sensor_filter_apply(in, out);
+
+    if (changed != NULL) {
+        *changed = c;
+    }
+    return out[0];
+}
+
+// --- HÀM: TỪNG BỘ LỌC TRÊN CHUỖI BIẾT TRƯỚC ---
+static void test_filters(void)
+{
+    sensor_filter_type_t type;
+    bool changed;
+    int16_t v = 0;
+
+    // Không lọc: đưa thẳng ra, trùng hẳn thì bỏ qua
+    sensor_filter_init();
+    check(sensor_filter_get_type() == SENSOR_FILTER_NONE, "mac dinh phai la NONE");
+    check(feed(2500, &changed) == 2500 && changed, "NONE: mau dau tien phai cong bo");
+    check(feed(2500, &changed) == 2500 && !changed, "NONE: mau trung phai bi bo qua");
+    check(feed(2501, &changed) == 2501 && changed, "NONE: mau khac phai cong bo");
+    check(sensor_filter_get_stats()->samples == 3 && sensor_filter_get_stats()->published == 2
+          && sensor_filter_get_stats()->suppressed == 1, "NONE: sai thong ke");
+
+    // Ngưỡng: lệch không quá deadband thì giữ giá trị đã công bố
+    sensor_filter_set_deadband(DEADBAND);
+    check(feed(2505, &changed) == 2501 && !changed, "deadband: lech 4 phai bi bo qua");
+    check(feed(2507, &changed) == 2507 && changed, "deadband: lech 6 phai cong bo");
+    sensor_filter_set_deadband(0);
+
+    // Trung bình trượt cửa sổ 4: lúc đầu chia cho số mẫu đang có
+    sensor_filter_init();
+    check(sensor_filter_configure(SENSOR_FILTER_AVG, 4) == SL_STATUS_OK, "AVG: cau hinh loi");
+    check(feed(100, NULL) == 100, "AVG: mau 1");
+    check(feed(200, NULL) == 150, "AVG: mau 2");
+    check(feed(300, NULL) == 200, "AVG: mau 3");
+    check(feed(400, NULL) == 250, "AVG: mau 4");
+    check(feed(500, NULL) == 350, "AVG: mau 5 phai day mau cu nhat ra");
+    check(feed(-700, NULL) == 125, "AVG: gia tri am");
+    check(feed(-701, NULL) == -125, "AVG: lam tron so am");
+
+    // Trung vị cửa sổ 5: một gai nhiễu không lọt ra
+    sensor_filter_init();
+    check(sensor_filter_configure(SENSOR_FILTER_MEDIAN, 5) == SL_STATUS_OK, "MED: cau hinh loi");
+    for (int i = 0; i < 5; i++) {
+        v = feed(2500 + i, NULL);
+    }
+    check(v == 2502, "MED: trung vi 5 mau");
+    check(feed(9000, NULL) == 2503, "MED: gai nhieu lot ra");
+    check(feed(-3000, NULL) == 2503, "MED: gai nhieu am lot ra");
+    check(sensor_filter_configure(SENSOR_FILTER_MEDIAN, 4) == SL_STATUS_OK, "MED: doi cua so loi");
+    feed(10, NULL);
+    check(feed(20, NULL) == 15, "MED: doi cua so phai bat dau lai, so mau chan lay trung binh");
+
+    // Kalman: bám theo bậc thang và ổn định ở giá trị hằng
+    sensor_filter_init();
+    check(sensor_filter_configure(SENSOR_FILTER_KALMAN, 1) == SL_STATUS_OK, "KAL: cau hinh loi");
+    check(feed(2000, NULL) == 2000, "KAL: mau dau tien lay lam uoc luong");
+    for (int i = 0; i < 100; i++) {
+        v = feed(3000, NULL);
+    }
+    check(v >= 2995 && v <= 3000, "KAL: khong hoi tu ve bac thang");
+    for (int i = 0; i < 200; i++) {
+        v = feed(-1000, NULL);
+    }
+    check(v >= -1005 && v <= -995, "KAL: khong hoi tu ve gia tri am");
+
+    // Tham số sai và tên bộ lọc
+    check(sensor_filter_configure(SENSOR_FILTER_AVG, 0) == SL_STATUS_INVALID_PARAMETER, "cua so 0");
+    check(sensor_filter_configure(SENSOR_FILTER_AVG, SENSOR_FILTER_WINDOW_MAX + 1)
+          == SL_STATUS_INVALID_PARAMETER, "cua so qua lon");
+    check(sensor_filter_configure(SENSOR_FILTER_COUNT, 4) == SL_STATUS_INVALID_PARAMETER, "loai bo loc sai");
+    check(sensor_filter_get_type() == SENSOR_FILTER_KALMAN, "tham so sai lam doi cau hinh");
+    check(sensor_filter_parse("MED", &type) == SL_STATUS_OK && type == SENSOR_FILTER_MEDIAN, "ten MED");
+    check(sensor_filter_parse("FOO", &type) == SL_STATUS_NOT_FOUND, "ten sai");
+    for (int i = 0; i < SENSOR_FILTER_COUNT; i++) {
+        check(sensor_filter_parse(sensor_filter_name((sensor_filter_type_t) i), &type) == SL_STATUS_OK
+              && type == (sensor_filter_type_t) i, "ten va parse khong khop");
+    }
+}
+
+// Nhiễu giả ngẫu nhiên cố định để kết quả lặp lại được
+static uint32_t rng = 12345;
+static int noise(void)
+{
+    rng = rng * 1103515245u + 12345u;
+    return (int)((rng >> 16) % (2 * NOISE_CENTI + 1)) - NOISE_CENTI;
+}
+
+// --- HÀM: CHUỖI ĐO CÓ NHIỄU, TRẢ VỀ SAI SỐ TUYỆT ĐỐI TRUNG BÌNH (centi) ---
+// Nhiệt độ thật trôi chậm 0.01 °C mỗi 10 mẫu, độ ẩm đứng yên; thỉnh thoảng
+// một mẫu gai lệch 5 °C như khi đọc hỏng.
+static double simulate(sensor_filter_type_t type, uint8_t window, sensor_filter_stats_t *stats)
+{
+    uint64_t err = 0;
+
+    rng = 12345;
+    sensor_filter_init();
+    sensor_filter_configure(type, window);
+    sensor_filter_set_deadband(DEADBAND);
+    for (int i = 0; i < SAMPLES; i++) {
+        int16_t truth[SENSOR_FILTER_CHANNELS] = { (int16_t)(2500 + i / 10), 6000 };
+        int16_t in[SENSOR_FILTER_CHANNELS], out[SENSOR_FILTER_CHANNELS];
+
+        for (int c = 0; c < SENSOR_FILTER_CHANNELS; c++) {
+            in[c] = (int16_t)(truth[c] + noise() + (i % 97 == 50 ? 500 : 0));
+        }
+        sensor_filter_apply(in, out);
+        // Bỏ giai đoạn khởi động
+        if (i >= 50) {
+            for (int c = 0; c < SENSOR_FILTER_CHANNELS; c++) {
+                err += (uint64_t)abs(out[c] - truth[c]);
+            }
+        }
+    }
+    *stats = *sensor_filter_get_stats();
+    return (double)err / ((SAMPLES - 50) * SENSOR_FILTER_CHANNELS);
+}
+
+int main(void)
+{
+    static const struct {
+        sensor_filter_type_t type;
+        uint8_t window;
+    } runs[] = {
+        { SENSOR_FILTER_NONE, 1 },
+        { SENSOR_FILTER_AVG, 8 },
+        { SENSOR_FILTER_MEDIAN, 5 },
+        { SENSOR_FILTER_KALMAN, 1 },
+    };
+    double mae[4];
+    sensor_filter_stats_t st[4];
+
+    test_filters();
+
+    printf("%-6s %6s %10s %10s %10s %8s\n", "loc", "cua so", "sai so TB", "cong bo", "bo qua", "bo qua %");
+    for (size_t i = 0; i < sizeof(runs) / sizeof(runs[0]); i++) {
+        mae[i] = simulate(runs[i].type, runs[i].window, &st[i]);
+        printf("%-6s %6u %10.1f %10u %10u %7.1f%%\n", sensor_filter_name(runs[i].type), runs[i].window,
+               mae[i], st[i].published, st[i].suppressed, 100.0 * st[i].suppressed / st[i].samples);
+        check(st[i].samples == SAMPLES && st[i].published + st[i].suppressed == SAMPLES,
+              "thong ke khong cong du so mau");
+    }
+    for (size_t i = 1; i < sizeof(runs) / sizeof(runs[0]); i++) {
+        check(mae[i] < mae[0], "bo loc khong giam sai so");
+        check(st[i].suppressed > st[0].suppressed, "bo loc khong bo qua them cap nhat nao");
+    }
+
+    if (failures) {
+        printf("%d loi\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("OK: bo loc AVG/MED/KAL giam nhieu va bo qua cap nhat khong doi\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+# Bộ dịch font cho GLIB: đọc font BDF, sinh file C chứa bảng điểm ảnh theo
+# layout GLIB_FONT_LAYOUT_GLYPH_ROWS.
+#
+# Mỗi glyph được lưu thành fontHeight hàng liên tiếp, mỗi hàng ceil(w/8) byte,
+# điểm ảnh trái nhất ở bit 0 của byte đầu (đúng thứ tự LSB-first của
+# framebuffer memlcd), nên GLIB_drawChar ghép thẳng một hàng vào framebuffer
+# mà không phải đảo bit hay nhảy theo fontRowOffset.
+#
+#   fontc.py font.bdf -o glib_font_x.c           sinh file C
+#   fontc.py font.bdf -o glib_font_x.c --check   báo lỗi nếu file C đã cũ
+#   fontc.py font.bdf -o ... --proportional      thêm bảng độ rộng từng glyph
+#
+# Các thuộc tính riêng trong BDF (STARTPROPERTIES):
+#   _GLIB_NAME, _GLIB_GUARD, _GLIB_BRIEF, _GLIB_DESCRIPTION   tên và chú thích
+#   _GLIB_LINE_SPACING, _GLIB_CHAR_SPACING                    khoảng cách (pixel)
+#   _GLIB_NUMBERS_ONLY 1      chỉ có "0123456789: " (NumbersOnlyFont)
+#   _GLIB_PROPORTIONAL 1      giống --proportional
+import argparse
+import os
+import sys
+
+# ==========================================
+# CẤU HÌNH
+# ==========================================
+FULL_CHARSET = ''.join(chr(c) for c in range(ord(' '), ord('~') + 1))
+NUMBERS_CHARSET = '0123456789: '
+BYTES_PER_LINE = 12
+
+
+class FontError(Exception):
+    pass
+
+
+# --- HÀM: ĐỌC FONT BDF ---
+def parse_bdf(path):
+    font = {'comments': [], 'props': {}, 'glyphs': {}}
+    with open(path, encoding='ascii') as f:
+        lines = [l.rstrip('\n') for l in f]
+
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        i += 1
+        if not words:
+            continue
+        key = words[0]
+        if key == 'COMMENT':
+            font['comments'].append(lines[i - 1][len('COMMENT '):].rstrip())
+        elif key == 'FONTBOUNDINGBOX':
+            font['bbox'] = [int(v) for v in words[1:5]]
+        elif key == 'STARTPROPERTIES':
+            while lines[i].split()[0] != 'ENDPROPERTIES':
+                name, _, value = lines[i].partition(' ')
+                value = value.strip()
+                if value.startswith('"'):
+                    value = value[1:-1].replace('""', '"')
+                font['props'][name] = value
+                i += 1
+            i += 1
+        elif key == 'STARTCHAR':
+            glyph = {'name': ' '.join(words[1:])}
+            while True:
+                words = lines[i].split()
+                i += 1
+                if words[0] == 'ENCODING':
+                    glyph['encoding'] = int(words[1])
+                elif words[0] == 'DWIDTH':
+                    glyph['dwidth'] = int(words[1])
+                elif words[0] == 'BBX':
+                    glyph['bbx'] = [int(v) for v in words[1:5]]
+                elif words[0] == 'BITMAP':
+                    glyph['bitmap'] = [int(l, 16) for l in lines[i:i + glyph['bbx'][1]]]
+                    i += glyph['bbx'][1]
+                elif words[0] == 'ENDCHAR':
+                    break
+            font['glyphs'][glyph['encoding']] = glyph
+    if 'bbox' not in font:
+        raise FontError('%s: thieu FONTBOUNDINGBOX' % path)
+    return font
+
+
+# --- HÀM: ĐƯA MỘT GLYPH VỀ Ô fontWidth x fontHeight, TRẢ VỀ CÁC HÀNG LSB-FIRST ---
+def glyph_rows(font, glyph):
+    fw, fh, fx, fy = font['bbox']
+    w, h, x, y = glyph['bbx']
+    left = x - fx
+    top = (fh + fy) - (h + y)
+    row_bits = (w + 7) // 8 * 8
+    rows = [0] * fh
+
+    if left < 0 or top < 0 or left + w > fw or top + h > fh:
+        raise FontError('glyph %s nam ngoai FONTBOUNDINGBOX' % glyph['name'])
+    for r, value in enumerate(glyph['bitmap']):
+        bits = 0
+        for c in range(w):
+            # BDF: bit cao nhất của hàng là điểm ảnh trái nhất
+            if value >> (row_bits - 1 - c) & 1:
+                bits |= 1 << (left + c)
+        rows[top + r] = bits
+    return rows
+
+
+def c_char(ch):
+    if ch in '\\\'':
+        return "'\\%s'" % ch
+    return "'%s'" % ch
+
+
+# --- HÀM: SINH FILE C ---
+def compile_font(font, source, proportional):
+    props = font['props']
+    for p in ('_GLIB_NAME', '_GLIB_GUARD', '_GLIB_BRIEF', '_GLIB_DESCRIPTION'):
+        if p not in props:
+            raise FontError('%s: thieu thuoc tinh %s' % (source, p))
+    name = props['_GLIB_NAME']
+    guard = props['_GLIB_GUARD']
+    numbers_only = props.get('_GLIB_NUMBERS_ONLY', '0') == '1'
+    proportional = proportional or props.get('_GLIB_PROPORTIONAL', '0') == '1'
+    line_spacing = int(props.get('_GLIB_LINE_SPACING', '0'))
+    char_spacing = int(props.get('_GLIB_CHAR_SPACING', '0'))
+    charset = NUMBERS_CHARSET if numbers_only else FULL_CHARSET
+
+    width, height = font['bbox'][0], font['bbox'][1]
+    row_bytes = (width + 7) // 8
+    if width > 32:
+        raise FontError('%s: glyph rong hon 32 diem anh' % source)
+
+    data = []
+    advances = []
+    for ch in charset:
+        glyph = font['glyphs'].get(ord(ch))
+        if glyph is None:
+            raise FontError('%s: thieu ky tu %s' % (source, c_char(ch)))
+        row_data = []
+        for bits in glyph_rows(font, glyph):
+            row_data += [(bits >> (8 * b)) & 0xFF for b in range(row_bytes)]
+        data.append((ch, row_data))
+        advance = glyph.get('dwidth', width) + char_spacing
+        if advance > 255:
+            raise FontError('%s: do rong %s qua lon' % (source, c_char(ch)))
+        advances.append(advance)
+
+    out = []
+    out.append('/***************************************************************************//**')
+    out.append(' * @file')
+    out.append(' * @brief %s' % props['_GLIB_BRIEF'])
+    out.append(' *******************************************************************************')
+    if 'COPYRIGHT' in props:
+        out.append(' * # License')
+        out.append(' * <b>%s</b>' % props['COPYRIGHT'])
+        out.append(' *******************************************************************************')
+    out.append(' *')
+    for line in font['comments']:
+        out.append((' * ' + line).rstrip())
+    out.append(' *')
+    out.append(' ******************************************************************************/')
+    out.append('')
+    out.append('/* Generated by PC-host-sim/tools/fontc.py from %s, do not edit. */' % source)
+    out.append('')
+    out.append('/* Standard C header files */')
+    out.append('#include <stdint.h>')
+    out.append('#include "glib.h"')
+    out.append('')
+    out.append('#if (%s == 1) || defined(DOXYGEN)' % guard)
+    out.append('')
+    out.append('/** @brief Pixel data for the "%s" font.' % name)
+    out.append(' *  %d rows of %d byte%s per glyph, leftmost pixel in bit 0. */'
+               % (height, row_bytes, '' if row_bytes == 1 else 's'))
+    out.append('static const uint8_t %sPixMap[] =' % name)
+    out.append('{')
+    for n, (ch, row_data) in enumerate(data):
+        last = n == len(data) - 1
+        if len(row_data) <= BYTES_PER_LINE:
+            # Glyph nhỏ: một dòng mỗi glyph, tên ký tự ở cuối dòng
+            out.append('  ' + ', '.join('0x%02x' % b for b in row_data)
+                       + (' ' if last else ',') + ' /* %s */' % c_char(ch))
+            continue
+        out.append('  /* %s */' % c_char(ch))
+        for k in range(0, len(row_data), BYTES_PER_LINE):
+            chunk = row_data[k:k + BYTES_PER_LINE]
+            end = last and k + BYTES_PER_LINE >= len(row_data)
+            out.append('  ' + ', '.join('0x%02x' % b for b in chunk) + ('' if end else ','))
+    out.append('};')
+    out.append('')
+    if proportional:
+        out.append('/** @brief Advance widths of the "%s" glyphs, in pixels. */' % name)
+        out.append('static const uint8_t %sAdvance[] =' % name)
+        out.append('{')
+        for k in range(0, len(advances), BYTES_PER_LINE):
+            chunk = advances[k:k + BYTES_PER_LINE]
+            end = k + BYTES_PER_LINE >= len(advances)
+            out.append('  ' + ', '.join('%2d' % a for a in chunk) + ('' if end else ','))
+        out.append('};')
+        out.append('')
+    out.append('/**')
+    out.append(' * @brief %s' % props['_GLIB_DESCRIPTION'])
+    out.append(' */')
+    head = 'const GLIB_Font_t %s = { ' % name
+    pad = ' ' * len(head)
+    out.append(head + '(void *)%sPixMap,' % name)
+    out.append(pad + '%d, /* glyphs */' % len(charset))
+    out.append(pad + 'sizeof(%sPixMap[0]),' % name)
+    out.append(pad + '%d, %d, %d, %d, %d, %s,' % (row_bytes, width, height, line_spacing,
+                                                 char_spacing,
+                                                 'NumbersOnlyFont' if numbers_only else 'FullFont'))
+    out.append(pad + 'GLIB_FONT_LAYOUT_GLYPH_ROWS, %s };'
+               % ('%sAdvance' % name if proportional else 'NULL'))
+    out.append('')
+    out.append('#endif // %s' % guard)
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    ap = argparse.ArgumentParser(description='BDF -> GLIB font C table')
+    ap.add_argument('bdf')
+    ap.add_argument('-o', '--output', required=True)
+    ap.add_argument('--proportional', action='store_true',
+                    help='sinh bang do rong tung glyph tu DWIDTH')
+    ap.add_argument('--check', action='store_true',
+                    help='chi kiem tra file C co khop voi BDF khong')
+    args = ap.parse_args()
+
+    try:
+        text = compile_font(parse_bdf(args.bdf), os.path.basename(args.bdf), args.proportional)
+    except (FontError, OSError, ValueError, KeyError, IndexError) as e:
+        print('fontc: %s' % e, file=sys.stderr)
+        return 1
+
+    if args.check:
+        try:
+            with open(args.output, encoding='utf-8') as f:
+                current = f.read()
+        except OSError:
+            current = None
+        if current != text:
+            print('fontc: %s cu, chay lai "./build.sh fonts"' % args.output, file=sys.stderr)
+            return 1
+        return 0
+
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(text)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+# Bộ chuyển ảnh cho GLIB: đọc ảnh PBM hoặc BMP, sinh file C chứa một
+# GLIB_PackedImage_t vẽ bằng GLIB_drawPackedImage().
+#
+# Mỗi hàng ảnh là ceil(w/8) byte, điểm ảnh trái nhất ở bit 0 của byte đầu,
+# bit 1 là trắng (đúng thứ tự LSB-first của framebuffer memlcd). Các hàng có
+# thể được XOR với hàng ngay trên (row delta, hàng đầu XOR với hàng đen) rồi
+# nén PackBits; một đoạn PackBits không bao giờ vắt sang hàng sau, nên bộ
+# giải mã chỉ cần một hàng đệm.
+#
+#   imgc.py anh.pbm -o anh.c                      sinh file C, tự chọn cách nén nhỏ nhất
+#   imgc.py anh.bmp -o anh.c --mode packbits      ép một cách nén
+#   imgc.py anh.pbm -o anh.c --crop 12,14,41,33   chỉ lấy vùng x,y,w,h
+#   imgc.py anh.pbm -o anh.c --check              báo lỗi nếu file C đã cũ
+#
+# Đầu vào: PBM P1/P4, BMP không nén 1/8/24-bit (điểm có độ sáng >= 128 là
+# trắng, độ sáng tính như BMP_readMonoRow: (77R + 150G + 29B) >> 8).
+import argparse
+import os
+import re
+import struct
+import sys
+
+# ==========================================
+# CẤU HÌNH
+# ==========================================
+MAX_WIDTH = 128         # GLIB_PACKED_IMAGE_MAX_WIDTH
+BYTES_PER_LINE = 16
+
+PACKBITS = 0x01
+ROW_DELTA = 0x02
+MODES = {
+    'raw': 0,
+    'packbits': PACKBITS,
+    'delta': ROW_DELTA,
+    'packbits-delta': PACKBITS | ROW_DELTA,
+}
+FLAG_NAMES = {
+    0: '0',
+    PACKBITS: 'GLIB_PACKED_IMAGE_PACKBITS',
+    ROW_DELTA: 'GLIB_PACKED_IMAGE_ROW_DELTA',
+    PACKBITS | ROW_DELTA: 'GLIB_PACKED_IMAGE_PACKBITS | GLIB_PACKED_IMAGE_ROW_DELTA',
+}
+
+
+class ImageError(Exception):
+    pass
+
+
+# --- HÀM: ĐỌC ẢNH, TRẢ VỀ (w, h, các hàng điểm ảnh 0/1 với 1 là trắng) ---
+def read_pbm(data):
+    # Header: magic, rộng, cao, cách nhau bởi khoảng trắng hoặc chú thích '#'
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        m = re.compile(rb'\s*(#[^\n]*\n\s*)*([^\s#]+)').match(data, pos)
+        if m is None:
+            raise ImageError('header PBM hong')
+        tokens.append(m.group(2))
+        pos = m.end()
+    magic, w, h = tokens[0], int(tokens[1]), int(tokens[2])
+
+    if magic == b'P4':
+        pos += 1
+        row_bytes = (w + 7) // 8
+        if len(data) < pos + row_bytes * h:
+            raise ImageError('PBM bi cat')
+        rows = []
+        for y in range(h):
+            row = data[pos + y * row_bytes:pos + (y + 1) * row_bytes]
+            # PBM: bit cao nhất là điểm trái nhất, bit 1 là đen
+            rows.append([0 if row[x >> 3] >> (7 - (x & 7)) & 1 else 1 for x in range(w)])
+        return w, h, rows
+    if magic == b'P1':
+        bits = [c for c in re.sub(rb'#[^\n]*', b'', data[pos:]) if c in b'01']
+        if len(bits) < w * h:
+            raise ImageError('PBM bi cat')
+        return w, h, [[0 if bits[y * w + x] == ord('1') else 1 for x in range(w)]
+                      for y in range(h)]
+    raise ImageError('chi doc duoc PBM P1/P4')
+
+
+def read_bmp(data):
+    if len(data) < 54:
+        raise ImageError('BMP bi cat')
+    offset, = struct.unpack_from('<I', data, 10)
+    header_size, w, h, planes, bpp, compression = struct.unpack_from('<IiiHHI', data, 14)
+    if compression != 0 or bpp not in (1, 8, 24):
+        raise ImageError('chi doc duoc BMP khong nen 1/8/24-bit')
+    top_down = h < 0
+    h = abs(h)
+
+    palette = []
+    if bpp <= 8:
+        for i in range(1 << bpp):
+            b, g, r = data[14 + header_size + 4 * i:14 + header_size + 4 * i + 3]
+            palette.append((77 * r + 150 * g + 29 * b) >> 8)
+
+    stride = (w * bpp + 31) // 32 * 4
+    if len(data) < offset + stride * h:
+        raise ImageError('BMP bi cat')
+    rows = [None] * h
+    for r in range(h):
+        row = data[offset + r * stride:offset + (r + 1) * stride]
+        luma = []
+        for x in range(w):
+            if bpp == 24:
+                b, g, red = row[3 * x:3 * x + 3]
+                luma.append((77 * red + 150 * g + 29 * b) >> 8)
+            elif bpp == 8:
+                luma.append(palette[row[x]])
+            else:
+                luma.append(palette[row[x >> 3] >> (7 - (x & 7)) & 1])
+        rows[r if top_down else h - 1 - r] = [1 if l >= 128 else 0 for l in luma]
+    return w, h, rows
+
+
+def read_image(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:2] == b'BM':
+        return read_bmp(data)
+    return read_pbm(data)
+
+
+# --- HÀM: NÉN ---
+def row_bytes_of(pixels):
+    out = bytearray((len(pixels) + 7) // 8)
+    for x, p in enumerate(pixels):
+        if p:
+            out[x >> 3] |= 1 << (x & 7)
+    return out
+
+
+def packbits(row):
+    out = bytearray()
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and run < 128 and row[i + run] == row[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([(1 - run) & 0xFF, row[i]])
+            i += run
+            continue
+        # Đoạn tuyệt đối: dừng trước một đoạn lặp >= 3 byte
+        start = i
+        while i < len(row) and i - start < 128:
+            if i + 2 < len(row) and row[i] == row[i + 1] == row[i + 2]:
+                break
+            i += 1
+        out += bytes([i - start - 1]) + row[start:i]
+    return out
+
+
+def encode(rows, flags):
+    out = bytearray()
+    prev = bytearray(len(rows[0]) if rows else 0)
+    for row in rows:
+        data = bytes(a ^ b for a, b in zip(row, prev)) if flags & ROW_DELTA else row
+        out += packbits(data) if flags & PACKBITS else data
+        prev = row
+    return bytes(out)
+
+
+# --- HÀM: SINH FILE C ---
+def compile_image(path, name, crop, mode):
+    w, h, pixels = read_image(path)
+    if crop is not None:
+        cx, cy, cw, ch = crop
+        if cx < 0 or cy < 0 or cw <= 0 or ch <= 0 or cx + cw > w or cy + ch > h:
+            raise ImageError('vung cat nam ngoai anh %dx%d' % (w, h))
+        pixels = [r[cx:cx + cw] for r in pixels[cy:cy + ch]]
+        w, h = cw, ch
+    if w > MAX_WIDTH:
+        raise ImageError('anh rong %d, toi da %d diem anh' % (w, MAX_WIDTH))
+
+    rows = [row_bytes_of(r) for r in pixels]
+    if mode == 'auto':
+        # Cách nhỏ nhất; bằng nhau thì chọn cách giải mã đơn giản hơn
+        flags, data = min(((f, encode(rows, f)) for f in sorted(MODES.values())),
+                          key=lambda c: len(c[1]))
+    else:
+        flags = MODES[mode]
+        data = encode(rows, flags)
+
+    source = os.path.basename(path)
+    if crop is not None:
+        source += ' (%d,%d %dx%d)' % crop
+    out = []
+    out.append('/* Generated by PC-host-sim/tools/imgc.py from %s, do not edit. */' % source)
+    out.append('/* %dx%d, %s: %d bytes, %d unpacked. */'
+               % (w, h, [k for k, v in MODES.items() if v == flags][0], len(data),
+                  len(rows[0]) * h if rows else 0))
+    out.append('')
+    out.append('/* Standard C header files */')
+    out.append('#include <stdint.h>')
+    out.append('#include "glib.h"')
+    out.append('')
+    out.append('static const uint8_t %sData[] =' % name)
+    out.append('{')
+    for k in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[k:k + BYTES_PER_LINE]
+        end = k + BYTES_PER_LINE >= len(data)
+        out.append('  ' + ', '.join('0x%02x' % b for b in chunk) + ('' if end else ','))
+    out.append('};')
+    out.append('')
+    head = 'const GLIB_PackedImage_t %s = { ' % name
+    pad = ' ' * len(head)
+    out.append(head + '%d, %d,' % (w, h))
+    out.append(pad + '%s,' % FLAG_NAMES[flags])
+    out.append(pad + 'sizeof(%sData), %sData };' % (name, name))
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    ap = argparse.ArgumentParser(description='PBM/BMP -> GLIB packed image C source')
+    ap.add_argument('image')
+    ap.add_argument('-o', '--output', required=True)
+    ap.add_argument('--name', help='ten bien GLIB_PackedImage_t (mac dinh: ten file)')
+    ap.add_argument('--crop', help='chi lay vung x,y,w,h cua anh')
+    ap.add_argument('--mode', choices=['auto'] + list(MODES), default='auto',
+                    help='cach nen (mac dinh: nho nhat)')
+    ap.add_argument('--check', action='store_true',
+                    help='chi kiem tra file C co khop voi anh khong')
+    args = ap.parse_args()
+
+    name = args.name or re.sub(r'\W', '_', os.path.splitext(os.path.basename(args.image))[0])
+    try:
+        crop = tuple(int(v) for v in args.crop.split(',')) if args.crop else None
+        if crop is not None and len(crop) != 4:
+            raise ImageError('--crop can x,y,w,h')
+        text = compile_image(args.image, name, crop, args.mode)
+    except (ImageError, OSError, ValueError, struct.error, IndexError) as e:
+        print('imgc: %s' % e, file=sys.stderr)
+        return 1
+
+    if args.check:
+        try:
+            with open(args.output, encoding='utf-8') as f:
+                current = f.read()
+        except OSError:
+            current = None
+        if current != text:
+            print('imgc: %s cu, chay lai "./build.sh images"' % args.output, file=sys.stderr)
+            return 1
+        return 0
+
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(text)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -7,6 +7,10 @@
 #include <stdlib.h>
 #include "app.h"
 #include "dht20.h"
+#include "centi.h"
+#include "i2c_bus.h"
+#include "sensor_sched.h"
+#include "sensor_filter.h"
 #include "sl_sleeptimer.h"
 #include "app_log.h"
 #include "app_lcd.h"
@@ -31,7 +35,9 @@ extern GLIB_Context_t glibContext;
 #define SET_1_SEC(x)                (uint8_t)(STEP_RES_1_SEC | ((x) & (0x3F)))
 #define SET_10_SEC(x)               (uint8_t)(STEP_RES_10_SEC | ((x) & (0x3F)))
 
-#define EX_B0_PRESS                 ((1) << 5)
+#define EX_B0_PRESS                 ((1) << 5)    // Nhấn ngắn: đổi chu kỳ đo
+#define EX_B0_LONG_PRESS            ((1) << 7)    // Giữ lâu: sang trang kế tiếp
+#define B0_LONG_PRESS_MS            800
 
 // --- CẤU HÌNH ---
 static uint32_t measure_interval_ms = 1000; // Mặc định 1s
@@ -45,8 +51,18 @@ static uint32_t last_measure_tick = 0;
 static char input_buffer[64];
 static uint8_t input_pos = 0;
 
-static float current_temp = 0.0f;
-static float current_hum = 0.0f;
+// Số liệu đã lọc công bố lần gần nhất, đơn vị 0.01 (centi °C, centi %RH)
+static int16_t current_temp = 0;
+static int16_t current_hum = 0;
+
+// Số liệu cho trang BLE và trang thống kê
+static uint8_t connection_handle = 0xff;
+static int8_t last_rssi = 0;
+static uint32_t sample_count = 0;
+static uint32_t read_error_count = 0;
+static sl_sleeptimer_timer_handle_t btn0_hold_timer;
+static volatile bool btn0_long_fired = false;
+static uint8_t dht20_index = 0;
 
 static uint8_t period_idx = 0;
 static uint8_t periods[] = {
@@ -66,14 +82,93 @@ static uint32_t parse_period_to_ms(uint8_t interval) {
     }
 }
 
+// Đặt chu kỳ quảng bá theo ms, stack BLE dùng đơn vị 0.625 ms (số nguyên)
+static void adv_set_interval(uint32_t ms) {
+    uint32_t adv_tim = ms * 16 / 10;
+    sl_bt_advertiser_set_timing(advertising_set_handle, adv_tim, adv_tim, 0, 0);
+}
+
+// Giữ đủ B0_LONG_PRESS_MS: sang trang ngay khi còn đang giữ
+static void btn0_hold_expired(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    btn0_long_fired = true;
+    sl_bt_external_signal(EX_B0_LONG_PRESS);
+}
+
+// Nhấn ngắn vẫn đổi chu kỳ đo như trước, nhưng báo lúc nhả nút (nhấn rồi
+// nhả trước B0_LONG_PRESS_MS) để phân biệt với giữ lâu để chuyển trang
 void sl_button_on_change(const sl_button_t *handle) {
+    if (handle != &sl_button_btn0) return;
+
     if (sl_button_get_state(handle) == SL_SIMPLE_BUTTON_PRESSED) {
-        if (handle == &sl_button_btn0) {
+        btn0_long_fired = false;
+        sl_sleeptimer_start_timer_ms(&btn0_hold_timer, B0_LONG_PRESS_MS,
+                                     btn0_hold_expired, NULL, 0, 0);
+    } else {
+        sl_sleeptimer_stop_timer(&btn0_hold_timer);
+        if (!btn0_long_fired) {
             sl_bt_external_signal(EX_B0_PRESS);
         }
     }
 }
 
+static uint32_t uptime_s(void) {
+    uint64_t ms = 0;
+    sl_sleeptimer_tick64_to_ms(sl_sleeptimer_get_tick_count64(), &ms);
+    return (uint32_t)(ms / 1000);
+}
+
+// Kết quả một lần đo DHT20 (xong, lỗi hoặc hết lần hỏi lại)
+static void measurement_done(sl_status_t sc, int16_t temp, int16_t hum) {
+  if (sc == SL_STATUS_OK) {
+      int16_t raw[SENSOR_FILTER_CHANNELS] = { temp, hum };
+      int16_t filtered[SENSOR_FILTER_CHANNELS];
+      bool changed = sensor_filter_apply(raw, filtered);
+      const sensor_filter_stats_t *fs = sensor_filter_get_stats();
+      char t[CENTI_STR_LEN], h[CENTI_STR_LEN];
+
+      app_log("DATA:T=%s,H=%s\n", centi_format(t, sizeof(t), temp), centi_format(h, sizeof(h), hum));
+
+      // Biểu đồ là trục thời gian: mỗi lần đo một cột, kể cả khi bị bỏ qua
+      memlcd_plot_sample(filtered[0]);
+
+      if (changed) {
+          current_temp = filtered[0];
+          current_hum = filtered[1];
+          app_log("FILT:T=%s,H=%s\n", centi_format(t, sizeof(t), current_temp),
+                  centi_format(h, sizeof(h), current_hum));
+          memlcd_update_sensor(current_temp, current_hum, measure_interval_ms);
+
+          if (advertising_set_handle != 0xff) {
+              update_adv_data(&myAdvData, advertising_set_handle, current_temp, current_hum);
+          }
+      } else {
+          app_log("FILT: khong doi, bo qua %lu/%lu\n",
+                  (unsigned long)fs->suppressed, (unsigned long)fs->samples);
+      }
+      sample_count++;
+  } else {
+      app_log("ERR: Read Fail\n");
+      read_error_count++;
+  }
+
+  // RSSI đến sau qua sl_bt_evt_connection_rssi_id
+  if (connection_handle != 0xff) {
+      sl_bt_connection_get_rssi(connection_handle);
+  }
+  memlcd_update_stats(uptime_s(), sample_count, read_error_count);
+}
+
+// Cấu hình bộ lọc và số lần cập nhật đã bỏ qua
+static void log_filter(void) {
+  const sensor_filter_stats_t *fs = sensor_filter_get_stats();
+
+  app_log(">> CAU HINH UART: Loc %s, cua so %u, nguong %u (0.01), bo qua %lu/%lu cap nhat\n",
+          sensor_filter_name(sensor_filter_get_type()), sensor_filter_get_window(),
+          sensor_filter_get_deadband(), (unsigned long)fs->suppressed, (unsigned long)fs->samples);
+}
+
 void process_input_command(char *cmd) {
   if (strncmp(cmd, "SET_P=", 6) == 0) {
       int val = atoi(cmd + 6);
@@ -87,9 +182,43 @@ void process_input_command(char *cmd) {
       int val = atoi(cmd + 8);
       if (val >= 32 && advertising_set_handle != 0xff) {
           adv_interval_ms = val;
-          uint32_t adv_tim = (uint32_t)(val * 1.6);
-          sl_bt_advertiser_set_timing(advertising_set_handle, adv_tim, adv_tim, 0, 0);
+          adv_set_interval(adv_interval_ms);
           app_log(">> CAU HINH UART: BLE ADV = %lu ms\n", adv_interval_ms);
+          memlcd_update_ble(connection_handle != 0xff, last_rssi, adv_interval_ms);
+      }
+  }
+  else if (strncmp(cmd, "SET_FILTER=", 11) == 0) {
+      sensor_filter_type_t type;
+      if (sensor_filter_parse(cmd + 11, &type) == SL_STATUS_OK) {
+          sensor_filter_configure(type, sensor_filter_get_window());
+          log_filter();
+      }
+  }
+  else if (strncmp(cmd, "SET_WIN=", 8) == 0) {
+      int val = atoi(cmd + 8);
+      if (val >= 1 && val <= SENSOR_FILTER_WINDOW_MAX) {
+          sensor_filter_configure(sensor_filter_get_type(), (uint8_t)val);
+          log_filter();
+      }
+  }
+  else if (strncmp(cmd, "SET_DB=", 7) == 0) {
+      int val = atoi(cmd + 7);
+      if (val >= 0 && val <= 10000) {
+          sensor_filter_set_deadband((uint16_t)val);
+          log_filter();
+      }
+  }
+  else if (strcmp(cmd, "FILTER?") == 0) {
+      log_filter();
+  }
+  else if (strncmp(cmd, "SET_FRAME=", 10) == 0) {
+      int val = atoi(cmd + 10);
+      if (val >= 0 && val <= 10000) {
+          memlcd_frame_stats_t fs;
+          memlcd_set_frame_period((uint32_t)val);
+          memlcd_get_frame_stats(&fs);
+          app_log(">> CAU HINH UART: Chu ky khung = %d ms (da gui %lu/%lu khung)\n",
+                  val, (unsigned long)fs.flushed, (unsigned long)fs.requested);
       }
   }
 }
@@ -115,15 +244,22 @@ void app_init(void) {
   app_log("\n=======================================\n");
   app_log("    HE THONG GIAM SAT MOI TRUONG\n");
   app_log("=======================================\n");
+  app_log("BTN0: nhan ngan = doi chu ky do, giu %d ms = sang trang LCD\n", B0_LONG_PRESS_MS);
 
   memlcd_app_init(); // Gọi hàm bên app_lcd.c
-  memlcd_update_sensor(0.0, 0.0, measure_interval_ms);
+  memlcd_update_sensor(0, 0, measure_interval_ms);
 
+  // Hàng đợi I2C theo ngắt cho các lần đo (sl_i2cspm_init đã chạy ở sl_system_init)
+  i2c_bus_init();
+  sensor_sched_init();
+  sensor_filter_init();
   if (dht20_init() == SL_STATUS_OK) {
       app_log("[SUCCESS] DHT20 Init OK\n");
   } else {
       app_log("[ERROR] DHT20 Init Failed\n");
   }
+  // Cảm biến mới chỉ cần đăng ký thêm ở đây, thời gian đo chồng lên nhau
+  sensor_sched_register(&dht20_sensor, &dht20_index);
   sl_simple_button_enable(&sl_button_btn0);
 }
 
@@ -135,18 +271,34 @@ void sl_bt_on_event(sl_bt_msg_t *evt) {
       sc = sl_bt_advertiser_create_set(&advertising_set_handle);
       app_assert_status(sc);
 
-      uint32_t adv_tim = (uint32_t)(adv_interval_ms * 1.6);
-      sl_bt_advertiser_set_timing(advertising_set_handle, adv_tim, adv_tim, 0, 0);
+      adv_set_interval(adv_interval_ms);
 
-      fill_adv_packet(&myAdvData, FLAG_VALUE, COMPANY_ID, myStudentID, 0.0f, 0.0f, "DHT20_BLE");
+      fill_adv_packet(&myAdvData, FLAG_VALUE, COMPANY_ID, myStudentID, 0, 0, "DHT20_BLE");
       start_adv(&myAdvData, advertising_set_handle);
+      memlcd_update_ble(false, 0, adv_interval_ms);
+      break;
+
+    case sl_bt_evt_connection_opened_id:
+      connection_handle = evt->data.evt_connection_opened.connection;
+      last_rssi = 0;
+      memlcd_update_ble(true, last_rssi, adv_interval_ms);
+      break;
+
+    case sl_bt_evt_connection_rssi_id:
+      last_rssi = evt->data.evt_connection_rssi.rssi;
+      memlcd_update_ble(true, last_rssi, adv_interval_ms);
       break;
 
     case sl_bt_evt_connection_closed_id:
+      connection_handle = 0xff;
+      memlcd_update_ble(false, 0, adv_interval_ms);
       sl_bt_legacy_advertiser_start(advertising_set_handle, sl_bt_legacy_advertiser_connectable);
       break;
 
     case sl_bt_evt_system_external_signal_id:
+      if (evt->data.evt_system_external_signal.extsignals & EX_B0_LONG_PRESS) {
+          memlcd_next_page();
+      }
       if (evt->data.evt_system_external_signal.extsignals & EX_B0_PRESS) {
           period_idx++;
           if (period_idx >= sizeof(periods)) period_idx = 0;
@@ -158,6 +310,24 @@ void sl_bt_on_event(sl_bt_msg_t *evt) {
 
           if (measure_interval_ms > 0) last_measure_tick = 0;
       }
+      if (evt->data.evt_system_external_signal.extsignals & EX_LCD_REFRESH_DONE) {
+          memlcd_on_refresh_done();
+      }
+      if (evt->data.evt_system_external_signal.extsignals & EX_SENSOR_READY) {
+          if (sensor_sched_process() == SL_STATUS_OK) {
+              int16_t values[SENSOR_SCHED_VALUES_MAX] = { 0 };
+              const sensor_sched_report_t *r = sensor_sched_get_report();
+              sc = sensor_sched_get(dht20_index, values);
+              measurement_done(sc, values[0], values[1]);
+              app_log("SCHED: bus %lu ppm, cpu %lu ppm, tre %lu ms\n",
+                      sensor_sched_bus_duty_ppm(r),
+                      sensor_sched_cpu_duty_ppm(r),
+                      sl_sleeptimer_tick_to_ms(r->latency_ticks));
+          }
+      }
+      if (evt->data.evt_system_external_signal.extsignals & EX_LCD_FRAME) {
+          memlcd_on_frame();
+      }
       break;
 
     default: break;
@@ -175,27 +345,9 @@ void app_process_action(void) {
       if (tick_diff >= measure_interval_ms) {
           last_measure_tick = current_tick;
 
-          float temp = 0.0f;
-          float hum = 0.0f;
-
-          if (dht20_read(&temp, &hum) == SL_STATUS_OK) {
-              current_temp = temp;
-              current_hum = hum;
-
-              int t_int = (int)temp;
-              int t_frac = (int)((temp - t_int) * 100); if(t_frac < 0) t_frac = -t_frac;
-              int h_int = (int)hum;
-              int h_frac = (int)((hum - h_int) * 100);
-
-              app_log("DATA:T=%d.%02d,H=%d.%02d\n", t_int, t_frac, h_int, h_frac);
-
-              memlcd_update_sensor(temp, hum, measure_interval_ms);
-
-              if (advertising_set_handle != 0xff) {
-                  update_adv_data(&myAdvData, advertising_set_handle, temp, hum);
-              }
-          } else {
-              app_log("ERR: Read Fail\n");
+          // Trigger mọi cảm biến cùng lúc, kết quả về qua EX_SENSOR_READY
+          if (!sensor_sched_is_busy() && sensor_sched_start() != SL_STATUS_OK) {
+              measurement_done(SL_STATUS_TRANSMIT, 0, 0);
           }
       }
   }
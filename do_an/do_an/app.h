@@ -5,6 +5,6 @@
 
 void app_init(void);
 void app_process_action(void);
-void memlcd_update_sensor(float temp, float hum, uint32_t interval_ms);
+void memlcd_update_sensor(int16_t temp_centi, int16_t hum_centi, uint32_t interval_ms);
 
 #endif // APP_H
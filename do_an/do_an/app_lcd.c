@@ -1,59 +1,428 @@
 #include <stdio.h>
+#include <string.h>
 #include "sl_board_control.h"
 #include "em_assert.h"
 #include "glib.h"
 #include "dmd.h"
+#include "lcd.h"
+#include "lcd_display.h"
 #include "app_lcd.h"
+#include "centi.h"
+#include "sl_bt_api.h"
+#include "sl_sleeptimer.h"
 
 // Biến toàn cục context màn hình
 GLIB_Context_t glibContext;
 
+// --- CÁC TRANG MÀN HÌNH ---
+// Mỗi trang có framebuffer riêng và luôn được vẽ sẵn, kể cả khi đang ẩn.
+// Chuyển trang chỉ đổi framebuffer mà driver gửi đi, không vẽ lại gì.
+// Trang cảm biến dùng framebuffer của DMD_init(), các trang còn lại lấy từ
+// vùng nhớ pagePool bên dưới.
+#define PAGE_FB_SIZE  SL_MEMLCD_FRAMEBUFFER_SIZE(SL_MEMLCD_DISPLAY_WIDTH, \
+                                                 SL_MEMLCD_DISPLAY_HEIGHT, \
+                                                 SL_MEMLCD_DISPLAY_BPP)
+static uint8_t pagePool[(MEMLCD_PAGE_COUNT - 1) * PAGE_FB_SIZE] SL_ATTRIBUTE_ALIGN(4);
+static void *pageBuffer[MEMLCD_PAGE_COUNT];
+static memlcd_page_t visiblePage = MEMLCD_PAGE_SENSOR;
+
+// Lưới chữ của từng trang, chỉ vẽ lại ký tự nào thay đổi
+static GLIB_TextGrid_t textGrid[MEMLCD_PAGE_COUNT];
+
+static const char *const pageTitle[MEMLCD_PAGE_COUNT] = {
+  "DHT20 MONITOR",
+  "BLE GATEWAY",
+  "STATISTICS",
+};
+
+// Biểu đồ nhiệt độ dưới các dòng chữ: mỗi cột một mẫu, đơn vị 0.1 độ C
+#define TEMP_CHART_MIN              0     // 0.0 C ở đáy
+#define TEMP_CHART_MAX              500   // 50.0 C ở đỉnh
+static const GLIB_Rectangle_t tempChartFrame = { 3, 83, 124, 125 };
+static const GLIB_Rectangle_t tempChartArea  = { 4, 84, 123, 124 };
+static GLIB_StripChart_t tempChart;
+
+// Cảnh báo nhiệt độ cao: dòng nhiệt độ nhấp nháy theo mỗi lần đo. Đảo màu
+// bằng cách vẽ một hình chữ nhật trắng với phép XOR, vẽ lại lần nữa là trả
+// về như cũ, không phải vẽ lại chữ bên dưới.
+#define TEMP_ALARM_CENTI            3500   // 35.00 °C
+static const GLIB_Rectangle_t tempAlarmRect = { 2, 48, 125, 65 };
+static bool tempAlarmShown = false;
+
+// Số liệu đo bằng chữ phóng to giữa tiêu đề và biểu đồ: nhãn và đơn vị vẽ
+// một lần lúc khởi động, giá trị căn phải trong SENSOR_VALUE_CHARS ô và chỉ
+// vẽ lại khi chuỗi đổi.
+#define SENSOR_VALUE_SCALE          2
+#define SENSOR_VALUE_CHARS          6      // "-50.00" .. "149.99"
+#define SENSOR_VALUE_X              34
+#define SENSOR_LABEL_X              5
+#define SENSOR_UNIT_X               110
+static const int32_t sensorValueY[2] = { 49, 66 };   // Nhiệt độ, độ ẩm
+static char sensorValueShown[2][SENSOR_VALUE_CHARS + 1];
+
+// Có nội dung mới được vẽ trong lúc khung trước còn đang gửi
+static bool refresh_pending = false;
+
+// --- LỊCH VẼ KHUNG HÌNH ---
+// Các hàm memlcd_update_*() chỉ ghi số liệu vào model dưới đây và đánh dấu
+// trang cần vẽ lại (stale). Việc vẽ và gửi chạy trong memlcd_on_frame(),
+// tối đa một lần mỗi chu kỳ khung: yêu cầu đầu tiên hẹn sleeptimer tới đầu
+// chu kỳ kế tiếp, các yêu cầu sau đó trong cùng chu kỳ chỉ cập nhật model.
+#define STALE_PAGE(page)            (1u << (page))
+#define STALE_VISIBLE               (1u << MEMLCD_PAGE_COUNT)  // Đổi trang đang hiện
+
+// Số mẫu biểu đồ chờ khung kế tiếp; đầy thì bỏ mẫu cũ nhất
+#define CHART_PENDING_MAX           8
+
+static struct {
+  int16_t temp_centi;
+  int16_t hum_centi;
+  uint32_t interval_ms;
+  int16_t chart[CHART_PENDING_MAX];
+  uint8_t chart_first;
+  uint8_t chart_count;
+} sensorModel;
+
+static struct {
+  bool connected;
+  int8_t rssi;
+  uint32_t adv_interval_ms;
+} bleModel;
+
+static struct {
+  uint32_t uptime_s;
+  uint32_t samples;
+  uint32_t read_errors;
+} statsModel;
+
+static uint32_t staleMask = 0;
+static uint32_t framePeriodMs = MEMLCD_FRAME_PERIOD_MS;
+static uint32_t lastFrameTick = 0;
+static bool frameScheduled = false;
+static sl_sleeptimer_timer_handle_t frameTimer;
+static memlcd_frame_stats_t frameStats;
+
+// Gọi từ ngắt khi SPI gửi xong: chỉ báo cho stack BLE, xử lý ở vòng lặp chính
+static void memlcd_refresh_done(void *context)
+{
+  (void)context;
+  sl_bt_external_signal(EX_LCD_REFRESH_DONE);
+}
+
+// Bắt đầu gửi các hàng dirty mà không chờ. Nếu khung trước chưa gửi xong
+// thì để lại, memlcd_on_refresh_done() sẽ gửi tiếp (gộp với các khung vẽ
+// sau đó). Trả về true nếu một lần gửi thực sự bắt đầu.
+static bool memlcd_flush(void)
+{
+  EMSTATUS status = DMD_updateDisplayAsync(memlcd_refresh_done, NULL);
+
+  if (status == DMD_ERROR_BUSY) {
+    refresh_pending = true;
+  }
+  return status == DMD_OK;
+}
+
+void memlcd_on_refresh_done(void)
+{
+  if (refresh_pending) {
+    refresh_pending = false;
+    if (memlcd_flush()) {
+      frameStats.flushed++;
+    }
+  }
+}
+
+// Gọi từ ngắt sleeptimer: vẽ ở vòng lặp chính như EX_LCD_REFRESH_DONE
+static void memlcd_frame_timer(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  (void)handle;
+  (void)data;
+  sl_bt_external_signal(EX_LCD_FRAME);
+}
+
+// Hẹn khung kế tiếp một chu kỳ sau khung trước
+static void frame_schedule(void)
+{
+  uint32_t elapsed_ms;
+
+  // Đã qua một chu kỳ từ khung trước: vẽ ngay khi xử lý xong sự kiện này
+  elapsed_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count() - lastFrameTick);
+  if (elapsed_ms >= framePeriodMs) {
+    sl_bt_external_signal(EX_LCD_FRAME);
+  } else {
+    sl_sleeptimer_start_timer_ms(&frameTimer, framePeriodMs - elapsed_ms,
+                                 memlcd_frame_timer, NULL, 0, 0);
+  }
+}
+
+// Đánh dấu phần cần vẽ lại và hẹn khung kế tiếp nếu chưa hẹn
+static void frame_request(uint32_t stale)
+{
+  staleMask |= stale;
+  frameStats.requested++;
+  if (frameScheduled) {
+    return;
+  }
+  frameScheduled = true;
+  frame_schedule();
+}
+
+void memlcd_set_frame_period(uint32_t period_ms)
+{
+  bool running = false;
+
+  framePeriodMs = period_ms;
+
+  // Khung đang chờ timer: hẹn lại theo chu kỳ mới, tính từ khung trước
+  sl_sleeptimer_is_timer_running(&frameTimer, &running);
+  if (frameScheduled && running) {
+    sl_sleeptimer_stop_timer(&frameTimer);
+    frame_schedule();
+  }
+}
+
+void memlcd_get_frame_stats(memlcd_frame_stats_t *stats)
+{
+  *stats = frameStats;
+}
+
+// Vẽ vào một trang: chọn framebuffer của trang đó cho các hàm DMD/GLIB.
+// Vẽ vào trang đang hiện thì không đổi gì.
+static void page_begin(memlcd_page_t page)
+{
+  DMD_selectFramebuffer(pageBuffer[page]);
+}
+
+// Trả framebuffer của trang đang hiện về cho driver gửi đi
+static void page_end(void)
+{
+  DMD_selectFramebuffer(pageBuffer[visiblePage]);
+}
+
 void memlcd_app_init(void)
 {
   uint32_t status;
+  char buf[16];
   status = sl_board_enable_display(); EFM_ASSERT(status == SL_STATUS_OK);
   status = DMD_init(0); EFM_ASSERT(status == DMD_OK);
   status = GLIB_contextInit(&glibContext); EFM_ASSERT(status == GLIB_OK);
 
+  // Framebuffer cho các trang
+  status = DMD_getFrameBuffer(&pageBuffer[MEMLCD_PAGE_SENSOR]); EFM_ASSERT(status == DMD_OK);
+  status = DMD_setFramebufferPool(pagePool, sizeof(pagePool)); EFM_ASSERT(status == DMD_OK);
+  for (int page = 1; page < MEMLCD_PAGE_COUNT; page++) {
+    status = DMD_allocateFramebuffer(&pageBuffer[page]); EFM_ASSERT(status == DMD_OK);
+  }
+
   glibContext.backgroundColor = White;
   glibContext.foregroundColor = Black;
-  GLIB_clear(&glibContext);
   GLIB_setFont(&glibContext, (GLIB_Font_t *) &GLIB_FontNarrow6x8);
 
+  // Phần cố định của mỗi trang: số trang ở dòng 0, tiêu đề ở dòng 4
+  for (int page = MEMLCD_PAGE_COUNT - 1; page >= 0; page--) {
+    page_begin((memlcd_page_t) page);
+    GLIB_clear(&glibContext);
+    GLIB_textGridInit(&textGrid[page], &glibContext);
+    snprintf(buf, sizeof(buf), "%d/%d", page + 1, MEMLCD_PAGE_COUNT);
+    GLIB_textGridDrawLine(&textGrid[page], buf, 0, GLIB_ALIGN_RIGHT, -2);
+    GLIB_textGridDrawLine(&textGrid[page], pageTitle[page], 4, GLIB_ALIGN_CENTER, 0);
+  }
+
   // Dịch dòng khởi động xuống dòng 2 cho đồng bộ
-  GLIB_drawStringOnLine(&glibContext, "SYSTEM BOOT...", 2, GLIB_ALIGN_CENTER, 0, 0, true);
+  GLIB_textGridDrawLine(&textGrid[MEMLCD_PAGE_SENSOR], "SYSTEM BOOT...", 2, GLIB_ALIGN_CENTER, 0);
+
+  // Nhãn và đơn vị của hai dòng số liệu, canh giữa theo chiều cao chữ phóng to
+  for (int i = 0; i < 2; i++) {
+    int32_t y = sensorValueY[i] + (SENSOR_VALUE_SCALE - 1) * glibContext.font.fontHeight / 2;
+
+    GLIB_drawString(&glibContext, i == 0 ? "Temp" : "Hum", i == 0 ? 4 : 3, SENSOR_LABEL_X, y, true);
+    GLIB_drawString(&glibContext, i == 0 ? "C" : "%", 1, SENSOR_UNIT_X, y, true);
+  }
+
+  // Khung biểu đồ vẽ một lần, bên trong chỉ cuộn khi có mẫu mới
+  GLIB_drawRect(&glibContext, &tempChartFrame);
+  GLIB_stripChartInit(&tempChart, &glibContext, &tempChartArea,
+                      TEMP_CHART_MIN, TEMP_CHART_MAX);
+  page_end();
   DMD_updateDisplay();
 }
 
-void memlcd_update_sensor(float temp, float hum, uint32_t interval_ms)
+void memlcd_next_page(void)
+{
+  visiblePage = (memlcd_page_t) ((visiblePage + 1) % MEMLCD_PAGE_COUNT);
+  frame_request(STALE_VISIBLE);
+}
+
+void memlcd_plot_sample(int16_t temp_centi)
+{
+  if (sensorModel.chart_count == CHART_PENDING_MAX) {
+    sensorModel.chart_first = (sensorModel.chart_first + 1) % CHART_PENDING_MAX;
+    sensorModel.chart_count--;
+  }
+  sensorModel.chart[(sensorModel.chart_first + sensorModel.chart_count) % CHART_PENDING_MAX]
+    = (int16_t)(temp_centi / 10);
+  sensorModel.chart_count++;
+  frame_request(STALE_PAGE(MEMLCD_PAGE_SENSOR));
+}
+
+void memlcd_update_ble(bool connected, int8_t rssi, uint32_t adv_interval_ms)
+{
+  bleModel.connected = connected;
+  bleModel.rssi = rssi;
+  bleModel.adv_interval_ms = adv_interval_ms;
+  frame_request(STALE_PAGE(MEMLCD_PAGE_BLE));
+}
+
+void memlcd_update_stats(uint32_t uptime_s, uint32_t samples, uint32_t read_errors)
+{
+  statsModel.uptime_s = uptime_s;
+  statsModel.samples = samples;
+  statsModel.read_errors = read_errors;
+  frame_request(STALE_PAGE(MEMLCD_PAGE_STATS));
+}
+
+void memlcd_update_sensor(int16_t temp_centi, int16_t hum_centi, uint32_t interval_ms)
+{
+  sensorModel.temp_centi = temp_centi;
+  sensorModel.hum_centi = hum_centi;
+  sensorModel.interval_ms = interval_ms;
+  frame_request(STALE_PAGE(MEMLCD_PAGE_SENSOR));
+}
+
+// --- VẼ TỪNG TRANG TỪ MODEL ---
+static void render_ble(void)
+{
+  GLIB_TextGrid_t *grid = &textGrid[MEMLCD_PAGE_BLE];
+  char buf[40];
+
+  snprintf(buf, sizeof(buf), "ADV : %lu ms", (unsigned long) bleModel.adv_interval_ms);
+  GLIB_textGridDrawLine(grid, buf, 6, GLIB_ALIGN_LEFT, 5);
+  GLIB_textGridDrawLine(grid, bleModel.connected ? "LINK: CONNECTED" : "LINK: ADVERTISING",
+                        7, GLIB_ALIGN_LEFT, 5);
+  if (bleModel.connected) {
+    snprintf(buf, sizeof(buf), "RSSI: %d dBm", bleModel.rssi);
+  } else {
+    snprintf(buf, sizeof(buf), "RSSI: --");
+  }
+  GLIB_textGridDrawLine(grid, buf, 8, GLIB_ALIGN_LEFT, 5);
+}
+
+static void render_stats(void)
 {
+  GLIB_TextGrid_t *grid = &textGrid[MEMLCD_PAGE_STATS];
+  uint32_t uptime_s = statsModel.uptime_s;
+  DMD_UpdateStats lcd;
   char buf[40];
-  GLIB_clear(&glibContext);
+
+  DMD_getUpdateStats(&lcd);
+
+  snprintf(buf, sizeof(buf), "UP  : %lu:%02lu:%02lu", (unsigned long) (uptime_s / 3600),
+           (unsigned long) (uptime_s / 60 % 60), (unsigned long) (uptime_s % 60));
+  GLIB_textGridDrawLine(grid, buf, 6, GLIB_ALIGN_LEFT, 5);
+  snprintf(buf, sizeof(buf), "READ: %lu", (unsigned long) statsModel.samples);
+  GLIB_textGridDrawLine(grid, buf, 7, GLIB_ALIGN_LEFT, 5);
+  snprintf(buf, sizeof(buf), "FAIL: %lu", (unsigned long) statsModel.read_errors);
+  GLIB_textGridDrawLine(grid, buf, 8, GLIB_ALIGN_LEFT, 5);
+  snprintf(buf, sizeof(buf), "ROWS: %lu/%lu", (unsigned long) lcd.rowsSent,
+           (unsigned long) lcd.rowsDirty);
+  GLIB_textGridDrawLine(grid, buf, 9, GLIB_ALIGN_LEFT, 5);
+  snprintf(buf, sizeof(buf), "FRM : %lu/%lu", (unsigned long) frameStats.flushed,
+           (unsigned long) frameStats.requested);
+  GLIB_textGridDrawLine(grid, buf, 10, GLIB_ALIGN_LEFT, 5);
+}
+
+// Vẽ một giá trị phóng to nếu khác lần vẽ trước. Chuỗi được đệm dấu cách
+// bên trái tới SENSOR_VALUE_CHARS ô, vẽ đè màu nền nên không cần xóa trước.
+static void draw_sensor_value(int i, int16_t centi)
+{
+  char value[CENTI_STR_LEN];
+  char text[SENSOR_VALUE_CHARS + 1];
+
+  snprintf(text, sizeof(text), "%*s", SENSOR_VALUE_CHARS, centi_format(value, sizeof(value), centi));
+  if (strcmp(text, sensorValueShown[i]) == 0) {
+    return;
+  }
+  GLIB_drawStringScaled(&glibContext, text, SENSOR_VALUE_CHARS, SENSOR_VALUE_X,
+                        sensorValueY[i], SENSOR_VALUE_SCALE, true);
+  strcpy(sensorValueShown[i], text);
+}
+
+// Đảo màu vùng cảnh báo (bật nếu đang tắt, tắt nếu đang bật)
+static void temp_alarm_toggle(void)
+{
+  uint32_t fg = glibContext.foregroundColor;
+
+  GLIB_setRasterOp(&glibContext, GLIB_RASTER_OP_XOR);
+  glibContext.foregroundColor = White;
+  GLIB_drawRectFilled(&glibContext, &tempAlarmRect);
+  glibContext.foregroundColor = fg;
+  GLIB_setRasterOp(&glibContext, GLIB_RASTER_OP_COPY);
+  tempAlarmShown = !tempAlarmShown;
+}
+
+static void render_sensor(void)
+{
+  GLIB_TextGrid_t *grid = &textGrid[MEMLCD_PAGE_SENSOR];
+  int temp = sensorModel.temp_centi;
+  int hum = sensorModel.hum_centi;
+  uint32_t interval_ms = sensorModel.interval_ms;
+  char buf[40];
+  bool alarm_was_shown = tempAlarmShown;
+
+  // Cuộn biểu đồ sang trái một cột cho mỗi mẫu mới, phần còn lại giữ nguyên.
+  // Trang ẩn vẫn được vẽ để biểu đồ luôn liền mạch.
+  while (sensorModel.chart_count > 0) {
+    GLIB_stripChartAddSample(&tempChart, sensorModel.chart[sensorModel.chart_first]);
+    sensorModel.chart_first = (sensorModel.chart_first + 1) % CHART_PENDING_MAX;
+    sensorModel.chart_count--;
+  }
+
+  // Không xóa màn hình: lưới chữ và số liệu tự so sánh với nội dung cũ
+  // Chữ vẽ đè màu nền: tắt vùng đảo màu trước khi vẽ chữ
+  if (tempAlarmShown) temp_alarm_toggle();
 
   // --- DÒNG 2: HIỂN THỊ CHU KỲ (Dịch từ 0 -> 2) ---
   if (interval_ms == 0) sprintf(buf, "CYCLE: NO UPDATE");
-  else if (interval_ms >= 60000) sprintf(buf, "CYCLE: %lu min", interval_ms / 60000);
-  else if (interval_ms >= 1000) sprintf(buf, "CYCLE: %lu sec", interval_ms / 1000);
-  else sprintf(buf, "CYCLE: %lu ms", interval_ms);
+  else if (interval_ms >= 60000) sprintf(buf, "CYCLE: %lu min", (unsigned long) (interval_ms / 60000));
+  else if (interval_ms >= 1000) sprintf(buf, "CYCLE: %lu sec", (unsigned long) (interval_ms / 1000));
+  else sprintf(buf, "CYCLE: %lu ms", (unsigned long) interval_ms);
 
-  GLIB_drawStringOnLine(&glibContext, buf, 2, GLIB_ALIGN_CENTER, 0, 0, true);
+  GLIB_textGridDrawLine(grid, buf, 2, GLIB_ALIGN_CENTER, 0);
 
-  // --- DÒNG 4: TIÊU ĐỀ (Dịch từ 2 -> 4) ---
-  GLIB_drawStringOnLine(&glibContext, "DHT20 MONITOR", 4, GLIB_ALIGN_CENTER, 0, 0, true);
+  // --- SỐ LIỆU: NHIỆT ĐỘ VÀ ĐỘ ẨM PHÓNG TO ---
+  draw_sensor_value(0, temp);
+  draw_sensor_value(1, hum);
 
-  // --- DÒNG 6 & 7: SỐ LIỆU (Dịch từ 4,5 -> 6,7) ---
-  int t_int = (int)temp;
-  int t_frac = (int)((temp - t_int) * 100); if(t_frac < 0) t_frac = -t_frac;
-  int h_int = (int)hum;
-  int h_frac = (int)((hum - h_int) * 100);
+  // Quá ngưỡng: lần vẽ này bật nếu lần trước tắt -> nhấp nháy
+  if (temp >= TEMP_ALARM_CENTI && !alarm_was_shown) temp_alarm_toggle();
+}
 
-  // Nhiệt độ
-  snprintf(buf, sizeof(buf), "Temp: %d.%02d C", t_int, t_frac);
-  GLIB_drawStringOnLine(&glibContext, buf, 6, GLIB_ALIGN_LEFT, 5, 0, true);
+void memlcd_on_frame(void)
+{
+  uint32_t stale = staleMask;
 
-  // Độ ẩm
-  snprintf(buf, sizeof(buf), "Hum : %d.%02d %%", h_int, h_frac);
-  GLIB_drawStringOnLine(&glibContext, buf, 7, GLIB_ALIGN_LEFT, 5, 0, true);
+  frameScheduled = false;
+  staleMask = 0;
+  lastFrameTick = sl_sleeptimer_get_tick_count();
 
-  DMD_updateDisplay();
+  // Vẽ mọi trang có số liệu mới, kể cả trang ẩn, rồi gửi trang đang hiện
+  if (stale & STALE_PAGE(MEMLCD_PAGE_SENSOR)) {
+    page_begin(MEMLCD_PAGE_SENSOR);
+    render_sensor();
+  }
+  if (stale & STALE_PAGE(MEMLCD_PAGE_BLE)) {
+    page_begin(MEMLCD_PAGE_BLE);
+    render_ble();
+  }
+  if (stale & STALE_PAGE(MEMLCD_PAGE_STATS)) {
+    page_begin(MEMLCD_PAGE_STATS);
+    render_stats();
+  }
+  page_end();
+
+  // Chỉ các hàng có ô chữ thay đổi mới bị đánh dấu dirty và gửi qua SPI,
+  // việc gửi chạy nền bằng ngắt nên BLE/UART không bị chặn
+  if (memlcd_flush()) {
+    frameStats.flushed++;
+  }
 }
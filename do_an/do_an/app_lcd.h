@@ -2,11 +2,66 @@
 #define APP_LCD_H
 
 #include <stdint.h> // Để dùng uint32_t
+#include <stdbool.h>
+
+// Bit external signal báo màn hình đã gửi xong một khung (EX_B0_PRESS là bit 5,
+// EX_B0_LONG_PRESS là bit 7)
+#define EX_LCD_REFRESH_DONE         ((1) << 6)
+
+// Bit external signal báo đến lúc vẽ khung kế tiếp
+#define EX_LCD_FRAME                ((1) << 8)
+
+// Chu kỳ khung mặc định: vẽ và gửi màn hình tối đa một lần mỗi 100 ms
+#define MEMLCD_FRAME_PERIOD_MS      100
+
+// Số khung được yêu cầu (mỗi lần gọi memlcd_update_*, memlcd_plot_sample,
+// memlcd_next_page) và số lần gửi thực sự bắt đầu (khung phải chờ SPI bận
+// được gộp với khung sau và chỉ tính một lần)
+typedef struct {
+  uint32_t requested;
+  uint32_t flushed;
+} memlcd_frame_stats_t;
+
+// Các trang màn hình, chuyển bằng memlcd_next_page()
+typedef enum {
+  MEMLCD_PAGE_SENSOR = 0,   // Nhiệt độ, độ ẩm và biểu đồ
+  MEMLCD_PAGE_BLE,          // Quảng bá, kết nối và RSSI của gateway
+  MEMLCD_PAGE_STATS,        // Thời gian chạy, số lần đo, số hàng LCD đã gửi
+  MEMLCD_PAGE_COUNT
+} memlcd_page_t;
 
 // Khai báo hàm khởi tạo màn hình
 void memlcd_app_init(void);
 
+// Các hàm dưới đây chỉ ghi số liệu mới và hẹn một khung: màn hình được vẽ
+// và gửi đi tối đa một lần mỗi chu kỳ khung, dù có bao nhiêu lần gọi.
+
+// Hiện trang kế tiếp. Các trang luôn được vẽ sẵn nên chỉ gửi các hàng khác.
+void memlcd_next_page(void);
+
+// Cập nhật trang BLE (rssi chỉ dùng khi connected)
+void memlcd_update_ble(bool connected, int8_t rssi, uint32_t adv_interval_ms);
+
+// Cập nhật trang thống kê
+void memlcd_update_stats(uint32_t uptime_s, uint32_t samples, uint32_t read_errors);
+
+// Gọi khi nhận EX_LCD_REFRESH_DONE: gửi tiếp phần đã vẽ trong lúc chờ
+void memlcd_on_refresh_done(void);
+
+// Gọi khi nhận EX_LCD_FRAME: vẽ các trang có số liệu mới rồi gửi một lần
+void memlcd_on_frame(void);
+
+// Đổi chu kỳ khung (0: vẽ ngay ở lần xử lý sự kiện kế tiếp). Khung đang
+// được hẹn thì hẹn lại theo chu kỳ mới.
+void memlcd_set_frame_period(uint32_t period_ms);
+
+void memlcd_get_frame_stats(memlcd_frame_stats_t *stats);
+
+// Thêm một mẫu nhiệt độ (centi °C) vào biểu đồ, được vẽ ở khung kế tiếp
+void memlcd_plot_sample(int16_t temp_centi);
+
 // --- SỬA DÒNG NÀY (Thêm tham số thứ 3: interval_ms) ---
-void memlcd_update_sensor(float temp, float hum, uint32_t interval_ms);
+// temp_centi/hum_centi: đơn vị 0.01 °C và 0.01 %RH
+void memlcd_update_sensor(int16_t temp_centi, int16_t hum_centi, uint32_t interval_ms);
 
 #endif // APP_LCD_H
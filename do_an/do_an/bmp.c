@@ -33,6 +33,7 @@
 
 /* C Standard header files */
 #include <stdint.h>
+#include <string.h>
 
 /* EM types */
 #include "em_types.h"
@@ -68,18 +69,60 @@ typedef struct __BMP_RleInfo{
 
 RleInfo rleInfo;
 
+/* Streaming 1 bpp decoder, see BMP_readMonoRow() */
+static uint8_t  monoPaletteBits[256 / 8];
+static uint32_t monoPaletteEntries = 0;
+static int16_t  monoError[BMP_MONO_MAX_WIDTH + 2];
+static uint32_t monoWidth     = 0;
+static uint32_t monoRowsRead  = 0;
+static uint32_t monoCacheIdx  = 0;
+static uint32_t monoCacheLen  = 0;
+static int32_t  monoCarry     = 0;
+static int32_t  monoBelow     = 0;
+static uint32_t rleSkipRows   = 0;
+static uint32_t rleStartX     = 0;
+static uint32_t rleEndOfFile  = 0;
+
+/* 4x4 Bayer matrix for BMP_DITHER_ORDERED */
+static const uint8_t bayer4x4[4][4] = {
+  { 0, 8, 2, 10 },
+  { 12, 4, 14, 6 },
+  { 3, 11, 1, 9 },
+  { 15, 7, 13, 5 }
+};
+
 /* Local function pointer */
 EMSTATUS (*fpReadData)(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead);
 
+/* Image in memory, see BMP_initMemory(). NULL when reading through fpReadData */
+static const uint8_t *memImage   = NULL;
+static uint32_t      memSize     = 0;
+static uint32_t      memPos      = 0;
+
+/* Last two RLE bytes returned by BMP_readRleData() */
+static const uint8_t *rleData    = NULL;
+
+/* Bytes of the image not yet used by BMP_readMonoRow() */
+static const uint8_t *monoData   = NULL;
+
 /** @endcond */
 
 /* Local function declarations */
-static EMSTATUS BMP_readRawData8bit(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
+static EMSTATUS BMP_readBytes(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead);
+static EMSTATUS BMP_fetchBytes(const uint8_t **pData, uint32_t bytesToRead);
+static EMSTATUS BMP_readRawData8bit(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength, const uint8_t **pData);
 static EMSTATUS BMP_readRawData24bit(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
 static EMSTATUS BMP_readRawDataRLE8(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
 static EMSTATUS BMP_readPaddingBytes(uint8_t paddingBytes);
 static EMSTATUS BMP_readRleData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
 static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsRead);
+static void BMP_monoPutLuma(uint8_t row[], uint32_t x, uint32_t y, int32_t luma, BMP_Dither_t dither);
+static void BMP_monoPutIndex(uint8_t row[], uint32_t x, uint32_t y, uint8_t index, BMP_Dither_t dither);
+static EMSTATUS BMP_monoFillCache(void);
+static EMSTATUS BMP_monoReadByte(uint8_t *byte);
+static uint8_t BMP_reverseBits(uint8_t byte);
+static EMSTATUS BMP_readMonoRowUncompressed(uint8_t row[], uint32_t y, BMP_Dither_t dither);
+static EMSTATUS BMP_readMonoRowRLE8(uint8_t row[], uint32_t y, BMP_Dither_t dither);
 
 /**************************************************************************//**
 *  @brief
@@ -89,9 +132,10 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
 *   - 24-bit Uncompressed.
 *   - 8-bit Uncompressed.
 *   - 8-bit RLE compressed.
+*   - 1-bit Uncompressed, with BMP_readMonoRow() only.
 *
 *  @param palette
-*  Data buffer to hold palette. Required for 8bpp BMPs.
+*  Data buffer to hold palette. Required for 8bpp and 1bpp BMPs.
 *
 *  @param paletteSize
 *  Size of palette in bytes. If BMP is 8-bit, this potentially has to be 256 * 4 bytes.
@@ -127,6 +171,7 @@ EMSTATUS BMP_init(uint8_t *palette, uint32_t paletteSize, EMSTATUS (*fp)(uint8_t
 
   /* Set function pointer */
   fpReadData = fp;
+  memImage   = NULL;
 
   fileReset   = 0;
   paletteRead = 0;
@@ -137,11 +182,62 @@ EMSTATUS BMP_init(uint8_t *palette, uint32_t paletteSize, EMSTATUS (*fp)(uint8_t
   return BMP_OK;
 }
 
+/**************************************************************************//**
+*  @brief
+*  Initializes BMP Module to decode a BMP file that is in memory, for example
+*  an image linked into flash.
+*
+*  The pixel and RLE data are read in place: the decoder walks the image with
+*  a pointer instead of copying it through the local cache, and no read
+*  function is called. Only the header and the palette are copied, since
+*  BMP_reset() converts them. BMP_reset() starts again at the beginning of the
+*  image, so it can be drawn any number of times. BMP_init() switches back to
+*  reading through a function.
+*
+*  @param image
+*  The BMP file. Has to stay valid as long as it is decoded.
+*
+*  @param imageSize
+*  Size of the BMP file in bytes.
+*
+*  @param palette
+*  Data buffer to hold palette, see BMP_init().
+*
+*  @param paletteSize
+*  Size of palette in bytes, see BMP_init().
+*
+*  @return
+*  Returns BMP_OK on success, or else error code.
+******************************************************************************/
+EMSTATUS BMP_initMemory(const uint8_t *image, uint32_t imageSize, uint8_t *palette, uint32_t paletteSize)
+{
+  EMSTATUS status;
+
+  if (image == NULL) {
+    return BMP_ERROR_INVALID_ARGUMENT;
+  }
+
+  status = BMP_init(palette, paletteSize, NULL);
+  if (status != BMP_OK) {
+    return status;
+  }
+
+  memImage = image;
+  memSize  = imageSize;
+  memPos   = 0;
+
+  return BMP_OK;
+}
+
 /**************************************************************************//**
 *  @brief
 *  Makes the module ready for new bmp file. Reads in header from file, and checks
 *  if the provided bmp file is valid and supported. It reads in palette if
-*  BMP file is 8bpp. Uses function pointer set in BMP_init().
+*  BMP file is 8bpp or 1bpp. Uses function pointer set in BMP_init(), or the
+*  image set in BMP_initMemory().
+*
+*  The palette is stored as RGB. The fourth byte of each entry is replaced by
+*  the luminance of the color, which BMP_readMonoRow() uses for dithering.
 *
 *  @return
 *  Returns BMP_OK on success, or else error code
@@ -155,8 +251,11 @@ EMSTATUS BMP_reset()
 
   EMSTATUS status;
 
+  /* An image in memory is read from the beginning again */
+  memPos = 0;
+
   /* Read in header */
-  status = fpReadData((uint8_t *) &bmpHeader, BMP_HEADER_SIZE, BMP_HEADER_SIZE);
+  status = BMP_readBytes((uint8_t *) &bmpHeader, BMP_HEADER_SIZE, BMP_HEADER_SIZE);
   if (status != BMP_OK) {
     return status;
   }
@@ -177,12 +276,14 @@ EMSTATUS BMP_reset()
   }
 
   /* Check if file is supported */
-  if (bmpHeader.bitsPerPixel != 24 && bmpHeader.bitsPerPixel != 8) {
+  if (bmpHeader.bitsPerPixel != 24 && bmpHeader.bitsPerPixel != 8
+      && bmpHeader.bitsPerPixel != 1) {
     return BMP_ERROR_FILE_NOT_SUPPORTED;
   }
 
   /* Check if compression is supported */
-  if (bmpHeader.compressionType > 1) {
+  if (bmpHeader.compressionType > 1
+      || (bmpHeader.bitsPerPixel == 1 && bmpHeader.compressionType != NO_COMPRESSION)) {
     return BMP_ERROR_FILE_NOT_SUPPORTED;
   }
 
@@ -198,7 +299,7 @@ EMSTATUS BMP_reset()
   }
 
   /* Check if palette is necessary */
-  if (bmpHeader.bitsPerPixel == 8) {
+  if (bmpHeader.bitsPerPixel <= 8) {
     /* Check if BMP_Palette is big enough */
     uint32_t pSize = bmpHeader.dataOffset - BMP_HEADER_SIZE;
     if (pSize > bmpPalette.size) {
@@ -210,13 +311,14 @@ EMSTATUS BMP_reset()
     }
 
     /* Read in palette */
-    status = fpReadData(bmpPalette.data, bmpPalette.size, pSize);
+    status = BMP_readBytes(bmpPalette.data, bmpPalette.size, pSize);
     if (status != BMP_OK) {
       return status;
     }
 
     uint8_t  swap;
     uint32_t i;
+    uint32_t luma;
     /* Convert BGR values to RGB values */
     for (i = 0; i < pSize; i += 4) {
       swap = bmpPalette.data[i];
@@ -226,6 +328,18 @@ EMSTATUS BMP_reset()
       bmpPalette.data[i + 2] = swap;
     }
 
+    /* Precompute the luminance and the undithered 1 bpp value of each entry */
+    memset(monoPaletteBits, 0, sizeof(monoPaletteBits));
+    monoPaletteEntries = pSize / 4;
+    for (i = 0; i < monoPaletteEntries; i++) {
+      luma = (77 * bmpPalette.data[4 * i] + 150 * bmpPalette.data[4 * i + 1]
+              + 29 * bmpPalette.data[4 * i + 2]) >> 8;
+      bmpPalette.data[4 * i + 3] = (uint8_t) luma;
+      if (luma >= 128) {
+        monoPaletteBits[i >> 3] |= 1 << (i & 7);
+      }
+    }
+
     paletteRead = 1;
   }
 
@@ -236,6 +350,17 @@ EMSTATUS BMP_reset()
   rleInfo.isPadding       = 0;
   rleInfo.pixelsRemaining = 0;
   rleInfo.pixelIdx        = 0;
+  monoWidth               = bmpHeader.width;
+  if (monoWidth > BMP_MONO_MAX_WIDTH) {
+    monoWidth = BMP_MONO_MAX_WIDTH;
+  }
+  monoRowsRead            = 0;
+  monoCacheIdx            = 0;
+  monoCacheLen            = 0;
+  rleSkipRows             = 0;
+  rleStartX               = 0;
+  rleEndOfFile            = 0;
+  memset(monoError, 0, sizeof(monoError));
 
   return BMP_OK;
 }
@@ -282,6 +407,11 @@ EMSTATUS BMP_readRgbData(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsR
     return BMP_ERROR_BUFFER_TOO_SMALL;
   }
 
+  /* 1bpp images can only be read with BMP_readMonoRow() */
+  if (bmpHeader.bitsPerPixel == 1) {
+    return BMP_ERROR_FILE_NOT_SUPPORTED;
+  }
+
   EMSTATUS status = BMP_OK;
 
   /* Calculate how many bytes to read */
@@ -292,6 +422,7 @@ EMSTATUS BMP_readRgbData(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsR
   uint32_t     i           = 0;
 
   BMP_DataType dataType;
+  const uint8_t *pIndex;
 
   /* Check color depth of BMP */
   if (bmpHeader.bitsPerPixel == 8) {
@@ -321,7 +452,7 @@ EMSTATUS BMP_readRgbData(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsR
         }
 
         /* Read in palette indicies */
-        status = BMP_readRawData8bit(&dataType, localCache, bytesToRead);
+        status = BMP_readRawData8bit(&dataType, NULL, bytesToRead, &pIndex);
         if (status != BMP_OK) {
           return status;
         }
@@ -329,11 +460,11 @@ EMSTATUS BMP_readRgbData(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsR
         /* Decode the indicies to RGB values */
         for (i = 0; i < dataType.size; ++i) {
           /* Set red */
-          buffer[bufferIdx] = bmpPalette.data[4 * localCache[i]];
+          buffer[bufferIdx] = bmpPalette.data[4 * pIndex[i]];
           /* Set green */
-          buffer[bufferIdx + 1] = bmpPalette.data[4 * localCache[i] + 1];
+          buffer[bufferIdx + 1] = bmpPalette.data[4 * pIndex[i] + 1];
           /* Set blue */
-          buffer[bufferIdx + 2] = bmpPalette.data[4 * localCache[i] + 2];
+          buffer[bufferIdx + 2] = bmpPalette.data[4 * pIndex[i] + 2];
 
           bufferIdx += 3;
         }
@@ -385,6 +516,7 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
   uint32_t     bytesLeftInBuffer = bufLength - (bufLength % 3);
   uint32_t     bytesToRead;
   uint32_t     i;
+  const uint8_t *pIndex;
 
   while (bytesLeftInBuffer > 0 && dataType.endOfRow == 0) {
     if (rleInfo.mode == MODE_RLE) {
@@ -413,11 +545,11 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
           return status;
         }
 
-        /* Check if localCache contains RLE info */
-        if (localCache[0] > 0) {
+        /* Check if rleData contains RLE info */
+        if (rleData[0] > 0) {
           /* Store the RLE info in buffer */
-          rleInfo.pixelsRemaining = localCache[0];
-          rleInfo.pixelIdx        = localCache[1];
+          rleInfo.pixelsRemaining = rleData[0];
+          rleInfo.pixelIdx        = rleData[1];
         }
       }
     }
@@ -438,7 +570,7 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
       }
 
       /* Read in bytesToRead */
-      status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, bytesToRead);
+      status = BMP_fetchBytes(&pIndex, bytesToRead);
       if (status != BMP_OK) {
         return status;
       }
@@ -448,11 +580,11 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
       /* Convert 8-bit bytes to RGB values */
       for (i = 0; i < bytesToRead; ++i) {
         /* Set red */
-        buffer[bufferIdx] = bmpPalette.data[4 * localCache[i]];
+        buffer[bufferIdx] = bmpPalette.data[4 * pIndex[i]];
         /* Set green */
-        buffer[bufferIdx + 1] = bmpPalette.data[4 * localCache[i] + 1];
+        buffer[bufferIdx + 1] = bmpPalette.data[4 * pIndex[i] + 1];
         /* Set blue */
-        buffer[bufferIdx + 2] = bmpPalette.data[4 * localCache[i] + 2];
+        buffer[bufferIdx + 2] = bmpPalette.data[4 * pIndex[i] + 2];
 
         bufferIdx         += 3;
         bytesLeftInBuffer -= 3;
@@ -467,12 +599,10 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
 
         /* Read in padding if necessary */
         if (rleInfo.isPadding == 1) {
-          status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, 1);
+          status = BMP_readPaddingBytes(1);
           if (status != BMP_OK) {
             return status;
           }
-
-          dataIdx += 1;
         }
 
         /* Read in the next 2 bytes to see if end of row is reached or end of file */
@@ -482,10 +612,10 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
         }
 
         /* Check if the next 2 bytes is RLE info */
-        if (localCache[0] > 0) {
+        if (rleData[0] > 0) {
           /* Store rle bytes */
-          rleInfo.pixelsRemaining = localCache[0];
-          rleInfo.pixelIdx        = localCache[1];
+          rleInfo.pixelsRemaining = rleData[0];
+          rleInfo.pixelIdx        = rleData[1];
         }
       }
     }
@@ -504,11 +634,14 @@ static EMSTATUS BMP_readRgbDataRLE8(uint8_t buffer[], uint32_t bufLength, uint32
 *  Buffer to be filled with raw data
 *  @param bufLength
 *  Length of buffer
+*  @param pData
+*  Set to the data read. If buffer is NULL, the data is not copied and pData
+*  points to the image or to the local cache
 *
 *  @return
 *  Returns BMP_OK on success
 ******************************************************************************/
-static EMSTATUS BMP_readRawData8bit(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength)
+static EMSTATUS BMP_readRawData8bit(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength, const uint8_t **pData)
 {
   /* Check if end of file is reached */
   if (dataIdx >= bytesInImage) {
@@ -536,7 +669,12 @@ static EMSTATUS BMP_readRawData8bit(BMP_DataType *dataType, uint8_t buffer[], ui
   }
 
   /* Read in bytesToRead */
-  status = fpReadData(buffer, bufLength, bytesToRead);
+  if (buffer == NULL) {
+    status = BMP_fetchBytes(pData, bytesToRead);
+  } else {
+    status = BMP_readBytes(buffer, bufLength, bytesToRead);
+    *pData = buffer;
+  }
   if (status != BMP_OK) {
     return status;
   }
@@ -590,7 +728,7 @@ static EMSTATUS BMP_readRawData24bit(BMP_DataType *dataType, uint8_t buffer[], u
   }
 
   /* Read in bytesToRead */
-  status = fpReadData(buffer, bufLength, bytesToRead);
+  status = BMP_readBytes(buffer, bufLength, bytesToRead);
   if (status != BMP_OK) {
     return status;
   }
@@ -660,11 +798,11 @@ static EMSTATUS BMP_readRawDataRLE8(BMP_DataType *dataType, uint8_t buffer[], ui
         return status;
       }
 
-      /* Check if localCache contains RLE info */
-      if (localCache[0] > 0) {
+      /* Check if rleData contains RLE info */
+      if (rleData[0] > 0) {
         /* Store the RLE info in buffer */
-        buffer[bufferIdx]     = localCache[0];
-        buffer[bufferIdx + 1] = localCache[1];
+        buffer[bufferIdx]     = rleData[0];
+        buffer[bufferIdx + 1] = rleData[1];
 
         bufferIdx      += 2;
         dataType->size += 2;
@@ -683,7 +821,7 @@ static EMSTATUS BMP_readRawDataRLE8(BMP_DataType *dataType, uint8_t buffer[], ui
     }
 
     /* Read in bytesToRead */
-    status = fpReadData(buffer, bufLength, bytesToRead);
+    status = BMP_readBytes(buffer, bufLength, bytesToRead);
     if (status != BMP_OK) {
       return status;
     }
@@ -699,12 +837,10 @@ static EMSTATUS BMP_readRawDataRLE8(BMP_DataType *dataType, uint8_t buffer[], ui
 
       /* Read in padding if necessary */
       if (rleInfo.isPadding == 1) {
-        status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, 1);
+        status = BMP_readPaddingBytes(1);
         if (status != BMP_OK) {
           return status;
         }
-
-        dataIdx += 1;
       }
     }
   }
@@ -717,10 +853,10 @@ static EMSTATUS BMP_readRawDataRLE8(BMP_DataType *dataType, uint8_t buffer[], ui
     }
 
     /* Check if the next 2 bytes is RLE info */
-    if (localCache[0] > 0) {
+    if (rleData[0] > 0) {
       /* Store rle bytes */
-      rleInfo.pixelsRemaining = localCache[0];
-      rleInfo.pixelIdx        = localCache[1];
+      rleInfo.pixelsRemaining = rleData[0];
+      rleInfo.pixelIdx        = rleData[1];
     }
   }
 
@@ -741,7 +877,8 @@ static EMSTATUS BMP_readPaddingBytes(uint8_t paddingBytes)
 {
   if (paddingBytes > 0) {
     /* Read in padding bytes from bmp file */
-    EMSTATUS status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, paddingBytes);
+    const uint8_t *pPadding;
+    EMSTATUS status = BMP_fetchBytes(&pPadding, paddingBytes);
     if (status != BMP_OK) {
       return status;
     }
@@ -781,7 +918,7 @@ static EMSTATUS BMP_readRleData(BMP_DataType *dataType, uint8_t buffer[], uint32
   rleInfo.isPadding       = 0;
 
   /* Read in 2 bytes */
-  status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, 2);
+  status = BMP_fetchBytes(&rleData, 2);
   if (status != BMP_OK) {
     return status;
   }
@@ -794,21 +931,22 @@ static EMSTATUS BMP_readRleData(BMP_DataType *dataType, uint8_t buffer[], uint32
   }
 
   /* 1. Check for marker */
-  if (localCache[0] == 0) {
+  if (rleData[0] == 0) {
     /* a. End of scan line marker */
-    if (localCache[1] == 0) {
+    if (rleData[1] == 0) {
       dataType->endOfRow = 1;
     }
     /* b. End of file marker */
-    else if (localCache[1] == 1) {
+    else if (rleData[1] == 1) {
       dataType->endOfRow = 1;
       return BMP_ERROR_END_OF_FILE;
     }
     /* c. Run offset marker */
-    else if (localCache[1] == 2) {
+    else if (rleData[1] == 2) {
       /* Read in coordinates for offset marker */
       /* BMP Module doesnt support this marker, but needs to read it in anyway */
-      status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, 2);
+      const uint8_t *pOffset;
+      status = BMP_fetchBytes(&pOffset, 2);
       if (status != BMP_OK) {
         return status;
       }
@@ -816,10 +954,10 @@ static EMSTATUS BMP_readRleData(BMP_DataType *dataType, uint8_t buffer[], uint32
       dataIdx += 2;
     }
     /* d. Unencoded run marker */
-    else if (localCache[1] > 2) {
+    else if (rleData[1] > 2) {
       /* Switch to 8bit mode and set pixelsRemaining */
       rleInfo.mode            = MODE_8BIT;
-      rleInfo.pixelsRemaining = localCache[1];
+      rleInfo.pixelsRemaining = rleData[1];
 
       if (rleInfo.pixelsRemaining % 2 == 1) {
         rleInfo.isPadding = 1;
@@ -830,6 +968,87 @@ static EMSTATUS BMP_readRleData(BMP_DataType *dataType, uint8_t buffer[], uint32
   return BMP_OK;
 }
 
+/**************************************************************************//**
+*  @brief
+*  Help function to copy the next bytes of the BMP file into buffer, from the
+*  image set in BMP_initMemory() or with the read function set in BMP_init().
+*
+*  @param buffer
+*  Buffer to be filled
+*  @param bufLength
+*  Length of buffer
+*  @param bytesToRead
+*  Number of bytes to read
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS BMP_readBytes(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead)
+{
+  EMSTATUS      status;
+  const uint8_t *pData;
+
+  if (memImage == NULL) {
+    return fpReadData(buffer, bufLength, bytesToRead);
+  }
+
+  if (bytesToRead > bufLength) {
+    return BMP_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  status = BMP_fetchBytes(&pData, bytesToRead);
+  if (status != BMP_OK) {
+    return status;
+  }
+
+  memcpy(buffer, pData, bytesToRead);
+
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function to get the next bytes of the BMP file without copying them
+*  when the image is in memory. Otherwise they are read into the local cache.
+*
+*  @param pData
+*  Set to the bytes read. Valid until the next read.
+*  @param bytesToRead
+*  Number of bytes to read. At most BMP_LOCAL_CACHE_SIZE, unless the image is
+*  in memory.
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS BMP_fetchBytes(const uint8_t **pData, uint32_t bytesToRead)
+{
+  EMSTATUS status;
+
+  if (memImage != NULL) {
+    if (bytesToRead > memSize - memPos) {
+      return BMP_ERROR_IO;
+    }
+
+    *pData  = &memImage[memPos];
+    memPos += bytesToRead;
+
+    return BMP_OK;
+  }
+
+  if (bytesToRead > BMP_LOCAL_CACHE_SIZE) {
+    return BMP_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  status = fpReadData(localCache, BMP_LOCAL_CACHE_SIZE, bytesToRead);
+  if (status != BMP_OK) {
+    return status;
+  }
+
+  *pData = localCache;
+
+  return BMP_OK;
+}
+
 /**************************************************************************//**
 *  @brief
 *  Fills buffer with raw data from BMP file.
@@ -877,6 +1096,11 @@ EMSTATUS BMP_readRawData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufL
     return BMP_ERROR_INVALID_ARGUMENT;
   }
 
+  /* 1bpp images can only be read with BMP_readMonoRow() */
+  if (bmpHeader.bitsPerPixel == 1) {
+    return BMP_ERROR_FILE_NOT_SUPPORTED;
+  }
+
   dataType->size            = 0;
   dataType->bitsPerPixel    = 0;
   dataType->compressionType = 0;
@@ -905,7 +1129,8 @@ EMSTATUS BMP_readRawData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufL
     /* Check for RLE compression */
     if (bmpHeader.compressionType == NO_COMPRESSION) {
       /* Read in 8 bit data */
-      status = BMP_readRawData8bit(dataType, buffer, bufLength);
+      const uint8_t *pData;
+      status = BMP_readRawData8bit(dataType, buffer, bufLength, &pData);
 
       /* Check if end of row is reached */
       if (dataType->endOfRow == 1) {
@@ -926,6 +1151,397 @@ EMSTATUS BMP_readRawData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufL
   return status;
 }
 
+/**************************************************************************//**
+*  @brief
+*  Reads the next row of the image as a 1bpp row, converting and dithering the
+*  pixels on the fly.
+*
+*  The row has the monochrome bitmap format of GLIB_drawBitmap(): pixel x is
+*  bit (x & 7) of byte (x >> 3), and 1 is white. 24-bit pixels and palette
+*  entries are reduced to their luminance (0.30 R + 0.59 G + 0.11 B). With
+*  BMP_DITHER_NONE palette images use the palette-to-bit table built by
+*  BMP_reset(), and 1-bit images are copied a byte at a time.
+*
+*  The file is read through the function pointer set in BMP_init(), at most
+*  BMP_LOCAL_CACHE_SIZE bytes at a time, so no buffer for the whole image is
+*  needed. An image set with BMP_initMemory() is converted in place. Only the
+*  first BMP_MONO_MAX_WIDTH pixels of each row are converted; the rest of the
+*  row is skipped. Rows come in the order of the file, which for BMPs is from
+*  the bottom of the image to the top.
+*
+*  Floyd-Steinberg dithering keeps the error of one row, so the same dither
+*  mode has to be used for all rows of the image. A file that is read with
+*  this function cannot also be read with BMP_readRgbData() or
+*  BMP_readRawData() before the next BMP_reset().
+*
+*  @param row
+*  Buffer receiving the pixels
+*  @param rowLength
+*  Length of row in bytes, at least (min(width, BMP_MONO_MAX_WIDTH) + 7) / 8
+*  @param dither
+*  Dithering used to reduce the pixels to black and white
+*  @param rowIndex
+*  Receives the y coordinate of the row in the image, 0 is the top row
+*
+*  @return
+*  - Returns BMP_OK on success
+*  - Returns BMP_ERROR_END_OF_FILE when all rows have been read
+*  - Returns error code otherwise.
+******************************************************************************/
+EMSTATUS BMP_readMonoRow(uint8_t row[], uint32_t rowLength, BMP_Dither_t dither, uint32_t *rowIndex)
+{
+  EMSTATUS status;
+  uint32_t y;
+
+  /* Check if module is initialized */
+  if (moduleInit == 0) {
+    return BMP_ERROR_MODULE_NOT_INITIALIZED;
+  }
+
+  /* Check file is reset */
+  if (fileReset == 0) {
+    return BMP_ERROR_FILE_NOT_RESET;
+  }
+
+  if (row == NULL || rowIndex == NULL || dither > BMP_DITHER_FLOYD_STEINBERG) {
+    return BMP_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (rowLength * 8 < monoWidth) {
+    return BMP_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  if (bmpHeader.bitsPerPixel <= 8 && paletteRead == 0) {
+    return BMP_ERROR_PALETTE_NOT_READ;
+  }
+
+  if (monoRowsRead >= bmpHeader.height) {
+    return BMP_ERROR_END_OF_FILE;
+  }
+
+  y = bmpHeader.height - 1 - monoRowsRead;
+  memset(row, 0, (monoWidth + 7) / 8);
+  monoCarry = 0;
+  monoBelow = 0;
+
+  if (bmpHeader.compressionType == RLE8_COMPRESSION) {
+    status = BMP_readMonoRowRLE8(row, y, dither);
+  } else {
+    status = BMP_readMonoRowUncompressed(row, y, dither);
+  }
+  if (status != BMP_OK) {
+    return status;
+  }
+
+  monoRowsRead += 1;
+  *rowIndex     = y;
+
+  return BMP_OK;
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Sets pixel x of the row from its luminance (0-255) */
+static void BMP_monoPutLuma(uint8_t row[], uint32_t x, uint32_t y, int32_t luma, BMP_Dither_t dither)
+{
+  int32_t white;
+  int32_t value;
+  int32_t quant;
+  int16_t *err;
+
+  if (x >= monoWidth) {
+    return;
+  }
+
+  if (dither == BMP_DITHER_ORDERED) {
+    white = luma >= bayer4x4[y & 3][x & 3] * 16 + 8;
+  } else if (dither == BMP_DITHER_FLOYD_STEINBERG) {
+    /* err[0] holds the error carried down to this pixel from the previous
+     * row. Once it is used, err[-1] and err[0] collect the error for the
+     * next row, the lower right share is kept in monoBelow until the next
+     * pixel has used its own error. */
+    err       = &monoError[x + 1];
+    value     = luma + monoCarry + err[0];
+    white     = value >= 128;
+    quant     = value - (white ? 255 : 0);
+    monoCarry = quant * 7 / 16;
+    err[-1]  += quant * 3 / 16;
+    err[0]    = monoBelow + quant * 5 / 16;
+    monoBelow = quant / 16;
+  } else {
+    white = luma >= 128;
+  }
+
+  if (white) {
+    row[x >> 3] |= 1 << (x & 7);
+  }
+}
+
+/* Sets pixel x of the row from a palette index */
+static void BMP_monoPutIndex(uint8_t row[], uint32_t x, uint32_t y, uint8_t index, BMP_Dither_t dither)
+{
+  if (dither == BMP_DITHER_NONE) {
+    if (x < monoWidth && (monoPaletteBits[index >> 3] & (1 << (index & 7)))) {
+      row[x >> 3] |= 1 << (x & 7);
+    }
+  } else {
+    BMP_monoPutLuma(row, x, y,
+                    index < monoPaletteEntries ? bmpPalette.data[4 * index + 3] : 0,
+                    dither);
+  }
+}
+
+/* Gets the next bytes of the image when monoData is used up */
+static EMSTATUS BMP_monoFillCache(void)
+{
+  EMSTATUS status;
+  uint32_t bytesToRead;
+
+  if (monoCacheIdx < monoCacheLen) {
+    return BMP_OK;
+  }
+
+  if (dataIdx >= bytesInImage) {
+    return BMP_ERROR_END_OF_FILE;
+  }
+
+  /* An image in memory is used in place, as far as it goes */
+  bytesToRead = bytesInImage - dataIdx;
+  if (memImage != NULL) {
+    if (bytesToRead > memSize - memPos) {
+      bytesToRead = memSize - memPos;
+    }
+    if (bytesToRead == 0) {
+      return BMP_ERROR_IO;
+    }
+  } else if (bytesToRead > BMP_LOCAL_CACHE_SIZE) {
+    bytesToRead = BMP_LOCAL_CACHE_SIZE;
+  }
+
+  status = BMP_fetchBytes(&monoData, bytesToRead);
+  if (status != BMP_OK) {
+    return status;
+  }
+
+  dataIdx     += bytesToRead;
+  monoCacheIdx = 0;
+  monoCacheLen = bytesToRead;
+
+  return BMP_OK;
+}
+
+static EMSTATUS BMP_monoReadByte(uint8_t *byte)
+{
+  EMSTATUS status = BMP_monoFillCache();
+  if (status != BMP_OK) {
+    return status;
+  }
+
+  *byte = monoData[monoCacheIdx++];
+
+  return BMP_OK;
+}
+
+/* Reverses the bit order of a byte: BMP stores the leftmost pixel in bit 7 */
+static uint8_t BMP_reverseBits(uint8_t byte)
+{
+  byte = (uint8_t) ((byte >> 4) | (byte << 4));
+  byte = (uint8_t) (((byte >> 2) & 0x33) | ((byte & 0x33) << 2));
+  return (uint8_t) (((byte >> 1) & 0x55) | ((byte & 0x55) << 1));
+}
+
+/** @endcond */
+
+/**************************************************************************//**
+*  @brief
+*  Help function used by BMP_readMonoRow to convert one row of 24-bit, 8-bit
+*  or 1-bit uncompressed data, including the padding at the end of the row.
+*
+*  @param row
+*  Cleared row buffer
+*  @param y
+*  Row in the image, used by ordered dithering
+*  @param dither
+*  Dithering mode
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS BMP_readMonoRowUncompressed(uint8_t row[], uint32_t y, BMP_Dither_t dither)
+{
+  static const uint8_t lumaWeight[3] = { 29, 150, 77 }; /* B, G, R */
+
+  EMSTATUS status;
+  uint32_t bytesLeft = bmpHeader.imageDataSize / bmpHeader.height;
+  uint32_t x         = 0;
+  uint32_t component = 0;
+  uint32_t luma      = 0;
+  uint32_t chunk;
+  uint32_t i;
+  uint32_t bit;
+  const uint8_t *pData;
+  uint8_t  invert;
+
+  /* Value of a 1-bit pixel is the palette bit of its index */
+  invert = (monoPaletteBits[0] & 1) ? 0xFF : 0x00;
+
+  while (bytesLeft > 0) {
+    status = BMP_monoFillCache();
+    if (status != BMP_OK) {
+      return status;
+    }
+
+    chunk = monoCacheLen - monoCacheIdx;
+    if (chunk > bytesLeft) {
+      chunk = bytesLeft;
+    }
+    pData         = &monoData[monoCacheIdx];
+    monoCacheIdx += chunk;
+    bytesLeft    -= chunk;
+
+    if (bmpHeader.bitsPerPixel == 8) {
+      for (i = 0; i < chunk && x < monoWidth; i++, x++) {
+        BMP_monoPutIndex(row, x, y, pData[i], dither);
+      }
+    } else if (bmpHeader.bitsPerPixel == 24) {
+      for (i = 0; i < chunk && x < monoWidth; i++) {
+        luma += lumaWeight[component] * pData[i];
+        if (++component == 3) {
+          BMP_monoPutLuma(row, x, y, (int32_t) (luma >> 8), dither);
+          component = 0;
+          luma      = 0;
+          x        += 1;
+        }
+      }
+    } else if (dither == BMP_DITHER_NONE
+               && (monoPaletteBits[0] & 1) != ((monoPaletteBits[0] >> 1) & 1)) {
+      /* Black and white palette: copy whole bytes */
+      for (i = 0; i < chunk && x < monoWidth; i++, x += 8) {
+        row[x >> 3] = BMP_reverseBits(pData[i]) ^ invert;
+      }
+      if (x > monoWidth) {
+        row[(monoWidth - 1) >> 3] &= (uint8_t) (0xFF >> (x - monoWidth));
+      }
+    } else {
+      for (i = 0; i < chunk && x < monoWidth; i++) {
+        for (bit = 0; bit < 8; bit++, x++) {
+          BMP_monoPutIndex(row, x, y, (pData[i] >> (7 - bit)) & 1, dither);
+        }
+      }
+    }
+  }
+
+  return BMP_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Help function used by BMP_readMonoRow to decode one row of RLE8 data.
+*
+*  Pixels skipped by a delta code, and rows after the end of bitmap code, take
+*  the color of palette entry 0. A delta that moves down ends the row and
+*  leaves the following rows blank until the target row is reached.
+*
+*  @param row
+*  Cleared row buffer
+*  @param y
+*  Row in the image, used by ordered dithering
+*  @param dither
+*  Dithering mode
+*
+*  @return
+*  Returns BMP_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS BMP_readMonoRowRLE8(uint8_t row[], uint32_t y, BMP_Dither_t dither)
+{
+  EMSTATUS status = BMP_OK;
+  uint32_t x      = 0;
+  uint32_t end;
+  uint8_t  count;
+  uint8_t  code;
+  uint8_t  dx;
+  uint8_t  dy;
+  uint8_t  index;
+
+  if (rleSkipRows > 0) {
+    rleSkipRows -= 1;
+  } else {
+    /* Continue at the column where a delta moved to */
+    for (; x < rleStartX; x++) {
+      BMP_monoPutIndex(row, x, y, 0, dither);
+    }
+    rleStartX = 0;
+
+    while (rleEndOfFile == 0) {
+      status = BMP_monoReadByte(&count);
+      if (status == BMP_OK) {
+        status = BMP_monoReadByte(&code);
+      }
+      if (status != BMP_OK) {
+        break;
+      }
+
+      if (count > 0) {
+        /* Encoded run */
+        for (end = x + count; x < end; x++) {
+          BMP_monoPutIndex(row, x, y, code, dither);
+        }
+      } else if (code == 0) {
+        /* End of line */
+        break;
+      } else if (code == 1) {
+        /* End of bitmap */
+        rleEndOfFile = 1;
+      } else if (code == 2) {
+        /* Delta */
+        status = BMP_monoReadByte(&dx);
+        if (status == BMP_OK) {
+          status = BMP_monoReadByte(&dy);
+        }
+        if (status != BMP_OK) {
+          break;
+        }
+        if (dy > 0) {
+          rleSkipRows = dy - 1;
+          rleStartX   = x + dx;
+          break;
+        }
+        for (end = x + dx; x < end; x++) {
+          BMP_monoPutIndex(row, x, y, 0, dither);
+        }
+      } else {
+        /* Absolute run, padded to an even number of bytes */
+        for (end = x + code; x < end; x++) {
+          status = BMP_monoReadByte(&index);
+          if (status != BMP_OK) {
+            break;
+          }
+          BMP_monoPutIndex(row, x, y, index, dither);
+        }
+        if (status == BMP_OK && (code & 1)) {
+          status = BMP_monoReadByte(&index);
+        }
+        if (status != BMP_OK) {
+          break;
+        }
+      }
+    }
+
+    /* Image data ending without an end of bitmap code is not an error */
+    if (status == BMP_ERROR_END_OF_FILE) {
+      rleEndOfFile = 1;
+      status       = BMP_OK;
+    }
+  }
+
+  /* Rest of the row */
+  for (; x < monoWidth; x++) {
+    BMP_monoPutIndex(row, x, y, 0, dither);
+  }
+
+  return status;
+}
+
 /**************************************************************************//**
 *  @brief
 *  Get width of BMP image in pixels
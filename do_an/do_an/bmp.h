@@ -102,6 +102,8 @@ extern "C" {
 
 /** BMP Local cache size */
 #define BMP_LOCAL_CACHE_SIZE                (BMP_CONFIG_LOCAL_CACHE_SIZE)
+/** Widest row converted by BMP_readMonoRow(), wider images are cut off */
+#define BMP_MONO_MAX_WIDTH                  (BMP_CONFIG_MONO_MAX_WIDTH)
 
 /** @brief BMP Module header structure. Must be packed to exact 54 bytes.
  */
@@ -174,11 +176,24 @@ typedef struct __BMP_DataType{
   uint32_t endOfRow;
 } BMP_DataType;
 
+/** @brief Dithering used by BMP_readMonoRow() to reduce pixels to 1 bpp
+ */
+typedef enum __BMP_Dither{
+  /** Pixels darker than 50 % luminance are black, the others white */
+  BMP_DITHER_NONE = 0,
+  /** 4x4 Bayer threshold matrix */
+  BMP_DITHER_ORDERED,
+  /** Floyd-Steinberg error diffusion */
+  BMP_DITHER_FLOYD_STEINBERG,
+} BMP_Dither_t;
+
 /* Module prototypes */
 EMSTATUS BMP_init(uint8_t *palette, uint32_t paletteSize, EMSTATUS (*fp)(uint8_t buffer[], uint32_t bufLength, uint32_t bytesToRead));
+EMSTATUS BMP_initMemory(const uint8_t *image, uint32_t imageSize, uint8_t *palette, uint32_t paletteSize);
 EMSTATUS BMP_reset(void);
 EMSTATUS BMP_readRgbData(uint8_t buffer[], uint32_t bufLength, uint32_t *pixelsRead);
 EMSTATUS BMP_readRawData(BMP_DataType *dataType, uint8_t buffer[], uint32_t bufLength);
+EMSTATUS BMP_readMonoRow(uint8_t row[], uint32_t rowLength, BMP_Dither_t dither, uint32_t *rowIndex);
 
 /* Accessor functions */
 int32_t BMP_getWidth(void);
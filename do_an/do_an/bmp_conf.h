@@ -32,5 +32,6 @@
 #define __BMP_CONFIG_H_
 
 #define BMP_CONFIG_LOCAL_CACHE_SIZE    (128)
+#define BMP_CONFIG_MONO_MAX_WIDTH      (128)
 
 #endif /* __BMP_CONFIG_H_ */
@@ -0,0 +1,11 @@
+#include "centi.h"
+#include <stdio.h>
+
+char *centi_format(char *buf, size_t len, int16_t centi)
+{
+  // Đổi sang dương bằng int32_t: -32768 không có số dương int16_t tương ứng
+  int32_t mag = centi < 0 ? -(int32_t)centi : centi;
+
+  snprintf(buf, len, "%s%ld.%02ld", centi < 0 ? "-" : "", (long)(mag / 100), (long)(mag % 100));
+  return buf;
+}
@@ -0,0 +1,17 @@
+#ifndef CENTI_H
+#define CENTI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Số liệu đơn vị 0.01 (centi °C, centi %RH, xem dht20.h) dạng chữ
+// "-0.05", "25.34": dấu in riêng vì -5 / 100 ra 0, mất dấu trừ.
+
+// Đủ cho mọi int16_t: "-327.68" và ký tự kết thúc
+#define CENTI_STR_LEN               8
+
+// --- HÀM: GHI centi RA buf (tối đa len byte, kể cả ký tự kết thúc) ---
+// Trả về buf để dùng thẳng trong printf("%s").
+char *centi_format(char *buf, size_t len, int16_t centi);
+
+#endif // CENTI_H
@@ -0,0 +1,16 @@
+#ifndef SENSOR_SCHED_CONFIG_H
+#define SENSOR_SCHED_CONFIG_H
+
+#include "em_device.h"
+
+// Bộ đếm chu kỳ CPU dùng để đo thời gian CPU của bộ lập lịch (sensor_sched.c):
+// bộ đếm DWT->CYCCNT của lõi Cortex-M33, chạy ở tần số lõi
+#define SENSOR_SCHED_CPU_COUNTER_INIT()                       \
+  do {                                                        \
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;           \
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                      \
+  } while (0)
+#define SENSOR_SCHED_CPU_COUNTER()    (DWT->CYCCNT)
+#define SENSOR_SCHED_CPU_HZ()         SystemCoreClockGet()
+
+#endif // SENSOR_SCHED_CONFIG_H
@@ -1,13 +1,9 @@
 #include <string.h>
 #include "custom_adv.h"
-
-// Helper: Float to Int16 (25.5 -> 2550)
-static int16_t convert_float_to_int16(float value) {
-  return (int16_t)(value * 100);
-}
+#include "centi.h"
 
 void fill_adv_packet(CustomAdv_t *pData, uint8_t flags, uint16_t companyID,
-                     uint32_t student_id, float temp, float hum, char *name)
+                     uint32_t student_id, int16_t temp_centi, int16_t hum_centi, char *name)
 {
   // Reset bộ nhớ để tránh rác
   memset(pData, 0, sizeof(CustomAdv_t));
@@ -32,14 +28,11 @@ void fill_adv_packet(CustomAdv_t *pData, uint8_t flags, uint16_t companyID,
   pData->student_id_1 = (student_id >> 16) & 0xFF;
   pData->student_id_0 = (student_id >> 24) & 0xFF;
 
-  // 5. Temp & Hum
-  int16_t i_temp = convert_float_to_int16(temp);
-  int16_t i_hum = convert_float_to_int16(hum);
-
-  pData->temp_LO = i_temp & 0xFF;
-  pData->temp_HI = (i_temp >> 8) & 0xFF;
-  pData->hum_LO = i_hum & 0xFF;
-  pData->hum_HI = (i_hum >> 8) & 0xFF;
+  // 5. Temp & Hum (đã ở đơn vị 0.01: 25.5 -> 2550)
+  pData->temp_LO = temp_centi & 0xFF;
+  pData->temp_HI = (temp_centi >> 8) & 0xFF;
+  pData->hum_LO = hum_centi & 0xFF;
+  pData->hum_HI = (hum_centi >> 8) & 0xFF;
 
   // 6. Name
   int n = strlen(name);
@@ -53,7 +46,10 @@ void fill_adv_packet(CustomAdv_t *pData, uint8_t flags, uint16_t companyID,
   // Size = Flags(3) + Manuf(1+1+11) + Name(1+1+n)
   pData->data_size = 3 + (2 + pData->len_manuf) + (1 + pData->len_name);
 
-  app_log("ADV Init: Size=%d, T=%.2f, H=%.2f\r\n", pData->data_size, temp, hum);
+  char t[CENTI_STR_LEN], h[CENTI_STR_LEN];
+
+  app_log("ADV Init: Size=%d, T=%s, H=%s\r\n", pData->data_size,
+          centi_format(t, sizeof(t), temp_centi), centi_format(h, sizeof(h), hum_centi));
 }
 
 void start_adv(CustomAdv_t *pData, uint8_t advertising_set_handle)
@@ -82,19 +78,15 @@ void start_adv(CustomAdv_t *pData, uint8_t advertising_set_handle)
 }
 
 void update_adv_data(CustomAdv_t *pData, uint8_t advertising_set_handle,
-                     float temp, float hum)
+                     int16_t temp_centi, int16_t hum_centi)
 {
   sl_status_t sc;
 
-  // Chuyển đổi dữ liệu mới
-  int16_t i_temp = convert_float_to_int16(temp);
-  int16_t i_hum = convert_float_to_int16(hum);
-
   // Cập nhật vào Struct
-  pData->temp_LO = i_temp & 0xFF;
-  pData->temp_HI = (i_temp >> 8) & 0xFF;
-  pData->hum_LO = i_hum & 0xFF;
-  pData->hum_HI = (i_hum >> 8) & 0xFF;
+  pData->temp_LO = temp_centi & 0xFF;
+  pData->temp_HI = (temp_centi >> 8) & 0xFF;
+  pData->hum_LO = hum_centi & 0xFF;
+  pData->hum_HI = (hum_centi >> 8) & 0xFF;
 
   sc = sl_bt_legacy_advertiser_set_data(advertising_set_handle,
                                         0,
@@ -104,12 +96,10 @@ void update_adv_data(CustomAdv_t *pData, uint8_t advertising_set_handle,
   // --- SỬA ĐOẠN NÀY ---
   if (sc == SL_STATUS_OK) {
       // Tách số để in ra log (vì %f không hoạt động)
-      int t_int = (int)temp;
-      int t_frac = (int)((temp - t_int) * 100);
-      int h_int = (int)hum;
-      int h_frac = (int)((hum - h_int) * 100);
+      char t[CENTI_STR_LEN], h[CENTI_STR_LEN];
 
-      app_log("BLE Updated: T=%d.%02d, H=%d.%02d\r\n", t_int, t_frac, h_int, h_frac);
+      app_log("BLE Updated: T=%s, H=%s\r\n", centi_format(t, sizeof(t), temp_centi),
+              centi_format(h, sizeof(h), hum_centi));
   } else {
       app_log("ERR: Update ADV failed 0x%04x\r\n", sc);
   }
@@ -54,12 +54,12 @@ typedef struct __attribute__((packed))
 } CustomAdv_t;
 
 void fill_adv_packet(CustomAdv_t *pData, uint8_t flags, uint16_t companyID,
-                     uint32_t student_id, float temp, float hum, char *name);
+                     uint32_t student_id, int16_t temp_centi, int16_t hum_centi, char *name);
 
 void start_adv(CustomAdv_t *pData, uint8_t advertising_set_handle);
 
 void update_adv_data(CustomAdv_t *pData, uint8_t advertising_set_handle,
-                     float temp, float hum);
+                     int16_t temp_centi, int16_t hum_centi);
 
 #ifdef __cplusplus
 }
@@ -1,6 +1,7 @@
 #include "dht20.h"
-#include "sl_i2cspm_instances.h"
-#include "em_i2c.h"
+#include <stddef.h>
+#include <string.h>
+#include "i2c_bus.h"
 #include "sl_sleeptimer.h"
 #include "app_log.h"
 
@@ -20,7 +21,7 @@ void i2c_scan(void)
       seq.buf[0].data = &dummy;
       seq.buf[0].len = 1;
 
-      I2C_TransferReturn_TypeDef ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
+      I2C_TransferReturn_TypeDef ret = i2c_bus_transfer_blocking(&seq);
 
       if (ret == i2cTransferDone) {
           if (addr == DHT20_ADDR) {
@@ -54,7 +55,7 @@ bool dht20_is_connected(void)
   seq.buf[0].data = &dummy;
   seq.buf[0].len = 1;
 
-  return (I2CSPM_Transfer(sl_i2cspm_sensor, &seq) == i2cTransferDone);
+  return (i2c_bus_transfer_blocking(&seq) == i2cTransferDone);
 }
 
 // Soft reset DHT20
@@ -71,7 +72,7 @@ sl_status_t dht20_soft_reset(void)
   seq.buf[0].data = &reset_cmd;
   seq.buf[0].len = 1;
 
-  ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
+  ret = i2c_bus_transfer_blocking(&seq);
   if (ret != i2cTransferDone) {
       app_log("Soft reset failed\n");
       return SL_STATUS_FAIL;
@@ -111,7 +112,7 @@ sl_status_t dht20_init(void)
   seq.buf[0].data = &status;
   seq.buf[0].len = 1;
 
-  ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
+  ret = i2c_bus_transfer_blocking(&seq);
   if (ret != i2cTransferDone) {
       app_log("ERROR: Cannot read DHT20 status\n");
       return SL_STATUS_FAIL;
@@ -132,7 +133,7 @@ sl_status_t dht20_init(void)
       seq.buf[0].data = init_cmd;
       seq.buf[0].len = 3;
 
-      ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
+      ret = i2c_bus_transfer_blocking(&seq);
       if (ret != i2cTransferDone) {
           app_log("ERROR: Calibration command failed\n");
           return SL_STATUS_FAIL;
@@ -145,7 +146,7 @@ sl_status_t dht20_init(void)
       seq.flags = I2C_FLAG_READ;
       seq.buf[0].data = &status;
       seq.buf[0].len = 1;
-      ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
+      ret = i2c_bus_transfer_blocking(&seq);
 
       app_log("DHT20 status after calibration: 0x%02X\n", status);
 
@@ -159,75 +160,203 @@ sl_status_t dht20_init(void)
   return SL_STATUS_OK;
 }
 
-sl_status_t dht20_read(float *temperature, float *humidity)
+// Làm tròn về 24 bit có nghĩa (gần nhất, hòa thì về chẵn), đúng như kết quả
+// của một phép tính float. Dùng để đổi mã thô sang centi chỉ bằng nhân và
+// dịch bit mà vẫn ra cùng giá trị với công thức float trước đây: ở vài trăm
+// mã, float làm tròn x.99998 lên x+1 nên phép chia nguyên thuần túy lệch 1.
+static uint64_t dht20_round24(uint64_t x)
 {
-  app_log("\n\t\tNHIET DO & DO AM\n\n");
-    uint8_t trigger_cmd[3] = {0xAC, 0x33, 0x00};
-    uint8_t rx_buffer[7];
-    I2C_TransferSeq_TypeDef seq;
-    I2C_TransferReturn_TypeDef ret;
-
-    // Gửi lệnh trigger measurement
-    seq.addr = DHT20_ADDR << 1;
-    seq.flags = I2C_FLAG_WRITE;
-    seq.buf[0].data = trigger_cmd;
-    seq.buf[0].len = 3;
-
-    ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
-    if (ret != i2cTransferDone) {
-        return SL_STATUS_TRANSMIT;
-    }
-
-    // Đợi đo xong (80ms)
-    sl_sleeptimer_delay_millisecond(80);
-
-    // Đọc 7 bytes dữ liệu
-    seq.flags = I2C_FLAG_READ;
-    seq.buf[0].data = rx_buffer;
-    seq.buf[0].len = 7;
-
-    ret = I2CSPM_Transfer(sl_i2cspm_sensor, &seq);
-    if (ret != i2cTransferDone) {
-        return SL_STATUS_RECEIVE;
-    }
-
-    // In raw data
-    app_log("\t Raw: %02X %02X %02X %02X %02X %02X %02X\n",
-            rx_buffer[0], rx_buffer[1], rx_buffer[2], rx_buffer[3],
-            rx_buffer[4], rx_buffer[5], rx_buffer[6]);
-
-    // Kiểm tra busy bit
-    if (rx_buffer[0] & 0x80) {
-        return SL_STATUS_NOT_READY;
-    }
-
-    // Trích xuất RH_Code (20 bits)
-    uint32_t RH_Code = ((uint32_t)rx_buffer[1] << 12) |
-                       ((uint32_t)rx_buffer[2] << 4) |
-                       ((uint32_t)rx_buffer[3] >> 4);
-
-    // Trích xuất Temp_Code (20 bits)
-    uint32_t Temp_Code = (((uint32_t)rx_buffer[3] & 0x0F) << 16) |
-                         ((uint32_t)rx_buffer[4] << 8) |
-                         ((uint32_t)rx_buffer[5]);
-
-    app_log("\t RH_Code: 0x%05lX (%lu)\n", RH_Code, RH_Code);
-    app_log("\t Temp_Code: 0x%05lX (%lu)\n", Temp_Code, Temp_Code);
-
-    // Tính toán với kiểm tra
-    float hum_value = ((float)RH_Code / 1048576.0f) * 100.0f;
-    float temp_value = ((float)Temp_Code / 1048576.0f) * 200.0f - 50.0f;
-
-    // In giá trị tính được
-    app_log("\t Humidity: %d.%02d%%, Temperature: %d.%02d C\n\n",
-            (int)hum_value,
-            (int)((hum_value - (int)hum_value) * 100),
-            (int)temp_value,
-            (int)((temp_value - (int)temp_value) * 100));
-
-    // Gán giá trị
-    *humidity = hum_value;
-    *temperature = temp_value;
-
-    return SL_STATUS_OK;
+  uint32_t shift;
+  uint64_t half, rem;
+
+  if (x < ((uint64_t)1 << 24)) {
+      return x;
+  }
+  // Số bit thừa ngoài 24 bit có nghĩa (CLZ là một lệnh trên Cortex-M33)
+  shift = 40 - (uint32_t)__builtin_clzll(x);
+  half = (uint64_t)1 << (shift - 1);
+  rem = x & ((half << 1) - 1);
+  x -= rem;
+  if (rem > half || (rem == half && ((x >> shift) & 1))) {
+      x += half << 1;
+  }
+  return x;
+}
+
+// Giá trị trung gian tính theo đơn vị 2^-20 (mã thô / 2^20 là chính xác),
+// mỗi bước làm tròn như một phép nhân/trừ float:
+//   RH[%]   = code / 2^20 * 100           -> centi = trunc(RH * 100)
+//   T[°C]   = code / 2^20 * 200 - 50      -> centi = trunc(T * 100)
+int16_t dht20_hum_centi(uint32_t rh_code)
+{
+  uint64_t hum = dht20_round24((uint64_t)rh_code * 100u);
+
+  return (int16_t)(dht20_round24(hum * 100u) >> 20);
+}
+
+int16_t dht20_temp_centi(uint32_t temp_code)
+{
+  int64_t temp = (int64_t)dht20_round24((uint64_t)temp_code * 200u) - ((int64_t)50 << 20);
+  uint64_t mag = dht20_round24((uint64_t)(temp < 0 ? -temp : temp));
+
+  // Ép kiểu từ float cắt về phía 0: làm tròn trên độ lớn rồi gắn dấu
+  mag = dht20_round24(mag * 100u) >> 20;
+  return (int16_t)(temp < 0 ? -(int32_t)mag : (int32_t)mag);
+}
+
+// Giải mã khung DHT20_FRAME_LEN byte: trạng thái, 20 bit độ ẩm, 20 bit
+// nhiệt độ, CRC. Không in gì: bộ lập lịch gọi lại mỗi lần cảm biến còn bận.
+static sl_status_t dht20_convert(const uint8_t *rx_buffer, int16_t *temp_centi, int16_t *hum_centi)
+{
+  // Kiểm tra busy bit
+  if (rx_buffer[0] & DHT20_STATUS_BUSY) {
+      return SL_STATUS_NOT_READY;
+  }
+
+  // Trích xuất RH_Code (20 bits)
+  uint32_t RH_Code = ((uint32_t)rx_buffer[1] << 12) |
+                     ((uint32_t)rx_buffer[2] << 4) |
+                     ((uint32_t)rx_buffer[3] >> 4);
+
+  // Trích xuất Temp_Code (20 bits)
+  uint32_t Temp_Code = (((uint32_t)rx_buffer[3] & 0x0F) << 16) |
+                       ((uint32_t)rx_buffer[4] << 8) |
+                       ((uint32_t)rx_buffer[5]);
+
+  // Tính toán bằng số nguyên, đơn vị 0.01
+  *hum_centi = dht20_hum_centi(RH_Code);
+  *temp_centi = dht20_temp_centi(Temp_Code);
+
+  return SL_STATUS_OK;
+}
+
+// Mô tả cho bộ lập lịch nhiều cảm biến: values[0] nhiệt độ, values[1] độ ẩm.
+// Khung thô chỉ in một lần mỗi lần đo, khi đã có kết quả.
+static sl_status_t dht20_decode(const uint8_t *rx, int16_t *values)
+{
+  sl_status_t sc = dht20_convert(rx, &values[0], &values[1]);
+
+  if (sc == SL_STATUS_OK) {
+      app_log("\t Raw: %02X %02X %02X %02X %02X %02X %02X\n",
+              rx[0], rx[1], rx[2], rx[3], rx[4], rx[5], rx[6]);
+  }
+  return sc;
+}
+
+const sensor_driver_t dht20_sensor = {
+  .name = "DHT20",
+  .addr = DHT20_ADDR,
+  .trigger_len = DHT20_TRIGGER_LEN,
+  .trigger_cmd = DHT20_TRIGGER_CMD,
+  .conversion_ms = DHT20_MEASURE_MS,
+  .read_len = DHT20_FRAME_LEN,
+  .decode = dht20_decode,
+};
+
+// ================= ĐO RIÊNG LẺ: dht20_start() / dht20_poll() =================
+typedef enum {
+  DHT20_MEAS_IDLE = 0,
+  DHT20_MEAS_BUSY,        // Đang trigger, chờ đo hoặc đọc
+  DHT20_MEAS_DONE,        // Có khung hoặc lỗi, chờ dht20_poll()
+} dht20_meas_state_t;
+
+static volatile dht20_meas_state_t measState = DHT20_MEAS_IDLE;
+static volatile sl_status_t measStatus;
+static i2c_bus_transfer_t measTransfer;
+static sl_sleeptimer_timer_handle_t measTimer;
+static uint8_t measTx[DHT20_TRIGGER_LEN];
+static uint8_t measRx[DHT20_FRAME_LEN];
+static uint8_t measPolls;
+
+static void dht20_meas_read_done(i2c_bus_transfer_t *transfer, I2C_TransferReturn_TypeDef result)
+{
+  (void)transfer;
+  measStatus = (result == i2cTransferDone) ? SL_STATUS_OK : SL_STATUS_RECEIVE;
+  measState = DHT20_MEAS_DONE;
+}
+
+// Gọi từ ngắt sleeptimer: hết thời gian đo thì nộp lệnh đọc
+static void dht20_meas_timer(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  (void)handle;
+  (void)data;
+  i2c_bus_prepare_read(&measTransfer, dht20_sensor.addr, measRx, dht20_sensor.read_len,
+                       dht20_meas_read_done, NULL);
+  if (i2c_bus_submit(&measTransfer) != SL_STATUS_OK) {
+      measStatus = SL_STATUS_RECEIVE;
+      measState = DHT20_MEAS_DONE;
+  }
+}
+
+static void dht20_meas_wait(uint16_t ms)
+{
+  if (sl_sleeptimer_start_timer_ms(&measTimer, ms, dht20_meas_timer, NULL, 0, 0) != SL_STATUS_OK) {
+      measStatus = SL_STATUS_FAIL;
+      measState = DHT20_MEAS_DONE;
+  }
+}
+
+// Gọi từ ngắt I2C khi lệnh trigger xong
+static void dht20_meas_trigger_done(i2c_bus_transfer_t *transfer, I2C_TransferReturn_TypeDef result)
+{
+  (void)transfer;
+  if (result != i2cTransferDone) {
+      measStatus = SL_STATUS_TRANSMIT;
+      measState = DHT20_MEAS_DONE;
+      return;
+  }
+  dht20_meas_wait(dht20_sensor.conversion_ms);
+}
+
+sl_status_t dht20_start(void)
+{
+  sl_status_t sc;
+
+  if (measState != DHT20_MEAS_IDLE) {
+      return SL_STATUS_BUSY;
+  }
+  memcpy(measTx, dht20_sensor.trigger_cmd, dht20_sensor.trigger_len);
+  measPolls = 0;
+  measState = DHT20_MEAS_BUSY;
+  i2c_bus_prepare_write(&measTransfer, dht20_sensor.addr, measTx, dht20_sensor.trigger_len,
+                        dht20_meas_trigger_done, NULL);
+  sc = i2c_bus_submit(&measTransfer);
+  if (sc != SL_STATUS_OK) {
+      measState = DHT20_MEAS_IDLE;
+  }
+  return sc;
+}
+
+sl_status_t dht20_poll(int16_t *temp_centi, int16_t *hum_centi)
+{
+  int16_t values[SENSOR_SCHED_VALUES_MAX];
+  sl_status_t sc;
+
+  if (measState == DHT20_MEAS_IDLE) {
+      return SL_STATUS_INVALID_STATE;
+  }
+  if (measState == DHT20_MEAS_BUSY) {
+      return SL_STATUS_IN_PROGRESS;
+  }
+
+  sc = measStatus;
+  if (sc == SL_STATUS_OK) {
+      sc = dht20_sensor.decode(measRx, values);
+      if (sc == SL_STATUS_NOT_READY) {
+          // Cảm biến còn bận: đọc lại sau SENSOR_SCHED_POLL_MS
+          if (measPolls < SENSOR_SCHED_MAX_POLLS) {
+              measPolls++;
+              measState = DHT20_MEAS_BUSY;
+              dht20_meas_wait(SENSOR_SCHED_POLL_MS);
+              return SL_STATUS_IN_PROGRESS;
+          }
+          sc = SL_STATUS_TIMEOUT;
+      }
+  }
+  if (sc == SL_STATUS_OK) {
+      *temp_centi = values[0];
+      *hum_centi = values[1];
+  }
+  measState = DHT20_MEAS_IDLE;
+  return sc;
 }
@@ -2,15 +2,54 @@
 #define DHT20_H
 
 #include "sl_status.h"
+#include "sensor_sched.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 #define DHT20_ADDR 0x38
 
+// Một lần đo: lệnh trigger 0xAC 0x33 0x00, chờ DHT20_MEASURE_MS rồi đọc
+// khung DHT20_FRAME_LEN byte. Byte đầu có bit busy khi cảm biến chưa đo xong.
+#define DHT20_TRIGGER_CMD           { 0xAC, 0x33, 0x00 }
+#define DHT20_TRIGGER_LEN           3
+#define DHT20_MEASURE_MS            80
+#define DHT20_FRAME_LEN             7
+#define DHT20_STATUS_BUSY           0x80
+
+// Mọi kết quả đo là số nguyên đơn vị 0.01: nhiệt độ centi °C (2534 là
+// 25.34 °C), độ ẩm centi %RH. Cùng giá trị với gói quảng bá BLE.
+
 // Các hàm chính
 sl_status_t dht20_init(void);
-sl_status_t dht20_read(float *temperature, float *humidity);
 sl_status_t dht20_soft_reset(void);
 
+// Đo định kỳ chạy qua bộ lập lịch (sensor_sched.h) với mô tả dht20_sensor,
+// không chặn vòng lặp chính. dht20_init(), dht20_is_connected() và
+// i2c_scan() chặn, chỉ dùng lúc khởi động khi hàng đợi I2C rảnh.
+
+// Mô tả DHT20 cho bộ lập lịch nhiều cảm biến: values[0] là nhiệt độ
+// (centi °C), values[1] là độ ẩm (centi %RH).
+extern const sensor_driver_t dht20_sensor;
+
+// Đo một DHT20 riêng lẻ, không cần bộ lập lịch, bằng chính các bước của
+// dht20_sensor (lệnh trigger, thời gian đo, giải mã) trên hàng đợi I2C:
+//   1. dht20_start(): nộp lệnh trigger rồi trả về ngay. Trigger xong thì
+//      hẹn timer DHT20_MEASURE_MS, timer nộp lệnh đọc. SL_STATUS_BUSY nếu
+//      lần đo trước chưa xong.
+//   2. dht20_poll() gọi từ vòng lặp chính: SL_STATUS_IN_PROGRESS khi chưa
+//      đọc xong. Cảm biến còn bận thì đọc lại sau SENSOR_SCHED_POLL_MS, tối
+//      đa SENSOR_SCHED_MAX_POLLS lần rồi SL_STATUS_TIMEOUT. Xong thì trả về
+//      SL_STATUS_OK cùng kết quả, SL_STATUS_TRANSMIT/RECEIVE khi lỗi bus.
+// Không dùng cùng lúc với sensor_sched cho cùng cảm biến.
+sl_status_t dht20_start(void);
+sl_status_t dht20_poll(int16_t *temp_centi, int16_t *hum_centi);
+
+// --- HÀM: ĐỔI MÃ THÔ 20 BIT SANG CENTI BẰNG SỐ NGUYÊN ---
+// Khớp từng bit với công thức float cũ (code / 2^20 * 100 và
+// code / 2^20 * 200 - 50, nhân 100 rồi cắt phần lẻ) trên cả 2^20 mã.
+int16_t dht20_hum_centi(uint32_t rh_code);
+int16_t dht20_temp_centi(uint32_t temp_code);
+
 // Hàm tiện ích
 void i2c_scan(void);
 bool dht20_is_connected(void);
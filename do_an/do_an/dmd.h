@@ -91,6 +91,8 @@ extern "C" {
 #define DMD_ERROR_NOT_SUPPORTED                 (ECODE_DMD_BASE | 0x000a)
 /** Not enough memory.  */
 #define DMD_ERROR_NOT_ENOUGH_MEMORY             (ECODE_DMD_BASE | 0x000b)
+/** A display update is still in progress. */
+#define DMD_ERROR_BUSY                          (ECODE_DMD_BASE | 0x000c)
 
 /* Tests */
 /** Device code test */
@@ -131,6 +133,58 @@ typedef struct __DMD_DisplayGeometry{
   uint16_t clipHeight;
 } DMD_DisplayGeometry; /**< Typedef for display dimensions */
 
+/** Callback called when an update started by DMD_updateDisplayAsync() has
+    completed. Called from interrupt context. */
+typedef void (*DMD_UpdateCallback_t)(void *context);
+
+/** Raster operation combining the pixels written by the drawing functions
+    with the pixels already in the framebuffer. For monochrome displays a set
+    bit is a white pixel. */
+typedef enum __DMD_RasterOp{
+  DMD_RASTER_OP_COPY = 0,   /**< Pixel = source (the default) */
+  DMD_RASTER_OP_OR,         /**< Pixel = pixel OR source */
+  DMD_RASTER_OP_AND_NOT,    /**< Pixel = pixel AND NOT source */
+  DMD_RASTER_OP_XOR         /**< Pixel = pixel XOR source */
+} DMD_RasterOp; /**< Typedef for the raster operations */
+
+/** @struct DMD_Span
+ *  @brief Horizontal run of pixels on one row, in display coordinates
+ */
+typedef struct __DMD_Span{
+  /** Y coordinate of the row */
+  int32_t y;
+  /** X coordinate of one end of the run */
+  int32_t x0;
+  /** X coordinate of the other end of the run, inclusive */
+  int32_t x1;
+} DMD_Span; /**< Typedef for a horizontal span */
+
+/** @struct DMD_UpdateStats
+ *  @brief Row counters of the display updates
+ */
+typedef struct __DMD_UpdateStats{
+  /** Rows that were marked dirty when an update was started */
+  uint32_t rowsDirty;
+  /** Rows that were actually sent to the display device */
+  uint32_t rowsSent;
+} DMD_UpdateStats; /**< Typedef for display update counters */
+
+/** @struct DMD_DisplayListStats
+ *  @brief Usage of the display list, see SL_MEMLCD_DISPLAY_LIST
+ */
+typedef struct __DMD_DisplayListStats{
+  /** Bytes of the list holding commands */
+  uint32_t bytesUsed;
+  /** Highest value of bytesUsed */
+  uint32_t bytesPeak;
+  /** Size of the list */
+  uint32_t bytesTotal;
+  /** Bands rendered by the display updates */
+  uint32_t bandsRendered;
+  /** Drawing calls that failed because the list was full */
+  uint32_t overflows;
+} DMD_DisplayListStats; /**< Typedef for display list counters */
+
 /** @struct DMD_MemoryError
  *  @brief Information about a memory error
  */
@@ -228,9 +282,55 @@ EMSTATUS DMD_writeDataRLE(uint16_t x, uint16_t y, uint16_t xlen, uint16_t ylen,
 EMSTATUS DMD_writeDataRLEFade(uint16_t x, uint16_t y, uint16_t xlen, uint16_t ylen,
                               const uint8_t *data,
                               int red, int green, int blue, int weight);
+/** @endcond */
+
+/***************************************************************************//**
+ *  @brief
+ *    Reads pixels back from the framebuffer
+ *
+ *  @details
+ *    The inverse of DMD_writeData(): the coordinates are relative to the
+ *    clipping area and the pixels are packed in the same order and format.
+ *    Bits of the last byte of @p data past the last pixel are left unchanged.
+ *
+ *  @param x
+ *    X coordinate of the first pixel to be read, relative to the clipping area
+ *
+ *  @param y
+ *    Y coordinate of the first pixel to be read, relative to the clipping area
+ *
+ *  @param data
+ *    Array receiving the pixel data.
+ *
+ *  @param numPixels
+ *    Number of pixels to be read
+ *
+ *  @return
+ *    DMD_OK on success, DMD_ERROR_TOO_MUCH_DATA if the pixels run past the end
+ *    of the clipping area, DMD_ERROR_NOT_SUPPORTED on RGB displays.
+ ******************************************************************************/
 EMSTATUS DMD_readData(uint16_t x, uint16_t y,
                       uint8_t data[], uint32_t numPixels);
-/** @endcond */
+
+/***************************************************************************//**
+ *  @brief
+ *    Selects how the drawing functions combine pixels with the framebuffer
+ *
+ *  @details
+ *    The raster operation applies to DMD_writeData(), DMD_writeColor(),
+ *    DMD_writeRowMask() and DMD_fillSpans(). With DMD_RASTER_OP_XOR, writing
+ *    the same white pixels twice restores the framebuffer, so an overlay such
+ *    as a cursor or a highlight can be toggled without redrawing what is under
+ *    it. DMD_scrollLeft() always moves pixels as they are.
+ *
+ *  @param op
+ *    The raster operation, DMD_RASTER_OP_COPY after DMD_init().
+ *
+ *  @return
+ *    DMD_OK on success, DMD_ERROR_NOT_SUPPORTED for an unknown operation or
+ *    for any operation other than DMD_RASTER_OP_COPY on RGB displays.
+ ******************************************************************************/
+EMSTATUS DMD_setRasterOp(DMD_RasterOp op);
 
 /***************************************************************************//**
  *  @brief
@@ -260,6 +360,102 @@ EMSTATUS DMD_readData(uint16_t x, uint16_t y,
 EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
                         uint8_t green, uint8_t blue, uint32_t numPixels);
 
+/***************************************************************************//**
+ *  @brief
+ *    Merges a run of up to 32 pixels into one row of a monochrome display
+ *
+ *  @details
+ *    Pixel i of the run lands at (x + i, y) and takes its value from bit i of
+ *    @p pixels (1 = white, as for DMD_writeData()). Only the pixels whose bit
+ *    is set in @p mask are modified. Unlike DMD_writeData(), x and y are
+ *    display coordinates; the part of the run outside the current clipping
+ *    area is discarded.
+ *
+ *  @param x
+ *    X coordinate of pixel 0 of the run, may be negative
+ *
+ *  @param y
+ *    Y coordinate of the row
+ *
+ *  @param pixels
+ *    Pixel values, bit 0 is the leftmost pixel
+ *
+ *  @param mask
+ *    Pixels to write, bit 0 is the leftmost pixel
+ *
+ *  @return
+ *    DMD_OK if any pixel was written, DMD_ERROR_PIXEL_OUT_OF_BOUNDS if the run
+ *    is completely clipped, DMD_ERROR_NOT_SUPPORTED on RGB displays.
+ ******************************************************************************/
+EMSTATUS DMD_writeRowMask(int32_t x, int32_t y, uint32_t pixels, uint32_t mask);
+
+/***************************************************************************//**
+ *  @brief
+ *    Fills a batch of horizontal spans with one color
+ *
+ *  @details
+ *    Each span is clipped against the current clipping area and written
+ *    directly into the framebuffer, a 32-bit word at a time. Like
+ *    DMD_writeRowMask(), the coordinates are display coordinates. The ends of
+ *    a span may be given in any order.
+ *
+ *  @param spans
+ *    Array of spans to fill
+ *
+ *  @param numSpans
+ *    Number of spans in the array
+ *
+ *  @param red
+ *    Red component of the color
+ *
+ *  @param green
+ *    Green component of the color
+ *
+ *  @param blue
+ *    Blue component of the color
+ *
+ *  @return
+ *    DMD_OK if any pixel was written, DMD_ERROR_PIXEL_OUT_OF_BOUNDS if all
+ *    spans are completely clipped, DMD_ERROR_NOT_SUPPORTED on RGB displays.
+ ******************************************************************************/
+EMSTATUS DMD_fillSpans(const DMD_Span *spans, uint32_t numSpans,
+                       uint8_t red, uint8_t green, uint8_t blue);
+
+/***************************************************************************//**
+ *  @brief
+ *    Scrolls the pixels of a rectangle to the left on a monochrome display
+ *
+ *  @details
+ *    Within each row of the rectangle, pixel x takes the value of pixel
+ *    x + @p shift. The @p shift rightmost columns keep their content and are
+ *    meant to be redrawn by the caller. The rows are shifted in place a 32-bit
+ *    word at a time. Like DMD_writeRowMask(), the coordinates are display
+ *    coordinates and the rectangle is clipped against the current clipping
+ *    area.
+ *
+ *  @param x
+ *    X coordinate of the left column of the rectangle
+ *
+ *  @param y
+ *    Y coordinate of the top row of the rectangle
+ *
+ *  @param width
+ *    Width of the rectangle
+ *
+ *  @param height
+ *    Height of the rectangle
+ *
+ *  @param shift
+ *    Number of columns to scroll by, 1 to 31
+ *
+ *  @return
+ *    DMD_OK if any pixel was moved, DMD_ERROR_PIXEL_OUT_OF_BOUNDS if the
+ *    clipped rectangle is not wider than @p shift, DMD_ERROR_NOT_SUPPORTED on
+ *    RGB displays or for a shift outside 1 to 31.
+ ******************************************************************************/
+EMSTATUS DMD_scrollLeft(int32_t x, int32_t y, int32_t width, int32_t height,
+                        uint32_t shift);
+
 /***************************************************************************//**
  *  @brief
  *    Turns off the display and puts it into sleep mode
@@ -294,15 +490,80 @@ EMSTATUS DMD_wakeUp(void);
  ******************************************************************************/
 EMSTATUS DMD_flipDisplay(int horizontal, int vertical);
 
+/***************************************************************************//**
+ *  @brief
+ *    Gives the driver memory to allocate extra framebuffers from.
+ *
+ *  @details
+ *    The pool is cut into as many framebuffers as fit, at most 32, see
+ *    SL_MEMLCD_FRAMEBUFFER_SIZE(). The driver keeps using it until another
+ *    pool is set, so it must stay valid. The framebuffer of DMD_init() is not
+ *    part of the pool and is always available.
+ *
+ *  @param pool
+ *    Memory for the framebuffers, or NULL to remove the pool
+ *
+ *  @param size
+ *    Size of the pool in bytes
+ *
+ *  @return
+ *    DMD_OK on success, DMD_ERROR_BUSY if framebuffers of the current pool
+ *    are still allocated, DMD_ERROR_NOT_ENOUGH_MEMORY if not even one
+ *    framebuffer fits.
+ ******************************************************************************/
+EMSTATUS DMD_setFramebufferPool(void *pool, uint32_t size);
+
+/***************************************************************************//**
+ *  @brief
+ *    Allocates a framebuffer from the pool given to DMD_setFramebufferPool().
+ *
+ *  @details
+ *    The new framebuffer is all white, like a cleared display. Select it with
+ *    DMD_selectFramebuffer() to draw in it or show it.
+ *
+ *  @param framebuffer
+ *    Set to the new framebuffer
+ *
+ *  @return
+ *    DMD_OK on success, DMD_ERROR_NOT_ENOUGH_MEMORY if the pool is used up.
+ ******************************************************************************/
+EMSTATUS DMD_allocateFramebuffer(void **framebuffer);
+
+/***************************************************************************//**
+ *  @brief
+ *    Returns a framebuffer to the pool.
+ *
+ *  @param framebuffer
+ *    Framebuffer from DMD_allocateFramebuffer()
+ *
+ *  @return
+ *    DMD_OK on success, DMD_ERROR_BUSY if it is the active framebuffer,
+ *    DMD_ERROR_NOT_SUPPORTED if it was not allocated from the pool.
+ ******************************************************************************/
+EMSTATUS DMD_freeFramebuffer(void *framebuffer);
+
 /***************************************************************************//**
  *  @brief
  *    Select the active framebuffer DMD functions will draw in.
  *
+ *  @details
+ *    The active framebuffer is also the one the display updates send. Nothing
+ *    is copied or redrawn. Selecting the framebuffer the display shows again
+ *    after drawing in another one keeps only the rows dirtied in it since the
+ *    last update. Selecting any other framebuffer marks all rows dirty, and
+ *    the next update sends the rows that differ from what the display shows.
+ *    Selecting the active framebuffer does nothing. A transfer started by
+ *    DMD_updateDisplayAsync() is not affected, it sends its own copy of the
+ *    rows.
+ *
  *  @param framebuffer
- *    Pointer to the framebuffer to be selected as active framebuffer.
+ *    Pointer to the framebuffer to be selected as active framebuffer: the one
+ *    of DMD_init(), see DMD_getFrameBuffer(), or one from
+ *    DMD_allocateFramebuffer().
  *
  *  @return
- *    Returns DMD_OK if successful, error otherwise.
+ *    Returns DMD_OK if successful, DMD_ERROR_NOT_SUPPORTED for an unknown
+ *    framebuffer.
  ******************************************************************************/
 EMSTATUS DMD_selectFramebuffer (void *framebuffer);
 
@@ -327,12 +588,84 @@ EMSTATUS DMD_getFrameBuffer (void **framebuffer);
  *    Only the dirty rows/lines are updated on the display device. Dirty rows/lines
  *    are those that have been written to since the last display update. When a
  *    new active framebuffer is selected, all lines/rows will be marked as dirty.
+ *    Dirty rows whose content equals what was last sent are skipped.
  *
  *  @return
  *    Returns DMD_OK if successful, error otherwise.
  ******************************************************************************/
 EMSTATUS DMD_updateDisplay (void);
 
+/***************************************************************************//**
+ *  @brief
+ *    Start updating the display device without waiting for the transfer.
+ *
+ *  @details
+ *    The dirty rows are copied into a transfer buffer owned by the driver and
+ *    sent in the background; the dirty flags are cleared right away. Drawing
+ *    into the framebuffer can continue during the transfer, the rows touched
+ *    meanwhile are sent by the next update. If no row is dirty, the callback
+ *    is called before the function returns.
+ *
+ *  @param callback
+ *    Function called when the transfer has completed, or NULL. Called from
+ *    interrupt context.
+ *
+ *  @param context
+ *    Passed to the callback.
+ *
+ *  @return
+ *    Returns DMD_OK if the update was started, DMD_ERROR_BUSY if the previous
+ *    update is still in progress, error otherwise.
+ ******************************************************************************/
+EMSTATUS DMD_updateDisplayAsync(DMD_UpdateCallback_t callback, void *context);
+
+/***************************************************************************//**
+ *  @brief
+ *    Get the row counters of the display updates.
+ *
+ *  @details
+ *    A dirty row is only sent when its content differs from what was last
+ *    sent to the display, so rowsSent can be lower than rowsDirty, e.g. when
+ *    the same screen is cleared and drawn again.
+ *
+ *  @param stats
+ *    Filled with the counters accumulated since DMD_init() or the last call
+ *    to DMD_resetUpdateStats().
+ *
+ *  @return
+ *    Returns DMD_OK if successful, error otherwise.
+ ******************************************************************************/
+EMSTATUS DMD_getUpdateStats(DMD_UpdateStats *stats);
+
+/***************************************************************************//**
+ *  @brief
+ *    Reset the row counters of the display updates.
+ *
+ *  @return
+ *    Returns DMD_OK if successful, error otherwise.
+ ******************************************************************************/
+EMSTATUS DMD_resetUpdateStats(void);
+
+/***************************************************************************//**
+ *  @brief
+ *    Get the usage of the display list.
+ *
+ *  @details
+ *    In display list mode the list holds every command drawn since the last
+ *    time the whole display was filled with DMD_RASTER_OP_COPY, e.g. by
+ *    GLIB_clear(). When it is full, the drawing functions return
+ *    DMD_ERROR_NOT_ENOUGH_MEMORY. bandsRendered and overflows are reset by
+ *    DMD_resetUpdateStats(), bytesPeak by DMD_init() only.
+ *
+ *  @param stats
+ *    Filled with the usage of the list.
+ *
+ *  @return
+ *    Returns DMD_OK if successful, DMD_ERROR_NOT_SUPPORTED when the driver
+ *    is not built in display list mode.
+ ******************************************************************************/
+EMSTATUS DMD_getDisplayListStats(DMD_DisplayListStats *stats);
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 /* Test functions */
 EMSTATUS DMD_testParameterChecks(void);
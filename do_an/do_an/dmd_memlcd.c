@@ -56,10 +56,149 @@ static DMD_DisplayGeometry dimensions;
  * for rendering. */
 static uint32_t dirtyRows[(SL_MEMLCD_DISPLAY_HEIGHT  + (sizeof(uint32_t) * 8 - 1)) / sizeof(uint32_t) / 8];
 
-/* This framebuffer is large enough to store one full frame. */
-static uint8_t framebuffer[(SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_HEIGHT * SL_MEMLCD_DISPLAY_BPP) / 8];
+#if !(SL_MEMLCD_DISPLAY_LIST)
+/* This framebuffer is large enough to store one full frame. It is the active
+ * framebuffer after DMD_init(). */
+static uint8_t defaultFramebuffer[SL_MEMLCD_FRAMEBUFFER_SIZE(SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_HEIGHT, SL_MEMLCD_DISPLAY_BPP)] SL_ATTRIBUTE_ALIGN(4);
+
+/* Active framebuffer: the DMD functions draw in it and the updates send it. */
+static uint8_t *framebuffer = defaultFramebuffer;
+
+/* Framebuffer the display shows, i.e. the one of the last update. dirtyRows
+ * belongs to it: while another framebuffer is selected for drawing, its
+ * flags wait in shownDirtyRows and come back when it is selected again. */
+static uint8_t *shownFramebuffer = defaultFramebuffer;
+static uint32_t shownDirtyRows[sizeof(dirtyRows) / sizeof(dirtyRows[0])];
+
+/* Memory given to DMD_setFramebufferPool(), cut into framebufferPoolCount
+ * framebuffers. Bit i of framebufferPoolUsed is set while framebuffer i is
+ * allocated. */
+#define FRAMEBUFFER_POOL_MAX       32
+static uint8_t  *framebufferPool = NULL;
+static uint32_t  framebufferPoolCount = 0;
+static uint32_t  framebufferPoolUsed = 0;
+
+/* Copy of the pixel data last sent to the display. A dirty row is only sent
+ * when it differs from its copy here. lcd_clear() leaves the panel white,
+ * which is all ones in the framebuffer. */
+static uint8_t shadowFramebuffer[sizeof(defaultFramebuffer)] SL_ATTRIBUTE_ALIGN(4);
+
+/* Transfer buffer of DMD_updateDisplayAsync(). It holds its own copy of the
+ * rows being sent, so that the framebuffer can be drawn into meanwhile. */
+static uint8_t txBuffer[SL_MEMLCD_TX_BUFFER_SIZE(SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_HEIGHT)];
+
+/* State of the update started by DMD_updateDisplayAsync(). */
+static volatile bool updateInProgress = false;
+static DMD_UpdateCallback_t updateCallback;
+static void *updateContext;
+#else
+/* Commands of the display list. Each starts with its DL_* byte, followed by
+ * little-endian 16-bit display coordinates, already clipped:
+ *   DL_RASTER_OP  op
+ *   DL_FILL       color, x0, y0, x1, y1 (rectangle, inclusive)
+ *   DL_SPANS      count, color, y, x0, x1, then count - 1 times the
+ *                 signed 8-bit differences of y, x0 and x1 with the span
+ *                 before (x1 inclusive)
+ *   DL_ROWS       x, y, rows, n | DL_ROWS_SAME_MASK, then either one mask
+ *                 and rows * pixels, or rows * (mask, pixels). Masks and
+ *                 pixels are n bytes, pixel x + i of row y + r is bit i.
+ *   DL_DATA       xClip, clipWidth, x, y, numPixels (32-bit), pixel bits
+ *                 (the arguments of DMD_writeData(), with the clip)
+ *   DL_SCROLL     x0, y0, x1, y1, shift */
+#define DL_RASTER_OP               1
+#define DL_FILL                    2
+#define DL_SPANS                   3
+#define DL_ROWS                    4
+#define DL_DATA                    5
+#define DL_SCROLL                  6
+#define DL_ROWS_SAME_MASK          0x80
+#define DL_MAX_COUNT               255
+
+/* Display list: the commands recorded by the drawing functions since the
+ * display was last filled completely. listLast is the offset of the last
+ * command, that the next one may be merged into. */
+static uint8_t  displayList[SL_MEMLCD_DISPLAY_LIST_SIZE];
+static uint32_t listUsed = 0;
+static uint32_t listLast = 0;
+
+/* Raster operation in effect at the end of the list */
+static DMD_RasterOp listRasterOp = DMD_RASTER_OP_COPY;
+
+/* Last span of the list, while the last command is a DL_SPANS */
+static DMD_Span listSpanLast;
+
+/* Rows of the band being rendered by DMD_updateDisplay() */
+static uint8_t bandBuffer[SL_MEMLCD_FRAMEBUFFER_SIZE(SL_MEMLCD_DISPLAY_WIDTH, SL_MEMLCD_DISPLAY_LIST_BAND_ROWS, SL_MEMLCD_DISPLAY_BPP)] SL_ATTRIBUTE_ALIGN(4);
+
+/* Counters returned by DMD_getDisplayListStats(). */
+static DMD_DisplayListStats listStats;
+#endif
+
+/* Counters returned by DMD_getUpdateStats(). */
+static DMD_UpdateStats updateStats;
+
+/* Raster operation of the drawing functions, see DMD_setRasterOp(). */
+static DMD_RasterOp rasterOp = DMD_RASTER_OP_COPY;
 
 static void setLineDirty(int line);
+#if !(SL_MEMLCD_DISPLAY_LIST)
+static int framebufferPoolIndex(const void *fb);
+#endif
+#if !(SL_MEMLCD_DISPLAY_RGB_3BIT)
+static uint32_t rasterOpWord(uint32_t pixels, uint32_t source);
+#if (SL_MEMLCD_DISPLAY_TRANSPOSED)
+static void writeColumnBits(unsigned int x, unsigned int y, const uint8_t *data,
+                            uint32_t dataBit, uint32_t pixelData,
+                            unsigned int numPixels);
+static void readColumnBits(unsigned int x, unsigned int y, uint8_t *data,
+                           uint32_t dataBit, unsigned int numPixels);
+static void shiftColumnBits(unsigned int x, unsigned int y,
+                            unsigned int numPixels, unsigned int shift);
+#else
+static void copyRowBits(uint8_t *pRow, unsigned int x, const uint8_t *data,
+                        uint32_t dataBit, unsigned int numPixels);
+static void fillRowBits(uint8_t *pRow, unsigned int x, unsigned int numPixels,
+                        uint32_t pixelData);
+static void shiftRowBits(uint8_t *pRow, unsigned int x, unsigned int numPixels,
+                         unsigned int shift);
+#if !(SL_MEMLCD_DISPLAY_LIST)
+static void readRowBits(const uint8_t *pRow, unsigned int x, uint8_t *data,
+                        uint32_t dataBit, unsigned int numPixels);
+#endif
+static void mergeRowBits(uint8_t *pRow, int32_t x, uint32_t pixels,
+                         uint32_t mask);
+#endif
+#endif
+#if !(SL_MEMLCD_DISPLAY_LIST)
+static unsigned int collectChangedRows(uint8_t *rows);
+static void commitRows(const uint8_t *rows, unsigned int rowCount);
+static void updateDone(void *context);
+#else
+static bool isLineDirty(int line);
+static void putCoord(uint8_t *p, int32_t value);
+static int32_t getCoord(const uint8_t *p);
+static void putBits(uint8_t *p, uint32_t value, unsigned int bytes);
+static uint32_t getBits(const uint8_t *p, unsigned int bytes);
+static uint8_t *listExtend(uint32_t size);
+static uint8_t *listReserve(uint32_t size);
+static uint8_t *listMergeable(uint8_t type);
+static uint32_t listCommandSize(const uint8_t *pCmd);
+static bool listCommandInside(const uint8_t *pCmd, int32_t x0, int32_t y0,
+                              int32_t x1, int32_t y1);
+static void listCull(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                     uint32_t end);
+static void listCullRows(void);
+static EMSTATUS listFill(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                         uint32_t pixelData);
+static EMSTATUS listSpan(int32_t y, int32_t x0, int32_t x1, uint32_t pixelData);
+static EMSTATUS listRowMask(int32_t x, int32_t y, uint32_t pixels,
+                            uint32_t mask);
+static EMSTATUS listData(uint16_t x, uint16_t y, const uint8_t *data,
+                         uint32_t numPixels);
+static EMSTATUS listScroll(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                           uint32_t shift);
+static void renderBand(unsigned int bandStart, unsigned int bandRows);
+#endif
 
 EMSTATUS DMD_init(DMD_InitConfig *initConfig)
 {
@@ -83,9 +222,22 @@ EMSTATUS DMD_init(DMD_InitConfig *initConfig)
     return DMD_ERROR_DRIVER_NOT_INITIALIZED;
   }
 
+#if !(SL_MEMLCD_DISPLAY_LIST)
+  /* The display has just been cleared */
+  memset(shadowFramebuffer, 0xFF, sizeof(shadowFramebuffer));
+#else
+  memset(&listStats, 0, sizeof(listStats));
+  listStats.bytesTotal = sizeof(displayList);
+#endif
+
   /* Set up dimensions of the display */
+#if (SL_MEMLCD_DISPLAY_TRANSPOSED)
+  dimensions.xSize = memlcd->height;
+  dimensions.ySize = memlcd->width;
+#else
   dimensions.xSize = memlcd->width;
   dimensions.ySize = memlcd->height;
+#endif
 
   /* At initialization, the clip is the entire display */
   dimensions.xClipStart = 0;
@@ -154,14 +306,19 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
     return DMD_ERROR_TOO_MUCH_DATA;
   }
 
+#if (SL_MEMLCD_DISPLAY_LIST)
+  return listData(x, y, data, numPixels);
+#else
   /* Write data */
   unsigned int rowPixels;
-  uint8_t      pixelData = 0;
   int          pixelBit = 0;
-  uint8_t      matrixByte;
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
   uint8_t     *pDst;
   int          bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+#endif
 #if (SL_MEMLCD_DISPLAY_RGB_3BIT)
+  uint8_t      pixelData = 0;
+  uint8_t      matrixByte;
   int          pixelSrcByte = 0;
   int          pixelSrcBit  = 0;
 #endif
@@ -183,7 +340,9 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
                 ? (unsigned int)(dimensions.clipWidth - x) : numPixels;
     numPixels -= rowPixels;
 
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
     pDst = framebuffer + currentY * bytesPerRow;
+#endif
 
     /* Adjust x to account for clipping. */
     x += dimensions.xClipStart;
@@ -247,55 +406,23 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
       pixelBit = pixelBit % 8; /* Truncate pixel index for next byte */
     }
 
+#elif (SL_MEMLCD_DISPLAY_TRANSPOSED)
+    /* Rotated by 90 or 270 degrees: the row of the image is a column of the
+       framebuffer. */
+    writeColumnBits(x, currentY, data, pixelBit, 0, rowPixels);
+    pixelBit += rowPixels;
 #else /* Monochrome display */
 
-    /* If the start pixel (x) or the corresponding data bit
-       (pixelBit) are not aligned on a 8-bit boundary or there are
-       less than 8 bits to copy to the current row we copy pixel by
-       pixel. */
-    if ((0 != (x & 0x7))
-        || (0 != (pixelBit & 0x7))
-        || (rowPixels < 8)) {
-      rowPixels += x;
-      for (; x < rowPixels; x++, pixelBit++) {
-        pixelData = (data[pixelBit >> 3] >> (pixelBit & 0x7)) & 0x1;
-        /* Write pixel data to the pixelMatrix buffer. */
-        if (pixelData) {
-          pDst[x >> 3] |= 1 << (x & 0x7);
-        } else {
-          pDst[x >> 3] &= ~(1 << (x & 0x7));
-        }
-      }
-    } else {
-      /* The start pixel and it's corresponding data bit are aligned on
-         an 8-bit boundary and there are more than 8 bits to copy. Use
-         memcpy to copy pixel bits to the current row. Take special care
-         of potential remaining bits in the last byte on the row. */
-      pDst += x >> 3;
-
-      int numBytesToCopy = rowPixels >> 3;
-
-      if (numBytesToCopy) {
-        /* We can copy data continuosly from start to end. */
-        memcpy(pDst, &data[pixelBit >> 3], numBytesToCopy);
-        pixelBit  += numBytesToCopy << 3;
-        rowPixels -= numBytesToCopy << 3;
-        pDst      += numBytesToCopy;
-      }
-
-      /* Copy any remaining bits to the framebuffer. */
-      if (rowPixels) {
-        uint8_t pixelMask = (1 << rowPixels) - 1;
-        matrixByte = (*pDst & ~pixelMask)
-                     | (data[pixelBit >> 3] & pixelMask);
-        *pDst = matrixByte;
-        pixelBit += rowPixels;
-      }
-    }
+    /* Copy the row a 32-bit word at a time, whatever the alignment of the
+       start pixel (x) and of the corresponding data bit (pixelBit). */
+    copyRowBits(pDst, x, data, pixelBit, rowPixels);
+    pixelBit += rowPixels;
 #endif
 
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
     /* Mark row/line as dirty */
     setLineDirty(currentY);
+#endif
 
     /* Update variables for next row. */
     currentY++;
@@ -303,23 +430,58 @@ EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
   }
 
   return DMD_OK;
+#endif
 }
 
-/***************************************************************************//**
- *  @brief
- *    This function is not supported for memory lcd displays
- *
- *  @return
- *    DMD_ERROR_NOT_SUPPORTED
- ******************************************************************************/
 EMSTATUS DMD_readData(uint16_t x, uint16_t y, uint8_t data[], uint32_t numPixels)
 {
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+#if (SL_MEMLCD_DISPLAY_RGB_3BIT) || (SL_MEMLCD_DISPLAY_LIST)
+  /* The display list mode keeps no pixels to read */
   (void) x;          /* Suppress compiler warning: unused parameter. */
   (void) y;          /* Suppress compiler warning: unused parameter. */
   (void) data;       /* Suppress compiler warning: unused parameter. */
   (void) numPixels;  /* Suppress compiler warning: unused parameter. */
 
   return DMD_ERROR_NOT_SUPPORTED;
+#else
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
+  int          bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+#endif
+  unsigned int rowPixels;
+  uint32_t     dataBit = 0;
+  uint32_t     clipRemaining;
+  uint16_t     currentY;
+
+  /* Same bounds as DMD_writeData() */
+  clipRemaining = (dimensions.clipHeight - y) * dimensions.clipWidth - x;
+  if (numPixels > clipRemaining) {
+    return DMD_ERROR_TOO_MUCH_DATA;
+  }
+
+  currentY = dimensions.yClipStart + y;
+  while (numPixels) {
+    rowPixels =  numPixels > (unsigned int)(dimensions.clipWidth - x)
+                ? (unsigned int)(dimensions.clipWidth - x) : numPixels;
+    numPixels -= rowPixels;
+
+#if (SL_MEMLCD_DISPLAY_TRANSPOSED)
+    readColumnBits(dimensions.xClipStart + x, currentY, data, dataBit, rowPixels);
+#else
+    readRowBits(framebuffer + currentY * bytesPerRow, dimensions.xClipStart + x,
+                data, dataBit, rowPixels);
+#endif
+    dataBit += rowPixels;
+
+    x = 0;
+    currentY++;
+  }
+
+  return DMD_OK;
+#endif
 }
 
 EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
@@ -333,10 +495,54 @@ EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
     return DMD_ERROR_DRIVER_NOT_INITIALIZED;
   }
 
+#if (SL_MEMLCD_DISPLAY_LIST)
+  /* Record the run as rectangles: the whole rows of the clipping area in
+     one, the partial first and last rows in one each. */
+  uint32_t pixelData = green ? 0xFFFFFFFF : 0x00000000;
+  int32_t  xStart    = dimensions.xClipStart;
+  int32_t  row       = dimensions.yClipStart + y;
+  int32_t  maxRow    = dimensions.yClipStart + dimensions.clipHeight - 1;
+  uint32_t rowPixels;
+  uint32_t rows;
+  EMSTATUS status;
+
+  while (numPixels) {
+    if (row > maxRow) {
+      return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+    }
+    if (x == 0 && numPixels >= dimensions.clipWidth) {
+      rows = numPixels / dimensions.clipWidth;
+      if (rows > (uint32_t) (maxRow - row + 1)) {
+        rows = maxRow - row + 1;
+      }
+      status = listFill(xStart, row, xStart + dimensions.clipWidth - 1,
+                        row + rows - 1, pixelData);
+      numPixels -= rows * dimensions.clipWidth;
+      row       += rows;
+    } else {
+      rowPixels = numPixels > (uint32_t) (dimensions.clipWidth - x)
+                  ? (uint32_t) (dimensions.clipWidth - x) : numPixels;
+      status = listFill(xStart + x, row, xStart + x + rowPixels - 1, row,
+                        pixelData);
+      numPixels -= rowPixels;
+      row++;
+      x = 0;
+    }
+    if (status != DMD_OK) {
+      return status;
+    }
+  }
+
+  return DMD_OK;
+#else
   unsigned int rowPixels;
+#if (SL_MEMLCD_DISPLAY_RGB_3BIT)
   uint8_t      matrixByte;
+#endif
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
   uint8_t     *pDst;
   int          bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+#endif
   uint8_t      pixelData;
   uint16_t     currentY;
   uint16_t     maxY;
@@ -359,7 +565,9 @@ EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
     /* Adjust x to account for clipping. */
     x += dimensions.xClipStart;
 
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
     pDst = framebuffer + currentY * bytesPerRow;
+#endif
 
 #if (SL_MEMLCD_DISPLAY_RGB_3BIT) /* RGB display */
 
@@ -411,61 +619,23 @@ EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
       }
       pixelBit = pixelBit % 8; /* Truncate pixel index for next byte */
     }
-#else /* Monochrome display */
+#elif (SL_MEMLCD_DISPLAY_TRANSPOSED)
     pixelData = green ? 0xFF : 0x00;
 
-    /* Write pixel data to the pixelMatrix buffer. */
-    if (rowPixels < 8) {
-      rowPixels += x;
-      if (pixelData) {
-        for (; x < rowPixels; x++) {
-          pDst[x >> 3] |= 1 << (x & 0x7);
-        }
-      } else {
-        for (; x < rowPixels; x++) {
-          pDst[x >> 3] &= ~(1 << (x & 0x7));
-        }
-      }
-    } else {
-      int byteOffset = x & 0x7;
-      uint8_t pixelMask;
-
-      pDst += x >> 3;
-
-      if (byteOffset) {
-        /* Copy the pixels into first byte of the pixelMatrix buffer. */
-        pixelMask = (1 << byteOffset) - 1;
-        matrixByte = (*pDst & pixelMask)
-                     | (pixelData & ~pixelMask);
-        *pDst = matrixByte;
-        pDst++;
-        rowPixels -= 8 - byteOffset;
-      }
-
-      /* Now, remaining pixels start is 8-bit aligned. Copy the corresponding
-         number of bytes, then if there are remaining bits, copy them correctly
-         into the last byte. */
-      int numBytesToCopy = rowPixels >> 3;
-
-      if (numBytesToCopy) {
-        /* We can copy data continuosly from start to end. */
-        memset(pDst, pixelData, numBytesToCopy);
-        rowPixels  -= numBytesToCopy << 3;
-        pDst       += numBytesToCopy;
-      }
+    /* Rotated by 90 or 270 degrees: fill a column of the framebuffer. */
+    writeColumnBits(x, currentY, NULL, 0, pixelData ? 0xFFFFFFFF : 0x00000000,
+                    rowPixels);
+#else /* Monochrome display */
+    pixelData = green ? 0xFF : 0x00;
 
-      /* Copy any remaining bits to the framebuffer. */
-      if (rowPixels) {
-        pixelMask = (1 << rowPixels) - 1;
-        matrixByte = (*pDst & ~pixelMask)
-                     | (pixelData & pixelMask);
-        *pDst = matrixByte;
-      }
-    }
+    /* Fill the row a 32-bit word at a time. */
+    fillRowBits(pDst, x, rowPixels, pixelData ? 0xFFFFFFFF : 0x00000000);
 #endif
 
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
     /* Mark row/line as dirty */
     setLineDirty(currentY);
+#endif
 
     /* Update variable for next row/line. */
     x = 0;
@@ -473,6 +643,202 @@ EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
   }
 
   return DMD_OK;
+#endif
+}
+
+EMSTATUS DMD_writeRowMask(int32_t x, int32_t y, uint32_t pixels, uint32_t mask)
+{
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+#if (SL_MEMLCD_DISPLAY_RGB_3BIT)
+  (void) x;       /* Suppress compiler warning: unused parameter. */
+  (void) y;       /* Suppress compiler warning: unused parameter. */
+  (void) pixels;  /* Suppress compiler warning: unused parameter. */
+  (void) mask;    /* Suppress compiler warning: unused parameter. */
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#else
+  int32_t  xEnd = dimensions.xClipStart + dimensions.clipWidth;
+
+  if (y < dimensions.yClipStart
+      || y >= dimensions.yClipStart + dimensions.clipHeight) {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+
+  /* Drop the pixels left of the clipping area... */
+  if (x < dimensions.xClipStart) {
+    int32_t skip = dimensions.xClipStart - x;
+    if (skip >= 32) {
+      return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+    }
+    mask   >>= skip;
+    pixels >>= skip;
+    x       += skip;
+  }
+
+  /* ...and right of it. */
+  if (x >= xEnd) {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+  if (xEnd - x < 32) {
+    mask &= (1u << (xEnd - x)) - 1;
+  }
+  if (mask == 0) {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+
+#if (SL_MEMLCD_DISPLAY_LIST)
+  return listRowMask(x, y, pixels & mask, mask);
+#elif (SL_MEMLCD_DISPLAY_TRANSPOSED)
+  /* Rotated by 90 or 270 degrees: one framebuffer row per pixel. */
+  for (; mask; mask >>= 1, pixels >>= 1, x++) {
+    if (mask & 1) {
+      writeColumnBits(x, y, NULL, 0, (pixels & 1) ? 0xFFFFFFFF : 0, 1);
+    }
+  }
+  return DMD_OK;
+#else
+  mergeRowBits(framebuffer + y * ((SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8),
+               x, pixels, mask);
+
+  /* Mark row/line as dirty */
+  setLineDirty(y);
+
+  return DMD_OK;
+#endif
+#endif
+}
+
+EMSTATUS DMD_fillSpans(const DMD_Span *spans, uint32_t numSpans,
+                       uint8_t red, uint8_t green, uint8_t blue)
+{
+  (void) red;     /* Suppress compiler warning: unused parameter. */
+  (void) blue;    /* Suppress compiler warning: unused parameter. */
+
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+#if (SL_MEMLCD_DISPLAY_RGB_3BIT)
+  (void) spans;     /* Suppress compiler warning: unused parameter. */
+  (void) numSpans;  /* Suppress compiler warning: unused parameter. */
+  (void) green;     /* Suppress compiler warning: unused parameter. */
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#else
+  int       bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+  int32_t   xMin = dimensions.xClipStart;
+  int32_t   xMax = dimensions.xClipStart + dimensions.clipWidth - 1;
+  int32_t   yMin = dimensions.yClipStart;
+  int32_t   yMax = dimensions.yClipStart + dimensions.clipHeight - 1;
+  uint32_t  pixelData = green ? 0xFFFFFFFF : 0x00000000;
+  uint32_t  drawn = 0;
+  int32_t   x0, x1;
+
+  for (; numSpans; numSpans--, spans++) {
+    if (spans->y < yMin || spans->y > yMax) {
+      continue;
+    }
+    if (spans->x0 <= spans->x1) {
+      x0 = spans->x0;
+      x1 = spans->x1;
+    } else {
+      x0 = spans->x1;
+      x1 = spans->x0;
+    }
+    if (x0 > xMax || x1 < xMin) {
+      continue;
+    }
+    x0 = (x0 < xMin) ? xMin : x0;
+    x1 = (x1 > xMax) ? xMax : x1;
+
+#if (SL_MEMLCD_DISPLAY_LIST)
+    (void) bytesPerRow;  /* Suppress compiler warning: unused variable. */
+    EMSTATUS status = listSpan(spans->y, x0, x1, pixelData);
+    if (status != DMD_OK) {
+      return status;
+    }
+#elif (SL_MEMLCD_DISPLAY_TRANSPOSED)
+    (void) bytesPerRow;  /* Suppress compiler warning: unused variable. */
+    writeColumnBits(x0, spans->y, NULL, 0, pixelData, x1 - x0 + 1);
+#else
+    fillRowBits(framebuffer + spans->y * bytesPerRow, x0, x1 - x0 + 1, pixelData);
+
+    /* Mark row/line as dirty */
+    setLineDirty(spans->y);
+#endif
+    drawn++;
+  }
+
+  return (drawn == 0) ? DMD_ERROR_PIXEL_OUT_OF_BOUNDS : DMD_OK;
+#endif
+}
+
+EMSTATUS DMD_scrollLeft(int32_t x, int32_t y, int32_t width, int32_t height,
+                        uint32_t shift)
+{
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+#if (SL_MEMLCD_DISPLAY_RGB_3BIT)
+  (void) x;       /* Suppress compiler warning: unused parameter. */
+  (void) y;       /* Suppress compiler warning: unused parameter. */
+  (void) width;   /* Suppress compiler warning: unused parameter. */
+  (void) height;  /* Suppress compiler warning: unused parameter. */
+  (void) shift;   /* Suppress compiler warning: unused parameter. */
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#else
+  int      bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+  int32_t  x1 = x + width - 1;
+  int32_t  y1 = y + height - 1;
+  int32_t  row;
+
+  if (shift == 0 || shift > 31) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+
+  /* Clip against the clipping area */
+  if (x < dimensions.xClipStart) {
+    x = dimensions.xClipStart;
+  }
+  if (x1 > dimensions.xClipStart + dimensions.clipWidth - 1) {
+    x1 = dimensions.xClipStart + dimensions.clipWidth - 1;
+  }
+  if (y < dimensions.yClipStart) {
+    y = dimensions.yClipStart;
+  }
+  if (y1 > dimensions.yClipStart + dimensions.clipHeight - 1) {
+    y1 = dimensions.yClipStart + dimensions.clipHeight - 1;
+  }
+  if (x1 - x + 1 <= (int32_t) shift || y > y1) {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+
+#if (SL_MEMLCD_DISPLAY_LIST)
+  (void) bytesPerRow;  /* Suppress compiler warning: unused variable. */
+  (void) row;          /* Suppress compiler warning: unused variable. */
+
+  return listScroll(x, y, x1, y1, shift);
+#else
+  for (row = y; row <= y1; row++) {
+#if (SL_MEMLCD_DISPLAY_TRANSPOSED)
+    (void) bytesPerRow;  /* Suppress compiler warning: unused variable. */
+    shiftColumnBits(x, row, x1 - x + 1 - shift, shift);
+#else
+    shiftRowBits(framebuffer + row * bytesPerRow, x, x1 - x + 1 - shift, shift);
+
+    /* Mark row/line as dirty */
+    setLineDirty(row);
+#endif
+  }
+
+  return DMD_OK;
+#endif
+#endif
 }
 
 EMSTATUS DMD_sleep(void)
@@ -481,7 +847,7 @@ EMSTATUS DMD_sleep(void)
     return DMD_ERROR_DRIVER_NOT_INITIALIZED;
   }
 
-  return sl_memlcd_power_on(memlcd, false);
+  return lcd_power_on(memlcd, false);
 }
 
 EMSTATUS DMD_wakeUp(void)
@@ -490,112 +856,1577 @@ EMSTATUS DMD_wakeUp(void)
     return DMD_ERROR_DRIVER_NOT_INITIALIZED;
   }
 
-  return sl_memlcd_power_on(memlcd, true);
+  return lcd_power_on(memlcd, true);
 }
 
 EMSTATUS DMD_flipDisplay(int horizontal, int vertical)
 {
+  /* The orientation is chosen at compile time, see lcd_display.h. Only the
+     configured one can be "selected". */
+#if (SL_MEMLCD_DISPLAY_TRANSPOSED)
   (void) horizontal;    /* Suppress compiler warning: unused parameter. */
   (void) vertical;      /* Suppress compiler warning: unused parameter. */
 
   return DMD_ERROR_NOT_SUPPORTED;
+#else
+  if ((horizontal != 0) != SL_MEMLCD_DISPLAY_REVERSE_PIXELS
+      || (vertical != 0) != SL_MEMLCD_DISPLAY_REVERSE_ROWS) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+
+  return DMD_OK;
+#endif
+}
+
+EMSTATUS DMD_setRasterOp(DMD_RasterOp op)
+{
+  if (op > DMD_RASTER_OP_XOR) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+#if (SL_MEMLCD_DISPLAY_RGB_3BIT)
+  if (op != DMD_RASTER_OP_COPY) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+#endif
+
+  rasterOp = op;
+  return DMD_OK;
+}
+
+EMSTATUS DMD_setFramebufferPool(void *pool, uint32_t size)
+{
+#if (SL_MEMLCD_DISPLAY_LIST)
+  (void) pool;  /* Suppress compiler warning: unused parameter. */
+  (void) size;  /* Suppress compiler warning: unused parameter. */
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#else
+  uintptr_t padding;
+
+  if (framebufferPoolUsed != 0) {
+    return DMD_ERROR_BUSY;
+  }
+
+  framebufferPool      = NULL;
+  framebufferPoolCount = 0;
+  if (pool == NULL) {
+    return DMD_OK;
+  }
+
+  /* The framebuffers are accessed a word at a time */
+  padding = (4 - ((uintptr_t) pool & 0x3)) & 0x3;
+  if (size < padding + sizeof(defaultFramebuffer)) {
+    return DMD_ERROR_NOT_ENOUGH_MEMORY;
+  }
+
+  framebufferPool      = (uint8_t *) pool + padding;
+  framebufferPoolCount = (size - padding) / sizeof(defaultFramebuffer);
+  if (framebufferPoolCount > FRAMEBUFFER_POOL_MAX) {
+    framebufferPoolCount = FRAMEBUFFER_POOL_MAX;
+  }
+
+  return DMD_OK;
+#endif
+}
+
+EMSTATUS DMD_allocateFramebuffer(void **fb)
+{
+#if (SL_MEMLCD_DISPLAY_LIST)
+  *fb = NULL;
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#else
+  uint32_t i;
+
+  for (i = 0; i < framebufferPoolCount; i++) {
+    if (!(framebufferPoolUsed & (1u << i))) {
+      framebufferPoolUsed |= 1u << i;
+      *fb = framebufferPool + i * sizeof(defaultFramebuffer);
+
+      /* Start out like a cleared display */
+      memset(*fb, 0xFF, sizeof(defaultFramebuffer));
+      return DMD_OK;
+    }
+  }
+
+  return DMD_ERROR_NOT_ENOUGH_MEMORY;
+#endif
 }
 
 /***************************************************************************//**
  *  @brief
  *    Deallocate a framebuffer
  *
- *  @param framebuffer
+ *  @param fb
  *    Pointer to the framebuffer to be deallocated.
  *
  *  @return
  *    Returns DMD_OK if successful, error otherwise.
  ******************************************************************************/
-EMSTATUS DMD_freeFramebuffer(void *framebuffer)
+EMSTATUS DMD_freeFramebuffer(void *fb)
 {
-  (void) framebuffer;
-  /* Unsupported operation */
+#if (SL_MEMLCD_DISPLAY_LIST)
+  (void) fb;  /* Suppress compiler warning: unused parameter. */
+
   return DMD_ERROR_NOT_SUPPORTED;
+#else
+  int index = framebufferPoolIndex(fb);
+
+  if (index < 0) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+  if (fb == framebuffer) {
+    return DMD_ERROR_BUSY;
+  }
+  /* Its flags would not match a later framebuffer at the same address */
+  if (fb == shownFramebuffer) {
+    shownFramebuffer = NULL;
+  }
+
+  framebufferPoolUsed &= ~(1u << index);
+
+  return DMD_OK;
+#endif
 }
 
-EMSTATUS DMD_selectFramebuffer(void *framebuffer)
+EMSTATUS DMD_selectFramebuffer(void *fb)
 {
-  (void) framebuffer;
+#if (SL_MEMLCD_DISPLAY_LIST)
+  (void) fb;  /* Suppress compiler warning: unused parameter. */
+
   return DMD_ERROR_NOT_SUPPORTED;
+#else
+  if (fb != defaultFramebuffer && framebufferPoolIndex(fb) < 0) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+  if (fb == framebuffer) {
+    return DMD_OK;
+  }
+
+  /* Only the pointer changes. Drawing in another framebuffer and coming
+     back to the shown one keeps the rows dirtied in it since the last
+     update. Any other framebuffer may differ anywhere from the display: the
+     next update compares every row and sends the ones that differ. */
+  if (framebuffer == shownFramebuffer) {
+    memcpy(shownDirtyRows, dirtyRows, sizeof(dirtyRows));
+  }
+  framebuffer = fb;
+  if (framebuffer == shownFramebuffer) {
+    memcpy(dirtyRows, shownDirtyRows, sizeof(dirtyRows));
+  } else {
+    memset(dirtyRows, 0xFF, sizeof(dirtyRows));
+  }
+
+  return DMD_OK;
+#endif
 }
 
+#if (SL_MEMLCD_DISPLAY_LIST)
 EMSTATUS DMD_updateDisplay(void)
 {
   sl_status_t   status;
+  unsigned int  bandStart;
+  unsigned int  bandEnd;
   unsigned int  startRow;
-  unsigned int  consecutiveDirtyRows;
-  uint8_t      *pStartRow;
+  unsigned int  row;
   int           bytesPerRow  = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
-  uint32_t      dirtyFlags   = dirtyRows[0];
-  int           dirtyWordCnt = 1;
 
-  startRow             = 0;
-  consecutiveDirtyRows = 0;
-
-  while (startRow + consecutiveDirtyRows < memlcd->height) {
-    if (dirtyFlags & 0x1) {
-      consecutiveDirtyRows++;
-    } else {
-      if (consecutiveDirtyRows) {
-        /* We have reached the end of a series of consecutive dirty rows,
-           update display now. */
-        pStartRow = (uint8_t*) framebuffer + startRow * bytesPerRow;
-        status = lcd_tx(memlcd, pStartRow, startRow, consecutiveDirtyRows);
-        if (status != SL_STATUS_OK) {
-          return DMD_ERROR_MEMORY_ERROR;
-        }
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
 
-        startRow += consecutiveDirtyRows + 1;
-        consecutiveDirtyRows = 0;
-      } else {
-        startRow++;
-      }
+  for (bandStart = 0; bandStart < memlcd->height; bandStart = bandEnd) {
+    bandEnd = bandStart + SL_MEMLCD_DISPLAY_LIST_BAND_ROWS;
+    if (bandEnd > memlcd->height) {
+      bandEnd = memlcd->height;
     }
 
-    /* Shift down dirtyFlags until
-       all dirtyFlags in the current dirty word have been checked,
-       then set to next dirty word.  */
-    if ( (startRow + consecutiveDirtyRows) & DIRTY_WORD_BITS_LOG2_MASK ) {
-      dirtyFlags >>= 1;
-    } else {
-      dirtyFlags = dirtyRows[dirtyWordCnt++];
+    /* Only render the bands with a row drawn since the last update */
+    for (row = bandStart; row < bandEnd && !isLineDirty(row); row++) {
     }
-  }
+    if (row == bandEnd) {
+      continue;
+    }
+    renderBand(bandStart, bandEnd - bandStart);
+    listStats.bandsRendered++;
+
+    /* Send each series of consecutive dirty rows of the band to the display
+       as one multi-line burst. */
+    while (row < bandEnd) {
+      for (startRow = row; row < bandEnd && isLineDirty(row); row++) {
+        dirtyRows[row >> DIRTY_WORD_BITS_LOG2] &= ~(1u << (row & DIRTY_WORD_BITS_LOG2_MASK));
+      }
+      updateStats.rowsDirty += row - startRow;
+
+      status = lcd_tx(memlcd, bandBuffer + (startRow - bandStart) * bytesPerRow,
+                      startRow, row - startRow);
+      if (status != SL_STATUS_OK) {
+        /* Keep the rows that were not sent dirty */
+        for (; startRow < row; startRow++) {
+          setLineDirty(startRow);
+        }
+        return DMD_ERROR_MEMORY_ERROR;
+      }
+      updateStats.rowsSent += row - startRow;
 
-  /* Check if there dirty rows at end that have not been written yet. */
-  if (consecutiveDirtyRows) {
-    pStartRow = (uint8_t*) framebuffer + startRow * bytesPerRow;
-    status = lcd_tx(memlcd, pStartRow, startRow, consecutiveDirtyRows);
-    if (status != SL_STATUS_OK) {
-      return DMD_ERROR_MEMORY_ERROR;
+      for (; row < bandEnd && !isLineDirty(row); row++) {
+      }
     }
   }
 
-  /* Clear dirty rows flags. */
-  memset(dirtyRows, 0x0, sizeof(dirtyRows));
+  return DMD_OK;
+}
+
+EMSTATUS DMD_updateDisplayAsync(DMD_UpdateCallback_t callback, void *context)
+{
+  EMSTATUS status;
+
+  /* The band buffer is reused for every band, so the update is done before
+     returning. */
+  status = DMD_updateDisplay();
+  if (status == DMD_OK && callback != NULL) {
+    callback(context);
+  }
+
+  return status;
+}
+#else
+EMSTATUS DMD_updateDisplay(void)
+{
+  sl_status_t   status;
+  uint8_t       rows[SL_MEMLCD_DISPLAY_HEIGHT];
+  unsigned int  rowCount;
+  unsigned int  startRow;
+  unsigned int  consecutiveRows;
+  unsigned int  i;
+  uint8_t      *pStartRow;
+  int           bytesPerRow  = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  rowCount = collectChangedRows(rows);
+
+  for (i = 0; i < rowCount; i += consecutiveRows) {
+    /* Send each series of consecutive changed rows to the display as one
+       multi-line burst. */
+    startRow        = rows[i];
+    consecutiveRows = 1;
+    while (i + consecutiveRows < rowCount
+           && rows[i + consecutiveRows] == startRow + consecutiveRows) {
+      consecutiveRows++;
+    }
+
+    pStartRow = (uint8_t*) framebuffer + startRow * bytesPerRow;
+    status = lcd_tx(memlcd, pStartRow, startRow, consecutiveRows);
+    if (status != SL_STATUS_OK) {
+      /* Keep the rows that were not sent dirty */
+      for (; i < rowCount; i++) {
+        setLineDirty(rows[i]);
+      }
+      return DMD_ERROR_MEMORY_ERROR;
+    }
+    commitRows(&rows[i], consecutiveRows);
+  }
+
+  return DMD_OK;
+}
+
+EMSTATUS DMD_updateDisplayAsync(DMD_UpdateCallback_t callback, void *context)
+{
+  sl_status_t  status;
+  uint8_t      rows[SL_MEMLCD_DISPLAY_HEIGHT];
+  unsigned int rowCount;
+  unsigned int i;
+
+  if (memlcd == NULL) {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  if (updateInProgress) {
+    return DMD_ERROR_BUSY;
+  }
+
+  /* List the changed rows and hand them over to the transfer */
+  rowCount = collectChangedRows(rows);
+
+  if (rowCount == 0) {
+    if (callback != NULL) {
+      callback(context);
+    }
+    return DMD_OK;
+  }
+
+  updateCallback   = callback;
+  updateContext    = context;
+  updateInProgress = true;
+
+  status = lcd_tx_async(memlcd, framebuffer, rows, rowCount, txBuffer,
+                        updateDone, NULL);
+  if (status != SL_STATUS_OK) {
+    /* Nothing was sent, keep the rows dirty */
+    updateInProgress = false;
+    for (i = 0; i < rowCount; i++) {
+      setLineDirty(rows[i]);
+    }
+    return (status == SL_STATUS_BUSY) ? DMD_ERROR_BUSY : DMD_ERROR_MEMORY_ERROR;
+  }
+
+  /* The transfer buffer holds the rows now, so this is what the panel gets */
+  commitRows(rows, rowCount);
+
+  return DMD_OK;
+}
+#endif
+
+EMSTATUS DMD_getUpdateStats(DMD_UpdateStats *stats)
+{
+  *stats = updateStats;
+
+  return DMD_OK;
+}
+
+EMSTATUS DMD_resetUpdateStats(void)
+{
+  memset(&updateStats, 0, sizeof(updateStats));
+#if (SL_MEMLCD_DISPLAY_LIST)
+  listStats.bandsRendered = 0;
+  listStats.overflows     = 0;
+#endif
 
   return DMD_OK;
 }
 
+EMSTATUS DMD_getDisplayListStats(DMD_DisplayListStats *stats)
+{
+#if (SL_MEMLCD_DISPLAY_LIST)
+  *stats = listStats;
+  stats->bytesUsed = listUsed;
+
+  return DMD_OK;
+#else
+  (void) stats;  /* Suppress compiler warning: unused parameter. */
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#endif
+}
+
 EMSTATUS DMD_getFrameBuffer(void **fb)
 {
+#if (SL_MEMLCD_DISPLAY_LIST)
+  /* The pixels only exist one band at a time, during DMD_updateDisplay() */
+  *fb = NULL;
+
+  return DMD_ERROR_NOT_SUPPORTED;
+#else
   *fb = framebuffer;
 
   return DMD_OK;
+#endif
 }
 
+#if !(SL_MEMLCD_DISPLAY_LIST)
+/***************************************************************************//**
+ * @brief
+ *   Return the index in the pool of an allocated framebuffer, or -1 if fb is
+ *   not one.
+ ******************************************************************************/
+static int framebufferPoolIndex(const void *fb)
+{
+  uint32_t offset;
+
+  if (framebufferPool == NULL || (const uint8_t *) fb < framebufferPool) {
+    return -1;
+  }
+  offset = (uint32_t) ((const uint8_t *) fb - framebufferPool);
+  if (offset % sizeof(defaultFramebuffer) != 0
+      || offset / sizeof(defaultFramebuffer) >= framebufferPoolCount
+      || !(framebufferPoolUsed & (1u << (offset / sizeof(defaultFramebuffer))))) {
+    return -1;
+  }
+
+  return (int) (offset / sizeof(defaultFramebuffer));
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Mark the line as dirty.
  ******************************************************************************/
 static void setLineDirty(int line)
 {
-  dirtyRows[line >> DIRTY_WORD_BITS_LOG2] |= 1 << (line & DIRTY_WORD_BITS_LOG2_MASK);
+  dirtyRows[line >> DIRTY_WORD_BITS_LOG2] |= 1u << (line & DIRTY_WORD_BITS_LOG2_MASK);
+}
+
+#if !(SL_MEMLCD_DISPLAY_RGB_3BIT)
+#if !(SL_MEMLCD_DISPLAY_TRANSPOSED)
+/***************************************************************************//**
+ * @brief
+ *   Copy a run of pixels into a row of the framebuffer.
+ *
+ * @details
+ *   The rows of the framebuffer are word aligned and, on this little-endian
+ *   target, pixel x of a row is bit (x & 31) of word (x >> 5). The source bits
+ *   are gathered in a 64-bit funnel, refilled a word at a time, and shifted
+ *   into place so that every destination word is written once. Only the head
+ *   and tail words are merged with a mask. When source and destination have
+ *   the same bit position within a byte, the whole bytes are copied with
+ *   memcpy() instead. Raster operations other than DMD_RASTER_OP_COPY always
+ *   take the funnel path and combine each word with the framebuffer.
+ *
+ * @param pRow
+ *   First byte of the framebuffer row.
+ *
+ * @param x
+ *   First pixel of the run on the row.
+ *
+ * @param data
+ *   Source pixel data, bit i of byte n is pixel 8 * n + i.
+ *
+ * @param dataBit
+ *   Index in data of the bit holding the first pixel of the run.
+ *
+ * @param numPixels
+ *   Length of the run. The source is never read past its last pixel.
+ ******************************************************************************/
+static void copyRowBits(uint8_t *pRow, unsigned int x, const uint8_t *data,
+                        uint32_t dataBit, unsigned int numPixels)
+{
+  uint32_t      *pDst = (uint32_t *) pRow + (x >> 5);
+  const uint8_t *pSrc = data + (dataBit >> 3);
+  unsigned int   srcBytes;
+  unsigned int   remaining;
+  int            funnelBits;
+  uint64_t       funnel;
+  uint32_t       mask;
+  uint32_t       word;
+
+  if (numPixels == 0) {
+    return;
+  }
+
+  /* Same bit position within a byte: merge the head byte, memcpy the middle
+     and merge the tail byte. */
+  if ((x & 0x7) == (dataBit & 0x7) && rasterOp == DMD_RASTER_OP_COPY) {
+    uint8_t *pDstByte = pRow + (x >> 3);
+    uint8_t  byteMask = 0xFF << (x & 0x7);
+
+    if ((x & 0x7) + numPixels < 8) {
+      byteMask &= 0xFF >> (8 - (x & 0x7) - numPixels);
+    }
+    if (byteMask != 0xFF) {
+      *pDstByte  = (*pDstByte & ~byteMask) | (*pSrc & byteMask);
+      numPixels -= (numPixels < 8u - (x & 0x7)) ? numPixels : 8u - (x & 0x7);
+      pDstByte++;
+      pSrc++;
+    }
+    memcpy(pDstByte, pSrc, numPixels >> 3);
+    if (numPixels & 0x7) {
+      byteMask = 0xFF >> (8 - (numPixels & 0x7));
+      pDstByte += numPixels >> 3;
+      pSrc     += numPixels >> 3;
+      *pDstByte = (*pDstByte & ~byteMask) | (*pSrc & byteMask);
+    }
+    return;
+  }
+
+  /* Bytes of data holding the run */
+  srcBytes = ((dataBit & 0x7) + numPixels + 7) >> 3;
+
+  /* Prime the funnel with the first source byte and place its first pixel
+     at the bit position of x in the first destination word. */
+  funnel     = (uint64_t) (*pSrc++ >> (dataBit & 0x7)) << (x & 0x1F);
+  funnelBits = 8 - (dataBit & 0x7) + (x & 0x1F);
+  srcBytes--;
+
+  remaining = numPixels + (x & 0x1F);
+  mask      = 0xFFFFFFFF << (x & 0x1F);
+
+  while (remaining) {
+    /* Refill the funnel up to at least 32 bits */
+    while (funnelBits < 32 && srcBytes) {
+      if (srcBytes >= 4) {
+        memcpy(&word, pSrc, sizeof(word));
+        funnel     |= (uint64_t) word << funnelBits;
+        funnelBits += 32;
+        pSrc       += 4;
+        srcBytes   -= 4;
+      } else {
+        funnel     |= (uint64_t) *pSrc++ << funnelBits;
+        funnelBits += 8;
+        srcBytes--;
+      }
+    }
+
+    if (remaining < 32) {
+      mask &= 0xFFFFFFFF >> (32 - remaining);
+      remaining = 32;
+    }
+    word  = (uint32_t) funnel;
+    if (rasterOp != DMD_RASTER_OP_COPY) {
+      word = rasterOpWord(*pDst, word);
+    }
+    *pDst = (mask == 0xFFFFFFFF) ? word : ((*pDst & ~mask) | (word & mask));
+    pDst++;
+
+    funnel    >>= 32;
+    funnelBits -= 32;
+    remaining  -= 32;
+    mask        = 0xFFFFFFFF;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Fill a run of pixels of a row of the framebuffer, a word at a time.
+ *
+ * @param pixelData
+ *   0xFFFFFFFF for white, 0 for black.
+ ******************************************************************************/
+static void fillRowBits(uint8_t *pRow, unsigned int x, unsigned int numPixels,
+                        uint32_t pixelData)
+{
+  uint32_t     *pDst = (uint32_t *) pRow;
+  unsigned int  i    = x >> 5;
+  unsigned int  lastWord;
+  uint32_t      firstMask, lastMask;
+
+  if (numPixels == 0) {
+    return;
+  }
+
+  lastWord  = (x + numPixels - 1) >> 5;
+  firstMask = 0xFFFFFFFF << (x & 0x1F);
+  lastMask  = 0xFFFFFFFF >> (0x1F - ((x + numPixels - 1) & 0x1F));
+
+  if (rasterOp != DMD_RASTER_OP_COPY) {
+    /* OR, AND NOT and XOR with black leave the pixels as they are. */
+    if (pixelData == 0) {
+      return;
+    }
+    for (; i <= lastWord; i++) {
+      uint32_t mask = (i == lastWord) ? (firstMask & lastMask) : firstMask;
+      pDst[i]  ^= (pDst[i] ^ rasterOpWord(pDst[i], pixelData)) & mask;
+      firstMask = 0xFFFFFFFF;
+    }
+    return;
+  }
+
+  if (i == lastWord) {
+    firstMask &= lastMask;
+  } else {
+    pDst[i] = (pDst[i] & ~firstMask) | (pixelData & firstMask);
+    for (i++; i < lastWord; i++) {
+      pDst[i] = pixelData;
+    }
+    firstMask = lastMask;
+  }
+  pDst[i] = (pDst[i] & ~firstMask) | (pixelData & firstMask);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Move a run of pixels of a row of the framebuffer left, a word at a time.
+ *
+ * @details
+ *   Pixel x + i takes the value of pixel x + i + shift, for i below numPixels.
+ *   The words are processed in increasing order, so the next word still holds
+ *   its old pixels when its low bits are carried into the current one. Words
+ *   past the last source pixel are never read.
+ *
+ * @param shift
+ *   Number of pixels to move by, 1 to 31.
+ ******************************************************************************/
+static void shiftRowBits(uint8_t *pRow, unsigned int x, unsigned int numPixels,
+                         unsigned int shift)
+{
+  uint32_t     *pDst = (uint32_t *) pRow;
+  unsigned int  i    = x >> 5;
+  unsigned int  lastWord;
+  unsigned int  lastSrcWord;
+  uint32_t      mask, lastMask;
+  uint32_t      word;
+
+  if (numPixels == 0) {
+    return;
+  }
+
+  lastWord    = (x + numPixels - 1) >> 5;
+  lastSrcWord = (x + numPixels - 1 + shift) >> 5;
+  mask        = 0xFFFFFFFF << (x & 0x1F);
+  lastMask    = 0xFFFFFFFF >> (0x1F - ((x + numPixels - 1) & 0x1F));
+
+  for (; i <= lastWord; i++) {
+    word = pDst[i] >> shift;
+    if (i < lastSrcWord) {
+      word |= pDst[i + 1] << (32 - shift);
+    }
+    if (i == lastWord) {
+      mask &= lastMask;
+    }
+    pDst[i] = (mask == 0xFFFFFFFF) ? word : ((pDst[i] & ~mask) | (word & mask));
+    mask    = 0xFFFFFFFF;
+  }
+}
+
+#if !(SL_MEMLCD_DISPLAY_LIST)
+/***************************************************************************//**
+ * @brief
+ *   Read a run of pixels of a row of the framebuffer into a bit array.
+ *
+ * @details
+ *   Up to 32 pixels are fetched at a time from one or two framebuffer words
+ *   and merged into the bytes of data. Words past the end of the row are
+ *   never read.
+ *
+ * @param data
+ *   Destination pixel data, bit i of byte n is pixel 8 * n + i.
+ *
+ * @param dataBit
+ *   Index in data of the bit receiving the first pixel of the run.
+ ******************************************************************************/
+static void readRowBits(const uint8_t *pRow, unsigned int x, uint8_t *data,
+                        uint32_t dataBit, unsigned int numPixels)
+{
+  const uint32_t *pSrc     = (const uint32_t *) pRow;
+  unsigned int    lastWord = (SL_MEMLCD_DISPLAY_WIDTH - 1) >> 5;
+  unsigned int    n;
+  uint64_t        bits;
+  uint64_t        mask;
+  uint8_t        *pDst;
+
+  while (numPixels) {
+    n    = (numPixels < 32) ? numPixels : 32;
+    bits = pSrc[x >> 5] >> (x & 0x1F);
+    if ((x & 0x1F) && (x >> 5) < lastWord) {
+      bits |= (uint64_t) pSrc[(x >> 5) + 1] << (32 - (x & 0x1F));
+    }
+    mask = (((uint64_t) 1 << n) - 1) << (dataBit & 0x7);
+    bits = bits << (dataBit & 0x7);
+
+    pDst = data + (dataBit >> 3);
+    while (mask) {
+      *pDst = (*pDst & ~(uint8_t) mask) | ((uint8_t) bits & (uint8_t) mask);
+      pDst++;
+      mask >>= 8;
+      bits >>= 8;
+    }
+
+    x         += n;
+    dataBit   += n;
+    numPixels -= n;
+  }
+}
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Merge a run of up to 32 pixels into a row of the framebuffer.
+ *
+ * @details
+ *   The run covers at most 5 bytes of the row, they are merged one at a
+ *   time with the current raster operation.
+ *
+ * @param pixels
+ *   Pixel x + i of the run is bit i.
+ *
+ * @param mask
+ *   Only the pixels whose bit is set are modified, none right of the row.
+ ******************************************************************************/
+static void mergeRowBits(uint8_t *pRow, int32_t x, uint32_t pixels,
+                         uint32_t mask)
+{
+  uint8_t *pDst       = pRow + (x >> 3);
+  uint64_t wideMask   = (uint64_t) mask << (x & 0x7);
+  uint64_t widePixels = (uint64_t) pixels << (x & 0x7);
+
+  while (wideMask) {
+    uint8_t byteMask = (uint8_t) wideMask;
+    uint8_t value    = (uint8_t) widePixels;
+    if (rasterOp != DMD_RASTER_OP_COPY) {
+      value = (uint8_t) rasterOpWord(*pDst, value);
+    }
+    *pDst = (*pDst & ~byteMask) | (value & byteMask);
+    pDst++;
+    wideMask   >>= 8;
+    widePixels >>= 8;
+  }
+}
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Combine framebuffer pixels with source pixels using the current raster
+ *   operation.
+ ******************************************************************************/
+static uint32_t rasterOpWord(uint32_t pixels, uint32_t source)
+{
+  switch (rasterOp) {
+    case DMD_RASTER_OP_OR:
+      return pixels | source;
+    case DMD_RASTER_OP_AND_NOT:
+      return pixels & ~source;
+    case DMD_RASTER_OP_XOR:
+      return pixels ^ source;
+    default:
+      return source;
+  }
+}
+
+#if (SL_MEMLCD_DISPLAY_TRANSPOSED)
+/***************************************************************************//**
+ * @brief
+ *   Write a run of pixels of a row of the image into the transposed
+ *   framebuffer.
+ *
+ * @details
+ *   Image pixel (x, y) is bit (y & 7) of byte (y >> 3) of framebuffer row x,
+ *   so every pixel of the run is on its own framebuffer row. The rows are
+ *   marked dirty here.
+ *
+ * @param data
+ *   Source pixel data, bit i of byte n is pixel 8 * n + i, or NULL to fill
+ *   the run with pixelData.
+ *
+ * @param pixelData
+ *   0xFFFFFFFF for white, 0 for black. Only used when data is NULL.
+ ******************************************************************************/
+static void writeColumnBits(unsigned int x, unsigned int y, const uint8_t *data,
+                            uint32_t dataBit, uint32_t pixelData,
+                            unsigned int numPixels)
+{
+  int      bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+  uint8_t *pDst        = framebuffer + x * bytesPerRow + (y >> 3);
+  uint8_t  bit         = 1 << (y & 0x7);
+  uint8_t  value;
+
+  for (; numPixels; numPixels--, dataBit++, pDst += bytesPerRow) {
+    if (data != NULL) {
+      pixelData = ((data[dataBit >> 3] >> (dataBit & 0x7)) & 1) ? 0xFFFFFFFF : 0;
+    }
+    value = (uint8_t) rasterOpWord(*pDst, pixelData);
+    *pDst = (*pDst & ~bit) | (value & bit);
+    setLineDirty(x++);
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Read a run of pixels of a row of the image from the transposed
+ *   framebuffer, see writeColumnBits().
+ ******************************************************************************/
+static void readColumnBits(unsigned int x, unsigned int y, uint8_t *data,
+                           uint32_t dataBit, unsigned int numPixels)
+{
+  int            bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+  const uint8_t *pSrc        = framebuffer + x * bytesPerRow + (y >> 3);
+  uint8_t        dataMask;
+
+  for (; numPixels; numPixels--, dataBit++, pSrc += bytesPerRow) {
+    dataMask = 1 << (dataBit & 0x7);
+    if ((*pSrc >> (y & 0x7)) & 1) {
+      data[dataBit >> 3] |= dataMask;
+    } else {
+      data[dataBit >> 3] &= ~dataMask;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Move a run of pixels of a row of the image left in the transposed
+ *   framebuffer: pixel x + i takes the value of pixel x + i + shift.
+ ******************************************************************************/
+static void shiftColumnBits(unsigned int x, unsigned int y,
+                            unsigned int numPixels, unsigned int shift)
+{
+  int            bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+  uint8_t       *pDst        = framebuffer + x * bytesPerRow + (y >> 3);
+  const uint8_t *pSrc        = pDst + shift * bytesPerRow;
+  uint8_t        bit         = 1 << (y & 0x7);
+
+  for (; numPixels; numPixels--, pDst += bytesPerRow, pSrc += bytesPerRow) {
+    *pDst = (*pDst & ~bit) | (*pSrc & bit);
+    setLineDirty(x++);
+  }
+}
+#endif
+#endif
+
+#if !(SL_MEMLCD_DISPLAY_LIST)
+/***************************************************************************//**
+ * @brief
+ *   List the dirty rows whose content differs from what was last sent to
+ *   the display, and clear all dirty flags.
+ *
+ * @param rows
+ *   Filled with the row numbers, in increasing order.
+ *
+ * @return
+ *   Number of rows listed.
+ ******************************************************************************/
+static unsigned int collectChangedRows(uint8_t *rows)
+{
+  const uint32_t *pRow;
+  const uint32_t *pShadow;
+  unsigned int    rowCount = 0;
+  unsigned int    row;
+  unsigned int    i;
+  int             wordsPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 32;
+
+  for (row = 0; row < memlcd->height; row++) {
+    if (!(dirtyRows[row >> DIRTY_WORD_BITS_LOG2] & (1u << (row & DIRTY_WORD_BITS_LOG2_MASK)))) {
+      continue;
+    }
+    updateStats.rowsDirty++;
+
+    /* Compare the row word by word against the shadow copy */
+    pRow    = (const uint32_t *) framebuffer + row * wordsPerRow;
+    pShadow = (const uint32_t *) shadowFramebuffer + row * wordsPerRow;
+    for (i = 0; i < (unsigned int) wordsPerRow; i++) {
+      if (pRow[i] != pShadow[i]) {
+        rows[rowCount++] = (uint8_t) row;
+        break;
+      }
+    }
+  }
+
+  /* Clear dirty rows flags. */
+  memset(dirtyRows, 0x0, sizeof(dirtyRows));
+  shownFramebuffer = framebuffer;
+
+  return rowCount;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record rows as sent: copy them into the shadow framebuffer.
+ ******************************************************************************/
+static void commitRows(const uint8_t *rows, unsigned int rowCount)
+{
+  unsigned int i;
+  int          bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+
+  for (i = 0; i < rowCount; i++) {
+    memcpy(shadowFramebuffer + rows[i] * bytesPerRow,
+           framebuffer + rows[i] * bytesPerRow, bytesPerRow);
+  }
+  updateStats.rowsSent += rowCount;
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Completion of the transfer started by DMD_updateDisplayAsync().
+ ******************************************************************************/
+static void updateDone(void *context)
+{
+  (void) context;
+
+  updateInProgress = false;
+  if (updateCallback != NULL) {
+    updateCallback(updateContext);
+  }
+}
+
+#else
+/***************************************************************************//**
+ * @brief
+ *   Tell whether the line is dirty.
+ ******************************************************************************/
+static bool isLineDirty(int line)
+{
+  return (dirtyRows[line >> DIRTY_WORD_BITS_LOG2] & (1u << (line & DIRTY_WORD_BITS_LOG2_MASK))) != 0;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Store a display coordinate in a command, little-endian.
+ ******************************************************************************/
+static void putCoord(uint8_t *p, int32_t value)
+{
+  p[0] = (uint8_t) value;
+  p[1] = (uint8_t) (value >> 8);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Read a display coordinate of a command.
+ ******************************************************************************/
+static int32_t getCoord(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Store the low bytes of a mask or of pixels in a command, little-endian.
+ ******************************************************************************/
+static void putBits(uint8_t *p, uint32_t value, unsigned int bytes)
+{
+  unsigned int i;
+
+  for (i = 0; i < bytes; i++) {
+    p[i] = (uint8_t) (value >> (8 * i));
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Read a mask or pixels stored by putBits().
+ ******************************************************************************/
+static uint32_t getBits(const uint8_t *p, unsigned int bytes)
+{
+  uint32_t     value = 0;
+  unsigned int i;
+
+  for (i = 0; i < bytes; i++) {
+    value |= (uint32_t) p[i] << (8 * i);
+  }
+
+  return value;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Grow the last command of the display list.
+ *
+ * @return
+ *   The first added byte, or NULL if the list is full.
+ ******************************************************************************/
+static uint8_t *listExtend(uint32_t size)
+{
+  uint8_t *p;
+
+  if (listUsed + size > sizeof(displayList)) {
+    listStats.overflows++;
+    return NULL;
+  }
+
+  p         = &displayList[listUsed];
+  listUsed += size;
+  if (listUsed > listStats.bytesPeak) {
+    listStats.bytesPeak = listUsed;
+  }
+
+  return p;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Add a command of size bytes at the end of the display list.
+ *
+ * @details
+ *   A DL_RASTER_OP command goes first when the raster operation has changed
+ *   since the previous command. The commands hidden by the previous command
+ *   are removed first, see listCullRows().
+ *
+ * @return
+ *   The first byte of the command, or NULL if the list is full.
+ ******************************************************************************/
+static uint8_t *listReserve(uint32_t size)
+{
+  uint32_t opSize;
+  uint8_t *pCmd;
+
+  listCullRows();
+
+  opSize = (rasterOp != listRasterOp) ? 2 : 0;
+  pCmd   = listExtend(opSize + size);
+  if (pCmd == NULL) {
+    return NULL;
+  }
+
+  if (opSize) {
+    pCmd[0]      = DL_RASTER_OP;
+    pCmd[1]      = (uint8_t) rasterOp;
+    listRasterOp = rasterOp;
+    pCmd        += opSize;
+  }
+  listLast = (uint32_t) (pCmd - displayList);
+
+  return pCmd;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Return the last command of the display list if it has the given type and
+ *   can be grown with the current raster operation, NULL otherwise.
+ ******************************************************************************/
+static uint8_t *listMergeable(uint8_t type)
+{
+  if (listLast >= listUsed || displayList[listLast] != type
+      || rasterOp != listRasterOp) {
+    return NULL;
+  }
+
+  return &displayList[listLast];
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Return the size in bytes of a command of the display list.
+ ******************************************************************************/
+static uint32_t listCommandSize(const uint8_t *pCmd)
+{
+  uint32_t bytes;
+
+  switch (pCmd[0]) {
+    case DL_RASTER_OP:
+      return 2;
+    case DL_SPANS:
+      return 9 + 3 * (pCmd[1] - 1);
+    case DL_ROWS:
+      bytes = pCmd[6] & ~DL_ROWS_SAME_MASK;
+      if (pCmd[6] & DL_ROWS_SAME_MASK) {
+        return 7 + bytes + pCmd[5] * bytes;
+      }
+      return 7 + pCmd[5] * 2 * bytes;
+    case DL_DATA:
+      return 13 + (getBits(&pCmd[9], 4) + 7) / 8;
+    default:
+      /* DL_FILL and DL_SCROLL */
+      return 10;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Tell whether all the pixels a drawing command may modify are inside the
+ *   rectangle x0, y0, x1, y1 (inclusive).
+ ******************************************************************************/
+static bool listCommandInside(const uint8_t *pCmd, int32_t x0, int32_t y0,
+                              int32_t x1, int32_t y1)
+{
+  int32_t  xMin, yMin, xMax, yMax;
+  uint32_t bytes, mask, i;
+
+  switch (pCmd[0]) {
+    case DL_SPANS:
+      yMin = getCoord(&pCmd[3]);
+      xMin = getCoord(&pCmd[5]);
+      xMax = getCoord(&pCmd[7]);
+      for (i = 0; i < pCmd[1]; i++) {
+        if (i > 0) {
+          yMin += (int8_t) pCmd[9 + 3 * (i - 1)];
+          xMin += (int8_t) pCmd[10 + 3 * (i - 1)];
+          xMax += (int8_t) pCmd[11 + 3 * (i - 1)];
+        }
+        if (yMin < y0 || yMin > y1 || xMin < x0 || xMax > x1) {
+          return false;
+        }
+      }
+      return true;
+    case DL_ROWS:
+      /* Pixels of any of the masks */
+      bytes = pCmd[6] & ~DL_ROWS_SAME_MASK;
+      mask  = getBits(&pCmd[7], bytes);
+      for (i = 1; !(pCmd[6] & DL_ROWS_SAME_MASK) && i < pCmd[5]; i++) {
+        mask |= getBits(&pCmd[7 + 2 * bytes * i], bytes);
+      }
+      xMin = getCoord(&pCmd[1]);
+      yMin = getCoord(&pCmd[3]);
+      yMax = yMin + pCmd[5] - 1;
+      for (; !(mask & 1); mask >>= 1) {
+        xMin++;
+      }
+      for (xMax = xMin; mask > 1; mask >>= 1) {
+        xMax++;
+      }
+      break;
+    case DL_DATA:
+      /* The whole width of the clipping area */
+      xMin = getCoord(&pCmd[1]);
+      xMax = xMin + getCoord(&pCmd[3]) - 1;
+      yMin = getCoord(&pCmd[7]);
+      yMax = yMin + (getCoord(&pCmd[5]) + getBits(&pCmd[9], 4) - 1) / getCoord(&pCmd[3]);
+      break;
+    case DL_FILL:
+      xMin = getCoord(&pCmd[2]);
+      yMin = getCoord(&pCmd[4]);
+      xMax = getCoord(&pCmd[6]);
+      yMax = getCoord(&pCmd[8]);
+      break;
+    case DL_SCROLL:
+      xMin = getCoord(&pCmd[1]);
+      yMin = getCoord(&pCmd[3]);
+      xMax = getCoord(&pCmd[5]);
+      yMax = getCoord(&pCmd[7]);
+      break;
+    default:
+      return false;
+  }
+
+  return xMin >= x0 && xMax <= x1 && yMin >= y0 && yMax <= y1;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Remove the commands before offset end that are hidden by a command
+ *   overwriting the whole rectangle x0, y0, x1, y1 with
+ *   DMD_RASTER_OP_COPY.
+ *
+ * @details
+ *   This keeps the list short when a region is cleared or drawn over again.
+ *   A scroll reaching outside the rectangle may have moved pixels drawn
+ *   before it out of the rectangle, so the commands before such a scroll are
+ *   kept. The commands from end on move down over the removed ones.
+ ******************************************************************************/
+static void listCull(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                     uint32_t end)
+{
+  uint32_t start = 0;
+  uint32_t kept;
+  uint32_t offset;
+  uint32_t size;
+  bool     lastKeptIsOp = false;
+
+  for (offset = 0; offset < end; offset += size) {
+    size = listCommandSize(&displayList[offset]);
+    if (displayList[offset] == DL_SCROLL
+        && !listCommandInside(&displayList[offset], x0, y0, x1, y1)) {
+      start = offset + size;
+    }
+  }
+
+  for (offset = kept = start; offset < end; offset += size) {
+    size = listCommandSize(&displayList[offset]);
+    if (displayList[offset] == DL_RASTER_OP) {
+      /* A raster operation followed by another one is useless */
+      if (lastKeptIsOp) {
+        kept -= 2;
+      }
+      lastKeptIsOp = true;
+    } else if (listCommandInside(&displayList[offset], x0, y0, x1, y1)) {
+      continue;
+    } else {
+      lastKeptIsOp = false;
+    }
+    if (kept != offset) {
+      memmove(&displayList[kept], &displayList[offset], size);
+    }
+    kept += size;
+  }
+
+  if (kept != end) {
+    memmove(&displayList[kept], &displayList[end], listUsed - end);
+    listUsed -= end - kept;
+    listLast  = (listLast >= end) ? listLast - (end - kept) : listUsed;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Remove the commands hidden by the last command, if it is a DL_ROWS that
+ *   overwrites a rectangle: the same run of pixels on every row, e.g. an
+ *   opaque glyph, with DMD_RASTER_OP_COPY. Called when the next command
+ *   starts, once no row can be added to it any more.
+ ******************************************************************************/
+static void listCullRows(void)
+{
+  const uint8_t *pCmd;
+  uint32_t       mask;
+  int32_t        x;
+  int32_t        y;
+  int32_t        first = 0;
+  int32_t        last;
+
+  if (listLast >= listUsed || listRasterOp != DMD_RASTER_OP_COPY) {
+    return;
+  }
+  pCmd = &displayList[listLast];
+  if (pCmd[0] != DL_ROWS || !(pCmd[6] & DL_ROWS_SAME_MASK)) {
+    return;
+  }
+
+  /* The mask must be a single run of pixels */
+  mask = getBits(&pCmd[7], pCmd[6] & ~DL_ROWS_SAME_MASK);
+  for (; !(mask & 1); mask >>= 1) {
+    first++;
+  }
+  if (mask & (mask + 1)) {
+    return;
+  }
+  for (last = first; mask > 1; mask >>= 1) {
+    last++;
+  }
+
+  x = getCoord(&pCmd[1]);
+  y = getCoord(&pCmd[3]);
+  listCull(x + first, y, x + last, y + pCmd[5] - 1, listLast);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record the fill of a rectangle, in display coordinates.
+ *
+ * @details
+ *   A DMD_RASTER_OP_COPY fill hides the commands drawn before inside the
+ *   rectangle, they are removed. Filling the whole display this way starts
+ *   the list over, and as the rendering of a band starts from white, a
+ *   white fill is then not even recorded.
+ ******************************************************************************/
+static EMSTATUS listFill(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                         uint32_t pixelData)
+{
+  uint8_t *pCmd;
+  int32_t  row;
+
+  if (rasterOp == DMD_RASTER_OP_COPY && x0 == 0 && y0 == 0
+      && x1 == dimensions.xSize - 1 && y1 == dimensions.ySize - 1) {
+    listUsed     = 0;
+    listRasterOp = DMD_RASTER_OP_COPY;
+  } else if (rasterOp == DMD_RASTER_OP_COPY) {
+    listCull(x0, y0, x1, y1, listUsed);
+  }
+
+  if (listUsed != 0 || pixelData == 0) {
+    pCmd = listReserve(10);
+    if (pCmd == NULL) {
+      return DMD_ERROR_NOT_ENOUGH_MEMORY;
+    }
+    pCmd[0] = DL_FILL;
+    pCmd[1] = (pixelData != 0);
+    putCoord(&pCmd[2], x0);
+    putCoord(&pCmd[4], y0);
+    putCoord(&pCmd[6], x1);
+    putCoord(&pCmd[8], y1);
+  }
+
+  for (row = y0; row <= y1; row++) {
+    setLineDirty(row);
+  }
+
+  return DMD_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record the fill of a span, already clipped.
+ *
+ * @details
+ *   Consecutive spans of the same color share one DL_SPANS command, as long
+ *   as each one is close enough to the one before to be stored as
+ *   differences, e.g. the rows of a line or of a filled shape.
+ ******************************************************************************/
+static EMSTATUS listSpan(int32_t y, int32_t x0, int32_t x1, uint32_t pixelData)
+{
+  uint8_t *pCmd = listMergeable(DL_SPANS);
+  uint8_t *pDelta;
+  int32_t  dy  = y - listSpanLast.y;
+  int32_t  dx0 = x0 - listSpanLast.x0;
+  int32_t  dx1 = x1 - listSpanLast.x1;
+
+  if (pCmd != NULL && pCmd[1] < DL_MAX_COUNT && pCmd[2] == (pixelData != 0)
+      && dy >= -128 && dy <= 127 && dx0 >= -128 && dx0 <= 127
+      && dx1 >= -128 && dx1 <= 127) {
+    pDelta = listExtend(3);
+    if (pDelta == NULL) {
+      return DMD_ERROR_NOT_ENOUGH_MEMORY;
+    }
+    pCmd[1]++;
+    pDelta[0] = (uint8_t) dy;
+    pDelta[1] = (uint8_t) dx0;
+    pDelta[2] = (uint8_t) dx1;
+  } else {
+    pCmd = listReserve(9);
+    if (pCmd == NULL) {
+      return DMD_ERROR_NOT_ENOUGH_MEMORY;
+    }
+    pCmd[0] = DL_SPANS;
+    pCmd[1] = 1;
+    pCmd[2] = (pixelData != 0);
+    putCoord(&pCmd[3], y);
+    putCoord(&pCmd[5], x0);
+    putCoord(&pCmd[7], x1);
+  }
+  listSpanLast.y  = y;
+  listSpanLast.x0 = x0;
+  listSpanLast.x1 = x1;
+
+  setLineDirty(y);
+
+  return DMD_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record a run of masked pixels, already clipped.
+ *
+ * @details
+ *   The rows of a glyph or of an image come one after the other at the same
+ *   x, so a run on the row below the last one recorded is added to its
+ *   DL_ROWS command. While every row has the same mask, e.g. an opaque
+ *   glyph, the mask is only stored once. Single pixels, e.g. the pixels of
+ *   a line drawn by GLIB_drawPixel(), are recorded as spans one pixel long,
+ *   whose coordinates are stored as differences.
+ ******************************************************************************/
+static EMSTATUS listRowMask(int32_t x, int32_t y, uint32_t pixels,
+                            uint32_t mask)
+{
+  uint8_t     *pCmd;
+  uint8_t     *pRow;
+  unsigned int bytes;
+  unsigned int cmdBytes = 0;
+  bool         sameMask = false;
+
+  if (mask == 1) {
+    return listSpan(y, x, x, pixels ? 0xFFFFFFFF : 0x00000000);
+  }
+
+  pCmd  = listMergeable(DL_ROWS);
+  bytes = (mask > 0xFFFFFF) ? 4 : (mask > 0xFFFF) ? 3 : (mask > 0xFF) ? 2 : 1;
+
+  if (pCmd != NULL) {
+    cmdBytes = pCmd[6] & ~DL_ROWS_SAME_MASK;
+    if (getCoord(&pCmd[1]) != x || getCoord(&pCmd[3]) + pCmd[5] != y
+        || pCmd[5] == DL_MAX_COUNT || bytes > cmdBytes) {
+      pCmd = NULL;
+    } else if ((pCmd[6] & DL_ROWS_SAME_MASK)
+               && getBits(&pCmd[7], cmdBytes) != mask) {
+      /* With a single row both layouts are the same */
+      if (pCmd[5] == 1) {
+        pCmd[6] = (uint8_t) cmdBytes;
+      } else {
+        pCmd = NULL;
+      }
+    }
+  }
+
+  if (pCmd != NULL) {
+    sameMask = (pCmd[6] & DL_ROWS_SAME_MASK) != 0;
+    pRow     = listExtend(sameMask ? cmdBytes : 2 * cmdBytes);
+    if (pRow == NULL) {
+      return DMD_ERROR_NOT_ENOUGH_MEMORY;
+    }
+    pCmd[5]++;
+  } else {
+    pCmd = listReserve(7 + 2 * bytes);
+    if (pCmd == NULL) {
+      return DMD_ERROR_NOT_ENOUGH_MEMORY;
+    }
+    pCmd[0] = DL_ROWS;
+    putCoord(&pCmd[1], x);
+    putCoord(&pCmd[3], y);
+    pCmd[5]  = 1;
+    pCmd[6]  = (uint8_t) bytes | DL_ROWS_SAME_MASK;
+    cmdBytes = bytes;
+    pRow     = &pCmd[7];
+  }
+
+  if (!sameMask) {
+    putBits(pRow, mask, cmdBytes);
+    pRow += cmdBytes;
+  }
+  putBits(pRow, pixels, cmdBytes);
+
+  setLineDirty(y);
+
+  return DMD_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record the arguments of DMD_writeData() with the clipping area, and a
+ *   copy of the pixels.
+ ******************************************************************************/
+static EMSTATUS listData(uint16_t x, uint16_t y, const uint8_t *data,
+                         uint32_t numPixels)
+{
+  uint8_t *pCmd;
+  int32_t  row;
+  int32_t  lastRow;
+
+  if (y >= dimensions.clipHeight) {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+  if (numPixels == 0) {
+    return DMD_OK;
+  }
+
+  pCmd = listReserve(13 + (numPixels + 7) / 8);
+  if (pCmd == NULL) {
+    return DMD_ERROR_NOT_ENOUGH_MEMORY;
+  }
+  pCmd[0] = DL_DATA;
+  putCoord(&pCmd[1], dimensions.xClipStart);
+  putCoord(&pCmd[3], dimensions.clipWidth);
+  putCoord(&pCmd[5], x);
+  putCoord(&pCmd[7], dimensions.yClipStart + y);
+  putBits(&pCmd[9], numPixels, 4);
+  memcpy(&pCmd[13], data, (numPixels + 7) / 8);
+
+  row     = dimensions.yClipStart + y;
+  lastRow = row + (x + numPixels - 1) / dimensions.clipWidth;
+  for (; row <= lastRow; row++) {
+    setLineDirty(row);
+  }
+
+  return DMD_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Record the arguments of DMD_scrollLeft(), already clipped.
+ ******************************************************************************/
+static EMSTATUS listScroll(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                           uint32_t shift)
+{
+  uint8_t *pCmd;
+  int32_t  row;
+
+  pCmd = listReserve(10);
+  if (pCmd == NULL) {
+    return DMD_ERROR_NOT_ENOUGH_MEMORY;
+  }
+  pCmd[0] = DL_SCROLL;
+  putCoord(&pCmd[1], x0);
+  putCoord(&pCmd[3], y0);
+  putCoord(&pCmd[5], x1);
+  putCoord(&pCmd[7], y1);
+  pCmd[9] = (uint8_t) shift;
+
+  for (row = y0; row <= y1; row++) {
+    setLineDirty(row);
+  }
+
+  return DMD_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Render rows bandStart to bandStart + bandRows - 1 into the band buffer.
+ *
+ * @details
+ *   The band starts white, like the display after lcd_clear(), and the whole
+ *   display list is replayed into it. Each command only draws the part that
+ *   falls in the band, with the same row functions as the framebuffer mode.
+ ******************************************************************************/
+static void renderBand(unsigned int bandStart, unsigned int bandRows)
+{
+  const uint8_t *pCmd;
+  const uint8_t *pRow;
+  int            bytesPerRow = (SL_MEMLCD_DISPLAY_WIDTH * SL_MEMLCD_DISPLAY_BPP) / 8;
+  int32_t        yMin        = bandStart;
+  int32_t        yMax        = bandStart + bandRows - 1;
+  DMD_RasterOp   drawOp      = rasterOp;
+  int32_t        x0, y0, x1, y1;
+  uint32_t       offset, count, bytes, mask, i;
+  uint32_t       pixelData;
+  uint32_t       numPixels, rowPixels, dataBit;
+
+  memset(bandBuffer, 0xFF, bandRows * bytesPerRow);
+  rasterOp = DMD_RASTER_OP_COPY;
+
+  for (offset = 0; offset < listUsed; offset += listCommandSize(pCmd)) {
+    pCmd = &displayList[offset];
+    switch (pCmd[0]) {
+      case DL_RASTER_OP:
+        rasterOp = (DMD_RasterOp) pCmd[1];
+        break;
+
+      case DL_FILL:
+        pixelData = pCmd[1] ? 0xFFFFFFFF : 0x00000000;
+        x0 = getCoord(&pCmd[2]);
+        y0 = getCoord(&pCmd[4]);
+        x1 = getCoord(&pCmd[6]);
+        y1 = getCoord(&pCmd[8]);
+        y0 = (y0 < yMin) ? yMin : y0;
+        y1 = (y1 > yMax) ? yMax : y1;
+        for (; y0 <= y1; y0++) {
+          fillRowBits(bandBuffer + (y0 - yMin) * bytesPerRow, x0, x1 - x0 + 1,
+                      pixelData);
+        }
+        break;
+
+      case DL_SPANS:
+        count     = pCmd[1];
+        pixelData = pCmd[2] ? 0xFFFFFFFF : 0x00000000;
+        y0        = getCoord(&pCmd[3]);
+        x0        = getCoord(&pCmd[5]);
+        x1        = getCoord(&pCmd[7]);
+        for (i = 0, pRow = &pCmd[9]; i < count; i++) {
+          if (i > 0) {
+            y0   += (int8_t) pRow[0];
+            x0   += (int8_t) pRow[1];
+            x1   += (int8_t) pRow[2];
+            pRow += 3;
+          }
+          if (y0 >= yMin && y0 <= yMax) {
+            fillRowBits(bandBuffer + (y0 - yMin) * bytesPerRow, x0, x1 - x0 + 1,
+                        pixelData);
+          }
+        }
+        break;
+
+      case DL_ROWS:
+        x0    = getCoord(&pCmd[1]);
+        y0    = getCoord(&pCmd[3]);
+        count = pCmd[5];
+        bytes = pCmd[6] & ~DL_ROWS_SAME_MASK;
+        if (y0 > yMax || y0 + (int32_t) count <= yMin) {
+          break;
+        }
+        pRow = &pCmd[7];
+        if (pCmd[6] & DL_ROWS_SAME_MASK) {
+          mask  = getBits(pRow, bytes);
+          pRow += bytes;
+          for (i = 0; i < count; i++, y0++, pRow += bytes) {
+            if (y0 >= yMin && y0 <= yMax) {
+              mergeRowBits(bandBuffer + (y0 - yMin) * bytesPerRow, x0,
+                           getBits(pRow, bytes), mask);
+            }
+          }
+        } else {
+          for (i = 0; i < count; i++, y0++, pRow += 2 * bytes) {
+            if (y0 >= yMin && y0 <= yMax) {
+              mergeRowBits(bandBuffer + (y0 - yMin) * bytesPerRow, x0,
+                           getBits(pRow + bytes, bytes), getBits(pRow, bytes));
+            }
+          }
+        }
+        break;
+
+      case DL_DATA:
+        /* Same walk through the clipping area as DMD_writeData() */
+        x0        = getCoord(&pCmd[1]);
+        x1        = getCoord(&pCmd[3]);   /* Width of the clipping area */
+        i         = getCoord(&pCmd[5]);
+        y0        = getCoord(&pCmd[7]);
+        numPixels = getBits(&pCmd[9], 4);
+        dataBit   = 0;
+        for (; numPixels && y0 <= yMax; y0++) {
+          rowPixels = (numPixels > x1 - i) ? x1 - i : numPixels;
+          if (y0 >= yMin) {
+            copyRowBits(bandBuffer + (y0 - yMin) * bytesPerRow, x0 + i,
+                        &pCmd[13], dataBit, rowPixels);
+          }
+          dataBit   += rowPixels;
+          numPixels -= rowPixels;
+          i          = 0;
+        }
+        break;
+
+      case DL_SCROLL:
+        x0 = getCoord(&pCmd[1]);
+        y0 = getCoord(&pCmd[3]);
+        x1 = getCoord(&pCmd[5]);
+        y1 = getCoord(&pCmd[7]);
+        y0 = (y0 < yMin) ? yMin : y0;
+        y1 = (y1 > yMax) ? yMax : y1;
+        for (; y0 <= y1; y0++) {
+          shiftRowBits(bandBuffer + (y0 - yMin) * bytesPerRow, x0,
+                       x1 - x0 + 1 - pCmd[9], pCmd[9]);
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  rasterOp = drawOp;
+}
+#endif
+
 /** @endcond */
@@ -56,6 +56,27 @@ static __INLINE void GLIB_colorTranslate24bppInl(uint32_t color, uint8_t *red, u
   *green = (color >> GreenShift) & 0xFF;
   *blue  = (color >> BlueShift) & 0xFF;
 }
+
+/* Writes one pixel at display coordinates (x, y). DMD_writeColor() takes
+ * coordinates relative to the driver clipping area, which GLIB keeps equal to
+ * its own clipping region, so monochrome displays go through
+ * DMD_writeRowMask() instead, which works in display coordinates. */
+static EMSTATUS GLIB_writePixel(const GLIB_Context_t *pContext, int32_t x, int32_t y,
+                                uint8_t red, uint8_t green, uint8_t blue)
+{
+  EMSTATUS status;
+
+  status = DMD_writeRowMask(x, y, green ? 0xFFFFFFFF : 0x00000000, 1);
+  if (status == DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+  if (status != DMD_ERROR_NOT_SUPPORTED) {
+    return status;
+  }
+  return DMD_writeColor(x - pContext->clippingRegion.xMin,
+                        y - pContext->clippingRegion.yMin,
+                        red, green, blue, 1);
+}
 /** @endcond */
 
 /**************************************************************************//**
@@ -85,6 +106,9 @@ EMSTATUS GLIB_contextInit(GLIB_Context_t *pContext)
   pContext->backgroundColor = Black;
   pContext->foregroundColor = White;
 
+  /* Drawing replaces the pixels */
+  pContext->rasterOp = GLIB_RASTER_OP_COPY;
+
   /* Sets a pointer to the display geometry struct */
   status = DMD_getDisplayGeometry(&pTmpDisplayGeometry);
   if (status != DMD_OK) {
@@ -210,7 +234,10 @@ EMSTATUS GLIB_clear(GLIB_Context_t *pContext)
   /* Fill the display with the background color of the GLIB_Context_t  */
   width = pContext->pDisplayGeometry->clipWidth;
   height = pContext->pDisplayGeometry->clipHeight;
-  return DMD_writeColor(0, 0, red, green, blue, width * height);
+  DMD_setRasterOp(DMD_RASTER_OP_COPY);
+  status = DMD_writeColor(0, 0, red, green, blue, width * height);
+  DMD_setRasterOp((DMD_RasterOp) pContext->rasterOp);
+  return status;
 }
 
 /**************************************************************************//**
@@ -249,7 +276,9 @@ EMSTATUS GLIB_clearRegion(const GLIB_Context_t *pContext)
   /* Fill the region with the background color of the GLIB_Context_t */
   width = pContext->clippingRegion.xMax - pContext->clippingRegion.xMin + 1;
   height = pContext->clippingRegion.yMax - pContext->clippingRegion.yMin + 1;
+  DMD_setRasterOp(DMD_RASTER_OP_COPY);
   status = DMD_writeColor(0, 0, red, green, blue, width * height);
+  DMD_setRasterOp((DMD_RasterOp) pContext->rasterOp);
   if (status != DMD_OK) {
     return status;
   }
@@ -305,7 +334,8 @@ EMSTATUS GLIB_resetClippingRegion(GLIB_Context_t *pContext)
 
 /**************************************************************************//**
 *  @brief
-*  Apply the clipping region from the GLIB_Context_t in the DMD driver.
+*  Apply the clipping region and the raster operation from the GLIB_Context_t
+*  in the DMD driver.
 *
 *  @param pContext
 *  Pointer to a GLIB_Context_t
@@ -315,11 +345,18 @@ EMSTATUS GLIB_resetClippingRegion(GLIB_Context_t *pContext)
 ******************************************************************************/
 EMSTATUS GLIB_applyClippingRegion(const GLIB_Context_t *pContext)
 {
+  EMSTATUS status;
+
   /* Check arguments */
   if (pContext == NULL) {
     return GLIB_ERROR_INVALID_ARGUMENT;
   }
 
+  status = DMD_setRasterOp((DMD_RasterOp) pContext->rasterOp);
+  if (status != DMD_OK) {
+    return status;
+  }
+
   /* Reset driver clipping area to GLIB clipping region */
   return DMD_setClippingArea(pContext->clippingRegion.xMin,
                              pContext->clippingRegion.yMin,
@@ -327,6 +364,39 @@ EMSTATUS GLIB_applyClippingRegion(const GLIB_Context_t *pContext)
                              pContext->clippingRegion.yMax - pContext->clippingRegion.yMin + 1);
 }
 
+/**************************************************************************//**
+*  @brief
+*  Sets how the drawing functions combine the pixels they draw with the
+*  display content.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+*  @param rasterOp
+*  The raster operation. GLIB_contextInit() sets GLIB_RASTER_OP_COPY.
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_ERROR_INVALID_ARGUMENT for an unknown raster operation
+*  - Returns DMD_ERROR_NOT_SUPPORTED if the display does not support it
+******************************************************************************/
+EMSTATUS GLIB_setRasterOp(GLIB_Context_t *pContext, GLIB_RasterOp_t rasterOp)
+{
+  EMSTATUS status;
+
+  /* Check arguments */
+  if ((pContext == NULL) || (rasterOp > GLIB_RASTER_OP_XOR)) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  status = DMD_setRasterOp((DMD_RasterOp) rasterOp);
+  if (status != DMD_OK) {
+    return status;
+  }
+
+  pContext->rasterOp = rasterOp;
+  return GLIB_OK;
+}
+
 /**************************************************************************//**
 *  @brief
 *  Extracts the color components from the 32-bit color passed and puts them in
@@ -400,7 +470,7 @@ EMSTATUS GLIB_drawPixel(GLIB_Context_t *pContext, int32_t x, int32_t y)
 
   /* Translate color and draw pixel */
   GLIB_colorTranslate24bppInl(pContext->foregroundColor, &red, &green, &blue);
-  return DMD_writeColor(x, y, red, green, blue, 1);
+  return GLIB_writePixel(pContext, x, y, red, green, blue);
 }
 
 /**************************************************************************//**
@@ -436,7 +506,7 @@ EMSTATUS GLIB_drawPixelColor(GLIB_Context_t *pContext, int32_t x, int32_t y,
 
   /* Translate color and draw pixel */
   GLIB_colorTranslate24bppInl(color, &red, &green, &blue);
-  return DMD_writeColor(x, y, red, green, blue, 1);
+  return GLIB_writePixel(pContext, x, y, red, green, blue);
 }
 
 /**************************************************************************//**
@@ -475,5 +545,5 @@ EMSTATUS GLIB_drawPixelRGB(GLIB_Context_t *pContext, int32_t x, int32_t y,
   }
 
   /* Call Display driver function */
-  return DMD_writeColor(x, y, red, green, blue, 1);
+  return GLIB_writePixel(pContext, x, y, red, green, blue);
 }
@@ -108,6 +108,7 @@
  * @li @ref GLIB_drawLine(). Draw line with the foreground color.
  * @li @ref GLIB_drawLineH(). Draw a horizontal line.
  * @li @ref GLIB_drawLineV(). Draw a vertical line.
+ * @li @ref GLIB_drawSpans(). Draw a batch of horizontal lines.
  * @li @ref GLIB_drawRect(). Draw a rectangle outline with the foreground
  * color.
  * @li @ref GLIB_drawRectFilled(). Draw a filled rectangle using the foreground
@@ -115,6 +116,8 @@
  * @li @ref GLIB_drawPolygon(). Draw lines between all the points in the given
  * set using the foreground color.
  * @li @ref GLIB_drawPolygonFilled(). Draw filled polygon between points.
+ * @li @ref GLIB_drawPolygonFilledEx(). Draw filled polygon with any number
+ * of points, using scratch memory given by the caller.
  *
  * @n @section glib_draw_pixel Draw Pixels
  *
@@ -126,8 +129,9 @@
  *
  * @n @section glib_font Font rendering
  *
- *   GLIB Supports fixed width font rendering. The functions @ref GLIB_drawString()
- *   and @ref GLIB_drawChar() are used to render text on the display.
+ *   GLIB Supports fixed width and proportional font rendering. The functions
+ *   @ref GLIB_drawString() and @ref GLIB_drawChar() are used to render text on
+ *   the display.
  *
  *   GLIB provides these fonts for the user
  *
@@ -145,6 +149,18 @@
  *   height of each character and it also contains the bitmap of each
  *   character.
  *
+ *   The bundled fonts are generated from the BDF sources in PC-host-sim/fonts
+ *   by PC-host-sim/tools/fontc.py. The generated pixel maps use the
+ *   @ref GLIB_FONT_LAYOUT_GLYPH_ROWS layout: the rows of each glyph are stored
+ *   one after the other, with the leftmost pixel in bit 0 of the first byte,
+ *   so that a glyph row can be merged into the framebuffer as it is.
+ *   Proportional fonts carry an advance width for every glyph.
+ *
+ *   @ref GLIB_drawStringScaled() and @ref GLIB_drawCharScaled() draw any font
+ *   at 2, 3 or 4 times its size. Each glyph row is widened through a bit
+ *   expansion table and written to as many framebuffer rows as the scale, so
+ *   large readings do not need a second, larger font in flash.
+ *
  * @n @section glib_bitmap Draw Bitmap
  *
  *   To draw an image or custom bitmaps on the display the @ref GLIB_drawBitmap()
@@ -156,6 +172,49 @@
  *   foreground and background color settings, and that the format of the bitmap
  *   depends on the DMD implementation of the display.
  *
+ *   BMP files are drawn on monochrome displays with @ref GLIB_drawBmp(). It
+ *   reads the file through the function given to @ref BMP_init() one row at a
+ *   time and writes each row into the framebuffer as soon as it is converted,
+ *   so neither the file nor an RGB copy of it has to fit in RAM. 24-bit,
+ *   8-bit, RLE8 and 1-bit files are reduced to black and white with a
+ *   luminance threshold, an ordered dither or Floyd-Steinberg dithering.
+ *
+ *   Icons and splash screens kept in flash are smaller as a
+ *   @ref GLIB_PackedImage_t, drawn with @ref GLIB_drawPackedImage(). Its rows
+ *   are in the monochrome bitmap format, PackBits compressed and optionally
+ *   XORed with the row above so that rows repeating the previous one pack to
+ *   a few bytes. Each row is unpacked and merged into the framebuffer before
+ *   the next is read, at any position and clipped like the other drawing
+ *   functions. The host tool PC-host-sim/tools/imgc.py turns PBM and BMP
+ *   files into C source for such images and picks the smallest encoding.
+ *
+ * @n @section glib_rasterop Raster Operations
+ *
+ *   The drawing functions normally replace the pixels they draw. The raster
+ *   operation of the context, set with @ref GLIB_setRasterOp(), can instead
+ *   OR them into the display, clear them (AND NOT) or invert them (XOR); on
+ *   monochrome displays the source pixels are those drawn in White. Drawing
+ *   a White filled rectangle with @ref GLIB_RASTER_OP_XOR inverts it, and
+ *   drawing it again restores what was there, so a cursor, a highlight or a
+ *   blinking marker costs only the rows of the rectangle and no redraw of
+ *   what is underneath. Outlines that visit a pixel twice, such as the
+ *   corners of a polygon, leave that pixel unchanged under XOR. Like the
+ *   clipping region, the operation is applied to the DMD driver by
+ *   @ref GLIB_applyClippingRegion(). @ref GLIB_clear() and
+ *   @ref GLIB_clearRegion() always replace the pixels, and text grids and
+ *   strip charts expect @ref GLIB_RASTER_OP_COPY. @ref DMD_readData() reads
+ *   pixels back from the framebuffer.
+ *
+ * @n @section glib_stripchart Strip Chart
+ *
+ *   A @ref GLIB_StripChart_t plots the latest samples of a value in a
+ *   rectangle, one sample per column with the newest on the right.
+ *   @ref GLIB_stripChartAddSample() scrolls the rectangle one column to the
+ *   left with @ref DMD_scrollLeft() and draws only the new column, and
+ *   @ref GLIB_stripChartRedraw() draws the whole chart. Both only draw within
+ *   the clipping region of the context. The chart uses the monochrome bitmap
+ *   format of @ref GLIB_drawBitmap().
+ *
  * @n @section glib_example Example
  *
  *   This examples shows how to initialize a GLIB context and draw something
@@ -194,6 +253,9 @@
 /* Display Driver header files */
 #include "dmd.h"
 
+/* BMP header files */
+#include "bmp.h"
+
 #include "em_types.h"
 
 #ifdef __cplusplus
@@ -233,6 +295,17 @@ typedef enum __GLIB_Font_Class{
   NumbersOnlyFont,  /**< Numbers only font. */
 } GLIB_Font_Class;
 
+/** @brief Font pixel map layouts
+ */
+typedef enum __GLIB_Font_Layout{
+  /** Row r of glyph g is element (g + r * fontRowOffset) of the pixel map. */
+  GLIB_FONT_LAYOUT_STRIDED = 0,
+  /** The rows of glyph g are stored one after the other from byte
+   *  (g * fontHeight * fontRowOffset), each row is fontRowOffset bytes with
+   *  the leftmost pixel in bit 0 of the first byte. */
+  GLIB_FONT_LAYOUT_GLYPH_ROWS,
+} GLIB_Font_Layout_t;
+
 /** @brief Alignment types
  */
 typedef enum __GLIB_Align{
@@ -241,6 +314,15 @@ typedef enum __GLIB_Align{
   GLIB_ALIGN_RIGHT,
 } GLIB_Align_t;
 
+/** @brief Raster operations, see @ref DMD_RasterOp
+ */
+typedef enum __GLIB_RasterOp{
+  GLIB_RASTER_OP_COPY    = DMD_RASTER_OP_COPY,     /**< Replace the pixels */
+  GLIB_RASTER_OP_OR      = DMD_RASTER_OP_OR,       /**< OR into the pixels */
+  GLIB_RASTER_OP_AND_NOT = DMD_RASTER_OP_AND_NOT,  /**< Clear the pixels */
+  GLIB_RASTER_OP_XOR     = DMD_RASTER_OP_XOR,      /**< Invert the pixels */
+} GLIB_RasterOp_t;
+
 /** @brief Font definition structure
  */
 typedef struct __GLIB_Font_t{
@@ -271,6 +353,13 @@ typedef struct __GLIB_Font_t{
   /** The font class is used to tell glib if the font contains numbers only
    *  or characters and numbers */
   GLIB_Font_Class fontClass;
+
+  /** Layout of the font pixel map. */
+  GLIB_Font_Layout_t layout;
+
+  /** Advance width in pixels of each glyph, including the character spacing.
+   *  NULL for fixed width fonts, which advance fontWidth + charSpacing. */
+  const uint8_t *pAdvanceWidths;
 } GLIB_Font_t;
 
 /** @brief Rectangle structure
@@ -304,8 +393,148 @@ typedef struct __GLIB_Context_t{
 
   /** Font definition */
   GLIB_Font_t font;
+
+  /** Raster operation of the drawing functions */
+  GLIB_RasterOp_t rasterOp;
 } GLIB_Context_t;
 
+/** Number of spans the filled shapes collect before calling GLIB_drawSpans() */
+#define GLIB_SPAN_BATCH_SIZE      16
+
+/** Largest scale of GLIB_drawCharScaled() and GLIB_drawStringScaled() */
+#define GLIB_FONT_SCALE_MAX       4
+
+/** Number of lines a GLIB_TextGrid_t keeps track of */
+#define GLIB_TEXTGRID_MAX_LINES   16
+
+/** Number of characters a GLIB_TextGrid_t keeps per line */
+#define GLIB_TEXTGRID_MAX_COLS    24
+
+/** @brief Content of one line of a text grid
+ */
+typedef struct __GLIB_TextGridLine_t{
+  /** X-coordinate of the first character */
+  int32_t x;
+
+  /** Number of characters on the display */
+  uint32_t length;
+
+  /** Characters on the display */
+  char text[GLIB_TEXTGRID_MAX_COLS];
+} GLIB_TextGridLine_t;
+
+/** @brief Retained text grid
+ *  Keeps the text drawn on each line so that only changed characters are
+ *  redrawn, see GLIB_textGridDrawLine().
+ */
+typedef struct __GLIB_TextGrid_t{
+  /** Context used for drawing */
+  GLIB_Context_t *pContext;
+
+  /** Lines of the grid */
+  GLIB_TextGridLine_t lines[GLIB_TEXTGRID_MAX_LINES];
+} GLIB_TextGrid_t;
+
+/** Number of samples, and so columns, a GLIB_StripChart_t can hold */
+#define GLIB_STRIPCHART_MAX_SAMPLES   128
+
+/** Number of rows a GLIB_StripChart_t area can have */
+#define GLIB_STRIPCHART_MAX_ROWS      128
+
+/** @brief Scrolling strip chart
+ *  Keeps the latest samples in a ring buffer, one per column of the chart
+ *  area, newest on the right. See GLIB_stripChartAddSample().
+ */
+typedef struct __GLIB_StripChart_t{
+  /** Context used for drawing */
+  GLIB_Context_t *pContext;
+
+  /** Area of the chart on the display */
+  GLIB_Rectangle_t area;
+
+  /** Sample value drawn on the bottom row of the area */
+  int16_t minValue;
+
+  /** Sample value drawn on the top row of the area */
+  int16_t maxValue;
+
+  /** Number of columns of the area. The ring buffer holds one sample more,
+   *  the one before the leftmost column, which its segment starts from. */
+  uint32_t columns;
+
+  /** Index of the oldest sample in the ring buffer */
+  uint32_t first;
+
+  /** Number of samples in the ring buffer */
+  uint32_t count;
+
+  /** Ring buffer of samples */
+  int16_t samples[GLIB_STRIPCHART_MAX_SAMPLES + 1];
+} GLIB_StripChart_t;
+
+/** Widest image GLIB_drawPackedImage() can draw, in pixels */
+#define GLIB_PACKED_IMAGE_MAX_WIDTH   128
+
+/** The rows of a packed image are PackBits compressed */
+#define GLIB_PACKED_IMAGE_PACKBITS    0x01
+
+/** Each row of a packed image is stored XORed with the row above it, the
+ *  first row with a row of black pixels */
+#define GLIB_PACKED_IMAGE_ROW_DELTA   0x02
+
+/** @brief Packed monochrome image
+ *  Rows of ((width + 7) / 8) bytes in the monochrome bitmap format of
+ *  GLIB_drawBitmap(), top row first, optionally row-delta coded and PackBits
+ *  compressed. PackBits runs never cross a row. Images are made from PBM or
+ *  BMP files with the host tool imgc.py, see GLIB_drawPackedImage().
+ */
+typedef struct __GLIB_PackedImage_t{
+  /** Width of the image in pixels */
+  uint16_t width;
+
+  /** Height of the image in pixels */
+  uint16_t height;
+
+  /** GLIB_PACKED_IMAGE_PACKBITS and/or GLIB_PACKED_IMAGE_ROW_DELTA */
+  uint8_t flags;
+
+  /** Number of bytes of data */
+  uint32_t size;
+
+  /** Image data */
+  const uint8_t *data;
+} GLIB_PackedImage_t;
+
+/** @brief Edge of a polygon being filled by GLIB_drawPolygonFilledEx()
+ *  The caller provides an array of these as scratch memory, one per point
+ *  of the polygon. The fields are private to the filler.
+ */
+typedef struct __GLIB_PolygonEdge_t{
+  /** First row crossed by the edge */
+  int32_t yTop;
+
+  /** Last row crossed by the edge */
+  int32_t yBottom;
+
+  /** X-coordinate of the crossing on the current row, rounded down */
+  int32_t x;
+
+  /** Fractional part of the crossing, in units of 1/dy pixel */
+  int32_t xFrac;
+
+  /** Whole part of dx/dy, added to x on every row */
+  int32_t xStep;
+
+  /** Fractional part of dx/dy, in units of 1/dy pixel */
+  int32_t xFracStep;
+
+  /** Height of the edge */
+  int32_t dy;
+
+  /** Slot of the active edge list, which shares the array */
+  uint32_t active;
+} GLIB_PolygonEdge_t;
+
 /* Prototypes for graphics library functions */
 EMSTATUS GLIB_contextInit(GLIB_Context_t *pContext);
 
@@ -323,6 +552,8 @@ EMSTATUS GLIB_resetClippingRegion(GLIB_Context_t *pContext);
 
 EMSTATUS GLIB_applyClippingRegion(const GLIB_Context_t *pContext);
 
+EMSTATUS GLIB_setRasterOp(GLIB_Context_t *pContext, GLIB_RasterOp_t rasterOp);
+
 void GLIB_colorTranslate24bpp(uint32_t color, uint8_t *red, uint8_t *green, uint8_t *blue);
 
 uint32_t GLIB_rgbColor(uint8_t red, uint8_t green, uint8_t blue);
@@ -353,12 +584,43 @@ EMSTATUS GLIB_drawStringOnLine(GLIB_Context_t *pContext, const char *pString, ui
 EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x,
                        int32_t y, bool opaque);
 
+uint32_t GLIB_charAdvance(const GLIB_Font_t *pFont, char myChar);
+
+uint32_t GLIB_stringWidth(const GLIB_Font_t *pFont, const char *pString,
+                          size_t length);
+
+EMSTATUS GLIB_drawCharScaled(GLIB_Context_t *pContext, char myChar, int32_t x,
+                             int32_t y, uint32_t scale, bool opaque);
+
+EMSTATUS GLIB_drawStringScaled(GLIB_Context_t *pContext, const char *pString,
+                               uint32_t sLength, int32_t x0, int32_t y0,
+                               uint32_t scale, bool opaque);
+
+EMSTATUS GLIB_textGridInit(GLIB_TextGrid_t *pGrid, GLIB_Context_t *pContext);
+
+EMSTATUS GLIB_textGridDrawLine(GLIB_TextGrid_t *pGrid, const char *pString,
+                               uint8_t line, GLIB_Align_t align, int32_t xOffset);
+
+EMSTATUS GLIB_stripChartInit(GLIB_StripChart_t *pChart, GLIB_Context_t *pContext,
+                             const GLIB_Rectangle_t *pArea, int16_t minValue,
+                             int16_t maxValue);
+
+EMSTATUS GLIB_stripChartAddSample(GLIB_StripChart_t *pChart, int16_t value);
+
+EMSTATUS GLIB_stripChartRedraw(GLIB_StripChart_t *pChart);
+
 EMSTATUS GLIB_drawBitmap(GLIB_Context_t *pContext, int32_t x, int32_t y,
                          uint32_t width, uint32_t height, const uint8_t *picData);
 
 void GLIB_invertBitmap(GLIB_Context_t *pContext, uint32_t bitmapSize,
                        uint8_t *picData);
 
+EMSTATUS GLIB_drawBmp(GLIB_Context_t *pContext, int32_t x, int32_t y,
+                      BMP_Dither_t dither);
+
+EMSTATUS GLIB_drawPackedImage(GLIB_Context_t *pContext, int32_t x, int32_t y,
+                              const GLIB_PackedImage_t *pImage);
+
 EMSTATUS GLIB_drawLine(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
                        int32_t x2, int32_t y2);
 
@@ -368,6 +630,9 @@ EMSTATUS GLIB_drawLineH(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
 EMSTATUS GLIB_drawLineV(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
                         int32_t y2);
 
+EMSTATUS GLIB_drawSpans(GLIB_Context_t *pContext, const DMD_Span *spans,
+                        uint32_t numSpans);
+
 EMSTATUS GLIB_drawRect(GLIB_Context_t *pContext, const GLIB_Rectangle_t *pRect);
 
 EMSTATUS GLIB_drawRectFilled(GLIB_Context_t *pContext,
@@ -379,6 +644,10 @@ EMSTATUS GLIB_drawPolygon(GLIB_Context_t *pContext,
 EMSTATUS GLIB_drawPolygonFilled(GLIB_Context_t *pContext,
                                 uint32_t numPoints, const int32_t *polyPoints);
 
+EMSTATUS GLIB_drawPolygonFilledEx(GLIB_Context_t *pContext,
+                                  uint32_t numPoints, const int32_t *polyPoints,
+                                  GLIB_PolygonEdge_t *pEdges, uint32_t numEdges);
+
 EMSTATUS GLIB_drawPixelRGB(GLIB_Context_t *pContext, int32_t x, int32_t y,
                            uint8_t red, uint8_t green, uint8_t blue);
 
@@ -30,6 +30,7 @@
 
 /* Standard C header files */
 #include <stdint.h>
+#include <string.h>
 
 /* EM types */
 #include "em_types.h"
@@ -37,6 +38,11 @@
 /* GLIB header files */
 #include "glib.h"
 
+/* Local function prototypes */
+static EMSTATUS GLIB_unpackRow(const GLIB_PackedImage_t *pImage,
+                               uint32_t *pPos, uint8_t *pRow,
+                               uint32_t rowBytes);
+
 /**************************************************************************//**
 *  @brief
 *  Draws a bitmap
@@ -129,3 +135,259 @@ void GLIB_invertBitmap(GLIB_Context_t *pContext, uint32_t bitmapSize,
     picData[i] = ~(picData[i]);
   }
 }
+
+/**************************************************************************//**
+*  @brief
+*  Draws a BMP file on a monochrome display
+*
+*  Reads the header of the file with BMP_reset(), so BMP_init() must have been
+*  called and the read function has to be at the start of the file, or the
+*  image must have been set with BMP_initMemory(). The rows are read and
+*  reduced to 1bpp one at a time with BMP_readMonoRow() and merged into the
+*  framebuffer with DMD_writeRowMask(), so the image is clipped to the
+*  clipping region of the context and drawn with its raster operation. Only
+*  the first BMP_MONO_MAX_WIDTH columns of the image are drawn. Like
+*  GLIB_drawBitmap(), the image is insensitive to the foreground and
+*  background colors.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t in which the image is drawn.
+*  @param x
+*  X-coordinate of the top left corner of the image
+*  @param y
+*  Y-coordinate of the top left corner of the image
+*  @param dither
+*  Dithering used to reduce the image to black and white
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_ERROR_NOTHING_TO_DRAW if the image is
+*  outside the clipping region, GLIB_ERROR_IO, GLIB_ERROR_FILE_NOT_SUPPORTED
+*  or GLIB_ERROR_INVALID_FILE if the file can not be read,
+*  GLIB_ERROR_INVALID_ARGUMENT if the BMP module is not set up for the image,
+*  or GLIB_ERROR_IO if the display driver can not draw the rows. Only GLIB
+*  error codes are returned.
+******************************************************************************/
+EMSTATUS GLIB_drawBmp(GLIB_Context_t *pContext, int32_t x, int32_t y,
+                      BMP_Dither_t dither)
+{
+  uint32_t row[(BMP_MONO_MAX_WIDTH + 31) / 32];
+  uint32_t rowIndex;
+  uint32_t width;
+  uint32_t i;
+  uint32_t mask;
+  bool     drawn = false;
+  EMSTATUS status;
+
+  if (pContext == NULL) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  status = BMP_reset();
+  if (status == BMP_OK) {
+    width = (uint32_t) BMP_getWidth();
+    if (width > BMP_MONO_MAX_WIDTH) {
+      width = BMP_MONO_MAX_WIDTH;
+    }
+
+    while ((status = BMP_readMonoRow((uint8_t *) row, sizeof(row), dither, &rowIndex)) == BMP_OK) {
+      for (i = 0; i < width; i += 32) {
+        mask   = (width - i >= 32) ? 0xFFFFFFFF : ((1u << (width - i)) - 1);
+        status = DMD_writeRowMask(x + (int32_t) i, y + (int32_t) rowIndex,
+                                  row[i / 32], mask);
+        if (status == DMD_OK) {
+          drawn = true;
+        } else if (status != DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+          /* Driver not initialized, or not a monochrome display */
+          return GLIB_ERROR_IO;
+        }
+      }
+    }
+  }
+
+  /* Translate the BMP error codes */
+  switch (status) {
+    case BMP_ERROR_END_OF_FILE:
+      return drawn ? GLIB_OK : GLIB_ERROR_NOTHING_TO_DRAW;
+    case BMP_ERROR_IO:
+      return GLIB_ERROR_IO;
+    case BMP_ERROR_FILE_NOT_SUPPORTED:
+    case BMP_ERROR_ENDIAN_MISMATCH:
+      return GLIB_ERROR_FILE_NOT_SUPPORTED;
+    case BMP_ERROR_INVALID_ARGUMENT:
+    case BMP_ERROR_MODULE_NOT_INITIALIZED:
+    case BMP_ERROR_BUFFER_TOO_SMALL:
+    case BMP_ERROR_INVALID_PALETTE_SIZE:
+    case BMP_ERROR_PALETTE_NOT_READ:
+    case BMP_ERROR_FILE_NOT_RESET:
+      return GLIB_ERROR_INVALID_ARGUMENT;
+    default:
+      /* BMP_ERROR_HEADER_SIZE_MISMATCH, BMP_ERROR_FILE_INVALID */
+      return GLIB_ERROR_INVALID_FILE;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a packed monochrome image
+*
+*  The rows of the image are unpacked one at a time into a row buffer on the
+*  stack and merged into the framebuffer with DMD_writeRowMask(), which marks
+*  them dirty. The image is clipped to the clipping region of the context and
+*  drawn with its raster operation; rows below the clipping region are not
+*  unpacked. Like GLIB_drawBitmap(), the image is insensitive to the
+*  foreground and background colors.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t in which the image is drawn.
+*  @param x
+*  X-coordinate of the top left corner of the image
+*  @param y
+*  Y-coordinate of the top left corner of the image
+*  @param pImage
+*  The image, see GLIB_PackedImage_t
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_ERROR_NOTHING_TO_DRAW if the image is
+*  outside the clipping region, GLIB_ERROR_INVALID_ARGUMENT if the image is
+*  wider than GLIB_PACKED_IMAGE_MAX_WIDTH, GLIB_ERROR_INVALID_FILE if the data
+*  ends early or a PackBits run crosses a row, in which case the rows before
+*  it have been drawn, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawPackedImage(GLIB_Context_t *pContext, int32_t x, int32_t y,
+                              const GLIB_PackedImage_t *pImage)
+{
+  uint32_t row[(GLIB_PACKED_IMAGE_MAX_WIDTH + 31) / 32];
+  uint32_t rowBytes;
+  uint32_t pos = 0;
+  uint32_t i;
+  uint32_t mask;
+  int32_t  r = 0;
+  int32_t  firstRow;
+  int32_t  lastRow;
+  EMSTATUS status;
+
+  if ((pContext == NULL) || (pImage == NULL)
+      || ((pImage->data == NULL) && (pImage->size > 0))
+      || (pImage->width > GLIB_PACKED_IMAGE_MAX_WIDTH)) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  /* Rows of the image inside the clipping region */
+  firstRow = pContext->clippingRegion.yMin - y;
+  lastRow  = pContext->clippingRegion.yMax - y;
+  if (firstRow < 0) {
+    firstRow = 0;
+  }
+  if (lastRow > (int32_t) pImage->height - 1) {
+    lastRow = (int32_t) pImage->height - 1;
+  }
+  if ((pImage->width == 0) || (firstRow > lastRow)
+      || (x > pContext->clippingRegion.xMax)
+      || (x + (int32_t) pImage->width - 1 < pContext->clippingRegion.xMin)) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+
+  rowBytes = (pImage->width + 7) / 8;
+
+  /* Uncompressed rows can be skipped, the others have to be unpacked to find
+   * the start of the next row or to give the row above */
+  if ((pImage->flags & (GLIB_PACKED_IMAGE_PACKBITS | GLIB_PACKED_IMAGE_ROW_DELTA)) == 0) {
+    r   = firstRow;
+    pos = (uint32_t) firstRow * rowBytes;
+  }
+
+  /* The row above the first row is black */
+  memset(row, 0, sizeof(row));
+
+  for (; r <= lastRow; r++) {
+    status = GLIB_unpackRow(pImage, &pos, (uint8_t *) row, rowBytes);
+    if (status != GLIB_OK) {
+      return status;
+    }
+    if (r < firstRow) {
+      continue;
+    }
+
+    for (i = 0; i < pImage->width; i += 32) {
+      mask   = (pImage->width - i >= 32) ? 0xFFFFFFFF : ((1u << (pImage->width - i)) - 1);
+      status = DMD_writeRowMask(x + (int32_t) i, y + r, row[i / 32], mask);
+      if ((status != DMD_OK) && (status != DMD_ERROR_PIXEL_OUT_OF_BOUNDS)) {
+        return status;
+      }
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/**************************************************************************//**
+*  @brief
+*  Unpacks the row of a packed image starting at byte *pPos of its data into
+*  pRow, XORing it into the previous row for row-delta images, and advances
+*  *pPos to the next row.
+*
+*  @return
+*  Returns GLIB_OK, or GLIB_ERROR_INVALID_FILE if the data ends before the
+*  row or a PackBits run goes past the end of the row.
+******************************************************************************/
+static EMSTATUS GLIB_unpackRow(const GLIB_PackedImage_t *pImage,
+                               uint32_t *pPos, uint8_t *pRow,
+                               uint32_t rowBytes)
+{
+  const uint8_t *pData = pImage->data;
+  uint32_t size  = pImage->size;
+  uint32_t pos   = *pPos;
+  uint32_t i     = 0;
+  uint32_t count;
+  uint8_t  keep  = (pImage->flags & GLIB_PACKED_IMAGE_ROW_DELTA) ? 0xFF : 0x00;
+  uint8_t  value;
+  int8_t   code;
+
+  if ((pImage->flags & GLIB_PACKED_IMAGE_PACKBITS) == 0) {
+    if ((pos > size) || (size - pos < rowBytes)) {
+      return GLIB_ERROR_INVALID_FILE;
+    }
+    for (i = 0; i < rowBytes; i++) {
+      pRow[i] = (pRow[i] & keep) ^ pData[pos + i];
+    }
+    *pPos = pos + rowBytes;
+    return GLIB_OK;
+  }
+
+  while (i < rowBytes) {
+    if (pos >= size) {
+      return GLIB_ERROR_INVALID_FILE;
+    }
+    code = (int8_t) pData[pos++];
+
+    if (code >= 0) {
+      /* code + 1 literal bytes */
+      count = (uint32_t) code + 1;
+      if ((count > rowBytes - i) || (count > size - pos)) {
+        return GLIB_ERROR_INVALID_FILE;
+      }
+      while (count-- > 0) {
+        pRow[i] = (pRow[i] & keep) ^ pData[pos++];
+        i++;
+      }
+    } else if (code != -128) {
+      /* The next byte repeated 1 - code times */
+      count = (uint32_t) (1 - code);
+      if ((count > rowBytes - i) || (pos >= size)) {
+        return GLIB_ERROR_INVALID_FILE;
+      }
+      value = pData[pos++];
+      while (count-- > 0) {
+        pRow[i] = (pRow[i] & keep) ^ value;
+        i++;
+      }
+    }
+  }
+
+  *pPos = pos;
+  return GLIB_OK;
+}
+
+/** @endcond */
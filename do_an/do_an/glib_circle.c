@@ -40,6 +40,8 @@
 static EMSTATUS GLIB_drawPartialCirclePoints(GLIB_Context_t *pContext,
                                              int32_t xCenter, int32_t yCenter,
                                              int32_t x, int32_t y, uint8_t bitMask);
+static void GLIB_addCircleSpan(DMD_Span *spans, uint32_t *pNumSpans,
+                               int32_t y, int32_t x0, int32_t x1);
 
 /**************************************************************************//**
 *  @brief
@@ -165,6 +167,8 @@ EMSTATUS GLIB_drawCircleFilled(GLIB_Context_t *pContext, int32_t xCenter,
                                int32_t yCenter, uint32_t radius)
 {
   EMSTATUS status;
+  DMD_Span spans[GLIB_SPAN_BATCH_SIZE];
+  uint32_t numSpans = 0;
   int32_t x = 0;
   int32_t y = radius;
   int32_t d = 1 - radius;
@@ -175,14 +179,8 @@ EMSTATUS GLIB_drawCircleFilled(GLIB_Context_t *pContext, int32_t xCenter,
     return GLIB_ERROR_INVALID_ARGUMENT;
   }
 
-  /* Draws the initial circle fill line */
-  status = GLIB_drawLineH(pContext, xCenter - y, yCenter, xCenter + y);
-  if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
-    return status;
-  }
-  if (status == GLIB_OK) {
-    drawnElements++;
-  }
+  /* The initial circle fill line */
+  GLIB_addCircleSpan(spans, &numSpans, yCenter, xCenter - y, xCenter + y);
 
   /* Loops through all points from 0 to 45 degrees of the circle
    * (0 is defined straight upward) */
@@ -194,40 +192,41 @@ EMSTATUS GLIB_drawCircleFilled(GLIB_Context_t *pContext, int32_t xCenter,
       d += 2 * (x - y) + 1;
     }
 
-    /* Draws horizontal fill lines using 4 way symmetry */
-    status = GLIB_drawLineH(pContext, xCenter - x, yCenter + y, xCenter + x);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
-      return status;
-    }
-    if (status == GLIB_OK) {
-      drawnElements++;
+    /* Horizontal fill lines using 4 way symmetry. Each value of x is
+     * visited once, so the lines on rows yCenter +/- x are added right away. */
+    GLIB_addCircleSpan(spans, &numSpans, yCenter + x, xCenter - y, xCenter + y);
+    if (x != 0) {
+      GLIB_addCircleSpan(spans, &numSpans, yCenter - x, xCenter - y, xCenter + y);
     }
 
-    status = GLIB_drawLineH(pContext, xCenter - y, yCenter + x, xCenter + y);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
-      return status;
-    }
-    if (status == GLIB_OK) {
-      drawnElements++;
+    /* The lines on rows yCenter +/- y grow with x while y is unchanged. Only
+     * add the widest one: before y is decremented or the loop ends. */
+    if (d >= 0 || x + 1 >= y) {
+      GLIB_addCircleSpan(spans, &numSpans, yCenter + y, xCenter - x, xCenter + x);
+      GLIB_addCircleSpan(spans, &numSpans, yCenter - y, xCenter - x, xCenter + x);
     }
 
-    status = GLIB_drawLineH(pContext, xCenter - x, yCenter - y, xCenter + x);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
-      return status;
-    }
-    if (status == GLIB_OK) {
-      drawnElements++;
-    }
+    x++;
 
-    status = GLIB_drawLineH(pContext, xCenter - y, yCenter - x, xCenter + y);
-    if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
-      return status;
-    }
-    if (status == GLIB_OK) {
-      drawnElements++;
+    /* Draw the collected lines when the next iteration might not fit */
+    if (numSpans > GLIB_SPAN_BATCH_SIZE - 4) {
+      status = GLIB_drawSpans(pContext, spans, numSpans);
+      if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+        return status;
+      }
+      if (status == GLIB_OK) {
+        drawnElements++;
+      }
+      numSpans = 0;
     }
+  }
 
-    x++;
+  status = GLIB_drawSpans(pContext, spans, numSpans);
+  if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+    return status;
+  }
+  if (status == GLIB_OK) {
+    drawnElements++;
   }
   return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
@@ -288,3 +287,16 @@ static EMSTATUS GLIB_drawPartialCirclePoints(GLIB_Context_t *pContext,
   }
   return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
+
+/**************************************************************************//**
+*  @brief
+*  Appends a horizontal fill line to the spans of a filled circle.
+******************************************************************************/
+static void GLIB_addCircleSpan(DMD_Span *spans, uint32_t *pNumSpans,
+                               int32_t y, int32_t x0, int32_t x1)
+{
+  spans[*pNumSpans].y  = y;
+  spans[*pNumSpans].x0 = x0;
+  spans[*pNumSpans].x1 = x1;
+  (*pNumSpans)++;
+}
@@ -28,90 +28,122 @@
  *
  ******************************************************************************/
 
+/* Generated by PC-host-sim/tools/fontc.py from narrow_6x8.bdf, do not edit. */
+
 /* Standard C header files */
 #include <stdint.h>
 #include "glib.h"
 
 #if (SL_GLIB_FONTNARROW_6X8 == 1) || defined(DOXYGEN)
 
-/** @brief Pixel data for the "GLIB_FontNarrow6x8" font. */
+/** @brief Pixel data for the "GLIB_FontNarrow6x8" font.
+ *  8 rows of 1 byte per glyph, leftmost pixel in bit 0. */
 static const uint8_t GLIB_FontNarrow6x8PixMap[] =
 {
-  0x00, 0x04, 0x0a, 0x0a, 0x04, 0x03, 0x06, 0x06, 0x08, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x0e, 0x1f, 0x08, 0x1f, 0x0c, 0x1f,
-  0x0e, 0x0e, 0x00, 0x00, 0x10, 0x00, 0x01, 0x0e, 0x0e, 0x0e, 0x0f, 0x0e,
-  0x07, 0x1f, 0x1f, 0x0e, 0x11, 0x0e, 0x1c, 0x11, 0x01, 0x11, 0x11, 0x0e,
-  0x0f, 0x0e, 0x0f, 0x1e, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x0e,
-  0x00, 0x0e, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x01, 0x04, 0x08, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x06, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x1e, 0x13, 0x09, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x11, 0x06, 0x11, 0x08,
-  0x0c, 0x01, 0x02, 0x10, 0x11, 0x11, 0x06, 0x06, 0x08, 0x00, 0x02, 0x11,
-  0x10, 0x11, 0x11, 0x11, 0x09, 0x01, 0x01, 0x11, 0x11, 0x04, 0x08, 0x09,
-  0x01, 0x1b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x04, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x10, 0x02, 0x00, 0x08, 0x0a, 0x00, 0x04, 0x00, 0x01, 0x00,
-  0x10, 0x00, 0x12, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x04, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f,
-  0x01, 0x08, 0x05, 0x02, 0x02, 0x08, 0x15, 0x04, 0x00, 0x00, 0x00, 0x10,
-  0x19, 0x04, 0x10, 0x04, 0x0a, 0x0f, 0x01, 0x08, 0x11, 0x11, 0x06, 0x06,
-  0x04, 0x1f, 0x04, 0x10, 0x10, 0x11, 0x11, 0x01, 0x11, 0x01, 0x01, 0x01,
-  0x11, 0x04, 0x08, 0x05, 0x01, 0x15, 0x13, 0x11, 0x11, 0x11, 0x11, 0x01,
-  0x04, 0x11, 0x11, 0x11, 0x0a, 0x11, 0x08, 0x02, 0x01, 0x08, 0x11, 0x00,
-  0x08, 0x0e, 0x0d, 0x0e, 0x16, 0x0e, 0x02, 0x11, 0x0d, 0x06, 0x0c, 0x09,
-  0x04, 0x0b, 0x0d, 0x0e, 0x0f, 0x16, 0x0d, 0x0e, 0x07, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x1f, 0x02, 0x04, 0x08, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x0a, 0x0e, 0x04, 0x02, 0x00, 0x02, 0x08, 0x0e, 0x1f,
-  0x00, 0x1f, 0x00, 0x08, 0x15, 0x04, 0x08, 0x08, 0x09, 0x10, 0x0f, 0x04,
-  0x0e, 0x1e, 0x00, 0x00, 0x02, 0x00, 0x08, 0x08, 0x16, 0x11, 0x0f, 0x01,
-  0x11, 0x0f, 0x0f, 0x1d, 0x1f, 0x04, 0x08, 0x03, 0x01, 0x15, 0x15, 0x11,
-  0x0f, 0x11, 0x0f, 0x0e, 0x04, 0x11, 0x11, 0x15, 0x04, 0x0a, 0x04, 0x02,
-  0x02, 0x08, 0x00, 0x00, 0x00, 0x10, 0x13, 0x01, 0x19, 0x11, 0x07, 0x11,
-  0x13, 0x04, 0x08, 0x05, 0x04, 0x15, 0x13, 0x11, 0x11, 0x19, 0x13, 0x01,
-  0x02, 0x11, 0x11, 0x11, 0x0a, 0x11, 0x08, 0x01, 0x04, 0x10, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x02, 0x15, 0x00,
-  0x02, 0x08, 0x15, 0x04, 0x06, 0x00, 0x00, 0x04, 0x13, 0x04, 0x04, 0x10,
-  0x1f, 0x10, 0x11, 0x02, 0x11, 0x10, 0x06, 0x06, 0x04, 0x1f, 0x04, 0x04,
-  0x15, 0x1f, 0x11, 0x01, 0x11, 0x01, 0x01, 0x11, 0x11, 0x04, 0x08, 0x05,
-  0x01, 0x11, 0x19, 0x11, 0x01, 0x15, 0x05, 0x10, 0x04, 0x11, 0x11, 0x15,
-  0x0a, 0x04, 0x02, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x01,
-  0x11, 0x1f, 0x02, 0x1e, 0x11, 0x04, 0x08, 0x03, 0x04, 0x15, 0x11, 0x11,
-  0x0f, 0x1e, 0x01, 0x0e, 0x02, 0x11, 0x11, 0x15, 0x04, 0x1e, 0x04, 0x02,
-  0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x0f, 0x19, 0x09, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x06, 0x02,
-  0x11, 0x04, 0x02, 0x11, 0x08, 0x11, 0x11, 0x02, 0x11, 0x08, 0x06, 0x04,
-  0x08, 0x00, 0x02, 0x00, 0x15, 0x11, 0x11, 0x11, 0x09, 0x01, 0x01, 0x11,
-  0x11, 0x04, 0x09, 0x09, 0x01, 0x11, 0x11, 0x11, 0x01, 0x09, 0x09, 0x10,
-  0x04, 0x11, 0x0a, 0x15, 0x11, 0x04, 0x01, 0x02, 0x08, 0x08, 0x00, 0x00,
-  0x00, 0x11, 0x11, 0x11, 0x11, 0x01, 0x02, 0x10, 0x11, 0x04, 0x09, 0x05,
-  0x04, 0x11, 0x11, 0x11, 0x01, 0x10, 0x01, 0x10, 0x12, 0x19, 0x0a, 0x15,
-  0x0a, 0x10, 0x02, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x0a, 0x04, 0x18, 0x16, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x02, 0x00, 0x06, 0x01, 0x0e, 0x0e, 0x1f, 0x0e, 0x08, 0x0e, 0x0e, 0x02,
-  0x0e, 0x06, 0x00, 0x02, 0x10, 0x00, 0x01, 0x04, 0x0e, 0x11, 0x0f, 0x0e,
-  0x07, 0x1f, 0x01, 0x0e, 0x11, 0x0e, 0x06, 0x11, 0x1f, 0x11, 0x11, 0x0e,
-  0x01, 0x16, 0x11, 0x0f, 0x04, 0x0e, 0x04, 0x0a, 0x11, 0x04, 0x1f, 0x0e,
-  0x10, 0x0e, 0x00, 0x1f, 0x00, 0x1e, 0x0f, 0x0e, 0x1e, 0x0e, 0x02, 0x0e,
-  0x11, 0x0e, 0x06, 0x09, 0x0e, 0x11, 0x11, 0x0e, 0x01, 0x10, 0x01, 0x0f,
-  0x0c, 0x16, 0x04, 0x0a, 0x11, 0x0e, 0x1f, 0x0c, 0x04, 0x06, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ' ' */
+  0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, /* '!' */
+  0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, /* '"' */
+  0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a, 0x00, /* '#' */
+  0x04, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x04, 0x00, /* '$' */
+  0x03, 0x13, 0x08, 0x04, 0x02, 0x19, 0x18, 0x00, /* '%' */
+  0x06, 0x09, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00, /* '&' */
+  0x06, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, /* '\'' */
+  0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00, /* '(' */
+  0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00, /* ')' */
+  0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00, 0x00, /* '*' */
+  0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x02, 0x00, /* ',' */
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, /* '.' */
+  0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, /* '/' */
+  0x0e, 0x11, 0x19, 0x15, 0x13, 0x11, 0x0e, 0x00, /* '0' */
+  0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, /* '1' */
+  0x0e, 0x11, 0x10, 0x08, 0x04, 0x02, 0x1f, 0x00, /* '2' */
+  0x1f, 0x08, 0x04, 0x08, 0x10, 0x11, 0x0e, 0x00, /* '3' */
+  0x08, 0x0c, 0x0a, 0x09, 0x1f, 0x08, 0x08, 0x00, /* '4' */
+  0x1f, 0x01, 0x0f, 0x10, 0x10, 0x11, 0x0e, 0x00, /* '5' */
+  0x0c, 0x02, 0x01, 0x0f, 0x11, 0x11, 0x0e, 0x00, /* '6' */
+  0x1f, 0x10, 0x08, 0x04, 0x02, 0x02, 0x02, 0x00, /* '7' */
+  0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00, /* '8' */
+  0x0e, 0x11, 0x11, 0x1e, 0x10, 0x08, 0x06, 0x00, /* '9' */
+  0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x00, /* ':' */
+  0x00, 0x06, 0x06, 0x00, 0x06, 0x04, 0x02, 0x00, /* ';' */
+  0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, /* '<' */
+  0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, /* '=' */
+  0x01, 0x02, 0x04, 0x08, 0x04, 0x02, 0x01, 0x00, /* '>' */
+  0x0e, 0x11, 0x10, 0x08, 0x04, 0x00, 0x04, 0x00, /* '?' */
+  0x0e, 0x10, 0x10, 0x16, 0x15, 0x15, 0x0e, 0x00, /* '@' */
+  0x0e, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, /* 'A' */
+  0x0f, 0x11, 0x11, 0x0f, 0x11, 0x11, 0x0f, 0x00, /* 'B' */
+  0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, /* 'C' */
+  0x07, 0x09, 0x11, 0x11, 0x11, 0x09, 0x07, 0x00, /* 'D' */
+  0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, /* 'E' */
+  0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, /* 'F' */
+  0x0e, 0x11, 0x01, 0x1d, 0x11, 0x11, 0x0e, 0x00, /* 'G' */
+  0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, /* 'H' */
+  0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, /* 'I' */
+  0x1c, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00, /* 'J' */
+  0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, /* 'K' */
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, /* 'L' */
+  0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11, 0x00, /* 'M' */
+  0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, /* 'N' */
+  0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, /* 'O' */
+  0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, /* 'P' */
+  0x0e, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16, 0x00, /* 'Q' */
+  0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x00, /* 'R' */
+  0x1e, 0x01, 0x01, 0x0e, 0x10, 0x10, 0x0f, 0x00, /* 'S' */
+  0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, /* 'T' */
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, /* 'U' */
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, /* 'V' */
+  0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a, 0x00, /* 'W' */
+  0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, /* 'X' */
+  0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00, /* 'Y' */
+  0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, /* 'Z' */
+  0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00, /* '[' */
+  0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, /* '\\' */
+  0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00, /* ']' */
+  0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, /* '_' */
+  0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, /* '`' */
+  0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, /* 'a' */
+  0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f, 0x00, /* 'b' */
+  0x00, 0x00, 0x0e, 0x01, 0x01, 0x11, 0x0e, 0x00, /* 'c' */
+  0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1e, 0x00, /* 'd' */
+  0x00, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x0e, 0x00, /* 'e' */
+  0x0c, 0x12, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, /* 'f' */
+  0x00, 0x1e, 0x11, 0x11, 0x1e, 0x10, 0x0e, 0x00, /* 'g' */
+  0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, /* 'h' */
+  0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, /* 'i' */
+  0x08, 0x00, 0x0c, 0x08, 0x08, 0x09, 0x06, 0x00, /* 'j' */
+  0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00, /* 'k' */
+  0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, /* 'l' */
+  0x00, 0x00, 0x0b, 0x15, 0x15, 0x11, 0x11, 0x00, /* 'm' */
+  0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, /* 'n' */
+  0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, /* 'o' */
+  0x00, 0x00, 0x0f, 0x11, 0x0f, 0x01, 0x01, 0x00, /* 'p' */
+  0x00, 0x00, 0x16, 0x19, 0x1e, 0x10, 0x10, 0x00, /* 'q' */
+  0x00, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x00, /* 'r' */
+  0x00, 0x00, 0x0e, 0x01, 0x0e, 0x10, 0x0f, 0x00, /* 's' */
+  0x02, 0x02, 0x07, 0x02, 0x02, 0x12, 0x0c, 0x00, /* 't' */
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, /* 'u' */
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, /* 'v' */
+  0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, /* 'w' */
+  0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, /* 'x' */
+  0x00, 0x00, 0x11, 0x11, 0x1e, 0x10, 0x0e, 0x00, /* 'y' */
+  0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x00, /* 'z' */
+  0x0c, 0x02, 0x02, 0x01, 0x02, 0x02, 0x0c, 0x00, /* '{' */
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, /* '|' */
+  0x06, 0x08, 0x08, 0x10, 0x08, 0x08, 0x06, 0x00, /* '}' */
+  0x00, 0x02, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00  /* '~' */
 };
 
 /**
  * @brief Narrow 6x8 pixels font containing characters and numbers.
  */
 const GLIB_Font_t GLIB_FontNarrow6x8 = { (void *)GLIB_FontNarrow6x8PixMap,
-                                         sizeof(GLIB_FontNarrow6x8PixMap),
+                                         95, /* glyphs */
                                          sizeof(GLIB_FontNarrow6x8PixMap[0]),
-                                         100, 6, 8, 2, 0, FullFont };
+                                         1, 6, 8, 2, 0, FullFont,
+                                         GLIB_FONT_LAYOUT_GLYPH_ROWS, NULL };
 
 #endif // SL_GLIB_FONTNARROW_6X8
@@ -28,90 +28,122 @@
  *
  ******************************************************************************/
 
+/* Generated by PC-host-sim/tools/fontc.py from normal_8x8.bdf, do not edit. */
+
 /* Standard C header files */
 #include <stdint.h>
 #include "glib.h"
 
 #if (SL_GLIB_FONTNORMAL_8X8 == 1) || defined(DOXYGEN)
 
-/** @brief Pixel data for the "GLIB_FontNormal8x8" font. */
+/** @brief Pixel data for the "GLIB_FontNormal8x8" font.
+ *  8 rows of 1 byte per glyph, leftmost pixel in bit 0. */
 static const uint8_t GLIB_FontNormal8x8PixMap[] =
 {
-  0x00, 0x18, 0x6c, 0x6c, 0x10, 0xce, 0x38, 0x08, 0x60, 0x0c, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7c, 0x30, 0x7c, 0x7c, 0xc6, 0xfe, 0x7c, 0xfe,
-  0x7c, 0x7c, 0x00, 0x00, 0x70, 0x00, 0x1c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7c,
-  0x7e, 0xfe, 0xfe, 0x7c, 0xc6, 0x3c, 0x78, 0xc6, 0x06, 0xc6, 0xc6, 0x7c,
-  0x7e, 0x7c, 0x7e, 0x7c, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x7c,
-  0x00, 0x7c, 0x10, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x60, 0x00, 0x38, 0x00,
-  0x06, 0x00, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x18, 0x8c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6c, 0xfe, 0xfc, 0x6a, 0x2c, 0x18,
-  0x30, 0x18, 0x6c, 0x18, 0x00, 0x00, 0x00, 0xc0, 0xc6, 0x38, 0xc6, 0xc6,
-  0xc6, 0x06, 0xc6, 0xc0, 0xc6, 0xc6, 0x18, 0x18, 0x38, 0x7c, 0x38, 0xc6,
-  0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x06, 0x06, 0xc6, 0xc6, 0x18, 0x30, 0x66,
-  0x06, 0xee, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x18, 0xc6, 0xc6, 0xc6,
-  0xc6, 0xc6, 0xc0, 0x0c, 0x06, 0x60, 0x38, 0x00, 0x0c, 0x00, 0x06, 0x00,
-  0x60, 0x00, 0x0c, 0x00, 0x06, 0x18, 0x30, 0x06, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x18, 0x30, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x48, 0xfe,
-  0x16, 0x2e, 0x2c, 0x18, 0x18, 0x30, 0x38, 0x18, 0x00, 0x00, 0x00, 0x60,
-  0xc6, 0x30, 0x60, 0xc0, 0xc6, 0x06, 0x06, 0x60, 0xc6, 0xc6, 0x18, 0x18,
-  0x1c, 0x7c, 0x70, 0xc6, 0xf6, 0xc6, 0xc6, 0x06, 0xc6, 0x06, 0x06, 0x06,
-  0xc6, 0x18, 0x30, 0x36, 0x06, 0xfe, 0xde, 0xc6, 0xc6, 0xc6, 0xc6, 0x06,
-  0x18, 0xc6, 0xc6, 0xc6, 0x6c, 0xc6, 0x60, 0x0c, 0x0c, 0x60, 0x6c, 0x00,
-  0x04, 0x3c, 0x3e, 0x3c, 0x7c, 0x3c, 0x3c, 0x3c, 0x3e, 0x00, 0x00, 0x66,
-  0x0c, 0x6e, 0x3e, 0x3c, 0x3e, 0x3c, 0x36, 0x3c, 0x18, 0x66, 0x66, 0xc6,
-  0x66, 0x66, 0x7e, 0x18, 0x18, 0x30, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x00, 0x6c, 0x7c, 0x10, 0xdc, 0x00, 0x18, 0x30, 0xfe, 0x7e,
-  0x1c, 0x7e, 0x00, 0x30, 0xc6, 0x30, 0x30, 0x70, 0xfe, 0x7e, 0x7e, 0x30,
-  0x7c, 0xfc, 0x00, 0x00, 0x0e, 0x00, 0xe0, 0x70, 0xf6, 0xfe, 0x7e, 0x06,
-  0xc6, 0x1e, 0x1e, 0xf6, 0xfe, 0x18, 0x30, 0x1e, 0x06, 0xd6, 0xf6, 0xc6,
-  0x7e, 0xc6, 0x7e, 0x7c, 0x18, 0xc6, 0xc6, 0xd6, 0x38, 0xfc, 0x30, 0x0c,
-  0x18, 0x60, 0xc6, 0x00, 0x00, 0x60, 0x66, 0x06, 0x66, 0x66, 0x0c, 0x66,
-  0x66, 0x18, 0x30, 0x36, 0x0c, 0xd6, 0x66, 0x66, 0x66, 0x66, 0x6e, 0x06,
-  0x7c, 0x66, 0x66, 0xc6, 0x3c, 0x66, 0x30, 0x0c, 0x00, 0x60, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd0, 0xe8, 0x66, 0x00,
-  0x18, 0x30, 0x38, 0x7e, 0x1c, 0x7e, 0x1c, 0x18, 0xc6, 0x30, 0x18, 0xc0,
-  0xc0, 0xc0, 0xc6, 0x18, 0xc6, 0xc0, 0x18, 0x18, 0x1c, 0x7c, 0x70, 0x30,
-  0x76, 0xc6, 0xc6, 0x06, 0xc6, 0x06, 0x06, 0xc6, 0xc6, 0x18, 0x30, 0x36,
-  0x06, 0xc6, 0xe6, 0xc6, 0x06, 0xb6, 0xc6, 0xc0, 0x18, 0xc6, 0xc6, 0xfe,
-  0x6c, 0xc0, 0x18, 0x0c, 0x30, 0x60, 0x00, 0x00, 0x00, 0x7c, 0x66, 0x06,
-  0x66, 0x7e, 0x0c, 0x7c, 0x66, 0x18, 0x30, 0x1e, 0x0c, 0xd6, 0x66, 0x66,
-  0x3e, 0x56, 0x06, 0x3c, 0x18, 0x66, 0x66, 0xd6, 0x18, 0x7c, 0x18, 0x18,
-  0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xfe,
-  0x7e, 0xac, 0x66, 0x00, 0x30, 0x18, 0x6c, 0x18, 0x18, 0x00, 0x1c, 0x0c,
-  0xc6, 0x30, 0x0c, 0xc6, 0xc0, 0xc6, 0xc6, 0x0c, 0xc6, 0xc6, 0x18, 0x18,
-  0x38, 0x7c, 0x38, 0x00, 0x06, 0xc6, 0xc6, 0xc6, 0xc6, 0x06, 0x06, 0xc6,
-  0xc6, 0x18, 0x36, 0x66, 0x06, 0xc6, 0xc6, 0xc6, 0x06, 0x66, 0xc6, 0xc6,
-  0x18, 0xc6, 0x6c, 0xee, 0xc6, 0xc0, 0x0c, 0x0c, 0x60, 0x60, 0x00, 0xfe,
-  0x00, 0x66, 0x66, 0x06, 0x66, 0x06, 0x0c, 0x60, 0x66, 0x18, 0x36, 0x36,
-  0x0c, 0xc6, 0x66, 0x66, 0x06, 0x26, 0x06, 0x60, 0x18, 0x66, 0x3c, 0xd6,
-  0x3c, 0x60, 0x0c, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x00, 0x6c, 0x10, 0xe6, 0xdc, 0x00, 0x60, 0x0c, 0x00, 0x18,
-  0x0c, 0x00, 0x1c, 0x06, 0x7c, 0x78, 0xfe, 0x7c, 0xc0, 0x7c, 0x7c, 0x06,
-  0x7c, 0x7c, 0x00, 0x0c, 0x70, 0x00, 0x1c, 0x30, 0x7c, 0xc6, 0x7e, 0x7c,
-  0x7e, 0xfe, 0x06, 0xfc, 0xc6, 0x3c, 0x1c, 0xc6, 0xfe, 0xc6, 0xc6, 0x7c,
-  0x06, 0xdc, 0xc6, 0x7c, 0x18, 0x7c, 0x38, 0xc6, 0xc6, 0x7e, 0xfe, 0x7c,
-  0xc0, 0x7c, 0x00, 0xfe, 0x00, 0x7c, 0x3e, 0x3c, 0x7c, 0x3c, 0x0c, 0x3e,
-  0x66, 0x70, 0x1c, 0x66, 0x38, 0xc6, 0x66, 0x3c, 0x06, 0x5c, 0x06, 0x3e,
-  0x70, 0x7c, 0x18, 0xfc, 0x66, 0x3e, 0x7e, 0x30, 0x18, 0x18, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ' ' */
+  0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, /* '!' */
+  0x6c, 0x6c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, /* '"' */
+  0x6c, 0xfe, 0xfe, 0x6c, 0xfe, 0xfe, 0x6c, 0x00, /* '#' */
+  0x10, 0xfc, 0x16, 0x7c, 0xd0, 0x7e, 0x10, 0x00, /* '$' */
+  0xce, 0x6a, 0x2e, 0x10, 0xe8, 0xac, 0xe6, 0x00, /* '%' */
+  0x38, 0x2c, 0x2c, 0xdc, 0x66, 0x66, 0xdc, 0x00, /* '&' */
+  0x08, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, /* '\'' */
+  0x60, 0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00, /* '(' */
+  0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00, /* ')' */
+  0x00, 0x6c, 0x38, 0xfe, 0x38, 0x6c, 0x00, 0x00, /* '*' */
+  0x00, 0x18, 0x18, 0x7e, 0x7e, 0x18, 0x18, 0x00, /* '+' */
+  0x00, 0x00, 0x00, 0x1c, 0x1c, 0x18, 0x0c, 0x00, /* ',' */
+  0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00, /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x00, /* '.' */
+  0x00, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00, /* '/' */
+  0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, /* '0' */
+  0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00, /* '1' */
+  0x7c, 0xc6, 0x60, 0x30, 0x18, 0x0c, 0xfe, 0x00, /* '2' */
+  0x7c, 0xc6, 0xc0, 0x70, 0xc0, 0xc6, 0x7c, 0x00, /* '3' */
+  0xc6, 0xc6, 0xc6, 0xfe, 0xc0, 0xc0, 0xc0, 0x00, /* '4' */
+  0xfe, 0x06, 0x06, 0x7e, 0xc0, 0xc6, 0x7c, 0x00, /* '5' */
+  0x7c, 0xc6, 0x06, 0x7e, 0xc6, 0xc6, 0x7c, 0x00, /* '6' */
+  0xfe, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00, /* '7' */
+  0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, /* '8' */
+  0x7c, 0xc6, 0xc6, 0xfc, 0xc0, 0xc6, 0x7c, 0x00, /* '9' */
+  0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, /* ':' */
+  0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x0c, 0x00, /* ';' */
+  0x70, 0x38, 0x1c, 0x0e, 0x1c, 0x38, 0x70, 0x00, /* '<' */
+  0x00, 0x7c, 0x7c, 0x00, 0x7c, 0x7c, 0x00, 0x00, /* '=' */
+  0x1c, 0x38, 0x70, 0xe0, 0x70, 0x38, 0x1c, 0x00, /* '>' */
+  0x7c, 0xc6, 0xc6, 0x70, 0x30, 0x00, 0x30, 0x00, /* '?' */
+  0x7c, 0xc6, 0xf6, 0xf6, 0x76, 0x06, 0x7c, 0x00, /* '@' */
+  0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, /* 'A' */
+  0x7e, 0xc6, 0xc6, 0x7e, 0xc6, 0xc6, 0x7e, 0x00, /* 'B' */
+  0x7c, 0xc6, 0x06, 0x06, 0x06, 0xc6, 0x7c, 0x00, /* 'C' */
+  0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x00, /* 'D' */
+  0xfe, 0x06, 0x06, 0x1e, 0x06, 0x06, 0xfe, 0x00, /* 'E' */
+  0xfe, 0x06, 0x06, 0x1e, 0x06, 0x06, 0x06, 0x00, /* 'F' */
+  0x7c, 0xc6, 0x06, 0xf6, 0xc6, 0xc6, 0xfc, 0x00, /* 'G' */
+  0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, /* 'H' */
+  0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, /* 'I' */
+  0x78, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, /* 'J' */
+  0xc6, 0x66, 0x36, 0x1e, 0x36, 0x66, 0xc6, 0x00, /* 'K' */
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xfe, 0x00, /* 'L' */
+  0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x00, /* 'M' */
+  0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0xc6, 0x00, /* 'N' */
+  0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, /* 'O' */
+  0x7e, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, /* 'P' */
+  0x7c, 0xc6, 0xc6, 0xc6, 0xb6, 0x66, 0xdc, 0x00, /* 'Q' */
+  0x7e, 0xc6, 0xc6, 0x7e, 0xc6, 0xc6, 0xc6, 0x00, /* 'R' */
+  0x7c, 0xc6, 0x06, 0x7c, 0xc0, 0xc6, 0x7c, 0x00, /* 'S' */
+  0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, /* 'T' */
+  0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, /* 'U' */
+  0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, /* 'V' */
+  0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, /* 'W' */
+  0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x00, /* 'X' */
+  0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0x7e, 0x00, /* 'Y' */
+  0xfe, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0xfe, 0x00, /* 'Z' */
+  0x7c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x7c, 0x00, /* '[' */
+  0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x00, /* '\\' */
+  0x7c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7c, 0x00, /* ']' */
+  0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, /* '_' */
+  0x0c, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, /* '`' */
+  0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00, /* 'a' */
+  0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x3e, 0x00, /* 'b' */
+  0x00, 0x00, 0x3c, 0x06, 0x06, 0x06, 0x3c, 0x00, /* 'c' */
+  0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x00, /* 'd' */
+  0x00, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00, /* 'e' */
+  0x38, 0x0c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, /* 'f' */
+  0x00, 0x00, 0x3c, 0x66, 0x7c, 0x60, 0x3e, 0x00, /* 'g' */
+  0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00, /* 'h' */
+  0x00, 0x18, 0x00, 0x18, 0x18, 0x18, 0x70, 0x00, /* 'i' */
+  0x00, 0x30, 0x00, 0x30, 0x30, 0x36, 0x1c, 0x00, /* 'j' */
+  0x06, 0x06, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00, /* 'k' */
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x00, /* 'l' */
+  0x00, 0x00, 0x6e, 0xd6, 0xd6, 0xc6, 0xc6, 0x00, /* 'm' */
+  0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00, /* 'n' */
+  0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00, /* 'o' */
+  0x00, 0x00, 0x3e, 0x66, 0x3e, 0x06, 0x06, 0x00, /* 'p' */
+  0x00, 0x00, 0x3c, 0x66, 0x56, 0x26, 0x5c, 0x00, /* 'q' */
+  0x00, 0x00, 0x36, 0x6e, 0x06, 0x06, 0x06, 0x00, /* 'r' */
+  0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x00, /* 's' */
+  0x00, 0x18, 0x18, 0x7c, 0x18, 0x18, 0x70, 0x00, /* 't' */
+  0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00, /* 'u' */
+  0x00, 0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00, /* 'v' */
+  0x00, 0x00, 0xc6, 0xc6, 0xd6, 0xd6, 0xfc, 0x00, /* 'w' */
+  0x00, 0x00, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x00, /* 'x' */
+  0x00, 0x00, 0x66, 0x66, 0x7c, 0x60, 0x3e, 0x00, /* 'y' */
+  0x00, 0x00, 0x7e, 0x30, 0x18, 0x0c, 0x7e, 0x00, /* 'z' */
+  0x30, 0x18, 0x18, 0x0c, 0x18, 0x18, 0x30, 0x00, /* '{' */
+  0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, /* '|' */
+  0x18, 0x30, 0x30, 0x60, 0x30, 0x30, 0x18, 0x00, /* '}' */
+  0x8c, 0xd6, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00  /* '~' */
 };
 
 /**
  * @brief Normal 8x8 pixels font containing characters and numbers.
  */
 const GLIB_Font_t GLIB_FontNormal8x8 = { (void *)GLIB_FontNormal8x8PixMap,
-                                         sizeof(GLIB_FontNormal8x8PixMap),
+                                         95, /* glyphs */
                                          sizeof(GLIB_FontNormal8x8PixMap[0]),
-                                         100, 8, 8, 2, 0, FullFont };
+                                         1, 8, 8, 2, 0, FullFont,
+                                         GLIB_FONT_LAYOUT_GLYPH_ROWS, NULL };
 
-#endif // SL_GLIB_FONTNORMAL_8x8
+#endif // SL_GLIB_FONTNORMAL_8X8
@@ -28,43 +28,87 @@
  *
  ******************************************************************************/
 
+/* Generated by PC-host-sim/tools/fontc.py from number_16x20.bdf, do not edit. */
+
 /* Standard C header files */
 #include <stdint.h>
 #include "glib.h"
 
 #if (SL_GLIB_FONTNUMBER_16X20 == 1) || defined(DOXYGEN)
 
-/** @brief Pixel data for the "GLIB_FontNumber16x20" font. */
-static const uint16_t GLIB_FontNumber16x20PixMap[] =
+/** @brief Pixel data for the "GLIB_FontNumber16x20" font.
+ *  20 rows of 2 bytes per glyph, leftmost pixel in bit 0. */
+static const uint8_t GLIB_FontNumber16x20PixMap[] =
 {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x03c0, 0x0300, 0x07c0, 0x03e0, 0x0f00, 0x1ff8, 0x1f00, 0x1ffc, 0x07e0, 0x03e0, 0x0000, 0x0000,
-  0x0ff0, 0x03e0, 0x0fe0, 0x0ff0, 0x0f80, 0x1ff8, 0x3fc0, 0x1ffc, 0x0ff8, 0x07f0, 0x0000, 0x0000,
-  0x1e78, 0x03fc, 0x1c70, 0x0e38, 0x0f80, 0x0038, 0x31e0, 0x1c0c, 0x1c38, 0x0e38, 0x0180, 0x0000,
-  0x1c38, 0x03bc, 0x3838, 0x1c18, 0x0fc0, 0x0038, 0x0070, 0x1c0c, 0x381c, 0x1c1c, 0x03c0, 0x0000,
-  0x381c, 0x0380, 0x3838, 0x1c00, 0x0ee0, 0x0038, 0x0038, 0x0e00, 0x381c, 0x181c, 0x03c0, 0x0000,
-  0x381c, 0x0380, 0x3838, 0x1c00, 0x0ee0, 0x07b8, 0x0038, 0x0e00, 0x381c, 0x381c, 0x0180, 0x0000,
-  0x381c, 0x0380, 0x3c00, 0x0e00, 0x0e70, 0x0ff8, 0x07dc, 0x0e00, 0x1c38, 0x381c, 0x0000, 0x0000,
-  0x381c, 0x0380, 0x1c00, 0x07c0, 0x0e70, 0x1c38, 0x0ffc, 0x0700, 0x0ff0, 0x3c1c, 0x0000, 0x0000,
-  0x381c, 0x0380, 0x0e00, 0x07c0, 0x0e38, 0x3818, 0x1c7c, 0x0700, 0x0ff0, 0x3e38, 0x0000, 0x0000,
-  0x381c, 0x0380, 0x0700, 0x1e00, 0x0e1c, 0x3800, 0x3c3c, 0x0700, 0x1c38, 0x3ff0, 0x0000, 0x0000,
-  0x381c, 0x0380, 0x0380, 0x3c00, 0x3ffc, 0x3800, 0x383c, 0x0780, 0x381c, 0x3be0, 0x0180, 0x0000,
-  0x381c, 0x0380, 0x01c0, 0x3800, 0x3ffc, 0x3800, 0x381c, 0x0380, 0x381c, 0x3c00, 0x03c0, 0x0000,
-  0x381c, 0x0380, 0x00e0, 0x3800, 0x0e00, 0x3800, 0x381c, 0x0380, 0x381c, 0x1c00, 0x03c0, 0x0000,
-  0x1c38, 0x0380, 0x0070, 0x3800, 0x0e00, 0x3800, 0x3838, 0x0380, 0x381c, 0x0e00, 0x0180, 0x0000,
-  0x1e78, 0x0380, 0x0038, 0x1c0c, 0x0e00, 0x1c0c, 0x1c38, 0x01c0, 0x1c38, 0x0f8c, 0x0000, 0x0000,
-  0x0ff0, 0x7ffc, 0x3ffc, 0x1ffc, 0x3fc0, 0x0ffc, 0x1ff0, 0x01c0, 0x1ff8, 0x03fc, 0x0000, 0x0000,
-  0x03c0, 0x7ffc, 0x3ffc, 0x07f0, 0x3fc0, 0x07f0, 0x07c0, 0x01c0, 0x07e0, 0x00f8, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xf0, 0x0f, 0x78, 0x1e, 0x38, 0x1c,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x38, 0x1c, 0x78, 0x1e, 0xf0, 0x0f,
+  0xc0, 0x03, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xfc, 0x03, 0xbc, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0xfc, 0x7f,
+  0xfc, 0x7f, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0xe0, 0x0f, 0x70, 0x1c, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07,
+  0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0xfc, 0x3f,
+  0xfc, 0x3f, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xf0, 0x0f, 0x38, 0x0e, 0x18, 0x1c,
+  0x00, 0x1c, 0x00, 0x1c, 0x00, 0x0e, 0xc0, 0x07, 0xc0, 0x07, 0x00, 0x1e,
+  0x00, 0x3c, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x0c, 0x1c, 0xfc, 0x1f,
+  0xf0, 0x07, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0xc0, 0x0f,
+  0xe0, 0x0e, 0xe0, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x38, 0x0e, 0x1c, 0x0e,
+  0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0xc0, 0x3f,
+  0xc0, 0x3f, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0xb8, 0x07, 0xf8, 0x0f, 0x38, 0x1c, 0x18, 0x38, 0x00, 0x38,
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x0c, 0x1c, 0xfc, 0x0f,
+  0xf0, 0x07, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x3f, 0xe0, 0x31, 0x70, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0xdc, 0x07, 0xfc, 0x0f, 0x7c, 0x1c, 0x3c, 0x3c,
+  0x3c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x38, 0x38, 0x38, 0x1c, 0xf0, 0x1f,
+  0xc0, 0x07, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xfc, 0x1f, 0x0c, 0x1c, 0x0c, 0x1c,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x80, 0x07, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0xc0, 0x01, 0xc0, 0x01,
+  0xc0, 0x01, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0xf8, 0x0f, 0x38, 0x1c, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x38, 0x1c, 0xf0, 0x0f, 0xf0, 0x0f, 0x38, 0x1c,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x38, 0x1c, 0xf8, 0x1f,
+  0xe0, 0x07, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xf0, 0x07, 0x38, 0x0e, 0x1c, 0x1c,
+  0x1c, 0x18, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x3c, 0x38, 0x3e, 0xf0, 0x3f,
+  0xe0, 0x3b, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x0e, 0x8c, 0x0f, 0xfc, 0x03,
+  0xf8, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03,
+  0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
 };
 
 /**
  * @brief Large 16x20 pixels font containing only numbers.
  */
 const GLIB_Font_t GLIB_FontNumber16x20 = { (void *)GLIB_FontNumber16x20PixMap,
-                                           sizeof(GLIB_FontNumber16x20PixMap),
+                                           12, /* glyphs */
                                            sizeof(GLIB_FontNumber16x20PixMap[0]),
-                                           12, 16, 20, 5, 0, NumbersOnlyFont };
+                                           2, 16, 20, 5, 0, NumbersOnlyFont,
+                                           GLIB_FONT_LAYOUT_GLYPH_ROWS, NULL };
 
 #endif // SL_GLIB_FONTNUMBER_16X20
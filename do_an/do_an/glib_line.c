@@ -118,6 +118,67 @@ EMSTATUS GLIB_drawLineH(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
   return GLIB_applyClippingRegion(pContext);
 }
 
+/**************************************************************************//**
+*  @brief
+*  Draws a batch of horizontal lines
+*
+*  All spans are filled with the foreground color by a single call to
+*  DMD_fillSpans(), which clips them against the clipping region. Drivers that
+*  do not support span filling fall back to one GLIB_drawLineH() per span.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t in which the lines are drawn. The lines are
+*  drawn using the foreground color.
+*
+*  @param spans
+*  Array of spans, (y, x0, x1) with both ends inclusive
+*
+*  @param numSpans
+*  Number of spans in the array
+*
+*  @return
+*  Returns GLIB_OK on success.
+*  Returns GLIB_ERROR_NOTHING_TO_DRAW if all spans were outside the clipping region.
+*  Returns error code otherwise.
+******************************************************************************/
+EMSTATUS GLIB_drawSpans(GLIB_Context_t *pContext, const DMD_Span *spans,
+                        uint32_t numSpans)
+{
+  EMSTATUS status;
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint32_t drawnElements = 0;
+
+  /* Check arguments */
+  if (pContext == NULL || (spans == NULL && numSpans > 0)) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
+  status = DMD_fillSpans(spans, numSpans, red, green, blue);
+  if (status == DMD_OK) {
+    return GLIB_OK;
+  }
+  if (status == DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+  if (status != DMD_ERROR_NOT_SUPPORTED) {
+    return status;
+  }
+
+  for (; numSpans; numSpans--, spans++) {
+    status = GLIB_drawLineH(pContext, spans->x0, spans->y, spans->x1);
+    if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+      return status;
+    }
+    if (status == GLIB_OK) {
+      drawnElements++;
+    }
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
 /**************************************************************************//**
 *  @brief
 *  Draws a vertical line from x1, y1 to x1, y2
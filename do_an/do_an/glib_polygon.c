@@ -39,9 +39,14 @@
 
 /* Polygon fill algorithm allocation sizes */
 enum {
-  MAX_CROSSES = 64, /* Maximum intersection points (arbitrary limit) */
+  MAX_CROSSES = 64, /* Maximum points of GLIB_drawPolygonFilled() (arbitrary limit) */
 };
 
+/* Local function prototypes */
+static void GLIB_divFloor(int64_t num, int32_t den, int32_t *pQuot, int32_t *pRem);
+static void GLIB_stepEdge(GLIB_PolygonEdge_t *pEdge);
+static void GLIB_sortEdges(GLIB_PolygonEdge_t *pEdges, uint32_t count);
+
 /**************************************************************************//**
  * @brief
  * Draws a polygon using Bresnham's Midpoint Line Algorithm.
@@ -121,9 +126,8 @@ EMSTATUS GLIB_drawPolygon(GLIB_Context_t *pContext,
  * @brief
  * Draws a filled polygon using a scan line algorithm.
  *
- * This function draws a line between all points outlining the polygon.
- * The first and last point doesn't have to be the same. The function
- * automatically draws a line from the start point to the end point.
+ * Same as GLIB_drawPolygonFilledEx(), with an edge table owned by GLIB that
+ * holds up to MAX_CROSSES points.
  *
  * @param pContext
  *   Pointer to a GLIB_Context_t where the polygon is drawn.
@@ -141,55 +145,236 @@ EMSTATUS GLIB_drawPolygon(GLIB_Context_t *pContext,
 EMSTATUS GLIB_drawPolygonFilled(GLIB_Context_t *pContext,
                                 uint32_t numPoints, const int32_t *polyPoints)
 {
-  size_t i, j, numcrosses;
-  int32_t clip_y0 = pContext->clippingRegion.yMin;
-  int32_t clip_y1 = pContext->clippingRegion.yMax;
-  int32_t cur_y, min_y, max_y;
-  int32_t cross_x[MAX_CROSSES];
-  int32_t curpoint_y, curpoint_x, prvpoint_y, prvpoint_x;
+  static GLIB_PolygonEdge_t edges[MAX_CROSSES];
+
+  /* Check arguments */
+  if (numPoints > MAX_CROSSES) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  return GLIB_drawPolygonFilledEx(pContext, numPoints, polyPoints,
+                                  edges, MAX_CROSSES);
+}
+
+/**************************************************************************//**
+ * @brief
+ * Draws a filled polygon using an active edge table.
+ *
+ * The edges are sorted by their top row once. Going down the rows, an edge
+ * becomes active on its top row, leaves on its bottom row, and its crossing
+ * with the current row is stepped with integer arithmetic only: a whole and
+ * a fractional part in units of 1/dy pixel. The crossings of each row are
+ * sorted and filled pairwise (even-odd rule) from floor(crossing) to
+ * floor(crossing) inclusive. An edge crosses the rows below its upper point
+ * down to and including its lower point; the rows of the topmost and the
+ * bottommost points are not filled. The first and last point doesn't have to
+ * be the same.
+ *
+ * @param pContext
+ *   Pointer to a GLIB_Context_t where the polygon is drawn.
+ *   The polygon drawn using the foreground color.
+ * @param numPoints
+ *   Number of points in the polygon ( Has to be greater than 1 )
+ * @param polyPoints
+ *   Pointer to array of polygon points.
+ *   The points are laid out like this: polyPoints = {x1,y1,x2,y2 ... }
+ *   Polypoints has to contain at least (numPoints * 2) entries
+ * @param pEdges
+ *   Scratch memory for the edge table
+ * @param numEdges
+ *   Number of entries in pEdges, at least numPoints
+ *
+ * @return
+ * Returns GLIB_OK on success.
+ * Returns GLIB_ERROR_NOTHING_TO_DRAW if the polygon is outside the clipping region.
+ * Returns GLIB_ERROR_OUT_OF_MEMORY if pEdges is too small.
+ * Returns error code otherwise.
+ *****************************************************************************/
+EMSTATUS GLIB_drawPolygonFilledEx(GLIB_Context_t *pContext,
+                                  uint32_t numPoints, const int32_t *polyPoints,
+                                  GLIB_PolygonEdge_t *pEdges, uint32_t numEdges)
+{
+  EMSTATUS status;
+  DMD_Span spans[GLIB_SPAN_BATCH_SIZE];
+  uint32_t numSpans = 0;
+  uint32_t drawnElements = 0;
+  uint32_t edgeCount = 0;
+  uint32_t nextEdge = 0;
+  uint32_t activeCount = 0;
+  uint32_t i, j;
+  int32_t min_y, max_y;
+  int32_t cur_y;
 
   /* Check arguments */
   if (pContext == NULL || polyPoints == NULL || numPoints < 2
-      || numPoints > MAX_CROSSES) {
+      || pEdges == NULL) {
     return GLIB_ERROR_INVALID_ARGUMENT;
   }
+  if (numEdges < numPoints) {
+    return GLIB_ERROR_OUT_OF_MEMORY;
+  }
 
-  /* Find bounding box (respecting clipping region) */
+  /* Build the edge table, leaving out horizontal edges */
   min_y = max_y = polyPoints[1];
-  for (i = 1; i < numPoints; i++) {
-    cur_y = polyPoints[2 * i + 1];
-    min_y = (cur_y < min_y) ? cur_y : min_y;
-    max_y = (cur_y > max_y) ? cur_y : max_y;
+  j = numPoints - 1;
+  for (i = 0; i < numPoints; i++) {
+    int32_t x0 = polyPoints[j * 2];
+    int32_t y0 = polyPoints[j * 2 + 1];
+    int32_t x1 = polyPoints[i * 2];
+    int32_t y1 = polyPoints[i * 2 + 1];
+
+    min_y = (y1 < min_y) ? y1 : min_y;
+    max_y = (y1 > max_y) ? y1 : max_y;
+
+    if (y0 != y1) {
+      GLIB_PolygonEdge_t *pEdge = &pEdges[edgeCount++];
+
+      /* Make (x0, y0) the upper point */
+      if (y0 > y1) {
+        int32_t swap;
+        swap = x0; x0 = x1; x1 = swap;
+        swap = y0; y0 = y1; y1 = swap;
+      }
+      pEdge->yTop    = y0 + 1;
+      pEdge->yBottom = y1;
+      pEdge->dy      = y1 - y0;
+      pEdge->x       = x0;
+      pEdge->xFrac   = 0;
+      GLIB_divFloor((int64_t)(x1 - x0), pEdge->dy, &pEdge->xStep, &pEdge->xFracStep);
+    }
+    j = i;
   }
-  min_y = (min_y < clip_y0) ? clip_y0 : min_y;
-  max_y = (max_y > clip_y1) ? clip_y1 : max_y;
-
-  /* Find intersection points */
-  for (cur_y = min_y; cur_y < max_y; cur_y++) {
-    /* Find where the current line intersects each 2-tuple */
-    numcrosses = 0;
-    j = numPoints - 1;
-    for (i = 0; i < numPoints; i++) {
-      curpoint_y = polyPoints[i * 2 + 1];
-      prvpoint_y = polyPoints[j * 2 + 1];
-      if ((curpoint_y < cur_y && prvpoint_y >= cur_y)
-          || (prvpoint_y < cur_y && curpoint_y >= cur_y)) {
-        curpoint_x = polyPoints[i * 2];
-        prvpoint_x = polyPoints[j * 2];
-        cross_x[numcrosses] = (int) (curpoint_x
-                                     + (cur_y - curpoint_y)
-                                     / (float)(prvpoint_y - curpoint_y)
-                                     * (float) (prvpoint_x - curpoint_x));
-        numcrosses++;
+
+  /* Rows to fill: between the topmost and bottommost point, clipped */
+  min_y = (min_y + 1 < pContext->clippingRegion.yMin) ? pContext->clippingRegion.yMin : min_y + 1;
+  max_y = (max_y - 1 > pContext->clippingRegion.yMax) ? pContext->clippingRegion.yMax : max_y - 1;
+
+  GLIB_sortEdges(pEdges, edgeCount);
+
+  for (cur_y = min_y; cur_y <= max_y; cur_y++) {
+    /* Activate the edges starting on this row, or above the clipping region */
+    while (nextEdge < edgeCount && pEdges[nextEdge].yTop <= cur_y) {
+      GLIB_PolygonEdge_t *pEdge = &pEdges[nextEdge];
+
+      if (pEdge->yBottom >= cur_y) {
+        if (pEdge->yTop < cur_y) {
+          /* Jump to this row: x0 + floor((cur_y - y0) * dx / dy) */
+          int32_t xStep;
+          int32_t xFracStep;
+          GLIB_divFloor((int64_t)(cur_y - pEdge->yTop + 1)
+                        * (pEdge->xStep * (int64_t)pEdge->dy + pEdge->xFracStep),
+                        pEdge->dy, &xStep, &xFracStep);
+          pEdge->x    += xStep;
+          pEdge->xFrac = xFracStep;
+        } else {
+          GLIB_stepEdge(pEdge);
+        }
+        pEdges[activeCount++].active = nextEdge;
+      }
+      nextEdge++;
+    }
+
+    /* Sort the active edges by crossing; they stay almost sorted from row to row */
+    for (i = 1; i < activeCount; i++) {
+      uint32_t edge = pEdges[i].active;
+      int32_t  x    = pEdges[edge].x;
+      for (j = i; j > 0 && pEdges[pEdges[j - 1].active].x > x; j--) {
+        pEdges[j].active = pEdges[j - 1].active;
+      }
+      pEdges[j].active = edge;
+    }
+
+    /* Fill between pairs of crossings */
+    for (i = 0; i + 1 < activeCount; i += 2) {
+      spans[numSpans].y  = cur_y;
+      spans[numSpans].x0 = pEdges[pEdges[i].active].x;
+      spans[numSpans].x1 = pEdges[pEdges[i + 1].active].x;
+      numSpans++;
+
+      if (numSpans == GLIB_SPAN_BATCH_SIZE) {
+        status = GLIB_drawSpans(pContext, spans, numSpans);
+        if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+          return status;
+        }
+        if (status == GLIB_OK) {
+          drawnElements++;
+        }
+        numSpans = 0;
       }
-      j = i;
     }
 
-    /* Draw horizontal lines between intersection point 2-tuples */
-    for (i = 0; i < numcrosses; i += 2) {
-      GLIB_drawLineH(pContext, cross_x[i], cur_y, cross_x[i + 1]);
+    /* Retire the edges ending on this row and step the others to the next */
+    for (i = 0, j = 0; i < activeCount; i++) {
+      GLIB_PolygonEdge_t *pEdge = &pEdges[pEdges[i].active];
+      if (pEdge->yBottom > cur_y) {
+        GLIB_stepEdge(pEdge);
+        pEdges[j++].active = pEdges[i].active;
+      }
     }
+    activeCount = j;
   }
 
-  return GLIB_OK;
+  status = GLIB_drawSpans(pContext, spans, numSpans);
+  if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+    return status;
+  }
+  if (status == GLIB_OK) {
+    drawnElements++;
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/**************************************************************************//**
+ * @brief
+ * Divides with the quotient rounded down and a non-negative remainder.
+ *****************************************************************************/
+static void GLIB_divFloor(int64_t num, int32_t den, int32_t *pQuot, int32_t *pRem)
+{
+  int64_t quot = num / den;
+  int64_t rem  = num % den;
+
+  if (rem < 0) {
+    quot--;
+    rem += den;
+  }
+  *pQuot = (int32_t)quot;
+  *pRem  = (int32_t)rem;
+}
+
+/**************************************************************************//**
+ * @brief
+ * Moves the crossing of an edge one row down.
+ *****************************************************************************/
+static void GLIB_stepEdge(GLIB_PolygonEdge_t *pEdge)
+{
+  pEdge->x     += pEdge->xStep;
+  pEdge->xFrac += pEdge->xFracStep;
+  if (pEdge->xFrac >= pEdge->dy) {
+    pEdge->xFrac -= pEdge->dy;
+    pEdge->x++;
+  }
+}
+
+/**************************************************************************//**
+ * @brief
+ * Sorts the edge table by top row (Shell sort, no recursion or heap).
+ *****************************************************************************/
+static void GLIB_sortEdges(GLIB_PolygonEdge_t *pEdges, uint32_t count)
+{
+  GLIB_PolygonEdge_t tmp;
+  uint32_t gap, i, j;
+
+  for (gap = count / 2; gap > 0; gap /= 2) {
+    for (i = gap; i < count; i++) {
+      tmp = pEdges[i];
+      for (j = i; j >= gap && pEdges[j - gap].yTop > tmp.yTop; j -= gap) {
+        pEdges[j] = pEdges[j - gap];
+      }
+      pEdges[j] = tmp;
+    }
+  }
+}
+
+/** @endcond */
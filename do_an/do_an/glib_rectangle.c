@@ -203,7 +203,13 @@ EMSTATUS GLIB_drawRectFilled(GLIB_Context_t *pContext, const GLIB_Rectangle_t *p
     tmpRectangle.yMax = pContext->clippingRegion.yMax;
   }
 
-  /* Draw filled rectangle */
+  if (tmpRectangle.xMin > tmpRectangle.xMax || tmpRectangle.yMin > tmpRectangle.yMax) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+
+  /* Draw filled rectangle. Unlike circles and polygons all rows have the same
+     extent, so one clipping area and one DMD_writeColor() cover the whole
+     rectangle and no span list is needed. */
   GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
 
   width  = tmpRectangle.xMax - tmpRectangle.xMin + 1;
@@ -39,46 +39,62 @@
 #include "glib.h"
 #include "glib_color.h"
 
-/**************************************************************************//**
-*  @brief
-*  Draws a char using the font supplied with the library.
-*
-*  @param pContext
-*  Pointer to the GLIB_Context_t
-*
-*  @param myChar
-*  Char to be drawn
-*
-*  @param x
-*  Start x-coordinate for the char (Upper left corner)
-*
-*  @param y
-*  Start y-coordinate for the char (Upper left corner)
-*
-*  @param opaque
-*  Determines whether to show the background or color it with the background
-*  color specified by the GLIB_Context_t. If opaque == true, the background color is used.
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t y,
-                       bool opaque)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Row pattern of a color on a monochrome display. Matches the mapping in
+   DMD_writeColor(), which turns any non-zero green component into white. */
+static uint32_t GLIB_colorToRowPattern(uint32_t color)
 {
-  EMSTATUS status;
-  uint16_t fontIdx;
-  uint8_t *pPixMap8;
-  uint16_t *pPixMap16;
-  uint32_t *pPixMap32;
-  uint16_t row;
-  uint32_t currentRow;
-  uint16_t xOffset;
-  uint32_t drawnElements = 0;
+  return ((color >> GreenShift) & 0xFF) ? 0xFFFFFFFF : 0x00000000;
+}
 
-  /* Check arguments */
-  if (pContext == NULL) {
-    return GLIB_ERROR_INVALID_ARGUMENT;
+/* Reads one element of a GLIB_FONT_LAYOUT_STRIDED font pixel map. */
+static uint32_t GLIB_fontRow(const GLIB_Font_t *pFont, uint32_t idx)
+{
+  switch (pFont->sizeOfMapElement) {
+    case 1:
+      return ((const uint8_t *)pFont->pFontPixMap)[idx];
+
+    case 2:
+      return ((const uint16_t *)pFont->pFontPixMap)[idx];
+
+    default:
+      return ((const uint32_t *)pFont->pFontPixMap)[idx];
+  }
+}
+
+/* Assembles one glyph row of a GLIB_FONT_LAYOUT_GLYPH_ROWS font. */
+static uint32_t GLIB_glyphStripRow(const uint8_t *pRow, uint32_t rowBytes)
+{
+  uint32_t bits = pRow[0];
+
+  if (rowBytes > 1) {
+    bits |= (uint32_t)pRow[1] << 8;
+    if (rowBytes > 2) {
+      bits |= (uint32_t)pRow[2] << 16;
+      if (rowBytes > 3) {
+        bits |= (uint32_t)pRow[3] << 24;
+      }
+    }
   }
+  return bits;
+}
+
+/* Reads row 'row' of glyph 'glyph' in any pixel map layout. */
+static uint32_t GLIB_glyphRow(const GLIB_Font_t *pFont, uint32_t glyph, uint32_t row)
+{
+  if (pFont->layout == GLIB_FONT_LAYOUT_GLYPH_ROWS) {
+    const uint8_t *pRow = (const uint8_t *)pFont->pFontPixMap
+                          + (glyph * pFont->fontHeight + row) * pFont->fontRowOffset;
+    return GLIB_glyphStripRow(pRow, pFont->fontRowOffset);
+  }
+  return GLIB_fontRow(pFont, glyph + row * pFont->fontRowOffset);
+}
+
+/* Maps a char to its glyph index in the font. */
+static EMSTATUS GLIB_glyphIndex(const GLIB_Font_t *pFont, char myChar, uint16_t *pGlyph)
+{
+  uint16_t glyph;
 
   /* Check input char */
   if ((myChar < ' ') || (myChar > '~')) {
@@ -86,42 +102,177 @@ EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t
   }
 
   /* Sets the index in the font array */
-  if (pContext->font.fontClass == NumbersOnlyFont) {
-    fontIdx = (myChar - '0');
+  if (pFont->fontClass == NumbersOnlyFont) {
+    glyph = (myChar - '0');
     if (myChar == ':') {
-      fontIdx = 10;
+      glyph = 10;
     }
     if (myChar == ' ') {
-      fontIdx = 11;
+      glyph = 11;
     }
   } else { /* FullFont class */
-    fontIdx = myChar - ' ';
+    glyph = myChar - ' ';
   }
 
-  if (fontIdx > (pContext->font.cntOfMapElements - 1)) {
+  if (glyph > (pFont->cntOfMapElements - 1)) {
     return GLIB_ERROR_INVALID_CHAR;
   }
+  *pGlyph = glyph;
+  return GLIB_OK;
+}
 
-  /* Loop through the rows and draw the font */
-  pPixMap8 = (uint8_t *)pContext->font.pFontPixMap;
-  pPixMap16 = (uint16_t *)pContext->font.pFontPixMap;
-  pPixMap32 = (uint32_t *)pContext->font.pFontPixMap;
+/* Number of pixels the pen moves after drawing a glyph. */
+static uint32_t GLIB_glyphAdvance(const GLIB_Font_t *pFont, uint32_t glyph)
+{
+  if (pFont->pAdvanceWidths != NULL) {
+    return pFont->pAdvanceWidths[glyph];
+  }
+  return pFont->fontWidth + pFont->charSpacing;
+}
 
-  for (row = 0; row < pContext->font.fontHeight; row++) {
-    switch (pContext->font.sizeOfMapElement) {
-      case 1:
-        currentRow = pPixMap8[fontIdx];
-        break;
+/* Merges one glyph row into the framebuffer with DMD_writeRowMask(). Fully
+   transparent rows are skipped and report DMD_ERROR_PIXEL_OUT_OF_BOUNDS. */
+static EMSTATUS GLIB_writeGlyphRow(int32_t x, int32_t y, uint32_t bits,
+                                   uint32_t fgPattern, uint32_t bgPattern,
+                                   uint32_t cellMask, bool opaque)
+{
+  if (opaque) {
+    return DMD_writeRowMask(x, y, (bits & fgPattern) | (~bits & bgPattern),
+                            cellMask);
+  }
+  if (bits) {
+    return DMD_writeRowMask(x, y, fgPattern, bits);
+  }
+  return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+}
 
-      case 2:
-        currentRow = pPixMap16[fontIdx];
-        break;
+/* Clips the glyph rows [0, fontHeight) at y against the clipping region. */
+static void GLIB_clipGlyphRows(const GLIB_Context_t *pContext, int32_t y,
+                               int32_t *pRow, int32_t *pRowEnd)
+{
+  *pRow = 0;
+  if (y < pContext->clippingRegion.yMin) {
+    *pRow = pContext->clippingRegion.yMin - y;
+  }
+  *pRowEnd = pContext->font.fontHeight;
+  if (y + *pRowEnd > pContext->clippingRegion.yMax + 1) {
+    *pRowEnd = pContext->clippingRegion.yMax + 1 - y;
+  }
+}
 
-      default:
-        currentRow = pPixMap32[fontIdx];
+/* Draws a glyph of a GLIB_FONT_LAYOUT_STRIDED font one row at a time. Every
+   glyph row, including the character spacing, is merged into the framebuffer
+   by a single DMD_writeRowMask() call. Rows outside the clipping region are
+   skipped up front, the horizontal clip is done by the DMD driver. Returns
+   DMD_ERROR_NOT_SUPPORTED when the glyph or the display cannot be handled
+   this way. */
+static EMSTATUS GLIB_drawCharRows(GLIB_Context_t *pContext, uint32_t fontIdx,
+                                  int32_t x, int32_t y, bool opaque)
+{
+  EMSTATUS status;
+  const GLIB_Font_t *pFont = &pContext->font;
+  uint32_t cellWidth = GLIB_glyphAdvance(pFont, fontIdx);
+  uint32_t cellMask;
+  uint32_t glyphMask;
+  uint32_t fgPattern;
+  uint32_t bgPattern;
+  int32_t  row;
+  int32_t  rowEnd;
+  uint32_t drawnElements = 0;
+
+  if (cellWidth > 32) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+
+  cellMask  = (cellWidth == 32) ? 0xFFFFFFFF : ((1u << cellWidth) - 1);
+  glyphMask = (pFont->fontWidth >= 32) ? 0xFFFFFFFF : ((1u << pFont->fontWidth) - 1);
+  fgPattern = GLIB_colorToRowPattern(pContext->foregroundColor);
+  bgPattern = GLIB_colorToRowPattern(pContext->backgroundColor);
+
+  GLIB_clipGlyphRows(pContext, y, &row, &rowEnd);
+
+  for (fontIdx += row * pFont->fontRowOffset; row < rowEnd; row++) {
+    uint32_t bits = GLIB_fontRow(pFont, fontIdx) & glyphMask & cellMask;
+    fontIdx += pFont->fontRowOffset;
+
+    status = GLIB_writeGlyphRow(x, y + row, bits, fgPattern, bgPattern,
+                                cellMask, opaque);
+    if (status == DMD_OK) {
+      drawnElements++;
+    } else if (status != DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+      return status;
+    }
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
+/* Draws a glyph of a GLIB_FONT_LAYOUT_GLYPH_ROWS font. The rows of the glyph
+   are contiguous and already in framebuffer bit order, so each row is a
+   single load and a single DMD_writeRowMask() call. Returns
+   DMD_ERROR_NOT_SUPPORTED when the glyph or the display cannot be handled
+   this way. */
+static EMSTATUS GLIB_drawGlyphStrip(GLIB_Context_t *pContext, uint32_t glyph,
+                                    int32_t x, int32_t y, bool opaque)
+{
+  EMSTATUS status;
+  const GLIB_Font_t *pFont = &pContext->font;
+  uint32_t rowBytes = pFont->fontRowOffset;
+  uint32_t cellWidth = GLIB_glyphAdvance(pFont, glyph);
+  uint32_t cellMask;
+  uint32_t fgPattern;
+  uint32_t bgPattern;
+  const uint8_t *pRow;
+  int32_t  row;
+  int32_t  rowEnd;
+  uint32_t drawnElements = 0;
+
+  if (cellWidth > 32 || rowBytes == 0 || rowBytes > 4) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+
+  cellMask  = (cellWidth == 32) ? 0xFFFFFFFF : ((1u << cellWidth) - 1);
+  fgPattern = GLIB_colorToRowPattern(pContext->foregroundColor);
+  bgPattern = GLIB_colorToRowPattern(pContext->backgroundColor);
+
+  GLIB_clipGlyphRows(pContext, y, &row, &rowEnd);
+
+  pRow = (const uint8_t *)pFont->pFontPixMap
+         + (glyph * pFont->fontHeight + row) * rowBytes;
+  for (; row < rowEnd; row++, pRow += rowBytes) {
+    uint32_t bits = ((rowBytes == 1) ? pRow[0] : GLIB_glyphStripRow(pRow, rowBytes))
+                    & cellMask;
+
+    status = GLIB_writeGlyphRow(x, y + row, bits, fgPattern, bgPattern,
+                                cellMask, opaque);
+    if (status == DMD_OK) {
+      drawnElements++;
+    } else if (status != DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+      return status;
     }
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
+/* Draws a glyph pixel by pixel. Used on displays without row mask support. */
+static EMSTATUS GLIB_drawCharPixels(GLIB_Context_t *pContext, uint32_t glyph,
+                                    int32_t x, int32_t y, bool opaque)
+{
+  EMSTATUS status;
+  uint16_t row;
+  uint32_t currentRow;
+  uint16_t xOffset;
+  uint32_t cellWidth = GLIB_glyphAdvance(&pContext->font, glyph);
+  uint32_t glyphWidth = pContext->font.fontWidth;
+  uint32_t drawnElements = 0;
+
+  if (glyphWidth > cellWidth) {
+    glyphWidth = cellWidth;
+  }
 
-    for (xOffset = 0; xOffset < pContext->font.fontWidth; ++xOffset) {
+  for (row = 0; row < pContext->font.fontHeight; row++) {
+    currentRow = GLIB_glyphRow(&pContext->font, glyph, row);
+
+    for (xOffset = 0; xOffset < glyphWidth; ++xOffset) {
       /* Bit 1 means draw, Bit 0 means do not draw */
       if (currentRow & 0x1) {
         status = GLIB_drawPixel(pContext, x + xOffset, y + row);
@@ -145,7 +296,7 @@ EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t
     }
 
     /* Handle character spacing */
-    for (; xOffset < pContext->font.fontWidth + pContext->font.charSpacing; ++xOffset) {
+    for (; xOffset < cellWidth; ++xOffset) {
       if (opaque) {
         /* Draw background pixel */
         status = GLIB_drawPixelColor(pContext, x + xOffset, y + row, pContext->backgroundColor);
@@ -157,13 +308,319 @@ EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t
         }
       }
     }
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
+/* Bit expansion tables for scaled text: bit i of the index becomes bits
+   [scale * i, scale * i + scale) of the entry, so one lookup widens eight
+   glyph pixels. 2.5 kB of flash for the three scales. */
+#define GLIB_SCALE_BIT(b, s, i)   ((((b) >> (i)) & 1u) * (((1u << (s)) - 1u) << ((s) * (i))))
+#define GLIB_SCALE_BYTE(b, s)     (GLIB_SCALE_BIT(b, s, 0) | GLIB_SCALE_BIT(b, s, 1)   \
+                                   | GLIB_SCALE_BIT(b, s, 2) | GLIB_SCALE_BIT(b, s, 3) \
+                                   | GLIB_SCALE_BIT(b, s, 4) | GLIB_SCALE_BIT(b, s, 5) \
+                                   | GLIB_SCALE_BIT(b, s, 6) | GLIB_SCALE_BIT(b, s, 7))
+#define GLIB_SCALE_X2(b)          GLIB_SCALE_BYTE(b, 2)
+#define GLIB_SCALE_X3(b)          GLIB_SCALE_BYTE(b, 3)
+#define GLIB_SCALE_X4(b)          GLIB_SCALE_BYTE(b, 4)
+#define GLIB_SCALE_TABLE4(f, b)   f(b), f((b) + 1), f((b) + 2), f((b) + 3)
+#define GLIB_SCALE_TABLE16(f, b)  GLIB_SCALE_TABLE4(f, b), GLIB_SCALE_TABLE4(f, (b) + 4), \
+                                  GLIB_SCALE_TABLE4(f, (b) + 8), GLIB_SCALE_TABLE4(f, (b) + 12)
+#define GLIB_SCALE_TABLE64(f, b)  GLIB_SCALE_TABLE16(f, b), GLIB_SCALE_TABLE16(f, (b) + 16), \
+                                  GLIB_SCALE_TABLE16(f, (b) + 32), GLIB_SCALE_TABLE16(f, (b) + 48)
+#define GLIB_SCALE_TABLE256(f)    GLIB_SCALE_TABLE64(f, 0), GLIB_SCALE_TABLE64(f, 64), \
+                                  GLIB_SCALE_TABLE64(f, 128), GLIB_SCALE_TABLE64(f, 192)
+
+static const uint16_t GLIB_scaleX2[256] = { GLIB_SCALE_TABLE256(GLIB_SCALE_X2) };
+static const uint32_t GLIB_scaleX3[256] = { GLIB_SCALE_TABLE256(GLIB_SCALE_X3) };
+static const uint32_t GLIB_scaleX4[256] = { GLIB_SCALE_TABLE256(GLIB_SCALE_X4) };
+
+/* Words of a scaled glyph row: a cell is at most 32 pixels wide. */
+#define GLIB_SCALED_ROW_WORDS     ((32 * GLIB_FONT_SCALE_MAX + 31) / 32)
+
+/* Widens the 'width' lowest bits of 'bits' by 'scale' into pOut, leftmost
+   pixel in bit 0 of pOut[0]. Bits above 'width' must be clear. Returns the
+   number of words written. */
+static uint32_t GLIB_scaleRow(uint32_t bits, uint32_t width, uint32_t scale,
+                              uint32_t *pOut)
+{
+  uint64_t acc = 0;
+  uint32_t accBits = 0;
+  uint32_t words = 0;
+  uint32_t i;
+
+  for (i = 0; i < width; i += 8, bits >>= 8) {
+    uint32_t wide;
+
+    switch (scale) {
+      case 2:
+        wide = GLIB_scaleX2[bits & 0xFF];
+        break;
+      case 3:
+        wide = GLIB_scaleX3[bits & 0xFF];
+        break;
+      default:
+        wide = GLIB_scaleX4[bits & 0xFF];
+        break;
+    }
+    acc |= (uint64_t)wide << accBits;
+    accBits += 8 * scale;
+    while (accBits >= 32) {
+      pOut[words++] = (uint32_t)acc;
+      acc >>= 32;
+      accBits -= 32;
+    }
+  }
+  if (accBits > 0) {
+    pOut[words++] = (uint32_t)acc;
+  }
+  return words;
+}
+
+/* Draws a glyph 'scale' times its size on a monochrome display. Each glyph
+   row is widened once through the bit expansion tables, then written to
+   'scale' framebuffer rows with DMD_writeRowMask(), 32 pixels per call.
+   Returns DMD_ERROR_NOT_SUPPORTED when the display cannot be handled this
+   way. */
+static EMSTATUS GLIB_drawCharScaledRows(GLIB_Context_t *pContext, uint32_t glyph,
+                                        int32_t x, int32_t y, uint32_t scale,
+                                        bool opaque)
+{
+  EMSTATUS status;
+  const GLIB_Font_t *pFont = &pContext->font;
+  uint32_t cellWidth = GLIB_glyphAdvance(pFont, glyph);
+  uint32_t cellMask;
+  uint32_t glyphMask;
+  uint32_t fgPattern;
+  uint32_t bgPattern;
+  uint32_t cellWords[GLIB_SCALED_ROW_WORDS];
+  uint32_t rowWords[GLIB_SCALED_ROW_WORDS];
+  uint32_t words;
+  uint32_t row;
+  uint32_t w;
+  int32_t  yRow;
+  int32_t  yEnd;
+  uint32_t drawnElements = 0;
+
+  if (cellWidth > 32) {
+    return DMD_ERROR_NOT_SUPPORTED;
+  }
+
+  cellMask  = (cellWidth == 32) ? 0xFFFFFFFF : ((1u << cellWidth) - 1);
+  glyphMask = (pFont->fontWidth >= 32) ? 0xFFFFFFFF : ((1u << pFont->fontWidth) - 1);
+  fgPattern = GLIB_colorToRowPattern(pContext->foregroundColor);
+  bgPattern = GLIB_colorToRowPattern(pContext->backgroundColor);
+  words     = GLIB_scaleRow(cellMask, cellWidth, scale, cellWords);
+
+  for (row = 0; row < pFont->fontHeight; row++) {
+    /* Framebuffer rows of this glyph row, clipped to the clipping region */
+    yRow = y + (int32_t)(row * scale);
+    yEnd = yRow + (int32_t)scale;
+    if (yRow < pContext->clippingRegion.yMin) {
+      yRow = pContext->clippingRegion.yMin;
+    }
+    if (yEnd > pContext->clippingRegion.yMax + 1) {
+      yEnd = pContext->clippingRegion.yMax + 1;
+    }
+    if (yRow >= yEnd) {
+      continue;
+    }
+
+    GLIB_scaleRow(GLIB_glyphRow(pFont, glyph, row) & glyphMask & cellMask,
+                  cellWidth, scale, rowWords);
+
+    for (; yRow < yEnd; yRow++) {
+      for (w = 0; w < words; w++) {
+        status = GLIB_writeGlyphRow(x + (int32_t)(32 * w), yRow, rowWords[w],
+                                    fgPattern, bgPattern, cellWords[w], opaque);
+        if (status == DMD_OK) {
+          drawnElements++;
+        } else if (status != DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+          return status;
+        }
+      }
+    }
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
 
-    /* fontIdx offset for a new row */
-    fontIdx += pContext->font.fontRowOffset;
+/* Draws a glyph 'scale' times its size pixel by pixel. Used on displays
+   without row mask support. */
+static EMSTATUS GLIB_drawCharScaledPixels(GLIB_Context_t *pContext, uint32_t glyph,
+                                          int32_t x, int32_t y, uint32_t scale,
+                                          bool opaque)
+{
+  EMSTATUS status;
+  uint32_t row;
+  uint32_t col;
+  uint32_t dx;
+  uint32_t dy;
+  uint32_t currentRow;
+  uint32_t cellWidth = GLIB_glyphAdvance(&pContext->font, glyph);
+  uint32_t glyphWidth = pContext->font.fontWidth;
+  uint32_t drawnElements = 0;
+
+  if (glyphWidth > cellWidth) {
+    glyphWidth = cellWidth;
+  }
+
+  for (row = 0; row < pContext->font.fontHeight; row++) {
+    currentRow = GLIB_glyphRow(&pContext->font, glyph, row);
+
+    for (col = 0; col < cellWidth; col++, currentRow >>= 1) {
+      bool ink = (col < glyphWidth) && (currentRow & 0x1);
+
+      if (!ink && !opaque) {
+        continue;
+      }
+      for (dy = 0; dy < scale; dy++) {
+        for (dx = 0; dx < scale; dx++) {
+          status = GLIB_drawPixelColor(pContext, x + (int32_t)(col * scale + dx),
+                                       y + (int32_t)(row * scale + dy),
+                                       ink ? pContext->foregroundColor
+                                       : pContext->backgroundColor);
+          if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+            return status;
+          }
+          if (status == GLIB_OK) {
+            drawnElements++;
+          }
+        }
+      }
+    }
   }
   return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
 
+/** @endcond */
+
+/**************************************************************************//**
+*  @brief
+*  Returns the number of pixels the pen moves after drawing a char.
+*
+*  @details
+*  This is fontWidth + charSpacing for fixed width fonts, and the advance
+*  width of the glyph for proportional fonts.
+*
+*  @param pFont
+*  Pointer to the font
+*
+*  @param myChar
+*  Character
+*
+*  @return
+*  Advance in pixels, 0 for a character the proportional font does not have
+******************************************************************************/
+uint32_t GLIB_charAdvance(const GLIB_Font_t *pFont, char myChar)
+{
+  uint16_t glyph;
+
+  if (pFont->pAdvanceWidths == NULL) {
+    return pFont->fontWidth + pFont->charSpacing;
+  }
+  if (GLIB_glyphIndex(pFont, myChar, &glyph) != GLIB_OK) {
+    return 0;
+  }
+  return GLIB_glyphAdvance(pFont, glyph);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the width in pixels of a string, as used for alignment by
+*  GLIB_drawStringOnLine().
+*
+*  @details
+*  For fixed width fonts this is length * fontWidth: the character spacing
+*  is not counted at all, as in the original GLIB_drawStringOnLine()
+*  alignment. For proportional fonts this is the sum of the advance widths.
+*
+*  @param pFont
+*  Pointer to the font
+*
+*  @param pString
+*  Pointer to the string
+*
+*  @param length
+*  Number of characters of the string
+*
+*  @return
+*  Width in pixels
+******************************************************************************/
+uint32_t GLIB_stringWidth(const GLIB_Font_t *pFont, const char *pString,
+                          size_t length)
+{
+  uint32_t pixels = 0;
+  uint16_t glyph;
+  size_t   i;
+
+  if (pFont->pAdvanceWidths == NULL) {
+    return length * pFont->fontWidth;
+  }
+  for (i = 0; i < length; i++) {
+    if (GLIB_glyphIndex(pFont, pString[i], &glyph) == GLIB_OK) {
+      pixels += pFont->pAdvanceWidths[glyph];
+    }
+  }
+  return pixels;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a char using the font supplied with the library.
+*
+*  @details
+*  On monochrome displays each glyph row is written with one
+*  DMD_writeRowMask() call, otherwise the glyph is drawn pixel by pixel.
+*  Fonts in the GLIB_FONT_LAYOUT_GLYPH_ROWS layout take a faster path that
+*  reads the glyph rows straight from the pixel map.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context_t
+*
+*  @param myChar
+*  Char to be drawn
+*
+*  @param x
+*  Start x-coordinate for the char (Upper left corner)
+*
+*  @param y
+*  Start y-coordinate for the char (Upper left corner)
+*
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context_t. If opaque == true, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawChar(GLIB_Context_t *pContext, char myChar, int32_t x, int32_t y,
+                       bool opaque)
+{
+  EMSTATUS status;
+  uint16_t fontIdx;
+
+  /* Check arguments */
+  if (pContext == NULL) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  status = GLIB_glyphIndex(&pContext->font, myChar, &fontIdx);
+  if (status != GLIB_OK) {
+    return status;
+  }
+
+  if (pContext->font.layout == GLIB_FONT_LAYOUT_GLYPH_ROWS) {
+    status = GLIB_drawGlyphStrip(pContext, fontIdx, x, y, opaque);
+  } else {
+    status = GLIB_drawCharRows(pContext, fontIdx, x, y, opaque);
+  }
+  if (status != DMD_ERROR_NOT_SUPPORTED) {
+    return status;
+  }
+
+  return GLIB_drawCharPixels(pContext, fontIdx, x, y, opaque);
+}
+
 /**************************************************************************//**
 *  @brief
 *  Draws a string using the font supplied with the library.
@@ -229,7 +686,162 @@ EMSTATUS GLIB_drawString(GLIB_Context_t *pContext, const char* pString, uint32_t
     }
 
     /* Adjust x and y coordinate */
-    x += (pContext->font.fontWidth + pContext->font.charSpacing);
+    if (pContext->font.pAdvanceWidths != NULL) {
+      uint16_t glyph = 0;
+      GLIB_glyphIndex(&pContext->font, pString[stringIndex], &glyph);
+      x += pContext->font.pAdvanceWidths[glyph];
+    } else {
+      x += (pContext->font.fontWidth + pContext->font.charSpacing);
+    }
+  }
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a char of the current font scaled up by an integer factor.
+*
+*  @details
+*  Every glyph pixel becomes a square of scale x scale pixels, including the
+*  character spacing. On monochrome displays each glyph row is widened
+*  through a bit expansion table and written to the framebuffer rows it
+*  covers with DMD_writeRowMask(), otherwise the glyph is drawn pixel by
+*  pixel.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context_t
+*
+*  @param myChar
+*  Char to be drawn
+*
+*  @param x
+*  Start x-coordinate for the char (Upper left corner)
+*
+*  @param y
+*  Start y-coordinate for the char (Upper left corner)
+*
+*  @param scale
+*  Scale factor, 1 to GLIB_FONT_SCALE_MAX. A scale of 1 is the same as
+*  GLIB_drawChar().
+*
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context_t. If opaque == true, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawCharScaled(GLIB_Context_t *pContext, char myChar, int32_t x,
+                             int32_t y, uint32_t scale, bool opaque)
+{
+  EMSTATUS status;
+  uint16_t fontIdx;
+
+  /* Check arguments */
+  if (pContext == NULL || scale == 0 || scale > GLIB_FONT_SCALE_MAX) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (scale == 1) {
+    return GLIB_drawChar(pContext, myChar, x, y, opaque);
+  }
+
+  status = GLIB_glyphIndex(&pContext->font, myChar, &fontIdx);
+  if (status != GLIB_OK) {
+    return status;
+  }
+
+  status = GLIB_drawCharScaledRows(pContext, fontIdx, x, y, scale, opaque);
+  if (status != DMD_ERROR_NOT_SUPPORTED) {
+    return status;
+  }
+
+  return GLIB_drawCharScaledPixels(pContext, fontIdx, x, y, scale, opaque);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a string of the current font scaled up by an integer factor.
+*
+*  @details
+*  Advance widths, character spacing and line spacing are scaled as well, so
+*  the result looks like GLIB_drawString() with a font scale times larger.
+*  See GLIB_drawCharScaled().
+*
+*  @param pContext
+*  Pointer to a GLIB_Context_t
+*
+*  @param pString
+*  Pointer to the string that is drawn
+*
+*  @param sLength
+*  number of characters in the string
+*
+*  @param x0
+*  Start x-coordinate for the string (Upper left corner)
+*
+*  @param y0
+*  Start y-coordinate for the string (Upper left corner)
+*
+*  @param scale
+*  Scale factor, 1 to GLIB_FONT_SCALE_MAX
+*
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context_t. If opaque == 1, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawStringScaled(GLIB_Context_t *pContext, const char *pString,
+                               uint32_t sLength, int32_t x0, int32_t y0,
+                               uint32_t scale, bool opaque)
+{
+  EMSTATUS status;
+  uint32_t drawnElements = 0;
+  uint32_t stringIndex;
+  uint16_t glyph;
+  int32_t x, y;
+
+  /* Check arguments */
+  if (pContext == NULL || pString == NULL
+      || scale == 0 || scale > GLIB_FONT_SCALE_MAX) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (pContext->font.fontClass == InvalidFont) {
+    return GLIB_ERROR_INVALID_CHAR;
+  }
+
+  x = x0;
+  y = y0;
+
+  /* Loops through the string and prints char for char */
+  for (stringIndex = 0; stringIndex < sLength; stringIndex++) {
+    /* Newline char */
+    if (pString[stringIndex] == '\n') {
+      x = x0;
+      y = y + (int32_t)((pContext->font.fontHeight + pContext->font.lineSpacing) * scale);
+      continue;
+    }
+
+    /* Draw the current char */
+    status = GLIB_drawCharScaled(pContext, pString[stringIndex], x, y, scale, opaque);
+    if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+      return status;
+    }
+    if (status == GLIB_OK) {
+      drawnElements++;
+    }
+
+    /* Adjust x coordinate */
+    if (pContext->font.pAdvanceWidths != NULL) {
+      glyph = 0;
+      GLIB_glyphIndex(&pContext->font, pString[stringIndex], &glyph);
+      x += (int32_t)(pContext->font.pAdvanceWidths[glyph] * scale);
+    } else {
+      x += (int32_t)((pContext->font.fontWidth + pContext->font.charSpacing) * scale);
+    }
   }
   return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
 }
@@ -306,7 +918,7 @@ EMSTATUS GLIB_drawStringOnLine(GLIB_Context_t *pContext, const char *pString, ui
   size_t pixels;
 
   length = strlen(pString);
-  pixels = length * pContext->font.fontWidth;
+  pixels = GLIB_stringWidth(&pContext->font, pString, length);
   y = line * (pContext->font.fontHeight + pContext->font.lineSpacing) + yOffset;
 
   switch (align) {
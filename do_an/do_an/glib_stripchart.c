@@ -0,0 +1,344 @@
+/***************************************************************************//**
+ * @file
+ * @brief Graphics Library: Scrolling strip chart
+ *******************************************************************************
+ *
+ * The strip chart plots one sample per column, newest on the right. Adding a
+ * sample scrolls the chart area of the framebuffer one column to the left with
+ * DMD_scrollLeft() and draws only the new column, so the cost of a sample does
+ * not depend on how many samples are shown. The chart only draws inside its
+ * area and the clipping region of the context, and leaves the rest of the
+ * display, e.g. the lines of a text grid, untouched.
+ *
+ ******************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Number of words holding the pixels of one column */
+#define GLIB_STRIPCHART_COLUMN_WORDS  ((GLIB_STRIPCHART_MAX_ROWS + 31) / 32)
+
+/* Local function prototypes */
+static bool GLIB_stripChartBegin(GLIB_StripChart_t *pChart,
+                                 GLIB_Rectangle_t *pSaved);
+static EMSTATUS GLIB_stripChartEnd(GLIB_StripChart_t *pChart,
+                                   const GLIB_Rectangle_t *pSaved,
+                                   EMSTATUS status);
+static int32_t GLIB_stripChartRow(const GLIB_StripChart_t *pChart,
+                                  int16_t value);
+static void GLIB_stripChartFillBits(uint32_t *pBits, int32_t first,
+                                    int32_t last, uint32_t pixelData);
+static EMSTATUS GLIB_stripChartDrawColumn(GLIB_StripChart_t *pChart,
+                                          int32_t x);
+
+/**************************************************************************//**
+*  @brief
+*  Initializes a strip chart on top of a GLIB_Context_t.
+*
+*  @details
+*  The chart starts out empty and nothing is drawn; call
+*  GLIB_stripChartRedraw() to paint the area with the background color, or
+*  start from an area already cleared by GLIB_clear(). The samples are drawn
+*  with the foreground color of the context.
+*
+*  @param pChart
+*  Pointer to the strip chart
+*
+*  @param pContext
+*  Pointer to the GLIB_Context_t the chart draws with
+*
+*  @param pArea
+*  Area of the chart, at most GLIB_STRIPCHART_MAX_SAMPLES columns wide and
+*  GLIB_STRIPCHART_MAX_ROWS rows high
+*
+*  @param minValue
+*  Sample value drawn on the bottom row, lower values are drawn there too
+*
+*  @param maxValue
+*  Sample value drawn on the top row, higher values are drawn there too
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_stripChartInit(GLIB_StripChart_t *pChart, GLIB_Context_t *pContext,
+                             const GLIB_Rectangle_t *pArea, int16_t minValue,
+                             int16_t maxValue)
+{
+  /* Check arguments */
+  if (pChart == NULL || pContext == NULL || pArea == NULL
+      || pArea->xMin > pArea->xMax || pArea->yMin > pArea->yMax
+      || pArea->xMax - pArea->xMin >= GLIB_STRIPCHART_MAX_SAMPLES
+      || pArea->yMax - pArea->yMin >= GLIB_STRIPCHART_MAX_ROWS
+      || minValue >= maxValue) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  memset(pChart, 0, sizeof(GLIB_StripChart_t));
+  pChart->pContext = pContext;
+  pChart->area     = *pArea;
+  pChart->minValue = minValue;
+  pChart->maxValue = maxValue;
+  pChart->columns  = (uint32_t)(pArea->xMax - pArea->xMin + 1);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Adds a sample to the strip chart and updates the display.
+*
+*  @details
+*  The chart area is scrolled one column to the left and only the rightmost
+*  visible column is drawn. Each column shows a vertical segment from the row
+*  of the previous sample to the row of its own sample, so consecutive samples
+*  are connected. When the ring buffer is full the oldest sample is dropped;
+*  the segment of the leftmost column no longer starts from it.
+*
+*  @param pChart
+*  Pointer to the strip chart
+*
+*  @param value
+*  New sample
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_ERROR_NOTHING_TO_DRAW if the chart area is
+*  outside the clipping region, or else error code
+******************************************************************************/
+EMSTATUS GLIB_stripChartAddSample(GLIB_StripChart_t *pChart, int16_t value)
+{
+  EMSTATUS status;
+  GLIB_Rectangle_t saved;
+  const GLIB_Rectangle_t *pClip;
+
+  /* Check arguments */
+  if (pChart == NULL || pChart->pContext == NULL) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  /* Store the sample, dropping the oldest one when full */
+  if (pChart->count <= pChart->columns) {
+    pChart->samples[(pChart->first + pChart->count) % (pChart->columns + 1)] = value;
+    pChart->count++;
+  } else {
+    pChart->samples[pChart->first] = value;
+    pChart->first = (pChart->first + 1) % (pChart->columns + 1);
+  }
+
+  if (!GLIB_stripChartBegin(pChart, &saved)) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+  pClip = &pChart->pContext->clippingRegion;
+
+  /* Scroll the visible part of the area, then draw its rightmost column */
+  status = DMD_scrollLeft(pClip->xMin, pClip->yMin,
+                          pClip->xMax - pClip->xMin + 1,
+                          pClip->yMax - pClip->yMin + 1, 1);
+  if (status != DMD_OK && status != DMD_ERROR_PIXEL_OUT_OF_BOUNDS) {
+    return GLIB_stripChartEnd(pChart, &saved, status);
+  }
+  status = GLIB_stripChartDrawColumn(pChart, pClip->xMax);
+
+  return GLIB_stripChartEnd(pChart, &saved, status);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the whole strip chart.
+*
+*  @details
+*  Every column of the chart area is drawn from the ring buffer, columns
+*  without a sample are filled with the background color. Use this after the
+*  display was cleared or drawn over, GLIB_stripChartAddSample() relies on the
+*  area showing the chart.
+*
+*  @param pChart
+*  Pointer to the strip chart
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_ERROR_NOTHING_TO_DRAW if the chart area is
+*  outside the clipping region, or else error code
+******************************************************************************/
+EMSTATUS GLIB_stripChartRedraw(GLIB_StripChart_t *pChart)
+{
+  EMSTATUS status = GLIB_OK;
+  GLIB_Rectangle_t saved;
+  int32_t x;
+
+  /* Check arguments */
+  if (pChart == NULL || pChart->pContext == NULL) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (!GLIB_stripChartBegin(pChart, &saved)) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+
+  for (x = pChart->pContext->clippingRegion.xMin;
+       x <= pChart->pContext->clippingRegion.xMax; x++) {
+    status = GLIB_stripChartDrawColumn(pChart, x);
+    if (status != GLIB_OK) {
+      break;
+    }
+  }
+
+  return GLIB_stripChartEnd(pChart, &saved, status);
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/**************************************************************************//**
+*  @brief
+*  Narrows the clipping region of the context to the part of the chart area
+*  inside it and applies it to the display driver.
+*
+*  @return
+*  Returns false, with the clipping region left as it was, if the chart area
+*  is outside the clipping region.
+******************************************************************************/
+static bool GLIB_stripChartBegin(GLIB_StripChart_t *pChart,
+                                 GLIB_Rectangle_t *pSaved)
+{
+  GLIB_Rectangle_t *pClip = &pChart->pContext->clippingRegion;
+
+  *pSaved = *pClip;
+  if (pChart->area.xMin > pClip->xMax || pChart->area.xMax < pClip->xMin
+      || pChart->area.yMin > pClip->yMax || pChart->area.yMax < pClip->yMin) {
+    return false;
+  }
+
+  if (pChart->area.xMin > pClip->xMin) {
+    pClip->xMin = pChart->area.xMin;
+  }
+  if (pChart->area.xMax < pClip->xMax) {
+    pClip->xMax = pChart->area.xMax;
+  }
+  if (pChart->area.yMin > pClip->yMin) {
+    pClip->yMin = pChart->area.yMin;
+  }
+  if (pChart->area.yMax < pClip->yMax) {
+    pClip->yMax = pChart->area.yMax;
+  }
+  GLIB_applyClippingRegion(pChart->pContext);
+
+  return true;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Restores the clipping region saved by GLIB_stripChartBegin() and returns
+*  status, or the error of restoring the driver clipping area.
+******************************************************************************/
+static EMSTATUS GLIB_stripChartEnd(GLIB_StripChart_t *pChart,
+                                   const GLIB_Rectangle_t *pSaved,
+                                   EMSTATUS status)
+{
+  EMSTATUS applyStatus;
+
+  pChart->pContext->clippingRegion = *pSaved;
+  applyStatus = GLIB_applyClippingRegion(pChart->pContext);
+
+  return (status != GLIB_OK) ? status : applyStatus;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the display row of a sample value, rounded to the nearest row.
+******************************************************************************/
+static int32_t GLIB_stripChartRow(const GLIB_StripChart_t *pChart,
+                                  int16_t value)
+{
+  int32_t range  = pChart->maxValue - pChart->minValue;
+  int32_t height = pChart->area.yMax - pChart->area.yMin;
+
+  if (value <= pChart->minValue) {
+    return pChart->area.yMax;
+  }
+  if (value >= pChart->maxValue) {
+    return pChart->area.yMin;
+  }
+
+  return pChart->area.yMax
+         - ((value - pChart->minValue) * height * 2 + range) / (range * 2);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets bits first to last of a column bitmap to pixelData.
+******************************************************************************/
+static void GLIB_stripChartFillBits(uint32_t *pBits, int32_t first,
+                                    int32_t last, uint32_t pixelData)
+{
+  int32_t  i = first >> 5;
+  uint32_t mask;
+
+  for (; i <= last >> 5; i++) {
+    mask = 0xFFFFFFFF;
+    if (i == first >> 5) {
+      mask &= 0xFFFFFFFF << (first & 0x1F);
+    }
+    if (i == last >> 5) {
+      mask &= 0xFFFFFFFF >> (0x1F - (last & 0x1F));
+    }
+    pBits[i] = (pBits[i] & ~mask) | (pixelData & mask);
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws column x of the chart area within the clipping region, as one
+*  1 pixel wide bitmap.
+******************************************************************************/
+static EMSTATUS GLIB_stripChartDrawColumn(GLIB_StripChart_t *pChart,
+                                          int32_t x)
+{
+  EMSTATUS status;
+  GLIB_Context_t *pContext = pChart->pContext;
+  uint32_t bits[GLIB_STRIPCHART_COLUMN_WORDS];
+  uint32_t age = (uint32_t)(pChart->area.xMax - x);
+  uint32_t index;
+  int32_t  yTop    = pContext->clippingRegion.yMin;
+  int32_t  yBottom = pContext->clippingRegion.yMax;
+  int32_t  y1, y2, swap;
+  uint8_t  red, green, blue;
+
+  GLIB_colorTranslate24bpp(pContext->backgroundColor, &red, &green, &blue);
+  memset(bits, green ? 0xFF : 0x00, sizeof(bits));
+
+  /* Segment from the previous sample to the sample of this column */
+  if (age < pChart->count) {
+    index = pChart->first + pChart->count - 1 - age;
+    y1 = y2 = GLIB_stripChartRow(pChart, pChart->samples[index % (pChart->columns + 1)]);
+    if (age + 1 < pChart->count) {
+      y1 = GLIB_stripChartRow(pChart, pChart->samples[(index - 1) % (pChart->columns + 1)]);
+    }
+    if (y1 > y2) {
+      swap = y1;
+      y1   = y2;
+      y2   = swap;
+    }
+    y1 = (y1 < yTop) ? yTop : y1;
+    y2 = (y2 > yBottom) ? yBottom : y2;
+    if (y1 <= y2) {
+      GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
+      GLIB_stripChartFillBits(bits, y1 - yTop, y2 - yTop,
+                              green ? 0xFFFFFFFF : 0x00000000);
+    }
+  }
+
+  status = DMD_setClippingArea(x, yTop, 1, yBottom - yTop + 1);
+  if (status != DMD_OK) {
+    return status;
+  }
+
+  return DMD_writeData(0, 0, (const uint8_t *) bits, yBottom - yTop + 1);
+}
+
+/** @endcond */
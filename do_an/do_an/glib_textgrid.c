@@ -0,0 +1,235 @@
+/***************************************************************************//**
+ * @file
+ * @brief Graphics Library: Retained text grid
+ *******************************************************************************
+ *
+ * The text grid remembers what was last drawn on each text line. Redrawing a
+ * line only rasterizes the character cells that changed, so only the display
+ * rows of that line are marked dirty, and only when something really changed.
+ *
+ ******************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Local function prototypes */
+static EMSTATUS GLIB_textGridErase(GLIB_Context_t *pContext, int32_t x1,
+                                   int32_t x2, int32_t y);
+
+/**************************************************************************//**
+*  @brief
+*  Initializes a text grid on top of a GLIB_Context_t.
+*
+*  @details
+*  All lines start out empty; the area covered by the grid is assumed to be
+*  filled with the background color already (e.g. by GLIB_clear()). Call this
+*  function again after clearing the display or changing the font.
+*
+*  @param pGrid
+*  Pointer to the text grid
+*
+*  @param pContext
+*  Pointer to the GLIB_Context_t the grid draws with
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_textGridInit(GLIB_TextGrid_t *pGrid, GLIB_Context_t *pContext)
+{
+  /* Check arguments */
+  if (pGrid == NULL || pContext == NULL) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  memset(pGrid, 0, sizeof(GLIB_TextGrid_t));
+  pGrid->pContext = pContext;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a string on a line of the text grid.
+*
+*  @details
+*  The position of the string is computed as in GLIB_drawStringOnLine().
+*  A character is redrawn unless the same character is already on the
+*  display at the same x-coordinate. Each cell is as wide as the advance of
+*  its character, so with a proportional font a changed character moves the
+*  cells after it, and those are redrawn too. The parts of the previous
+*  content not covered by the new string are filled with the background
+*  color.
+*
+*  @param pGrid
+*  Pointer to the text grid
+*
+*  @param pString
+*  Pointer to the string. Characters beyond GLIB_TEXTGRID_MAX_COLS are ignored.
+*
+*  @param line
+*  Line on the display, lower than GLIB_TEXTGRID_MAX_LINES
+*
+*  @param align
+*  Horizontal alignment of the string on the line
+*
+*  @param xOffset
+*  Margin added to the aligned x-coordinate
+*
+*  @return
+*  Returns GLIB_OK if the display was modified, GLIB_ERROR_NOTHING_TO_DRAW if
+*  the line was unchanged, or else error code
+******************************************************************************/
+EMSTATUS GLIB_textGridDrawLine(GLIB_TextGrid_t *pGrid, const char *pString,
+                               uint8_t line, GLIB_Align_t align, int32_t xOffset)
+{
+  EMSTATUS status;
+  GLIB_Context_t *pContext;
+  GLIB_TextGridLine_t *pLine;
+  uint32_t length;
+  uint32_t i;
+  int32_t  x, y;
+  int32_t  oldX, newX;
+  int32_t  oldEnd, newEnd;
+  uint32_t drawnElements = 0;
+
+  /* Check arguments */
+  if (pGrid == NULL || pGrid->pContext == NULL || pString == NULL
+      || line >= GLIB_TEXTGRID_MAX_LINES) {
+    return GLIB_ERROR_INVALID_ARGUMENT;
+  }
+
+  pContext  = pGrid->pContext;
+  pLine     = &pGrid->lines[line];
+
+  length = strlen(pString);
+  if (length > GLIB_TEXTGRID_MAX_COLS) {
+    length = GLIB_TEXTGRID_MAX_COLS;
+  }
+
+  /* Same placement as GLIB_drawStringOnLine() */
+  switch (align) {
+    case GLIB_ALIGN_CENTER:
+      x = ((int32_t)pContext->pDisplayGeometry->xSize
+           - (int32_t)GLIB_stringWidth(&pContext->font, pString, length)) / 2;
+      break;
+    case GLIB_ALIGN_RIGHT:
+      x = (int32_t)pContext->pDisplayGeometry->xSize
+          - (int32_t)GLIB_stringWidth(&pContext->font, pString, length);
+      break;
+    default:
+      x = 0;
+      break;
+  }
+  x += xOffset;
+  y = line * (pContext->font.fontHeight + pContext->font.lineSpacing);
+
+  /* Redraw the cells that changed, walking the old and the new cells side by
+     side to know where each old character is */
+  oldX = pLine->x;
+  newX = x;
+  for (i = 0; i < length; i++) {
+    bool unchanged = (i < pLine->length && oldX == newX && pLine->text[i] == pString[i]);
+
+    if (i < pLine->length) {
+      oldX += (int32_t)GLIB_charAdvance(&pContext->font, pLine->text[i]);
+    }
+    if (!unchanged) {
+      status = GLIB_drawChar(pContext, pString[i], newX, y, true);
+      if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+        return status;
+      }
+      drawnElements++;
+    }
+    newX += (int32_t)GLIB_charAdvance(&pContext->font, pString[i]);
+  }
+
+  /* Erase the part of the previous content the new string does not cover */
+  if (pLine->length) {
+    for (; i < pLine->length; i++) {
+      oldX += (int32_t)GLIB_charAdvance(&pContext->font, pLine->text[i]);
+    }
+    oldEnd = oldX;
+    newEnd = newX;
+
+    if (length == 0) {
+      newEnd = x = oldEnd;
+    }
+    if (pLine->x < x) {
+      status = GLIB_textGridErase(pContext, pLine->x, (oldEnd < x) ? oldEnd : x, y);
+      if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+        return status;
+      }
+      drawnElements++;
+    }
+    if (oldEnd > newEnd) {
+      status = GLIB_textGridErase(pContext, (pLine->x > newEnd) ? pLine->x : newEnd, oldEnd, y);
+      if (status > GLIB_ERROR_NOTHING_TO_DRAW) {
+        return status;
+      }
+      drawnElements++;
+    }
+  }
+
+  /* Remember what is on the display now */
+  pLine->x      = x;
+  pLine->length = length;
+  memcpy(pLine->text, pString, length);
+
+  return ((drawnElements == 0) ? GLIB_ERROR_NOTHING_TO_DRAW : GLIB_OK);
+}
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/**************************************************************************//**
+*  @brief
+*  Fills the cells from x1 up to, but not including, x2 on the text line
+*  starting at y with the background color.
+******************************************************************************/
+static EMSTATUS GLIB_textGridErase(GLIB_Context_t *pContext, int32_t x1,
+                                   int32_t x2, int32_t y)
+{
+  EMSTATUS status;
+  uint8_t  red, green, blue;
+  int32_t  y2 = y + pContext->font.fontHeight - 1;
+
+  /* Clip against the clipping region */
+  if (x1 < pContext->clippingRegion.xMin) {
+    x1 = pContext->clippingRegion.xMin;
+  }
+  if (x2 > pContext->clippingRegion.xMax + 1) {
+    x2 = pContext->clippingRegion.xMax + 1;
+  }
+  if (y < pContext->clippingRegion.yMin) {
+    y = pContext->clippingRegion.yMin;
+  }
+  if (y2 > pContext->clippingRegion.yMax) {
+    y2 = pContext->clippingRegion.yMax;
+  }
+  if (x1 >= x2 || y > y2) {
+    return GLIB_ERROR_NOTHING_TO_DRAW;
+  }
+
+  status = DMD_setClippingArea(x1, y, x2 - x1, y2 - y + 1);
+  if (status != DMD_OK) {
+    return status;
+  }
+
+  GLIB_colorTranslate24bpp(pContext->backgroundColor, &red, &green, &blue);
+  status = DMD_writeColor(0, 0, red, green, blue, (x2 - x1) * (y2 - y + 1));
+  if (status != DMD_OK) {
+    return status;
+  }
+
+  /* Reset driver clipping area to GLIB clipping region */
+  return GLIB_applyClippingRegion(pContext);
+}
+
+/** @endcond */
@@ -0,0 +1,244 @@
+#include "i2c_bus.h"
+#include <stddef.h>
+#include "em_device.h"
+#include "em_core.h"
+#include "sl_i2cspm_instances.h"
+#include "sl_i2cspm_sensor_config.h"
+#include "sl_sleeptimer.h"
+
+// Ghép token để ra tên ngắt của ngoại vi I2C từ số hiệu, như lcd.c
+#define I2C_BUS_CONCAT3(A, B, C) A ## B ## C
+#define I2C_BUS_IRQn(N) I2C_BUS_CONCAT3(I2C, N, _IRQn)
+#define I2C_BUS_IRQHandler(N) I2C_BUS_CONCAT3(I2C, N, _IRQHandler)
+
+// Số lần hỏi vòng tối đa của transfer chặn, như I2CSPM_TRANSFER_TIMEOUT
+#define I2C_BUS_POLL_TIMEOUT 300000u
+
+// Hàng đợi FIFO móc nối qua transfer->next, đầu hàng là transfer đang chạy
+static i2c_bus_transfer_t *queueHead;
+static i2c_bus_transfer_t *queueTail;
+static uint32_t queueDepth;
+static volatile bool busActive;
+static uint32_t busStartTick;
+static uint32_t busTimeoutTicks;
+static sl_sleeptimer_timer_handle_t busWatchdog;
+static i2c_bus_stats_t busStats;
+
+static void i2c_bus_start(void);
+
+void i2c_bus_init(void)
+{
+  queueHead = NULL;
+  queueTail = NULL;
+  queueDepth = 0;
+  busActive = false;
+  busStats = (i2c_bus_stats_t){ 0 };
+  busTimeoutTicks = sl_sleeptimer_ms_to_tick(I2C_BUS_TIMEOUT_MS);
+  sl_sleeptimer_stop_timer(&busWatchdog);
+
+  NVIC_ClearPendingIRQ(I2C_BUS_IRQn(SL_I2CSPM_SENSOR_PERIPHERAL_NO));
+  NVIC_EnableIRQ(I2C_BUS_IRQn(SL_I2CSPM_SENSOR_PERIPHERAL_NO));
+}
+
+static void i2c_bus_prepare(i2c_bus_transfer_t *transfer, uint8_t addr, uint16_t flags,
+                            uint8_t *data, uint16_t len,
+                            i2c_bus_callback_t callback, void *context)
+{
+  transfer->seq.addr = (uint16_t)(addr << 1);
+  transfer->seq.flags = flags;
+  transfer->seq.buf[0].data = data;
+  transfer->seq.buf[0].len = len;
+  transfer->callback = callback;
+  transfer->context = context;
+}
+
+void i2c_bus_prepare_write(i2c_bus_transfer_t *transfer, uint8_t addr,
+                           uint8_t *data, uint16_t len,
+                           i2c_bus_callback_t callback, void *context)
+{
+  i2c_bus_prepare(transfer, addr, I2C_FLAG_WRITE, data, len, callback, context);
+}
+
+void i2c_bus_prepare_read(i2c_bus_transfer_t *transfer, uint8_t addr,
+                          uint8_t *data, uint16_t len,
+                          i2c_bus_callback_t callback, void *context)
+{
+  i2c_bus_prepare(transfer, addr, I2C_FLAG_READ, data, len, callback, context);
+}
+
+// Hủy transfer đang chạy trên ngoại vi: dừng máy trạng thái của I2C, xóa
+// FIFO và cờ ngắt để một ngắt trễ không bị tính cho transfer kế tiếp
+static void i2c_bus_abort(void)
+{
+  sl_i2cspm_sensor->CMD = I2C_CMD_ABORT | I2C_CMD_CLEARTX | I2C_CMD_CLEARPC;
+  I2C_IntDisable(sl_i2cspm_sensor, _I2C_IEN_MASK);
+  I2C_IntClear(sl_i2cspm_sensor, _I2C_IF_MASK);
+  NVIC_ClearPendingIRQ(I2C_BUS_IRQn(SL_I2CSPM_SENSOR_PERIPHERAL_NO));
+}
+
+// Lấy transfer ở đầu hàng ra, gọi khi ngắt đang tắt. Ngắt I2C và watchdog
+// cùng kết thúc transfer theo cách này nên chỉ một bên lấy được nó. Sau đó
+// bên gọi báo kết quả qua callback, callback có thể nộp bước tiếp theo, kể
+// cả nộp lại chính mô tả này.
+static i2c_bus_transfer_t *i2c_bus_dequeue(I2C_TransferReturn_TypeDef result)
+{
+  i2c_bus_transfer_t *done = queueHead;
+
+  queueHead = done->next;
+  if (queueHead == NULL) {
+      queueTail = NULL;
+  }
+  queueDepth--;
+  busActive = false;
+  sl_sleeptimer_stop_timer(&busWatchdog);
+  busStats.busy_ticks += sl_sleeptimer_get_tick_count() - busStartTick;
+  done->next = NULL;
+  done->pending = false;
+  busStats.completed++;
+  if (result != i2cTransferDone) {
+      busStats.errors++;
+  }
+  return done;
+}
+
+// Watchdog: transfer chiếm bus quá I2C_BUS_TIMEOUT_MS (thiết bị giữ SDA/SCL,
+// thiếu điện trở kéo lên...) thì bị hủy và kết thúc với i2cTransferSwFault,
+// để hàng đợi và driver không chờ mãi
+static void i2c_bus_timeout(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  i2c_bus_transfer_t *done;
+  CORE_DECLARE_IRQ_STATE;
+
+  (void)handle;
+  (void)data;
+  CORE_ENTER_CRITICAL();
+  // Transfer vừa xong ngay trước khi timer chạy thì không còn gì để hủy
+  if (!busActive
+      || sl_sleeptimer_get_tick_count() - busStartTick < busTimeoutTicks) {
+      CORE_EXIT_CRITICAL();
+      return;
+  }
+  i2c_bus_abort();
+  busStats.timeouts++;
+  done = i2c_bus_dequeue(i2cTransferSwFault);
+  CORE_EXIT_CRITICAL();
+
+  done->callback(done, i2cTransferSwFault);
+  i2c_bus_start();
+}
+
+// Bắt đầu transfer ở đầu hàng nếu bus rảnh
+static void i2c_bus_start(void)
+{
+  for (;;) {
+      I2C_TransferReturn_TypeDef ret;
+      i2c_bus_transfer_t *done;
+      CORE_DECLARE_IRQ_STATE;
+
+      CORE_ENTER_CRITICAL();
+      if (busActive || queueHead == NULL) {
+          CORE_EXIT_CRITICAL();
+          return;
+      }
+      busActive = true;
+      busStartTick = sl_sleeptimer_get_tick_count();
+      ret = I2C_TransferInit(sl_i2cspm_sensor, &queueHead->seq);
+      if (ret == i2cTransferInProgress) {
+          sl_sleeptimer_start_timer(&busWatchdog, busTimeoutTicks, i2c_bus_timeout,
+                                    NULL, 0, 0);
+          CORE_EXIT_CRITICAL();
+          return;
+      }
+      // Sai tham số: báo lỗi ngay rồi thử transfer kế tiếp
+      done = i2c_bus_dequeue(ret);
+      CORE_EXIT_CRITICAL();
+      done->callback(done, ret);
+  }
+}
+
+sl_status_t i2c_bus_submit(i2c_bus_transfer_t *transfer)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (transfer == NULL || transfer->callback == NULL) {
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_CRITICAL();
+  if (transfer->pending) {
+      CORE_EXIT_CRITICAL();
+      return SL_STATUS_BUSY;
+  }
+  transfer->pending = true;
+  transfer->next = NULL;
+  if (queueTail != NULL) {
+      queueTail->next = transfer;
+  } else {
+      queueHead = transfer;
+  }
+  queueTail = transfer;
+  busStats.submitted++;
+  if (++queueDepth > busStats.max_depth) {
+      busStats.max_depth = queueDepth;
+  }
+  CORE_EXIT_CRITICAL();
+
+  i2c_bus_start();
+  return SL_STATUS_OK;
+}
+
+bool i2c_bus_is_idle(void)
+{
+  return queueHead == NULL;
+}
+
+I2C_TransferReturn_TypeDef i2c_bus_transfer_blocking(I2C_TransferSeq_TypeDef *seq)
+{
+  I2C_TransferReturn_TypeDef ret;
+  uint32_t timeout = I2C_BUS_POLL_TIMEOUT;
+
+  if (!i2c_bus_is_idle()) {
+      return i2cTransferUsageFault;
+  }
+
+  // Hỏi vòng như I2CSPM_Transfer(), ngắt tắt để ISR không giành trạng thái
+  NVIC_DisableIRQ(I2C_BUS_IRQn(SL_I2CSPM_SENSOR_PERIPHERAL_NO));
+  ret = I2C_TransferInit(sl_i2cspm_sensor, seq);
+  while (ret == i2cTransferInProgress && timeout-- > 0) {
+      ret = I2C_Transfer(sl_i2cspm_sensor);
+  }
+  if (ret == i2cTransferInProgress) {
+      i2c_bus_abort();
+      busStats.timeouts++;
+      ret = i2cTransferSwFault;
+  }
+  NVIC_ClearPendingIRQ(I2C_BUS_IRQn(SL_I2CSPM_SENSOR_PERIPHERAL_NO));
+  NVIC_EnableIRQ(I2C_BUS_IRQn(SL_I2CSPM_SENSOR_PERIPHERAL_NO));
+  return ret;
+}
+
+const i2c_bus_stats_t *i2c_bus_get_stats(void)
+{
+  return &busStats;
+}
+
+// Ngắt của ngoại vi I2C: emlib tiến máy trạng thái của transfer đang chạy,
+// xong thì báo driver và chạy transfer kế tiếp
+void I2C_BUS_IRQHandler(SL_I2CSPM_SENSOR_PERIPHERAL_NO)(void)
+{
+  I2C_TransferReturn_TypeDef ret;
+  i2c_bus_transfer_t *done;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  ret = I2C_Transfer(sl_i2cspm_sensor);
+  if (ret == i2cTransferInProgress || !busActive) {
+      CORE_EXIT_CRITICAL();
+      return;
+  }
+  done = i2c_bus_dequeue(ret);
+  CORE_EXIT_CRITICAL();
+
+  done->callback(done, ret);
+  i2c_bus_start();
+}
@@ -0,0 +1,81 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include "sl_status.h"
+#include "em_i2c.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Hàng đợi transfer I2C trên sl_i2cspm_sensor, chạy bằng ngắt của ngoại vi
+// I2C (emlib I2C_TransferInit()/I2C_Transfer()) thay cho I2CSPM_Transfer()
+// chặn CPU suốt thời gian trên dây.
+//
+// Mỗi driver giữ mô tả transfer của mình (i2c_bus_transfer_t, không cấp phát
+// động), nộp vào hàng đợi bằng i2c_bus_submit() rồi trả về ngay. Transfer
+// chạy lần lượt theo thứ tự nộp; xong một transfer thì callback của nó được
+// gọi TRONG NGẮT với kết quả của emlib, và transfer kế tiếp được bắt đầu.
+// Callback chỉ nên lưu kết quả, hẹn timer, nộp bước tiếp theo hoặc báo cho
+// vòng lặp chính (sl_bt_external_signal()).
+//
+// Transfer nào chiếm bus quá I2C_BUS_TIMEOUT_MS bị watchdog (sleeptimer) hủy
+// và kết thúc với i2cTransferSwFault, nên một thiết bị treo bus không làm
+// cả hàng đợi đứng yên.
+
+// Thời gian tối đa một transfer được chạy trên bus, đủ rộng cho vài chục
+// byte ở 100 kHz kèm clock stretching
+#ifndef I2C_BUS_TIMEOUT_MS
+#define I2C_BUS_TIMEOUT_MS 10
+#endif
+
+typedef struct i2c_bus_transfer i2c_bus_transfer_t;
+
+// Gọi trong ngắt khi transfer kết thúc, result là i2cTransferDone hoặc lỗi
+typedef void (*i2c_bus_callback_t)(i2c_bus_transfer_t *transfer,
+                                   I2C_TransferReturn_TypeDef result);
+
+struct i2c_bus_transfer {
+  I2C_TransferSeq_TypeDef seq;    // Địa chỉ, cờ và bộ đệm như I2CSPM_Transfer()
+  i2c_bus_callback_t callback;
+  void *context;                  // Dữ liệu riêng của driver
+  i2c_bus_transfer_t *next;       // Dùng nội bộ cho hàng đợi
+  volatile bool pending;          // true từ lúc nộp tới trước khi gọi callback
+};
+
+// Thống kê từ lúc i2c_bus_init()
+typedef struct {
+  uint32_t submitted;             // Số transfer đã nộp
+  uint32_t completed;             // Số transfer xong (kể cả lỗi)
+  uint32_t errors;                // Số transfer kết thúc khác i2cTransferDone
+  uint32_t max_depth;             // Số transfer chờ nhiều nhất (kể cả đang chạy)
+  uint32_t busy_ticks;            // Tổng tick sleeptimer bus có transfer đang chạy
+  uint32_t timeouts;              // Số transfer bị hủy vì quá hạn (kể cả chặn)
+} i2c_bus_stats_t;
+
+// --- HÀM: BẬT NGẮT I2C, XÓA HÀNG ĐỢI VÀ THỐNG KÊ (GỌI SAU sl_i2cspm_init) ---
+void i2c_bus_init(void);
+
+// --- HÀM: ĐIỀN MÔ TẢ MỘT LẦN GHI/ĐỌC ĐƠN Ở ĐỊA CHỈ 7 BIT ---
+void i2c_bus_prepare_write(i2c_bus_transfer_t *transfer, uint8_t addr,
+                           uint8_t *data, uint16_t len,
+                           i2c_bus_callback_t callback, void *context);
+void i2c_bus_prepare_read(i2c_bus_transfer_t *transfer, uint8_t addr,
+                          uint8_t *data, uint16_t len,
+                          i2c_bus_callback_t callback, void *context);
+
+// --- HÀM: NỘP TRANSFER VÀO HÀNG ĐỢI, GỌI ĐƯỢC TRONG NGẮT ---
+// Trả về SL_STATUS_BUSY nếu mô tả này còn đang chờ, SL_STATUS_INVALID_PARAMETER
+// nếu thiếu callback. Bộ đệm phải còn sống tới khi callback được gọi.
+sl_status_t i2c_bus_submit(i2c_bus_transfer_t *transfer);
+
+// --- HÀM: true KHI KHÔNG CÒN TRANSFER NÀO CHỜ HOẶC ĐANG CHẠY ---
+bool i2c_bus_is_idle(void);
+
+// --- HÀM: TRANSFER CHẶN (HỎI VÒNG, TẮT NGẮT I2C) CHO LÚC KHỞI ĐỘNG ---
+// Dùng cho dht20_init(), i2c_scan()... khi chưa có gì khác trên bus. Trả về
+// i2cTransferUsageFault nếu hàng đợi đang bận thay vì chen vào giữa chừng,
+// i2cTransferSwFault nếu transfer không xong sau số lần hỏi vòng tối đa.
+I2C_TransferReturn_TypeDef i2c_bus_transfer_blocking(I2C_TransferSeq_TypeDef *seq);
+
+const i2c_bus_stats_t *i2c_bus_get_stats(void);
+
+#endif // I2C_BUS_H
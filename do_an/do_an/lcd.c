@@ -29,13 +29,15 @@
  ******************************************************************************/
 #include <lcd.h>
 #include <lcd_display.h>
+#include "sl_component_catalog.h"
 #include "sl_sleeptimer.h"
 #include "sl_udelay.h"
 #include "sl_clock_manager.h"
-#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && defined(SL_MEMLCD_USE_EUSART)
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
 #include "sl_power_manager.h"
 #endif
 
+#include "em_core.h"
 #include "em_gpio.h"
 
 #include <string.h>
@@ -46,9 +48,14 @@
 /* Concatenate preprocessor tokens A and B. */
 #define SL_CONCAT(A, B) A ## B
 
+/* Concatenate preprocessor tokens A, B and C. */
+#define SL_CONCAT3(A, B, C) A ## B ## C
+
 /* Generate the cmu clock symbol based on instance. */
 #if defined(SL_MEMLCD_USE_USART)
 #define SL_MEMLCD_SPI_CLOCK(N) SL_CONCAT(SL_BUS_CLOCK_USART, N)
+#define SL_MEMLCD_SPI_TX_IRQn(N) SL_CONCAT3(USART, N, _TX_IRQn)
+#define SL_MEMLCD_SPI_TX_IRQHandler(N) SL_CONCAT3(USART, N, _TX_IRQHandler)
 #elif defined(SL_MEMLCD_USE_EUSART)
 #define SL_MEMLCD_SPI_CLOCK(N) SL_CONCAT(SL_BUS_CLOCK_EUSART, N)
 #endif
@@ -100,6 +107,34 @@ static sli_memlcd_spi_handle_t spi_handle = {
 };
 #endif
 
+/* Display orientation chosen at compile time, see lcd_display.h: the row
+ * address sent for a framebuffer row, and reversal of the pixels of a row. */
+#if SL_MEMLCD_DISPLAY_REVERSE_ROWS
+#define LCD_ROW_ADDRESS(device, row)  ((uint8_t)((device)->height - 1 - (row)))
+#else
+#define LCD_ROW_ADDRESS(device, row)  ((uint8_t)(row))
+#endif
+
+#if SL_MEMLCD_DISPLAY_REVERSE_PIXELS
+static void reverse_row(uint8_t *dst, const uint8_t *src, unsigned int bytes);
+#endif
+
+#if defined(SL_MEMLCD_USE_USART)
+/** Completion callback of the transfer started by lcd_tx_async(). */
+static sl_memlcd_callback_t tx_async_callback;
+static void *tx_async_context;
+
+static void lcd_tx_async_done(void *context);
+
+/** One-shot timer ending the SCS hold time after an asynchronous transfer,
+ *  so the completion interrupt does not busy-wait. */
+static sl_sleeptimer_timer_handle_t hold_timer;
+static volatile bool hold_pending;
+
+static void hold_timer_expired(sl_sleeptimer_timer_handle_t *handle, void *data);
+static void lcd_tx_release(const struct sl_memlcd_t *device);
+#endif
+
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && defined(SL_MEMLCD_USE_EUSART)
 static sl_power_manager_em_transition_event_handle_t on_power_manager_event_handle;
 
@@ -123,6 +158,10 @@ sl_status_t lcd_configure(struct sl_memlcd_t *device)
   sli_memlcd_spi_init(&spi_handle, device->spi_freq, eusartClockMode0);
 #elif defined(SL_MEMLCD_USE_USART)
   sli_memlcd_spi_init(&spi_handle, device->spi_freq, usartClockMode0);
+
+  /* TX interrupt used by lcd_tx_async() */
+  NVIC_ClearPendingIRQ(SL_MEMLCD_SPI_TX_IRQn(SL_MEMLCD_SPI_PERIPHERAL_NO));
+  NVIC_EnableIRQ(SL_MEMLCD_SPI_TX_IRQn(SL_MEMLCD_SPI_PERIPHERAL_NO));
 #endif
 
   /* Setup GPIOs */
@@ -182,6 +221,9 @@ sl_status_t lcd_clear(const struct sl_memlcd_t *device)
 {
   uint16_t cmd;
 
+  /* Let a pending asynchronous transfer finish first */
+  lcd_tx_wait(device);
+
   /* Set SCS */
   GPIO_PinOutSet(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
 
@@ -204,27 +246,132 @@ sl_status_t lcd_clear(const struct sl_memlcd_t *device)
 
 sl_status_t lcd_tx(const struct sl_memlcd_t *device, const void *data, unsigned int row_start, unsigned int row_count)
 {
+  uint8_t cmd = CMD_UPDATE;
+  uint8_t dummy = 0x00;
+  const uint8_t *p = data;
 
-  sl_status_t status;
+  if (row_count == 0) {
+    return SL_STATUS_OK;
+  }
 
-  for (unsigned int i = 0; i < row_count; i++) {
-      uint8_t cmd = CMD_UPDATE;
-      uint8_t row = (uint8_t)row_start;
-      uint8_t dummy = 0x00;
+  /* Let a pending asynchronous transfer finish first */
+  lcd_tx_wait(device);
 
-      GPIO_PinOutSet(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
-      sl_udelay_wait(device->setup_us);
+  /* Multi-line update: all rows go out in a single SCS window. The command
+   * byte is sent once, each row is sent as address, data and one dummy byte,
+   * and one more dummy byte ends the transfer. */
+  GPIO_PinOutSet(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+  sl_udelay_wait(device->setup_us);
+
+  sli_memlcd_spi_tx(&spi_handle, &cmd, 1);
+  for (unsigned int i = 0; i < row_count; i++) {
+      uint8_t row = LCD_ROW_ADDRESS(device, row_start + i);
 
-      sli_memlcd_spi_tx(&spi_handle, &cmd, 1);
       sli_memlcd_spi_tx(&spi_handle, &row, 1);
-      sli_memlcd_spi_tx(&spi_handle, data, device->width / 8);
+#if SL_MEMLCD_DISPLAY_REVERSE_PIXELS
+      uint8_t line[SL_MEMLCD_DISPLAY_WIDTH / 8];
+
+      /* The bytes are in the USART FIFO when sli_memlcd_spi_tx() returns */
+      reverse_row(line, p, device->width / 8);
+      sli_memlcd_spi_tx(&spi_handle, line, device->width / 8);
+#else
+      sli_memlcd_spi_tx(&spi_handle, p, device->width / 8);
+#endif
       sli_memlcd_spi_tx(&spi_handle, &dummy, 1);
-      sli_memlcd_spi_wait(&spi_handle);
-      sl_udelay_wait(device->hold_us);
-      GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
-      row_start++;
-      data = (uint8_t*)data + device->width / 8;
+      p += device->width / 8;
   }
+  sli_memlcd_spi_tx(&spi_handle, &dummy, 1);
+
+  sli_memlcd_spi_wait(&spi_handle);
+  sl_udelay_wait(device->hold_us);
+  GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t lcd_tx_async(const struct sl_memlcd_t *device,
+                         const void *data,
+                         const uint8_t *rows,
+                         unsigned int row_count,
+                         uint8_t *buffer,
+                         sl_memlcd_callback_t callback,
+                         void *context)
+{
+#if defined(SL_MEMLCD_USE_USART)
+  const uint8_t *p = data;
+  unsigned int row_bytes = device->width / 8;
+  unsigned int len = 0;
+  sl_status_t status;
+
+  if (row_count == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  /* The buffer may still be in use by the previous transfer */
+  if (sli_memlcd_spi_tx_busy(&spi_handle)) {
+    return SL_STATUS_BUSY;
+  }
+  /* SCS of the previous transfer may still be in its hold time */
+  lcd_tx_release(device);
+
+  /* Same multi-line update as lcd_tx(). The rows do not need to be
+   * consecutive, since every row carries its own address. */
+  buffer[len++] = CMD_UPDATE;
+  for (unsigned int i = 0; i < row_count; i++) {
+      buffer[len++] = LCD_ROW_ADDRESS(device, rows[i]);
+#if SL_MEMLCD_DISPLAY_REVERSE_PIXELS
+      reverse_row(&buffer[len], p + rows[i] * row_bytes, row_bytes);
+#else
+      memcpy(&buffer[len], p + rows[i] * row_bytes, row_bytes);
+#endif
+      len += row_bytes;
+      buffer[len++] = 0x00;
+  }
+  buffer[len++] = 0x00;
+
+  tx_async_callback = callback;
+  tx_async_context  = context;
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+  /* The USART does not run in EM2 */
+  sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+#endif
+
+  GPIO_PinOutSet(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+  sl_udelay_wait(device->setup_us);
+
+  status = sli_memlcd_spi_tx_async(&spi_handle, buffer, len,
+                                   lcd_tx_async_done, (void *)device);
+  if (status != SL_STATUS_OK) {
+    GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+    sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+#endif
+  }
+
+  return status;
+#else
+  (void) device;
+  (void) data;
+  (void) rows;
+  (void) row_count;
+  (void) buffer;
+  (void) callback;
+  (void) context;
+
+  return SL_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+void lcd_tx_wait(const struct sl_memlcd_t *device)
+{
+  (void) device;
+
+#if defined(SL_MEMLCD_USE_USART)
+  while (sli_memlcd_spi_tx_busy(&spi_handle))
+    ;
+  lcd_tx_release(device);
+#endif
 }
 
 const sl_memlcd_t *lcd_get(void)
@@ -236,6 +383,19 @@ const sl_memlcd_t *lcd_get(void)
   }
 }
 
+#if SL_MEMLCD_DISPLAY_REVERSE_PIXELS
+/***************************************************************************//**
+ * Copy a framebuffer row with its pixels in reverse order: the last byte
+ * first, each with its bits reversed.
+ ******************************************************************************/
+static void reverse_row(uint8_t *dst, const uint8_t *src, unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; i++) {
+    dst[bytes - 1 - i] = SL_RBIT8(src[i]);
+  }
+}
+#endif
+
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && defined(SL_MEMLCD_USE_EUSART)
 /***************************************************************************//**
  * Power Manager callback notification for EUSART.
@@ -258,6 +418,92 @@ static void on_power_manager_event(sl_power_manager_em_t from,
 }
 #endif
 
+#if defined(SL_MEMLCD_USE_USART)
+/***************************************************************************//**
+ * Completion of the SPI transfer started by lcd_tx_async(). Starts the SCS
+ * hold time and notifies the caller: the transfer buffer is free from now on.
+ * Runs in interrupt context.
+ ******************************************************************************/
+static void lcd_tx_async_done(void *context)
+{
+  const sl_memlcd_t *device = context;
+  uint32_t ticks;
+
+  /* Round up: the hold time is a minimum */
+  ticks = (uint32_t)(((uint64_t)device->hold_us * sl_sleeptimer_get_timer_frequency()
+                      + 999999u) / 1000000u);
+  if (ticks == 0) {
+    ticks = 1;
+  }
+  hold_pending = true;
+  if (sl_sleeptimer_start_timer(&hold_timer, ticks, hold_timer_expired, NULL, 0,
+                                SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG)
+      != SL_STATUS_OK) {
+    hold_pending = false;
+    sl_udelay_wait(device->hold_us);
+    GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+  }
+
+  /* The sleeptimer keeps running in EM2 */
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+  sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+#endif
+
+  if (tx_async_callback != NULL) {
+    tx_async_callback(tx_async_context);
+  }
+}
+
+/***************************************************************************//**
+ * End of the SCS hold time started by lcd_tx_async_done().
+ ******************************************************************************/
+static void hold_timer_expired(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  (void) handle;
+  (void) data;
+
+  CORE_ENTER_ATOMIC();
+  if (hold_pending) {
+    hold_pending = false;
+    GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * End the SCS window of the last asynchronous transfer now if its hold timer
+ * has not expired yet. Called from the main loop before the next transfer.
+ ******************************************************************************/
+static void lcd_tx_release(const struct sl_memlcd_t *device)
+{
+  bool pending;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  pending = hold_pending;
+  if (pending) {
+    hold_pending = false;
+    sl_sleeptimer_stop_timer(&hold_timer);
+  }
+  CORE_EXIT_ATOMIC();
+
+  if (pending) {
+    sl_udelay_wait(device->hold_us);
+    GPIO_PinOutClear(SL_MEMLCD_SPI_CS_PORT, SL_MEMLCD_SPI_CS_PIN);
+  }
+}
+
+/***************************************************************************//**
+ * TX interrupt of the USART driving the display.
+ ******************************************************************************/
+void SL_MEMLCD_SPI_TX_IRQHandler(SL_MEMLCD_SPI_PERIPHERAL_NO)(void)
+{
+  sli_memlcd_spi_irq_handler(&spi_handle);
+}
+#endif
+
 #if defined (SL_MEMLCD_EXTCOMIN_PORT)
 /**************************************************************************//**
  * @brief
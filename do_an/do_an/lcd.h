@@ -55,6 +55,17 @@ extern "C" {
 #define SL_MEMLCD_COLOR_MODE_MONOCHROME          1
 #define SL_MEMLCD_COLOR_MODE_RGB_3BIT            2
 
+/** Size of a framebuffer of a display of width x height pixels at bpp bits
+ *  per pixel, e.g. for sizing the pool given to DMD_setFramebufferPool(). */
+#define SL_MEMLCD_FRAMEBUFFER_SIZE(width, height, bpp) \
+  (((width) * (height) * (bpp)) / 8)
+
+/** Size of the buffer needed by @ref lcd_tx_async() to send row_count rows
+ *  of a display that is width pixels wide: command byte, address, data and
+ *  dummy byte per row, and the final dummy byte. */
+#define SL_MEMLCD_TX_BUFFER_SIZE(width, row_count) \
+  (2 + (row_count) * ((width) / 8 + 2))
+
 /***************************************************************************//**
  * @addtogroup memlcd MEMLCD - Memory LCD
  * @brief Memory LCD interface.
@@ -130,6 +141,10 @@ sl_status_t lcd_clear(const struct sl_memlcd_t *device);
  * @brief
  *   Transmit a number of rows to the memory LCD display.
  *
+ * @details
+ *   The rows are sent as one multi-line update: a single SCS window and
+ *   command byte for all of them.
+ *
  * @param[in] device
  *   Memory LCD display device.
  *
@@ -151,6 +166,71 @@ sl_status_t lcd_tx(const struct sl_memlcd_t *device,
                            unsigned int row_start,
                            unsigned int row_count);
 
+/**************************************************************************//**
+ * @brief
+ *   Callback called when @ref lcd_tx_async() has completed.
+ *
+ * @note
+ *   Called from interrupt context.
+ *****************************************************************************/
+typedef void (*sl_memlcd_callback_t)(void *context);
+
+/**************************************************************************//**
+ * @brief
+ *   Start sending a set of rows to the memory LCD display without waiting.
+ *
+ * @details
+ *   The rows are packed into @p buffer as one multi-line update, which is
+ *   then sent by an interrupt driven SPI transfer. The function returns as
+ *   soon as the transfer is started, so @p data can be modified right away.
+ *   @p buffer must stay untouched until @p callback has been called.
+ *   SCS is released by a one-shot sleeptimer after the hold time, or by the
+ *   next lcd_tx_async(), lcd_tx(), lcd_clear() or lcd_tx_wait() if that
+ *   comes first.
+ *
+ * @param[in] device
+ *   Memory LCD display device.
+ *
+ * @param[in] data
+ *   Pointer to the first row of the pixel matrix buffer.
+ *
+ * @param[in] rows
+ *   Numbers of the rows to send, in any order. First row is 0.
+ *
+ * @param[in] row_count
+ *   Number of entries in rows, at least 1.
+ *
+ * @param[out] buffer
+ *   Transfer buffer of at least SL_MEMLCD_TX_BUFFER_SIZE(width, row_count)
+ *   bytes.
+ *
+ * @param[in] callback
+ *   Function called when the transfer has completed, or NULL.
+ *
+ * @param[in] context
+ *   Passed to the callback.
+ *
+ * @return
+ *   SL_STATUS_OK if the transfer was started, SL_STATUS_BUSY if another
+ *   transfer is in progress.
+ *****************************************************************************/
+sl_status_t lcd_tx_async(const struct sl_memlcd_t *device,
+                         const void *data,
+                         const uint8_t *rows,
+                         unsigned int row_count,
+                         uint8_t *buffer,
+                         sl_memlcd_callback_t callback,
+                         void *context);
+
+/**************************************************************************//**
+ * @brief
+ *   Wait until a transfer started by @ref lcd_tx_async() has completed.
+ *
+ * @param[in] device
+ *   Memory LCD display device.
+ *****************************************************************************/
+void lcd_tx_wait(const struct sl_memlcd_t *device);
+
 /**************************************************************************//**
  * @brief
  *   Refresh the display device.
@@ -43,6 +43,65 @@ extern "C" {
 #define SL_MEMLCD_DISPLAY_BPP             1
 #define SL_MEMLCD_DISPLAY_RGB_3BIT        0
 
+/* Orientation of the image on the panel, for boards mounted rotated or
+ * upside down. The image drawn through the DMD driver is turned clockwise by
+ * SL_MEMLCD_DISPLAY_ROTATION degrees (0, 90, 180 or 270), then mirrored left
+ * to right if SL_MEMLCD_DISPLAY_MIRROR is 1. */
+#ifndef SL_MEMLCD_DISPLAY_ROTATION
+#define SL_MEMLCD_DISPLAY_ROTATION        0
+#endif
+#ifndef SL_MEMLCD_DISPLAY_MIRROR
+#define SL_MEMLCD_DISPLAY_MIRROR          0
+#endif
+
+#if (SL_MEMLCD_DISPLAY_ROTATION != 0) && (SL_MEMLCD_DISPLAY_ROTATION != 90) \
+  && (SL_MEMLCD_DISPLAY_ROTATION != 180) && (SL_MEMLCD_DISPLAY_ROTATION != 270)
+#error "SL_MEMLCD_DISPLAY_ROTATION must be 0, 90, 180 or 270"
+#endif
+
+/* How the orientation is implemented. For 90 and 270 degrees the framebuffer
+ * holds the image transposed: image pixel (x, y) is framebuffer pixel (y, x).
+ * lcd_tx() and lcd_tx_async() then reverse the pixels of each row and/or the
+ * order of the rows while sending, so the other modes cost nothing while
+ * drawing. */
+#define SL_MEMLCD_DISPLAY_TRANSPOSED      ((SL_MEMLCD_DISPLAY_ROTATION == 90) \
+                                           || (SL_MEMLCD_DISPLAY_ROTATION == 270))
+#define SL_MEMLCD_DISPLAY_REVERSE_PIXELS  (((SL_MEMLCD_DISPLAY_ROTATION == 90)   \
+                                            || (SL_MEMLCD_DISPLAY_ROTATION == 180)) \
+                                           != (SL_MEMLCD_DISPLAY_MIRROR != 0))
+#define SL_MEMLCD_DISPLAY_REVERSE_ROWS    ((SL_MEMLCD_DISPLAY_ROTATION == 180) \
+                                           || (SL_MEMLCD_DISPLAY_ROTATION == 270))
+
+#if SL_MEMLCD_DISPLAY_RGB_3BIT && (SL_MEMLCD_DISPLAY_ROTATION || SL_MEMLCD_DISPLAY_MIRROR)
+#error "Display rotation is only supported on monochrome displays"
+#endif
+
+/* The transposed framebuffer keeps the panel row stride (WIDTH / 8 bytes)
+ * and the panel row count, so the image must have the panel's size. */
+#if SL_MEMLCD_DISPLAY_TRANSPOSED && (SL_MEMLCD_DISPLAY_WIDTH != SL_MEMLCD_DISPLAY_HEIGHT)
+#error "Rotation by 90 or 270 degrees needs a square display"
+#endif
+
+/* Display list mode, for panels whose framebuffer does not fit in RAM. The
+ * DMD drawing functions record compact commands in a list of
+ * SL_MEMLCD_DISPLAY_LIST_SIZE bytes instead of drawing into a framebuffer,
+ * and DMD_updateDisplay() replays them into a buffer of
+ * SL_MEMLCD_DISPLAY_LIST_BAND_ROWS rows, one band of the display at a time.
+ * Only the bands holding rows drawn since the last update are rendered. */
+#ifndef SL_MEMLCD_DISPLAY_LIST
+#define SL_MEMLCD_DISPLAY_LIST            0
+#endif
+#ifndef SL_MEMLCD_DISPLAY_LIST_SIZE
+#define SL_MEMLCD_DISPLAY_LIST_SIZE       4096
+#endif
+#ifndef SL_MEMLCD_DISPLAY_LIST_BAND_ROWS
+#define SL_MEMLCD_DISPLAY_LIST_BAND_ROWS  16
+#endif
+
+#if SL_MEMLCD_DISPLAY_LIST && (SL_MEMLCD_DISPLAY_RGB_3BIT || SL_MEMLCD_DISPLAY_TRANSPOSED)
+#error "The display list mode needs a monochrome display rotated by 0 or 180 degrees"
+#endif
+
 /* Max supported frequency is 1.1 MHz */
 #define SL_MEMLCD_SCLK_FREQ               1100000
 
@@ -32,6 +32,15 @@
 #include "sl_clock_manager.h"
 #include "em_gpio.h"
 
+/* State of the interrupt driven transfer. */
+static struct {
+  const uint8_t *data;
+  unsigned remaining;
+  sli_memlcd_spi_callback_t callback;
+  void *context;
+  volatile bool busy;
+} async_tx;
+
 sl_status_t sli_memlcd_spi_init(sli_memlcd_spi_handle_t *handle, int baudrate, USART_ClockMode_TypeDef mode)
 {
   USART_InitSync_TypeDef init = USART_INITSYNC_DEFAULT;
@@ -84,6 +93,71 @@ sl_status_t sli_memlcd_spi_tx(sli_memlcd_spi_handle_t *handle, const void *data,
   return SL_STATUS_OK;
 }
 
+sl_status_t sli_memlcd_spi_tx_async(sli_memlcd_spi_handle_t *handle,
+                                    const void *data, unsigned len,
+                                    sli_memlcd_spi_callback_t callback,
+                                    void *context)
+{
+  USART_TypeDef *usart = handle->usart;
+
+  if (async_tx.busy) {
+    return SL_STATUS_BUSY;
+  }
+  if (len == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  async_tx.data      = data;
+  async_tx.remaining = len;
+  async_tx.callback  = callback;
+  async_tx.context   = context;
+  async_tx.busy      = true;
+
+  /* The TXBL interrupt fires right away since the buffer is empty. */
+  USART_IntClear(usart, USART_IF_TXC);
+  USART_IntEnable(usart, USART_IEN_TXBL);
+
+  return SL_STATUS_OK;
+}
+
+bool sli_memlcd_spi_tx_busy(sli_memlcd_spi_handle_t *handle)
+{
+  (void) handle;
+
+  return async_tx.busy;
+}
+
+void sli_memlcd_spi_irq_handler(sli_memlcd_spi_handle_t *handle)
+{
+  USART_TypeDef *usart = handle->usart;
+  uint32_t flags = USART_IntGetEnabled(usart);
+
+  if (flags & USART_IF_TXBL) {
+    /* Keep the transmit buffer filled. */
+    while (async_tx.remaining && (usart->STATUS & USART_STATUS_TXBL)) {
+      usart->TXDATA = SL_RBIT8(*async_tx.data);
+      async_tx.data++;
+      async_tx.remaining--;
+    }
+
+    /* Everything is queued, wait for the last byte to be shifted out. */
+    if (async_tx.remaining == 0) {
+      USART_IntDisable(usart, USART_IEN_TXBL);
+      USART_IntClear(usart, USART_IF_TXC);
+      USART_IntEnable(usart, USART_IEN_TXC);
+    }
+  }
+
+  if (flags & USART_IF_TXC) {
+    USART_IntDisable(usart, USART_IEN_TXC);
+    USART_IntClear(usart, USART_IF_TXC);
+    async_tx.busy = false;
+    if (async_tx.callback != NULL) {
+      async_tx.callback(async_tx.context);
+    }
+  }
+}
+
 void sli_memlcd_spi_wait(sli_memlcd_spi_handle_t *handle)
 {
   USART_TypeDef *usart = handle->usart;
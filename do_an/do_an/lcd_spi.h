@@ -30,6 +30,7 @@
 #ifndef SL_MEMLCD_SPI_H
 #define SL_MEMLCD_SPI_H
 
+#include <stdbool.h>
 #include "sl_status.h"
 #include "em_usart.h"
 #include "sl_clock_manager.h"
@@ -121,6 +122,67 @@ sl_status_t sli_memlcd_spi_shutdown(sli_memlcd_spi_handle_t *handle);
  *****************************************************************************/
 sl_status_t sli_memlcd_spi_tx(sli_memlcd_spi_handle_t *handle, const void *data, unsigned len);
 
+/***************************************************************************//**
+ * @brief
+ *   Callback called when an interrupt driven transfer has completed.
+ *
+ * @note
+ *   Called from interrupt context.
+ *****************************************************************************/
+typedef void (*sli_memlcd_spi_callback_t)(void *context);
+
+/***************************************************************************//**
+ * @brief
+ *   Start an interrupt driven transmission on the SPI interface.
+ *
+ * @details
+ *   The function returns as soon as the transfer is started. The data is fed
+ *   to the USART from its TX interrupt and must stay valid until the callback
+ *   has been called. Only one transfer can be in progress at a time.
+ *
+ * @param[in] handle
+ *   Handle to the SPI interface.
+ *
+ * @param[in] data
+ *   Pointer to the data to be transmitted.
+ *
+ * @param[in] len
+ *   Length of data to transmit.
+ *
+ * @param[in] callback
+ *   Function called when the last bit has been shifted out.
+ *
+ * @param[in] context
+ *   Passed to the callback.
+ *
+ * @return
+ *   SL_STATUS_OK if the transfer was started, SL_STATUS_BUSY if a transfer
+ *   is already in progress.
+ *****************************************************************************/
+sl_status_t sli_memlcd_spi_tx_async(sli_memlcd_spi_handle_t *handle,
+                                    const void *data, unsigned len,
+                                    sli_memlcd_spi_callback_t callback,
+                                    void *context);
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether an interrupt driven transfer is in progress.
+ *
+ * @param[in] handle
+ *   Handle to the SPI interface.
+ *****************************************************************************/
+bool sli_memlcd_spi_tx_busy(sli_memlcd_spi_handle_t *handle);
+
+/***************************************************************************//**
+ * @brief
+ *   TX interrupt handler for interrupt driven transfers. Must be called from
+ *   the TX interrupt vector of the USART used by the handle.
+ *
+ * @param[in] handle
+ *   Handle to the SPI interface.
+ *****************************************************************************/
+void sli_memlcd_spi_irq_handler(sli_memlcd_spi_handle_t *handle);
+
 /***************************************************************************//**
  * @brief
  *   Wait for the SPI interface to complete all the pending transfers.
@@ -0,0 +1,206 @@
+#include "sensor_filter.h"
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+
+// Kalman giữ ước lượng với 8 bit lẻ (centi << 8), hệ số K theo Q16
+#define KALMAN_FRAC                 8
+#define KALMAN_ONE                  ((uint32_t)1 << 16)
+
+// Trạng thái của một kênh, cố định cho mọi bộ lọc
+typedef struct {
+  int16_t history[SENSOR_FILTER_WINDOW_MAX];  // Vòng đệm các mẫu gần nhất
+  uint8_t head;                               // Vị trí ghi mẫu kế tiếp
+  uint8_t count;                              // Số mẫu đang có (<= window)
+  int32_t sum;                                // Tổng history[] cho AVG
+  int32_t estimate;                           // Kalman: centi << KALMAN_FRAC
+  uint32_t variance;                          // Kalman: phương sai (centi^2)
+} filter_channel_t;
+
+static filter_channel_t channels[SENSOR_FILTER_CHANNELS];
+static sensor_filter_type_t filterType;
+static uint8_t filterWindow;
+static uint16_t filterDeadband;
+
+// Giá trị đã chuyển cho LCD/BLE lần gần nhất
+static int16_t published[SENSOR_FILTER_CHANNELS];
+static bool havePublished;
+static sensor_filter_stats_t filterStats;
+
+static const char *const filterNames[SENSOR_FILTER_COUNT] = {
+  [SENSOR_FILTER_NONE] = "NONE",
+  [SENSOR_FILTER_AVG] = "AVG",
+  [SENSOR_FILTER_MEDIAN] = "MED",
+  [SENSOR_FILTER_KALMAN] = "KAL",
+};
+
+static void filter_reset_channels(void)
+{
+  memset(channels, 0, sizeof(channels));
+}
+
+void sensor_filter_init(void)
+{
+  filterType = SENSOR_FILTER_NONE;
+  filterWindow = SENSOR_FILTER_DEFAULT_WINDOW;
+  filterDeadband = SENSOR_FILTER_DEFAULT_DEADBAND;
+  filter_reset_channels();
+  havePublished = false;
+  filterStats = (sensor_filter_stats_t){ 0 };
+}
+
+sl_status_t sensor_filter_configure(sensor_filter_type_t type, uint8_t window)
+{
+  if (type >= SENSOR_FILTER_COUNT || window == 0 || window > SENSOR_FILTER_WINDOW_MAX) {
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+  // Mẫu cũ thuộc cấu hình khác: bắt đầu lại, giá trị đã công bố giữ nguyên
+  if (type != filterType || window != filterWindow) {
+      filter_reset_channels();
+  }
+  filterType = type;
+  filterWindow = window;
+  return SL_STATUS_OK;
+}
+
+void sensor_filter_set_deadband(uint16_t deadband)
+{
+  filterDeadband = deadband;
+}
+
+// Chia làm tròn tới số gần nhất, nửa thì ra xa 0 (den > 0)
+static int16_t div_round(int32_t num, int32_t den)
+{
+  return (int16_t)(num >= 0 ? (num + den / 2) / den : -((-num + den / 2) / den));
+}
+
+// Thêm mẫu vào vòng đệm, mẫu cũ nhất bị đẩy ra khi đủ window
+static void history_push(filter_channel_t *ch, int16_t sample)
+{
+  if (ch->count == filterWindow) {
+      uint8_t oldest = (uint8_t)((ch->head + SENSOR_FILTER_WINDOW_MAX - filterWindow)
+                                 % SENSOR_FILTER_WINDOW_MAX);
+      ch->sum -= ch->history[oldest];
+  } else {
+      ch->count++;
+  }
+  ch->history[ch->head] = sample;
+  ch->head = (uint8_t)((ch->head + 1) % SENSOR_FILTER_WINDOW_MAX);
+  ch->sum += sample;
+}
+
+static int16_t filter_median(const filter_channel_t *ch)
+{
+  int16_t sorted[SENSOR_FILTER_WINDOW_MAX];
+  uint8_t n = ch->count;
+
+  // Chèn trực tiếp: tối đa 16 phần tử, mỗi mẫu một lần
+  for (uint8_t i = 0; i < n; i++) {
+      int16_t v = ch->history[(ch->head + SENSOR_FILTER_WINDOW_MAX - n + i) % SENSOR_FILTER_WINDOW_MAX];
+      uint8_t j = i;
+      while (j > 0 && sorted[j - 1] > v) {
+          sorted[j] = sorted[j - 1];
+          j--;
+      }
+      sorted[j] = v;
+  }
+  if (n & 1) {
+      return sorted[n / 2];
+  }
+  return div_round((int32_t)sorted[n / 2 - 1] + sorted[n / 2], 2);
+}
+
+// Kalman 1 chiều, mô hình x(k) = x(k-1) + nhiễu quá trình:
+//   P = P + Q;  K = P / (P + R);  x = x + K (z - x);  P = (1 - K) P
+static int16_t filter_kalman(filter_channel_t *ch, int16_t sample)
+{
+  int32_t z = (int32_t)sample * (1 << KALMAN_FRAC);
+  uint32_t p, k;
+
+  if (ch->count == 0) {
+      ch->count = 1;
+      ch->estimate = z;
+      ch->variance = SENSOR_FILTER_KALMAN_R;
+      return sample;
+  }
+  p = ch->variance + SENSOR_FILTER_KALMAN_Q;
+  k = (uint32_t)(((uint64_t)p << 16) / (p + SENSOR_FILTER_KALMAN_R));
+  ch->estimate += (int32_t)(((int64_t)k * (z - ch->estimate)) / (int64_t)KALMAN_ONE);
+  ch->variance = (uint32_t)(((uint64_t)(KALMAN_ONE - k) * p) >> 16);
+  return div_round(ch->estimate, 1 << KALMAN_FRAC);
+}
+
+static int16_t filter_channel(filter_channel_t *ch, int16_t sample)
+{
+  switch (filterType) {
+    case SENSOR_FILTER_AVG:
+      history_push(ch, sample);
+      return div_round(ch->sum, ch->count);
+    case SENSOR_FILTER_MEDIAN:
+      history_push(ch, sample);
+      return filter_median(ch);
+    case SENSOR_FILTER_KALMAN:
+      return filter_kalman(ch, sample);
+    default:
+      return sample;
+  }
+}
+
+bool sensor_filter_apply(const int16_t *in, int16_t *out)
+{
+  bool changed = !havePublished;
+
+  filterStats.samples++;
+  for (uint8_t i = 0; i < SENSOR_FILTER_CHANNELS; i++) {
+      out[i] = filter_channel(&channels[i], in[i]);
+      if (abs(out[i] - published[i]) > filterDeadband) {
+          changed = true;
+      }
+  }
+
+  if (!changed) {
+      memcpy(out, published, sizeof(published));
+      filterStats.suppressed++;
+      return false;
+  }
+  memcpy(published, out, sizeof(published));
+  havePublished = true;
+  filterStats.published++;
+  return true;
+}
+
+sensor_filter_type_t sensor_filter_get_type(void)
+{
+  return filterType;
+}
+
+uint8_t sensor_filter_get_window(void)
+{
+  return filterWindow;
+}
+
+uint16_t sensor_filter_get_deadband(void)
+{
+  return filterDeadband;
+}
+
+const sensor_filter_stats_t *sensor_filter_get_stats(void)
+{
+  return &filterStats;
+}
+
+const char *sensor_filter_name(sensor_filter_type_t type)
+{
+  return (type < SENSOR_FILTER_COUNT) ? filterNames[type] : "?";
+}
+
+sl_status_t sensor_filter_parse(const char *name, sensor_filter_type_t *type)
+{
+  for (uint8_t i = 0; i < SENSOR_FILTER_COUNT; i++) {
+      if (strcmp(name, filterNames[i]) == 0) {
+          *type = (sensor_filter_type_t) i;
+          return SL_STATUS_OK;
+      }
+  }
+  return SL_STATUS_NOT_FOUND;
+}
@@ -0,0 +1,69 @@
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#include "sl_status.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tầng lọc giữa kết quả đo (centi, xem dht20.h) và nơi dùng (LCD, gói
+// quảng bá BLE). Mỗi kênh (nhiệt độ, độ ẩm) có trạng thái cố định trong RAM
+// tĩnh, không cấp phát động. Chọn bộ lọc và cửa sổ lúc chạy, đổi thì các kênh
+// bắt đầu lại từ mẫu kế tiếp.
+//
+// Sau khi lọc, lần cập nhật bị bỏ qua (suppressed) nếu mọi kênh lệch so với
+// giá trị đã công bố lần trước không quá deadband: LCD và gói quảng bá không
+// phải cập nhật lại cùng một số liệu.
+
+#define SENSOR_FILTER_CHANNELS      2     // values[0] nhiệt độ, values[1] độ ẩm
+#define SENSOR_FILTER_WINDOW_MAX    16    // Cửa sổ lớn nhất của AVG/MEDIAN
+
+// Mặc định lúc khởi động: không lọc, chỉ bỏ qua số liệu trùng hẳn
+#define SENSOR_FILTER_DEFAULT_WINDOW    5
+#define SENSOR_FILTER_DEFAULT_DEADBAND  0
+
+// Kalman 1 chiều (mô hình bước ngẫu nhiên), phương sai theo centi^2: nhiễu
+// quá trình Q (nhiệt độ trôi ~0.02 mỗi mẫu) và nhiễu đo R (DHT20 ~0.2)
+#define SENSOR_FILTER_KALMAN_Q      4
+#define SENSOR_FILTER_KALMAN_R      400
+
+typedef enum {
+  SENSOR_FILTER_NONE,       // Đưa thẳng mẫu đo ra
+  SENSOR_FILTER_AVG,        // Trung bình trượt của window mẫu gần nhất
+  SENSOR_FILTER_MEDIAN,     // Trung vị của window mẫu gần nhất
+  SENSOR_FILTER_KALMAN,     // Kalman 1 chiều số nguyên (bỏ qua window)
+  SENSOR_FILTER_COUNT
+} sensor_filter_type_t;
+
+typedef struct {
+  uint32_t samples;         // Số mẫu đã qua bộ lọc
+  uint32_t published;       // Số lần được chuyển cho LCD/BLE
+  uint32_t suppressed;      // Số lần bị bỏ qua vì không đổi quá deadband
+} sensor_filter_stats_t;
+
+// --- HÀM: VỀ MẶC ĐỊNH VÀ XÓA THỐNG KÊ ---
+void sensor_filter_init(void);
+
+// --- HÀM: CHỌN BỘ LỌC VÀ CỬA SỔ ---
+// SL_STATUS_INVALID_PARAMETER khi type không hợp lệ hoặc window ngoài
+// 1..SENSOR_FILTER_WINDOW_MAX.
+sl_status_t sensor_filter_configure(sensor_filter_type_t type, uint8_t window);
+
+// --- HÀM: ĐẶT NGƯỠNG BỎ QUA (CENTI) ---
+void sensor_filter_set_deadband(uint16_t deadband);
+
+// --- HÀM: LỌC MỘT MẪU ---
+// in[]: mẫu đo, out[]: giá trị đã lọc. Trả về true nếu cần cập nhật LCD/BLE,
+// false nếu lần cập nhật này bị bỏ qua (out[] khi đó là giá trị đã công bố).
+bool sensor_filter_apply(const int16_t *in, int16_t *out);
+
+sensor_filter_type_t sensor_filter_get_type(void);
+uint8_t sensor_filter_get_window(void);
+uint16_t sensor_filter_get_deadband(void);
+const sensor_filter_stats_t *sensor_filter_get_stats(void);
+
+// --- HÀM: TÊN BỘ LỌC ("NONE", "AVG", "MED", "KAL") VÀ NGƯỢC LẠI ---
+const char *sensor_filter_name(sensor_filter_type_t type);
+// SL_STATUS_NOT_FOUND nếu tên không khớp
+sl_status_t sensor_filter_parse(const char *name, sensor_filter_type_t *type);
+
+#endif // SENSOR_FILTER_H
@@ -0,0 +1,335 @@
+#include "sensor_sched.h"
+#include <stddef.h>
+#include <string.h>
+#include "i2c_bus.h"
+#include "sl_sleeptimer.h"
+#include "sl_bt_api.h"
+#include "em_core.h"
+#include "sensor_sched_config.h"
+
+// Trạng thái của một chu kỳ
+typedef enum {
+  SCHED_STATE_IDLE,         // Không đo, có thể bắt đầu chu kỳ mới
+  SCHED_STATE_WAITING,      // Trigger/đọc đang trong hàng đợi I2C hoặc chờ timer
+  SCHED_STATE_READY,        // Đã đọc xong loạt, chờ sensor_sched_process()
+} sched_state_t;
+
+// Mỗi cảm biến đã đăng ký: mô tả transfer, bộ đệm và kết quả riêng
+typedef struct {
+  const sensor_driver_t *driver;
+  i2c_bus_transfer_t transfer;
+  uint8_t tx[SENSOR_SCHED_CMD_MAX];
+  uint8_t rx[SENSOR_SCHED_READ_MAX];
+  int16_t values[SENSOR_SCHED_VALUES_MAX];
+  volatile sl_status_t status;    // SL_STATUS_IN_PROGRESS khi còn phải đọc
+} sched_slot_t;
+
+static sched_slot_t slots[SENSOR_SCHED_MAX];
+static uint8_t slotCount;
+
+static volatile sched_state_t schedState = SCHED_STATE_IDLE;
+static volatile uint8_t pendingTransfers;
+static sl_sleeptimer_timer_handle_t schedTimer;
+static uint16_t waitMs;
+
+// Đo đạc của chu kỳ đang chạy, chép sang lastReport khi xong
+static sensor_sched_report_t report;
+static sensor_sched_report_t lastReport;
+static uint32_t cycleStartTick;
+static uint32_t prevStartTick;
+static uint32_t busTicksAtStart;
+static bool havePrevCycle;
+
+static void sched_read_done(i2c_bus_transfer_t *transfer, I2C_TransferReturn_TypeDef result);
+
+// Cộng thời gian CPU của một đoạn code vào chu kỳ đang chạy. Đoạn chạy ở
+// vòng lặp chính có thể bị ngắt của chính bộ lập lịch chen vào, phần đó bị
+// tính hai lần nhưng chỉ vài chục chu kỳ.
+static void sched_cpu_add(uint32_t start)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  report.cpu_cycles += SENSOR_SCHED_CPU_COUNTER() - start;
+  CORE_EXIT_ATOMIC();
+}
+
+// Đếm xuống một transfer của loạt đang chạy, trả về true nếu là transfer
+// cuối. Gọi từ ngắt I2C, ngắt sleeptimer và vòng lặp chính (nộp lỗi) nên
+// phép đọc-sửa-ghi phải nguyên tử, mất một lần đếm là chu kỳ treo mãi.
+static bool sched_transfer_done(void)
+{
+  bool last;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  last = (--pendingTransfers == 0);
+  CORE_EXIT_ATOMIC();
+  return last;
+}
+
+// Trong ngắt: mọi lệnh đọc đã xong, báo cho vòng lặp chính
+static void sched_burst_done(void)
+{
+  schedState = SCHED_STATE_READY;
+  sl_bt_external_signal(EX_SENSOR_READY);
+}
+
+// Gọi từ ngắt sleeptimer: nộp một loạt lệnh đọc cho các cảm biến chưa xong
+static void sched_timer(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  uint32_t cpu = SENSOR_SCHED_CPU_COUNTER();
+  uint8_t n = 0;
+
+  (void) handle;
+  (void) data;
+
+  for (uint8_t i = 0; i < slotCount; i++) {
+      if (slots[i].status == SL_STATUS_IN_PROGRESS) {
+          n++;
+      }
+  }
+  // Đếm trước khi nộp: callback đầu tiên có thể chạy trước khi nộp xong
+  pendingTransfers = n;
+  for (uint8_t i = 0; i < slotCount; i++) {
+      sched_slot_t *slot = &slots[i];
+      if (slot->status != SL_STATUS_IN_PROGRESS) {
+          continue;
+      }
+      i2c_bus_prepare_read(&slot->transfer, slot->driver->addr, slot->rx,
+                           slot->driver->read_len, sched_read_done, slot);
+      report.transfers++;
+      if (i2c_bus_submit(&slot->transfer) != SL_STATUS_OK) {
+          slot->status = SL_STATUS_FAIL;
+          if (sched_transfer_done()) {
+              sched_burst_done();
+          }
+      }
+  }
+  if (n == 0) {
+      sched_burst_done();
+  }
+  sched_cpu_add(cpu);
+}
+
+static void sched_start_wait(uint16_t ms)
+{
+  if (sl_sleeptimer_start_timer_ms(&schedTimer, ms, sched_timer, NULL, 0, 0) != SL_STATUS_OK) {
+      for (uint8_t i = 0; i < slotCount; i++) {
+          if (slots[i].status == SL_STATUS_IN_PROGRESS) {
+              slots[i].status = SL_STATUS_FAIL;
+          }
+      }
+      sched_burst_done();
+  }
+}
+
+// Gọi từ ngắt I2C khi một lệnh trigger xong. Timer chỉ hẹn sau trigger cuối
+// cùng nên cảm biến nào cũng đã có đủ conversion_ms của mình
+static void sched_trigger_done(i2c_bus_transfer_t *transfer, I2C_TransferReturn_TypeDef result)
+{
+  uint32_t cpu = SENSOR_SCHED_CPU_COUNTER();
+  sched_slot_t *slot = transfer->context;
+
+  if (result != i2cTransferDone) {
+      slot->status = SL_STATUS_TRANSMIT;
+  }
+  if (sched_transfer_done()) {
+      sched_start_wait(waitMs);
+  }
+  sched_cpu_add(cpu);
+}
+
+// Gọi từ ngắt I2C khi một lệnh đọc xong
+static void sched_read_done(i2c_bus_transfer_t *transfer, I2C_TransferReturn_TypeDef result)
+{
+  uint32_t cpu = SENSOR_SCHED_CPU_COUNTER();
+  sched_slot_t *slot = transfer->context;
+
+  if (result != i2cTransferDone) {
+      slot->status = SL_STATUS_RECEIVE;
+  }
+  if (sched_transfer_done()) {
+      sched_burst_done();
+  }
+  sched_cpu_add(cpu);
+}
+
+void sensor_sched_init(void)
+{
+  if (schedState != SCHED_STATE_IDLE) {
+      sl_sleeptimer_stop_timer(&schedTimer);
+  }
+  memset(slots, 0, sizeof(slots));
+  slotCount = 0;
+  schedState = SCHED_STATE_IDLE;
+  havePrevCycle = false;
+  memset(&lastReport, 0, sizeof(lastReport));
+  SENSOR_SCHED_CPU_COUNTER_INIT();
+}
+
+sl_status_t sensor_sched_register(const sensor_driver_t *driver, uint8_t *index)
+{
+  if (schedState != SCHED_STATE_IDLE) {
+      return SL_STATUS_INVALID_STATE;
+  }
+  if (driver == NULL || driver->decode == NULL
+      || driver->trigger_len > SENSOR_SCHED_CMD_MAX
+      || driver->read_len == 0 || driver->read_len > SENSOR_SCHED_READ_MAX) {
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (slotCount >= SENSOR_SCHED_MAX) {
+      return SL_STATUS_NO_MORE_RESOURCE;
+  }
+
+  slots[slotCount].driver = driver;
+  slots[slotCount].status = SL_STATUS_NOT_READY;
+  if (index != NULL) {
+      *index = slotCount;
+  }
+  slotCount++;
+  return SL_STATUS_OK;
+}
+
+// Bước 1: nộp lệnh trigger của mọi cảm biến rồi trả về ngay
+sl_status_t sensor_sched_start(void)
+{
+  uint32_t cpu = SENSOR_SCHED_CPU_COUNTER();
+  uint8_t triggers = 0;
+
+  if (schedState != SCHED_STATE_IDLE) {
+      return SL_STATUS_BUSY;
+  }
+  if (slotCount == 0) {
+      return SL_STATUS_INVALID_STATE;
+  }
+
+  memset(&report, 0, sizeof(report));
+  cycleStartTick = sl_sleeptimer_get_tick_count();
+  report.period_ticks = havePrevCycle ? cycleStartTick - prevStartTick : 0;
+  prevStartTick = cycleStartTick;
+  havePrevCycle = true;
+  busTicksAtStart = i2c_bus_get_stats()->busy_ticks;
+
+  // Chờ một lần bằng thời gian đo dài nhất
+  waitMs = 0;
+  for (uint8_t i = 0; i < slotCount; i++) {
+      slots[i].status = SL_STATUS_IN_PROGRESS;
+      if (slots[i].driver->conversion_ms > waitMs) {
+          waitMs = slots[i].driver->conversion_ms;
+      }
+      if (slots[i].driver->trigger_len > 0) {
+          triggers++;
+      }
+  }
+
+  schedState = SCHED_STATE_WAITING;
+  pendingTransfers = triggers;
+  for (uint8_t i = 0; i < slotCount; i++) {
+      sched_slot_t *slot = &slots[i];
+      if (slot->driver->trigger_len == 0) {
+          continue;
+      }
+      memcpy(slot->tx, slot->driver->trigger_cmd, slot->driver->trigger_len);
+      i2c_bus_prepare_write(&slot->transfer, slot->driver->addr, slot->tx,
+                            slot->driver->trigger_len, sched_trigger_done, slot);
+      report.transfers++;
+      if (i2c_bus_submit(&slot->transfer) != SL_STATUS_OK) {
+          slot->status = SL_STATUS_FAIL;
+          if (sched_transfer_done()) {
+              sched_start_wait(waitMs);
+          }
+      }
+  }
+  // Không cảm biến nào cần trigger: chỉ chờ rồi đọc
+  if (triggers == 0) {
+      sched_start_wait(waitMs);
+  }
+  sched_cpu_add(cpu);
+  return SL_STATUS_OK;
+}
+
+// Bước 3: giải mã, cảm biến nào chưa xong thì hẹn đọc lại riêng nó
+sl_status_t sensor_sched_process(void)
+{
+  uint32_t cpu = SENSOR_SCHED_CPU_COUNTER();
+  bool again = false;
+
+  if (schedState != SCHED_STATE_READY) {
+      return (schedState == SCHED_STATE_WAITING) ? SL_STATUS_IN_PROGRESS
+                                                 : SL_STATUS_INVALID_STATE;
+  }
+
+  for (uint8_t i = 0; i < slotCount; i++) {
+      sched_slot_t *slot = &slots[i];
+      if (slot->status != SL_STATUS_IN_PROGRESS) {
+          continue;
+      }
+      sl_status_t sc = slot->driver->decode(slot->rx, slot->values);
+      if (sc == SL_STATUS_NOT_READY) {
+          if (report.polls < SENSOR_SCHED_MAX_POLLS) {
+              again = true;
+              continue;
+          }
+          sc = SL_STATUS_TIMEOUT;
+      }
+      slot->status = sc;
+  }
+
+  if (again) {
+      report.polls++;
+      schedState = SCHED_STATE_WAITING;
+      sched_start_wait(SENSOR_SCHED_POLL_MS);
+      sched_cpu_add(cpu);
+      return SL_STATUS_IN_PROGRESS;
+  }
+
+  report.latency_ticks = sl_sleeptimer_get_tick_count() - cycleStartTick;
+  report.bus_ticks = i2c_bus_get_stats()->busy_ticks - busTicksAtStart;
+  report.cpu_hz = SENSOR_SCHED_CPU_HZ();
+  sched_cpu_add(cpu);
+  lastReport = report;
+  schedState = SCHED_STATE_IDLE;
+  return SL_STATUS_OK;
+}
+
+bool sensor_sched_is_busy(void)
+{
+  return schedState != SCHED_STATE_IDLE;
+}
+
+sl_status_t sensor_sched_get(uint8_t index, int16_t *values)
+{
+  if (index >= slotCount) {
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (slots[index].status == SL_STATUS_OK && values != NULL) {
+      memcpy(values, slots[index].values, sizeof(slots[index].values));
+  }
+  return slots[index].status;
+}
+
+const sensor_sched_report_t *sensor_sched_get_report(void)
+{
+  return &lastReport;
+}
+
+// Chu kỳ đầu tiên chưa có chu kỳ trước: lấy độ trễ làm mẫu số
+static uint32_t sched_period_ticks(const sensor_sched_report_t *r)
+{
+  uint32_t ticks = r->period_ticks ? r->period_ticks : r->latency_ticks;
+  return ticks ? ticks : 1;
+}
+
+uint32_t sensor_sched_bus_duty_ppm(const sensor_sched_report_t *r)
+{
+  return (uint32_t)(((uint64_t)r->bus_ticks * 1000000u) / sched_period_ticks(r));
+}
+
+uint32_t sensor_sched_cpu_duty_ppm(const sensor_sched_report_t *r)
+{
+  uint64_t period_cycles = ((uint64_t)sched_period_ticks(r) * r->cpu_hz)
+                           / sl_sleeptimer_get_timer_frequency();
+
+  return period_cycles ? (uint32_t)(((uint64_t)r->cpu_cycles * 1000000u) / period_cycles) : 0;
+}
@@ -0,0 +1,86 @@
+#ifndef SENSOR_SCHED_H
+#define SENSOR_SCHED_H
+
+#include "sl_status.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Bộ lập lịch lấy mẫu nhiều cảm biến I2C theo kiểu đường ống: mỗi chu kỳ
+// gửi lệnh trigger của mọi cảm biến đã đăng ký cùng lúc (qua hàng đợi
+// i2c_bus.h), chờ MỘT lần bằng thời gian đo dài nhất, rồi đọc kết quả của
+// tất cả trong một loạt. Thời gian chờ đo của các cảm biến chồng lên nhau
+// thay vì cộng dồn như khi đo lần lượt.
+//
+//   1. sensor_sched_start(): nộp mọi lệnh trigger rồi trả về ngay.
+//   2. Trigger cuối cùng xong, ngắt I2C hẹn timer bằng conversion_ms lớn
+//      nhất; timer nộp mọi lệnh đọc. Đọc xong hết thì gửi EX_SENSOR_READY.
+//   3. Khi nhận EX_SENSOR_READY gọi sensor_sched_process(): giải mã từng
+//      cảm biến. Cảm biến nào chưa đo xong (decode trả về
+//      SL_STATUS_NOT_READY) thì chỉ đọc lại những cảm biến đó sau
+//      SENSOR_SCHED_POLL_MS và trả về SL_STATUS_IN_PROGRESS.
+
+#define SENSOR_SCHED_MAX            4     // Số cảm biến đăng ký tối đa
+#define SENSOR_SCHED_CMD_MAX        4     // Độ dài lệnh trigger tối đa (byte)
+#define SENSOR_SCHED_READ_MAX       8     // Độ dài khung đọc tối đa (byte)
+#define SENSOR_SCHED_VALUES_MAX     2     // Số giá trị mỗi cảm biến
+#define SENSOR_SCHED_POLL_MS        10    // Chu kỳ đọc lại khi chưa đo xong
+#define SENSOR_SCHED_MAX_POLLS      10    // Số lần đọc lại tối đa mỗi chu kỳ
+
+// Bit external signal báo một chu kỳ đã đọc xong (EX_LCD_FRAME là bit 8)
+#define EX_SENSOR_READY             ((1) << 10)
+
+// Mô tả một cảm biến, hằng trong flash do driver cung cấp
+typedef struct {
+  const char *name;
+  uint8_t addr;                               // Địa chỉ I2C 7 bit
+  uint8_t trigger_len;
+  uint8_t trigger_cmd[SENSOR_SCHED_CMD_MAX];  // Lệnh bắt đầu đo
+  uint16_t conversion_ms;                     // Thời gian đo sau trigger
+  uint8_t read_len;                           // Số byte đọc kết quả
+  // Giải mã khung đọc được vào values[] (số nguyên đơn vị 0.01), gọi ở
+  // vòng lặp chính. Trả về SL_STATUS_NOT_READY nếu cảm biến báo chưa đo xong.
+  sl_status_t (*decode)(const uint8_t *rx, int16_t *values);
+} sensor_driver_t;
+
+// Đo đạc của chu kỳ vừa xong (tick sleeptimer, chu kỳ CPU)
+typedef struct {
+  uint32_t period_ticks;    // Từ lần bắt đầu chu kỳ trước tới chu kỳ này
+  uint32_t latency_ticks;   // Từ sensor_sched_start() tới khi có kết quả
+  uint32_t bus_ticks;       // Bus I2C bận trong chu kỳ (mọi transfer trên bus)
+  uint32_t cpu_cycles;      // CPU chạy code của bộ lập lịch và decode
+  uint32_t cpu_hz;          // Tần số của cpu_cycles
+  uint8_t transfers;        // Số transfer bộ lập lịch đã nộp
+  uint8_t polls;            // Số lần phải đọc lại
+} sensor_sched_report_t;
+
+// --- HÀM: XÓA DANH SÁCH CẢM BIẾN (GỌI SAU i2c_bus_init) ---
+void sensor_sched_init(void);
+
+// --- HÀM: ĐĂNG KÝ CẢM BIẾN, TRẢ VỀ CHỈ SỐ DÙNG CHO sensor_sched_get() ---
+// SL_STATUS_NO_MORE_RESOURCE khi đã đủ SENSOR_SCHED_MAX, SL_STATUS_INVALID_STATE
+// khi đang đo, SL_STATUS_INVALID_PARAMETER khi mô tả vượt giới hạn.
+sl_status_t sensor_sched_register(const sensor_driver_t *driver, uint8_t *index);
+
+// --- HÀM: BẮT ĐẦU MỘT CHU KỲ (SL_STATUS_BUSY NẾU CHU KỲ TRƯỚC CHƯA XONG) ---
+sl_status_t sensor_sched_start(void);
+
+// --- HÀM: XỬ LÝ EX_SENSOR_READY ---
+// SL_STATUS_OK khi chu kỳ xong (kết quả từng cảm biến qua sensor_sched_get()),
+// SL_STATUS_IN_PROGRESS khi còn chờ, SL_STATUS_INVALID_STATE khi không đo.
+sl_status_t sensor_sched_process(void);
+
+bool sensor_sched_is_busy(void);
+
+// --- HÀM: KẾT QUẢ CHU KỲ VỪA XONG CỦA MỘT CẢM BIẾN ---
+// Trả về trạng thái của cảm biến: SL_STATUS_OK, SL_STATUS_TRANSMIT (trigger
+// bị NACK), SL_STATUS_RECEIVE (đọc bị NACK), SL_STATUS_TIMEOUT (chưa xong
+// sau SENSOR_SCHED_MAX_POLLS lần đọc lại) hoặc lỗi của decode.
+sl_status_t sensor_sched_get(uint8_t index, int16_t *values);
+
+const sensor_sched_report_t *sensor_sched_get_report(void);
+
+// --- HÀM: TỶ LỆ BẬN (PHẦN TRIỆU) CỦA BUS VÀ CPU TRONG CHU KỲ LẤY MẪU ---
+uint32_t sensor_sched_bus_duty_ppm(const sensor_sched_report_t *report);
+uint32_t sensor_sched_cpu_duty_ppm(const sensor_sched_report_t *report);
+
+#endif // SENSOR_SCHED_H